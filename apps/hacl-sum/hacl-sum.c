@@ -0,0 +1,210 @@
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Hacl_SHA2_Streaming.h"
+
+// Bytes handed to update at once; the mapping is released behind it
+#define STRIDE (64 * 1024 * 1024)
+#define READ_BUFFER_SIZE (1024 * 1024)
+
+typedef struct {
+  int bits;
+  union {
+    Hacl_SHA2_Streaming_sha256 sha256;
+    Hacl_SHA2_Streaming_sha512 sha512;
+  } ctx;
+} sum_ctx;
+
+static uint64_t total_bytes = 0;
+
+void print_usage() {
+  printf("Usage: hacl-sum [-a 256|384|512] [-c] [-t] [file...]\n"
+         "Print or check SHA-2 checksums. With no file, or when file is -, read standard input.\n"
+         "Options:\n"
+         "-a <bits>  SHA-2 variant: 256 (default), 384 or 512\n"
+         "-c         read checksums from the files and check them\n"
+         "-t         report the hashing throughput on standard error\n");
+}
+
+static uint32_t hash_len(int bits) {
+  return (uint32_t)bits / 8;
+}
+
+static void sum_init(sum_ctx *s, int bits) {
+  s->bits = bits;
+  if (bits == 256) Hacl_SHA2_Streaming_sha256_init(&s->ctx.sha256);
+  else if (bits == 384) Hacl_SHA2_Streaming_sha384_init(&s->ctx.sha512);
+  else Hacl_SHA2_Streaming_sha512_init(&s->ctx.sha512);
+}
+
+static void sum_update(sum_ctx *s, uint8_t *data, uint64_t len) {
+  if (s->bits == 256) Hacl_SHA2_Streaming_sha256_update(&s->ctx.sha256, data, len);
+  else if (s->bits == 384) Hacl_SHA2_Streaming_sha384_update(&s->ctx.sha512, data, len);
+  else Hacl_SHA2_Streaming_sha512_update(&s->ctx.sha512, data, len);
+  total_bytes += len;
+}
+
+static void sum_finish(sum_ctx *s, uint8_t *hash) {
+  if (s->bits == 256) Hacl_SHA2_Streaming_sha256_finish(&s->ctx.sha256, hash);
+  else if (s->bits == 384) Hacl_SHA2_Streaming_sha384_finish(&s->ctx.sha512, hash);
+  else Hacl_SHA2_Streaming_sha512_finish(&s->ctx.sha512, hash);
+}
+
+static bool sum_fd_read(sum_ctx *s, int fd) {
+  uint8_t *buf = malloc(READ_BUFFER_SIZE);
+  if (buf == NULL) return false;
+  while (true) {
+    ssize_t n = read(fd, buf, READ_BUFFER_SIZE);
+    if (n == 0) break;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      free(buf);
+      return false;
+    }
+    sum_update(s, buf, (uint64_t)n);
+  }
+  free(buf);
+  return true;
+}
+
+// Regular files are mapped and hashed in place, in large strides
+static bool sum_fd_mmap(sum_ctx *s, int fd, uint64_t size) {
+  uint8_t *p = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (p == MAP_FAILED) return false;
+  madvise(p, size, MADV_SEQUENTIAL);
+  for (uint64_t off = 0; off < size; off += STRIDE) {
+    uint64_t n = size - off < STRIDE ? size - off : STRIDE;
+    sum_update(s, p + off, n);
+    madvise(p + off, n, MADV_DONTNEED);
+  }
+  munmap(p, size);
+  return true;
+}
+
+static bool sum_file(int bits, const char *name, uint8_t *hash) {
+  sum_ctx s;
+  struct stat sb;
+  bool ok;
+  int fd = strcmp(name, "-") ? open(name, O_RDONLY) : 0;
+  if (fd == -1) return false;
+  sum_init(&s, bits);
+  if (fd != 0 && fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0)
+    ok = sum_fd_mmap(&s, fd, (uint64_t)sb.st_size) || sum_fd_read(&s, fd);
+  else
+    ok = sum_fd_read(&s, fd);
+  if (fd != 0) close(fd);
+  if (ok) sum_finish(&s, hash);
+  return ok;
+}
+
+static void print_hex(uint8_t *str, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++)
+    printf("%02x", (unsigned int)str[i]);
+}
+
+static bool parse_hex(const char *a, uint8_t *str, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    unsigned int x;
+    if (sscanf(a + 2 * i, "%2x", &x) != 1) return false;
+    str[i] = (uint8_t)x;
+  }
+  return true;
+}
+
+// Checks every "<hex>  <file>" line of list; returns the number of failures
+static int check_list(int bits, const char *list) {
+  uint32_t hlen = hash_len(bits);
+  uint8_t expected[64], hash[64];
+  char line[4096];
+  int failures = 0;
+  FILE *f = strcmp(list, "-") ? fopen(list, "r") : stdin;
+  if (f == NULL) {
+    fprintf(stderr, "hacl-sum: %s: %s\n", list, strerror(errno));
+    return 1;
+  }
+  while (fgets(line, sizeof line, f)) {
+    size_t n = strlen(line);
+    while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r')) line[--n] = 0;
+    if (n < 2 * hlen + 2 || line[2 * hlen] != ' ' || !parse_hex(line, expected, hlen)) {
+      if (n > 0) fprintf(stderr, "hacl-sum: %s: improperly formatted line\n", list);
+      continue;
+    }
+    // "<hex>  <file>" (text) or "<hex> *<file>" (binary)
+    const char *name = line + 2 * hlen + 2;
+    if (!sum_file(bits, name, hash)) {
+      printf("%s: FAILED open or read\n", name);
+      failures++;
+    } else if (memcmp(hash, expected, hlen)) {
+      printf("%s: FAILED\n", name);
+      failures++;
+    } else
+      printf("%s: OK\n", name);
+  }
+  if (f != stdin) fclose(f);
+  if (failures > 0)
+    fprintf(stderr, "hacl-sum: WARNING: %d computed checksum%s did NOT match\n", failures, failures > 1 ? "s" : "");
+  return failures;
+}
+
+static double wall_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+  int bits = 256, c;
+  bool check = false, timing = false;
+  int failures = 0;
+  while ((c = getopt(argc, argv, "a:cth")) != -1) {
+    switch (c) {
+    case 'a':
+      bits = atoi(optarg);
+      if (bits != 256 && bits != 384 && bits != 512) {
+        print_usage();
+        return 1;
+      }
+      break;
+    case 'c': check = true; break;
+    case 't': timing = true; break;
+    default:
+      print_usage();
+      return c == 'h' ? 0 : 1;
+    }
+  }
+
+  char *stdin_name[] = { "-" };
+  char **files = optind < argc ? argv + optind : stdin_name;
+  int nfiles = optind < argc ? argc - optind : 1;
+  double t1 = wall_time();
+  for (int i = 0; i < nfiles; i++) {
+    uint8_t hash[64];
+    if (check)
+      failures += check_list(bits, files[i]);
+    else if (!sum_file(bits, files[i], hash)) {
+      fprintf(stderr, "hacl-sum: %s: %s\n", files[i], strerror(errno));
+      failures++;
+    } else {
+      print_hex(hash, hash_len(bits));
+      printf("  %s\n", files[i]);
+    }
+  }
+  double t2 = wall_time();
+
+  if (timing)
+    fprintf(stderr, "hacl-sum: SHA-%d, %" PRIu64 " bytes in %.3f s (%.2f GB/s)\n",
+            bits, total_bytes, t2 - t1, t2 > t1 ? (double)total_bytes / (t2 - t1) / 1e9 : 0.0);
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+#include <string.h>
+
+#include "quic_key_schedule.h"
+#include "Hacl_Util.h"
+
+static const uint8_t quic_ks_empty_sha256[32] = {
+  0xe3,0xb0,0xc4,0x42,0x98,0xfc,0x1c,0x14,0x9a,0xfb,0xf4,0xc8,0x99,0x6f,0xb9,0x24,
+  0x27,0xae,0x41,0xe4,0x64,0x9b,0x93,0x4c,0xa4,0x95,0x99,0x1b,0x78,0x52,0xb8,0x55
+};
+
+static const uint8_t quic_ks_empty_sha384[48] = {
+  0x38,0xb0,0x60,0xa7,0x51,0xac,0x96,0x38,0x4c,0xd9,0x32,0x7e,0xb1,0xb1,0xe3,0x6a,
+  0x21,0xfd,0xb7,0x11,0x14,0xbe,0x07,0x43,0x4c,0x0c,0xc7,0xbf,0x63,0xf6,0xe1,0xda,
+  0x27,0x4e,0xde,0xbf,0xe7,0x6f,0x65,0xfb,0xd5,0x1a,0xd2,0xf1,0x48,0x98,0xb9,0x5b
+};
+
+static const uint8_t quic_ks_empty_sha512[64] = {
+  0xcf,0x83,0xe1,0x35,0x7e,0xef,0xb8,0xbd,0xf1,0x54,0x28,0x50,0xd6,0x6d,0x80,0x07,
+  0xd6,0x20,0xe4,0x05,0x0b,0x57,0x15,0xdc,0x83,0xf4,0xa9,0x21,0xd3,0x6c,0xe9,0xce,
+  0x47,0xd0,0xd1,0x3c,0x5d,0x85,0xf2,0xb0,0xff,0x83,0x18,0xd2,0x87,0x7e,0xec,0x2f,
+  0x63,0xb9,0x31,0xbd,0x47,0x41,0x7a,0x81,0xa5,0x38,0x32,0x7a,0xf9,0x27,0xda,0x3e
+};
+
+#define QUIC_KS_LABEL(l) { "tls13 " l, sizeof("tls13 " l) - 1 }
+
+const quic_ks_label quic_ks_labels[QUIC_KS_NUM_LABELS] = {
+  [QUIC_KS_KEY] = QUIC_KS_LABEL("key"),
+  [QUIC_KS_IV] = QUIC_KS_LABEL("iv"),
+  [QUIC_KS_EXPORTER] = QUIC_KS_LABEL("exporter"),
+  [QUIC_KS_CLIENT_CLEARTEXT] = QUIC_KS_LABEL("QUIC client cleartext Secret"),
+  [QUIC_KS_SERVER_CLEARTEXT] = QUIC_KS_LABEL("QUIC server cleartext Secret"),
+  [QUIC_KS_EARLY_SECRET] = QUIC_KS_LABEL("EXPORTER-QUIC 0-RTT Secret"),
+  [QUIC_KS_CLIENT_1RTT] = QUIC_KS_LABEL("EXPORTER-QUIC client 1-RTT Secret"),
+  [QUIC_KS_SERVER_1RTT] = QUIC_KS_LABEL("EXPORTER-QUIC server 1-RTT Secret"),
+};
+
+uint32_t quic_ks_hash_len(quic_hash a)
+{
+  return (a == TLS_hash_SHA256 ? 32 :
+    (a == TLS_hash_SHA384 ? 48 : 64));
+}
+
+const uint8_t *quic_ks_empty_hash(quic_hash a)
+{
+  return (a == TLS_hash_SHA256 ? quic_ks_empty_sha256 :
+    (a == TLS_hash_SHA384 ? quic_ks_empty_sha384 : quic_ks_empty_sha512));
+}
+
+const quic_ks_label *quic_ks_find_label(const char *label)
+{
+  for(int i = 0; i < QUIC_KS_NUM_LABELS; i++)
+    if(!strcmp(quic_ks_labels[i].tls13_label + 6, label))
+      return &quic_ks_labels[i];
+  return NULL;
+}
+
+void quic_ks_key_init(quic_hmac_key *k, quic_hash a, const char *key, uint32_t key_len)
+{
+  k->hash = a;
+  if(a == TLS_hash_SHA256)
+    Hacl_HMAC_SHA2_sha256_init_key(&k->k.k256, (uint8_t*)key, key_len);
+  else if(a == TLS_hash_SHA384)
+    Hacl_HMAC_SHA2_sha384_init_key(&k->k.k512, (uint8_t*)key, key_len);
+  else
+    Hacl_HMAC_SHA2_sha512_init_key(&k->k.k512, (uint8_t*)key, key_len);
+}
+
+void quic_ks_key_wipe(quic_hmac_key *k)
+{
+  Hacl_Util_wipe(k, sizeof(quic_hmac_key));
+}
+
+int quic_ks_expand(quic_hmac_key *prk, char *okm, uint32_t okm_len, const char *info, uint32_t info_len)
+{
+  uint32_t hlen = quic_ks_hash_len(prk->hash);
+  if(okm_len > 255 * hlen || info_len > QUIC_KS_MAX_INFO) return 0;
+
+  // T(i) = HMAC(prk, T(i-1) || info || i)
+  char buf[64 + QUIC_KS_MAX_INFO + 1];
+  char t[64];
+  uint32_t tlen = 0;
+  for(uint32_t i = 1, done = 0; done < okm_len; i++)
+  {
+    memcpy(buf, t, tlen);
+    memcpy(buf + tlen, info, info_len);
+    buf[tlen + info_len] = (char)i;
+    quic_crypto_hmac_keyed(prk, t, buf, tlen + info_len + 1);
+    tlen = hlen;
+    uint32_t n = okm_len - done < hlen ? okm_len - done : hlen;
+    memcpy(okm + done, t, n);
+    done += n;
+  }
+
+  Hacl_Util_wipe(t, sizeof(t));
+  Hacl_Util_wipe(buf, sizeof(buf));
+  return 1;
+}
+
+int quic_ks_expand_label(quic_hmac_key *prk, char *out, const quic_ks_label *l, uint16_t key_len)
+{
+  uint32_t hlen = quic_ks_hash_len(prk->hash);
+  char info[QUIC_KS_MAX_INFO];
+  uint32_t info_len = 3 + l->len;
+  if(info_len + 1 + hlen > QUIC_KS_MAX_INFO) return 0;
+
+  info[0] = key_len ? (key_len >> 8) : 0;
+  info[1] = key_len ? (key_len & 255) : (char)hlen;
+  info[2] = (char)l->len;
+  memcpy(info + 3, l->tls13_label, l->len);
+
+  if(key_len)
+    info[info_len++] = 0;
+  else
+  {
+    info[info_len++] = (char)hlen;
+    memcpy(info + info_len, quic_ks_empty_hash(prk->hash), hlen);
+    info_len += hlen;
+  }
+
+  return quic_ks_expand(prk, out, key_len ? key_len : hlen, info, info_len);
+}
@@ -0,0 +1,71 @@
+#ifndef __QUIC_KEY_SCHEDULE
+#define __QUIC_KEY_SCHEDULE
+
+#include <stdint.h>
+
+#include "Hacl_HMAC_SHA2.h"
+#include "mitlsffi.h"
+#include "quic_provider.h"
+
+// Internal key schedule of the QUIC provider.
+//
+// HkdfLabel encodings of the fixed labels used during connection
+// setup are built at compile time, and the Hash("") contexts are
+// constants, so deriving a secret hashes nothing but the HMAC inputs.
+// Every HKDF-Expand runs on a keyed PRK (quic_hmac_key), expanded
+// once per secret and shared by all the labels derived from it.
+
+struct quic_hmac_key {
+  quic_hash hash;
+  union {
+    Hacl_HMAC_SHA2_key256 k256;
+    Hacl_HMAC_SHA2_key512 k512;
+  } k;
+};
+
+// "tls13 " || label, as it appears in an HkdfLabel
+typedef struct quic_ks_label {
+  const char *tls13_label;
+  uint8_t len;
+} quic_ks_label;
+
+// Indices of the precomputed labels in quic_ks_labels
+typedef enum {
+  QUIC_KS_KEY = 0,
+  QUIC_KS_IV,
+  QUIC_KS_EXPORTER,
+  QUIC_KS_CLIENT_CLEARTEXT,
+  QUIC_KS_SERVER_CLEARTEXT,
+  QUIC_KS_EARLY_SECRET,
+  QUIC_KS_CLIENT_1RTT,
+  QUIC_KS_SERVER_1RTT,
+  QUIC_KS_NUM_LABELS
+} quic_ks_label_id;
+
+extern const quic_ks_label quic_ks_labels[QUIC_KS_NUM_LABELS];
+
+// Largest HKDF info we build (same bound as quic_crypto_tls_label)
+#define QUIC_KS_MAX_INFO 323
+
+uint32_t quic_ks_hash_len(quic_hash a);
+
+// Hash("") for a, as a constant
+const uint8_t *quic_ks_empty_hash(quic_hash a);
+
+// Returns the precomputed encoding of label, or NULL
+const quic_ks_label *quic_ks_find_label(const char *label);
+
+// Keys k in place, without allocating
+void quic_ks_key_init(quic_hmac_key *k, quic_hash a, const char *key, uint32_t key_len);
+
+// Zeroes a keyed PRK
+void quic_ks_key_wipe(quic_hmac_key *k);
+
+// HKDF-Expand(prk, info, okm_len)
+int quic_ks_expand(quic_hmac_key *prk, char *okm, uint32_t okm_len, const char *info, uint32_t info_len);
+
+// HKDF-Expand-Label(prk, label, "", key_len), where key_len = 0 means
+// Hash("") as context and hlen bytes of output (see quic_crypto_tls_label)
+int quic_ks_expand_label(quic_hmac_key *prk, char *out, const quic_ks_label *l, uint16_t key_len);
+
+#endif /* end of include guard:  */
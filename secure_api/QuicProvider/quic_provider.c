@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <string.h>
 #include <assert.h>
 #include <time.h>
@@ -13,8 +14,12 @@
 #include "tmp/Crypto_AEAD.h"
 #include "tmp/Crypto_HMAC.h"
 #include "tmp/Crypto_HKDF.h"
+#include "Hacl_Chacha20Poly1305_Keyed.h"
+#include "Hacl_Chacha20Poly1305_IOVec.h"
 #include "mitlsffi.h"
 #include "quic_provider.h"
+#include "quic_key_schedule.h"
+#include "Hacl_Util.h"
 
 #define DEBUG 0
 
@@ -22,6 +27,10 @@ typedef struct quic_key {
   Crypto_AEAD_Invariant_aead_state_______ st;
   Crypto_Indexing_id id;
   char static_iv[12];
+  // ChaCha20-Poly1305 keys are run by HACL* directly, on this expanded
+  // key instead of st
+  int chacha20;
+  Hacl_Chacha20Poly1305_Keyed_key chacha20_key;
 } quic_key;
 
 #if DEBUG
@@ -69,6 +78,40 @@ int quic_crypto_hmac(quic_hash a, char *mac,
   return 1;
 }
 
+int quic_crypto_hmac_key(quic_hash a, quic_hmac_key **k,
+                         const char *key, uint32_t key_len)
+{
+  if(a < TLS_hash_SHA256) return 0;
+  quic_hmac_key *hk = malloc(sizeof(quic_hmac_key));
+  if(!(*k = hk)) return 0;
+
+  quic_ks_key_init(hk, a, key, key_len);
+  return 1;
+}
+
+int quic_crypto_hmac_keyed(quic_hmac_key *k, char *mac,
+                           const char *data, uint32_t data_len)
+{
+  if(k->hash == TLS_hash_SHA256)
+    Hacl_HMAC_SHA2_sha256_mac((uint8_t*)mac, &k->k.k256, (uint8_t*)data, data_len);
+  else if(k->hash == TLS_hash_SHA384)
+    Hacl_HMAC_SHA2_sha384_mac((uint8_t*)mac, &k->k.k512, (uint8_t*)data, data_len);
+  else
+    Hacl_HMAC_SHA2_sha512_mac((uint8_t*)mac, &k->k.k512, (uint8_t*)data, data_len);
+  return 1;
+}
+
+int quic_crypto_free_hmac_key(quic_hmac_key *k)
+{
+  // The expanded states are key material
+  if(k)
+  {
+    quic_ks_key_wipe(k);
+    free(k);
+  }
+  return 1;
+}
+
 int quic_crypto_hkdf_extract(quic_hash a, char *prk,
                              const char *salt, uint32_t salt_len,
                              const char *ikm, uint32_t ikm_len)
@@ -109,107 +152,140 @@ int quic_crypto_tls_label(quic_hash a, char *info, size_t *info_len, const char
   }
 
   // Empty hash
-  char hash[hlen];
-  if(!quic_crypto_hash(a, hash, label, 0)) return 0;
-
   info[9+label_len] = (char)hlen;
-  memcpy(info + label_len + 10, hash, hlen);
+  memcpy(info + label_len + 10, quic_ks_empty_hash(a), hlen);
   *info_len = label_len + 10 + hlen;
   return 1;
 }
 
+// Derive-Secret of the draft QUIC key schedule:
+//   tmp = HKDF-Expand-Label(secret, label, Hash(""), hlen)
+//   derived = HKDF-Expand-Label(tmp, "exporter", Hash(""), hlen)
+// The caller keys the PRK, so that it can be shared across labels
+static int quic_ks_derive_secret(char *derived, quic_hmac_key *prk, const quic_ks_label *l)
+{
+  uint32_t hlen = quic_ks_hash_len(prk->hash);
+  char tmp[64];
+  quic_hmac_key k;
+  int r = quic_ks_expand_label(prk, tmp, l, 0);
+
+#if DEBUG
+  printf("Intermediate:\n");
+  dump(tmp, hlen);
+#endif
+
+  if(r)
+  {
+    quic_ks_key_init(&k, prk->hash, tmp, hlen);
+    r = quic_ks_expand_label(&k, derived, &quic_ks_labels[QUIC_KS_EXPORTER], 0);
+    quic_ks_key_wipe(&k);
+  }
+  Hacl_Util_wipe(tmp, sizeof(tmp));
+  return r;
+}
+
 int quic_crypto_tls_derive_secret(quic_secret *derived, const quic_secret *secret, const char *label)
 {
-  uint32_t hlen = (secret->hash == TLS_hash_SHA256 ? 32 :
-    (secret->hash == TLS_hash_SHA384 ? 48 : 64));
-  char tmp[hlen];
-  char info[323] = {0};
-  size_t info_len;
+  uint32_t hlen = quic_ks_hash_len(secret->hash);
+  quic_ks_label custom;
+  char tls13_label[255];
+  quic_hmac_key prk;
 
-  if(!quic_crypto_tls_label(secret->hash, info, &info_len, label, 0))
-    return 0;
+  if(secret->hash < TLS_hash_SHA256) return 0;
 
-  derived->hash = secret->hash;
-  derived->ae = secret->ae;
+  const quic_ks_label *l = quic_ks_find_label(label);
+  if(!l)
+  {
+    size_t label_len = strlen(label);
+    if(label_len > 249) return 0;
+    memcpy(tls13_label, "tls13 ", 6);
+    memcpy(tls13_label + 6, label, label_len);
+    custom.tls13_label = tls13_label;
+    custom.len = (uint8_t)(label_len + 6);
+    l = &custom;
+  }
 
 #if DEBUG
   printf("Secret to expand <%s>:\n", label);
   dump_secret(secret);
 #endif
 
-  if(!quic_crypto_hkdf_expand(secret->hash, tmp, hlen,
-        secret->secret, hlen, info, info_len))
-    return 0;
-
-#if DEBUG
-  printf("Intermediate:\n");
-  dump(tmp, hlen);
-#endif
-
-  if(!quic_crypto_tls_label(secret->hash, info, &info_len, "exporter", 0))
-    return 0;
-
-  if(!quic_crypto_hkdf_expand(secret->hash, derived->secret, hlen,
-        tmp, hlen, info, info_len))
-    return 0;
+  quic_ks_key_init(&prk, secret->hash, secret->secret, hlen);
+  derived->hash = secret->hash;
+  derived->ae = secret->ae;
+  int r = quic_ks_derive_secret(derived->secret, &prk, l);
+  quic_ks_key_wipe(&prk);
 
 #if DEBUG
   printf("Derived:\n");
   dump_secret(derived);
 #endif
 
-  return 1;
+  return r;
 }
 
-int quic_derive_plaintext_secrets(quic_secret *client_cleartext, quic_secret *server_cleartext, const char *con_id, const char *salt)
+int quic_crypto_derive_plaintext_secrets(quic_secret *client_cleartext, quic_secret *server_cleartext, const char *con_id, const char *salt)
 {
   quic_secret s0;
+  quic_hmac_key prk;
   s0.hash = TLS_hash_SHA256;
   s0.ae = TLS_aead_AES_128_GCM;
 
-  if(!quic_crypto_hkdf_extract(s0.hash, s0.secret, salt, 20, con_id, 8))
-    return 0;
+  // HKDF-Extract(salt, con_id)
+  quic_ks_key_init(&prk, s0.hash, salt, 20);
+  quic_crypto_hmac_keyed(&prk, s0.secret, con_id, 8);
 
-  quic_crypto_tls_derive_secret(client_cleartext, &s0, "QUIC client cleartext Secret");
-  quic_crypto_tls_derive_secret(server_cleartext, &s0, "QUIC server cleartext Secret");
+  // Both secrets are expanded from the same keyed PRK
+  quic_ks_key_init(&prk, s0.hash, s0.secret, 32);
+  client_cleartext->hash = server_cleartext->hash = s0.hash;
+  client_cleartext->ae = server_cleartext->ae = s0.ae;
+  int r = quic_ks_derive_secret(client_cleartext->secret, &prk, &quic_ks_labels[QUIC_KS_CLIENT_CLEARTEXT])
+    && quic_ks_derive_secret(server_cleartext->secret, &prk, &quic_ks_labels[QUIC_KS_SERVER_CLEARTEXT]);
 
-  return 1;
+  quic_ks_key_wipe(&prk);
+  Hacl_Util_wipe(s0.secret, sizeof(s0.secret));
+  return r;
 }
 
 int quic_crypto_derive_key(/*out*/quic_key **k, const quic_secret *secret)
 {
+  if(secret->hash < TLS_hash_SHA256) return 0;
   quic_key *key = malloc(sizeof(quic_key));
   if(!(*k = key)) return 0;
 
   key->id = Crypto_Indexing_testId(secret->ae);
 
   uint32_t klen = (secret->ae == TLS_aead_AES_128_GCM ? 16 : 32);
-  uint32_t slen = (secret->hash == TLS_hash_SHA256 ? 32 :
-    (secret->hash == TLS_hash_SHA384 ? 48 : 64));
+  uint32_t slen = quic_ks_hash_len(secret->hash);
 
-  char info[323] = {0};
   char dkey[32];
-  size_t info_len;
-
-  if(!quic_crypto_tls_label(secret->hash, info, &info_len, "key", klen))
-    return 0;
+  quic_hmac_key prk;
+  quic_ks_key_init(&prk, secret->hash, secret->secret, slen);
 
   // HKDF-Expand-Label(Secret, "key", "", key_length)
-  if(!quic_crypto_hkdf_expand(secret->hash, dkey, klen, secret->secret, slen, info, info_len))
-    return 0;
-
-  if(!quic_crypto_tls_label(secret->hash, info, &info_len, "iv", 12))
-    return 0;
-
-  if(!quic_crypto_hkdf_expand(secret->hash, key->static_iv, 12, secret->secret, slen, info, info_len))
+  // HKDF-Expand-Label(Secret, "iv", "", 12)
+  int r = quic_ks_expand_label(&prk, dkey, &quic_ks_labels[QUIC_KS_KEY], klen)
+    && quic_ks_expand_label(&prk, key->static_iv, &quic_ks_labels[QUIC_KS_IV], 12);
+  quic_ks_key_wipe(&prk);
+  if(!r)
+  {
+    Hacl_Util_wipe(dkey, sizeof(dkey));
+    free(key);
+    *k = NULL;
     return 0;
+  }
 
-#if DEBIG
+#if DEBUG
    printf("KEY: "); dump(dkey, klen);
    printf("IV: "); dump(key->static_iv, 12);
 #endif
 
-  key->st = Crypto_AEAD_coerce(key->id, (uint8_t*)dkey);
+  key->chacha20 = secret->ae == TLS_aead_CHACHA20_POLY1305;
+  if(key->chacha20)
+    Hacl_Chacha20Poly1305_Keyed_init_key(&key->chacha20_key, (uint8_t*)dkey);
+  else
+    key->st = Crypto_AEAD_coerce(key->id, (uint8_t*)dkey);
+  Hacl_Util_wipe(dkey, sizeof(dkey));
   return 1;
 }
 
@@ -219,20 +295,64 @@ void sn_to_iv(char *iv, uint64_t sn)
     iv[i] ^= (sn >> (88-(i<<3))) & 255;
 }
 
+// Non-zero when [a, a + alen) and [b, b + blen) share a byte but do not
+// start at the same address
+static int quic_partial_overlap(const char *a, size_t alen, const char *b, size_t blen)
+{
+  uintptr_t x = (uintptr_t)a, y = (uintptr_t)b;
+  return x != y && x < y + blen && y < x + alen;
+}
+
+// Crypto.AEAD (AES-GCM) is only specified for disjoint buffers: in-place
+// calls stage the input here, on the stack for packet-sized inputs
+#define QUIC_STAGE_LEN 2048
+
+static char *quic_stage(char *stack, const char *in, uint32_t len)
+{
+  char *b = len <= QUIC_STAGE_LEN ? stack : malloc(len);
+  if(b && in) memcpy(b, in, len);
+  return b;
+}
+
+static void quic_unstage(char *stack, char *b, uint32_t len)
+{
+  Hacl_Util_wipe(b, len);
+  if(b != stack) free(b);
+}
+
 int quic_crypto_encrypt(quic_key *key, char *cipher, uint64_t sn, const char *ad, uint32_t ad_len, const char *plain, uint32_t plain_len)
 {
   char iv[12];
   memcpy(iv, key->static_iv, 12);
   sn_to_iv(iv, sn);
 
-  FStar_UInt128_t n = Crypto_Symmetric_Bytes_load_uint128(12, iv);
-  Crypto_AEAD_Encrypt_encrypt(key->id, key->st, n, ad_len, (uint8_t*)ad, plain_len, (uint8_t*)plain, cipher);
+  if(plain_len > UINT32_MAX - 16
+     || quic_partial_overlap(cipher, (size_t)plain_len + 16, plain, plain_len))
+    return 0;
+
+  if(key->chacha20)
+  {
+    // cipher may be plain (see Hacl_Chacha20Poly1305_Keyed.h); the tag
+    // never overlaps either
+    Hacl_Chacha20Poly1305_Keyed_aead_encrypt(&key->chacha20_key, (uint8_t*)cipher,
+      (uint8_t*)cipher + plain_len, (uint8_t*)plain, plain_len, (uint8_t*)ad, ad_len, (uint8_t*)iv);
+  }
+  else
+  {
+    char stack[QUIC_STAGE_LEN];
+    char *p = (char*)plain;
+    if(cipher == plain && !(p = quic_stage(stack, plain, plain_len)))
+      return 0;
+    FStar_UInt128_t n = Crypto_Symmetric_Bytes_load_uint128(12, iv);
+    Crypto_AEAD_Encrypt_encrypt(key->id, key->st, n, ad_len, (uint8_t*)ad, plain_len, (uint8_t*)p, cipher);
+    if(p != plain)
+      quic_unstage(stack, p, plain_len);
+  }
 
 #if DEBUG
   printf("ENCRYPT\nIV="); dump(iv, 12);
   printf("STATIC="); dump(key->static_iv, 12);
   printf("AD="); dump(ad, ad_len);
-  printf("PLAIN="); dump(plain, plain_len);
   printf("CIPHER="); dump(cipher, plain_len + 16);
 #endif
 
@@ -248,26 +368,158 @@ int quic_crypto_decrypt(quic_key *key, char *plain, uint64_t sn, const char *ad,
   if(cipher_len < Crypto_Symmetric_MAC_taglen)
     return 0;
 
-  FStar_UInt128_t n = Crypto_Symmetric_Bytes_load_uint128(12, iv);
   uint32_t plain_len = cipher_len - Crypto_Symmetric_MAC_taglen;
-  int r = Crypto_AEAD_Decrypt_decrypt(key->id, key->st, n, ad_len, (uint8_t*)ad, plain_len, plain, (uint8_t*)cipher);
+  if(quic_partial_overlap(plain, plain_len, cipher, cipher_len))
+    return 0;
+
+  int r;
+  if(key->chacha20)
+  {
+    // plain may be cipher, and is then left untouched on failure
+    r = Hacl_Chacha20Poly1305_Keyed_aead_decrypt(&key->chacha20_key, (uint8_t*)plain,
+      (uint8_t*)cipher, plain_len, (uint8_t*)cipher + plain_len, (uint8_t*)ad, ad_len, (uint8_t*)iv) == 0;
+  }
+  else
+  {
+    char stack[QUIC_STAGE_LEN];
+    char *p = plain;
+    if(plain == cipher && !(p = quic_stage(stack, NULL, plain_len)))
+      return 0;
+    FStar_UInt128_t n = Crypto_Symmetric_Bytes_load_uint128(12, iv);
+    r = Crypto_AEAD_Decrypt_decrypt(key->id, key->st, n, ad_len, (uint8_t*)ad, plain_len, (uint8_t*)p, (uint8_t*)cipher);
+    if(p != plain)
+    {
+      if(r) memcpy(plain, p, plain_len);
+      quic_unstage(stack, p, plain_len);
+    }
+  }
 
 #if DEBUG
   printf("DECRYPT %s\nIV=", r?"OK":"BAD"); dump(iv, 12);
   printf("STATIC="); dump(key->static_iv, 12);
   printf("AD="); dump(ad, ad_len);
-  printf("CIPHER="); dump(cipher, cipher_len);
-  printf("PLAIN="); dump(plain, plain_len);
+  if(r) { printf("PLAIN="); dump(plain, plain_len); }
 #endif
 
   return r;
 }
 
+static uint64_t quic_iov_len(const quic_iovec *v, uint32_t cnt)
+{
+  uint64_t len = 0;
+  for(uint32_t i = 0; i < cnt; i++)
+    len += v[i].len;
+  return len;
+}
+
+static void quic_iov_gather(char *buf, const quic_iovec *v, uint32_t cnt)
+{
+  for(uint32_t i = 0; i < cnt; i++)
+  {
+    memcpy(buf, v[i].buf, v[i].len);
+    buf += v[i].len;
+  }
+}
+
+// Writes the first len bytes of the segments
+static void quic_iov_scatter(const quic_iovec *v, const char *buf, uint64_t len)
+{
+  for(uint32_t i = 0; len > 0; i++)
+  {
+    uint32_t n = v[i].len < len ? v[i].len : (uint32_t)len;
+    memcpy(v[i].buf, buf, n);
+    buf += n;
+    len -= n;
+  }
+}
+
+// quic_iovec segments are passed to Hacl_Chacha20Poly1305_IOVec as they
+// are, which only works as long as both types have the same layout
+typedef char quic_iovec_matches_hacl[
+  sizeof(quic_iovec) == sizeof(Hacl_Chacha20Poly1305_IOVec_iovec)
+  && offsetof(quic_iovec, buf) == offsetof(Hacl_Chacha20Poly1305_IOVec_iovec, buf)
+  && offsetof(quic_iovec, len) == offsetof(Hacl_Chacha20Poly1305_IOVec_iovec, len) ? 1 : -1];
+
+#define QUIC_HACL_IOV(v) ((Hacl_Chacha20Poly1305_IOVec_iovec*)(v))
+
+int quic_crypto_encrypt_iov(quic_key *key, const quic_iovec *cipher, uint32_t cipher_cnt, char *tag, uint64_t sn, const quic_iovec *ad, uint32_t ad_cnt, const quic_iovec *plain, uint32_t plain_cnt)
+{
+  uint64_t ad_len = quic_iov_len(ad, ad_cnt);
+  uint64_t plain_len = quic_iov_len(plain, plain_cnt);
+  if(quic_iov_len(cipher, cipher_cnt) < plain_len)
+    return 0;
+
+  if(key->chacha20)
+  {
+    char iv[12];
+    memcpy(iv, key->static_iv, 12);
+    sn_to_iv(iv, sn);
+    return Hacl_Chacha20Poly1305_IOVec_aead_encrypt(QUIC_HACL_IOV(cipher), cipher_cnt, (uint8_t*)tag,
+      QUIC_HACL_IOV(plain), plain_cnt, QUIC_HACL_IOV(ad), ad_cnt, key->chacha20_key.key, (uint8_t*)iv) == 0;
+  }
+
+  // Crypto.AEAD only takes contiguous buffers
+  if(ad_len > UINT32_MAX || plain_len > UINT32_MAX - 16)
+    return 0;
+  size_t b_len = ad_len + 2 * plain_len + 16;
+  char *b = malloc(b_len);
+  if(!b) return 0;
+  char *c = b + ad_len + plain_len;
+  quic_iov_gather(b, ad, ad_cnt);
+  quic_iov_gather(b + ad_len, plain, plain_cnt);
+  quic_crypto_encrypt(key, c, sn, b, (uint32_t)ad_len, b + ad_len, (uint32_t)plain_len);
+  quic_iov_scatter(cipher, c, plain_len);
+  memcpy(tag, c + plain_len, 16);
+  Hacl_Util_wipe(b, b_len);
+  free(b);
+  return 1;
+}
+
+int quic_crypto_decrypt_iov(quic_key *key, const quic_iovec *plain, uint32_t plain_cnt, uint64_t sn, const quic_iovec *ad, uint32_t ad_cnt, const quic_iovec *cipher, uint32_t cipher_cnt, const char *tag)
+{
+  uint64_t ad_len = quic_iov_len(ad, ad_cnt);
+  uint64_t cipher_len = quic_iov_len(cipher, cipher_cnt);
+  if(quic_iov_len(plain, plain_cnt) < cipher_len)
+    return 0;
+
+  if(key->chacha20)
+  {
+    char iv[12];
+    memcpy(iv, key->static_iv, 12);
+    sn_to_iv(iv, sn);
+    // Zeroes what it decrypted if the tag does not verify
+    return Hacl_Chacha20Poly1305_IOVec_aead_decrypt(QUIC_HACL_IOV(plain), plain_cnt,
+      QUIC_HACL_IOV(cipher), cipher_cnt, (uint8_t*)tag, QUIC_HACL_IOV(ad), ad_cnt,
+      key->chacha20_key.key, (uint8_t*)iv) == 0;
+  }
+
+  if(ad_len > UINT32_MAX || cipher_len > UINT32_MAX - 16)
+    return 0;
+  size_t b_len = ad_len + 2 * cipher_len + 16;
+  char *b = malloc(b_len);
+  if(!b) return 0;
+  char *c = b + ad_len, *p = c + cipher_len + 16;
+  quic_iov_gather(b, ad, ad_cnt);
+  quic_iov_gather(c, cipher, cipher_cnt);
+  memcpy(c + cipher_len, tag, 16);
+  int r = quic_crypto_decrypt(key, p, sn, b, (uint32_t)ad_len, c, (uint32_t)cipher_len + 16);
+  if(r)
+    quic_iov_scatter(plain, p, cipher_len);
+  Hacl_Util_wipe(b, b_len);
+  free(b);
+  return r;
+}
+
 int quic_crypto_free_key(quic_key *key)
 {
   // ADL: the PRF stats is allocated with Buffer.screate
   // TODO switch to caller allocated style in Crypto.AEAD
-  if(key && key->st.prf.key)
+  if(key && !key->chacha20 && key->st.prf.key)
     free(key->st.prf.key);
-  if(key) free(key);
+  if(key)
+  {
+    if(key->chacha20)
+      Hacl_Util_wipe(&key->chacha20_key, sizeof(key->chacha20_key));
+    free(key);
+  }
 }
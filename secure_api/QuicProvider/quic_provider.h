@@ -48,8 +48,11 @@ int quic_crypto_tls_derive_secret(/*out*/ quic_secret *derived, const quic_secre
 int quic_crypto_derive_key(/*out*/quic_key **key, const quic_secret *secret);
 
 // AEAD-encrypts plain with additional data ad, using counter sn,
-// writing plain_len + 16 bytes to the output cipher. The input and
-// output buffer must not overlap.
+// writing plain_len + 16 bytes to the output cipher. Encryption may
+// be done in place: cipher may be plain, provided the buffer has room
+// for the 16-byte tag after the plaintext. Otherwise the input and
+// output buffers must not overlap, and calls where they partially
+// overlap fail and return 0.
 //
 // The packet number sn is internally combined with the static IV
 // to form the 12-byte AEAD IV
@@ -60,10 +63,35 @@ int quic_crypto_encrypt(quic_key *key, /*out*/ char *cipher, uint64_t sn, const
 
 // AEAD-decrypts cipher and authenticate additional data ad, using
 // counter; when successful, writes cipher_len - 16 bytes to the
-// output plain. The input and output buffers must not overlap.
+// output plain. As for encryption, plain may be cipher, and otherwise
+// the buffers must not overlap. In place, a packet whose tag does
+// not verify is left as it was.
+//
+// ChaCha20-Poly1305 keys work in place through stack buffers of at
+// most 512 bytes; AES-GCM keys copy the input of an in-place call to a
+// temporary buffer first.
 //
 int quic_crypto_decrypt(quic_key *key, /*out*/ char *plain, uint64_t sn, const char *ad, uint32_t ad_len, const char *cipher, uint32_t cipher_len);
 
+// A segment of a scattered buffer
+typedef struct quic_iovec {
+  char *buf;
+  uint32_t len;
+} quic_iovec;
+
+// Scatter-gather variants of quic_crypto_encrypt and quic_crypto_decrypt.
+// The additional data, plaintext and ciphertext are the concatenations
+// of their segments, and the 16-byte tag is passed on its own (e.g. the
+// packet trailer). Input and output segments need not line up; the
+// output must hold at least as many bytes as the input. An output byte
+// may be the input byte at the same position, but the input and output
+// must not overlap otherwise.
+//
+// ChaCha20-Poly1305 keys run over the segments without copying them;
+// AES-GCM keys gather them into a temporary buffer.
+int quic_crypto_encrypt_iov(quic_key *key, /*out*/ const quic_iovec *cipher, uint32_t cipher_cnt, /*out*/ char *tag, uint64_t sn, const quic_iovec *ad, uint32_t ad_cnt, const quic_iovec *plain, uint32_t plain_cnt);
+int quic_crypto_decrypt_iov(quic_key *key, /*out*/ const quic_iovec *plain, uint32_t plain_cnt, uint64_t sn, const quic_iovec *ad, uint32_t ad_cnt, const quic_iovec *cipher, uint32_t cipher_cnt, const char *tag);
+
 // Keys allocated by quic_crypto_derive_key must be freed
 int quic_crypto_free_key(quic_key *key);
 
@@ -71,6 +99,16 @@ int quic_crypto_free_key(quic_key *key);
 // Hash, HMAC and HKDF only suport SHA256, SHA384, and SHA512
 int quic_crypto_hash(quic_hash a, /*out*/ char *hash, const char *data, size_t data_len);
 int quic_crypto_hmac(quic_hash a, /*out*/ char *mac, const char *key, uint32_t key_len, const char *data, uint32_t data_len);
+
+// HMAC keys hold the inner and outer hash states reached after the
+// ipad and opad blocks, so that each MAC under the same key only
+// hashes the data and one finalization block. They are allocated by
+// quic_crypto_hmac_key and must be freed with quic_crypto_free_hmac_key.
+typedef struct quic_hmac_key quic_hmac_key;
+
+int quic_crypto_hmac_key(quic_hash a, /*out*/ quic_hmac_key **k, const char *key, uint32_t key_len);
+int quic_crypto_hmac_keyed(quic_hmac_key *k, /*out*/ char *mac, const char *data, uint32_t data_len);
+int quic_crypto_free_hmac_key(quic_hmac_key *k);
 int quic_crypto_hkdf_extract(quic_hash a, /*out*/ char *prk, const char *salt, uint32_t salt_len, const char *ikm, uint32_t ikm_len);
 int quic_crypto_hkdf_expand(quic_hash a, /*out*/ char *okm, uint32_t okm_len, const char *prk, uint32_t prk_len, const char *info, uint32_t info_len);
 
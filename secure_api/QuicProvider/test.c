@@ -19,6 +19,44 @@ void dump(unsigned char buffer[], size_t len)
   }
 }
 
+// Checks the scatter-gather functions against the contiguous ones, with
+// the AD, input and output each cut differently
+static void check_iov(quic_key *k, uint64_t sn, const char *ad, const char *data, uint32_t len)
+{
+  char c[128], c2[128], p2[128];
+  quic_iovec ad_v[2] = {{(char*)ad, 5}, {(char*)ad + 5, 8}};
+  quic_iovec in_v[3] = {{(char*)data, 0}, {(char*)data, 7}, {(char*)data + 7, len - 7}};
+  quic_iovec c_v[2] = {{c2, 20}, {c2 + 20, len - 20}};
+  quic_iovec p_v[1] = {{p2, len}};
+  quic_crypto_encrypt(k, c, sn, ad, 13, data, len);
+  assert(quic_crypto_encrypt_iov(k, c_v, 2, c2 + len, sn, ad_v, 2, in_v, 3));
+  assert(memcmp(c, c2, len + 16) == 0);
+  assert(quic_crypto_decrypt_iov(k, p_v, 1, sn, ad_v, 2, c_v, 2, c2 + len));
+  assert(memcmp(p2, data, len) == 0);
+  c2[len] ^= 1;
+  assert(!quic_crypto_decrypt_iov(k, p_v, 1, sn, ad_v, 2, c_v, 2, c2 + len));
+}
+
+// Checks in-place encryption and decryption against separate buffers
+static void check_inplace(quic_key *k, uint64_t sn, const char *ad, const char *data, uint32_t len)
+{
+  char c[128], b[128];
+  memcpy(b, data, len);
+  quic_crypto_encrypt(k, c, sn, ad, 13, data, len);
+  assert(quic_crypto_encrypt(k, b, sn, ad, 13, b, len));
+  assert(memcmp(b, c, len + 16) == 0);
+  assert(quic_crypto_decrypt(k, b, sn, ad, 13, b, len + 16));
+  assert(memcmp(b, data, len) == 0);
+  memcpy(b, c, len + 16);
+  b[len] ^= 1;
+  assert(!quic_crypto_decrypt(k, b, sn, ad, 13, b, len + 16));
+  c[len] ^= 1;
+  assert(memcmp(b, c, len + 16) == 0);
+  // Buffers that overlap without being equal are rejected
+  assert(!quic_crypto_encrypt(k, b + 1, sn, ad, 13, b, len));
+  assert(!quic_crypto_decrypt(k, b, sn, ad, 13, b + 1, len + 16));
+}
+
 int main(int argc, char **argv)
 {
   char hash[64] = {0};
@@ -51,6 +89,23 @@ int main(int argc, char **argv)
   dump(hash, 64);
   assert(memcmp(hash, "\x16\x4b\x7a\x7b\xfc\xf8\x19\xe2\xe3\x95\xfb\xe7\x3b\x56\xe0\xa3\x87\xbd\x64\x22\x2e\x83\x1f\xd6\x10\x27\x0c\xd7\xea\x25\x05\x54\x97\x58\xbf\x75\xc0\x5a\x99\x4a\x6d\x03\x4f\x65\xf8\xf0\xe6\xfd\xca\xea\xb1\xa3\x4d\x4a\x6b\x4b\x63\x6e\x07\x0a\x38\xbc\xe7\x37", 64) == 0);
 
+  quic_hmac_key *hk;
+  for(quic_hash a = TLS_hash_SHA256; a <= TLS_hash_SHA512; a++)
+  {
+    uint32_t hlen = (a == TLS_hash_SHA256 ? 32 : (a == TLS_hash_SHA384 ? 48 : 64));
+    char mac[64];
+    quic_crypto_hmac(a, hash, key, 4, data, 28);
+    if(!quic_crypto_hmac_key(a, &hk, key, 4))
+    {
+      printf("Failed to expand HMAC key\n");
+      return 1;
+    }
+    quic_crypto_hmac_keyed(hk, mac, data, 28);
+    assert(memcmp(hash, mac, hlen) == 0);
+    quic_crypto_free_hmac_key(hk);
+  }
+  printf("\nPrecomputed-key HMAC matches for SHA256, SHA384 and SHA512\n");
+
   char *salt = "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c";
   char *ikm = "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b";
   char *info = "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9";
@@ -58,6 +113,7 @@ int main(int argc, char **argv)
   printf("\nprk = HKDF-EXTRACT-SHA256('0x000102030405060708090a0b0c', '0x0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b')\n");
   quic_crypto_hkdf_extract(TLS_hash_SHA256, hash, salt, 13, ikm, 22);
   dump(hash, 32);
+  assert(memcmp(hash, "\x07\x77\x09\x36\x2c\x2e\x32\xdf\x0d\xdc\x3f\x0d\xc4\x7b\xba\x63\x90\xb6\xc7\x3b\xb5\x0f\x9c\x31\x22\xec\x84\x4a\xd7\xc2\xb3\xe5", 32) == 0);
 
   char prk[32] = {0};
   memcpy(prk, hash, 32);
@@ -71,6 +127,7 @@ int main(int argc, char **argv)
     return 1;
   }
   dump(okm, 42);
+  assert(memcmp(okm, "\x3c\xb2\x5f\x25\xfa\xac\xd5\x7a\x90\x43\x4f\x64\xd0\x36\x2f\x2a\x2d\x2d\x0a\x90\xcf\x1a\x5a\x4c\x5d\xb0\x2d\x56\xec\xc4\xc5\xbf\x34\x00\x72\x08\xd5\xb8\x87\x18\x58\x65", 42) == 0);
 
   quic_secret s = {0};
   s.hash = TLS_hash_SHA256;
@@ -78,6 +135,23 @@ int main(int argc, char **argv)
   memcpy(s.secret, hash, 32);
   quic_crypto_tls_derive_secret(&s, &s, "EXPORTER-QUIC server 1-RTT Secret");
 
+  // Known answers for the draft key schedule below (derived secrets, keys,
+  // IVs and ciphertexts) were computed with OpenSSL's HMAC-SHA256 and AEADs
+  assert(memcmp(s.secret, "\x42\xf5\x00\x1d\xda\xe6\xdb\x56\x95\x31\x09\x04\xef\x5d\x1d\xda\x35\xba\x49\x3e\xdf\x22\x0e\x23\x3e\x1f\xaf\x99\xb2\xb2\x6c\xd8", 32) == 0);
+
+  const char *con_id = "\x83\x94\xc8\xf0\x3e\x51\x57\x08";
+  const char *quic_salt = "\xaf\xc8\x24\xec\x5f\xc7\x7e\xca\x1e\x9d\x36\xf3\x7f\xb2\xd4\x65\x18\xc3\x66\x39";
+  quic_secret client_cleartext, server_cleartext;
+  if(!quic_crypto_derive_plaintext_secrets(&client_cleartext, &server_cleartext, con_id, quic_salt))
+  {
+    printf("Failed to derive cleartext secrets\n");
+    return 1;
+  }
+  assert(memcmp(client_cleartext.secret, "\x1d\xc1\xc6\x23\xb5\xca\xe5\xff\xef\xc4\xb7\xa4\xa6\xf9\xcb\xdc\x96\xc2\x50\x9b\x70\x91\x14\x33\x13\xbb\xb9\x30\x73\xd0\x0b\xe4", 32) == 0);
+  assert(memcmp(server_cleartext.secret, "\xbe\x5c\x7b\x21\xd2\x1c\x79\x8a\x17\x4a\xc4\xe6\x60\xd4\xbd\x41\xf9\xed\xeb\x25\x85\x05\xe8\x41\xcf\xda\x72\x66\x48\x0c\x7b\x7f", 32) == 0);
+  printf("\nClient cleartext secret:\n");
+  dump(client_cleartext.secret, 32);
+
   quic_key* k;
   if(!quic_crypto_derive_key(&k, &s))
   {
@@ -89,6 +163,7 @@ int main(int argc, char **argv)
   printf("\nAES-128-GCM encrypt test:\n");
   quic_crypto_encrypt(k, cipher, 0, salt, 13, data, 28);
   dump(cipher, 28+16);
+  assert(memcmp(cipher, "\xfb\x18\xcd\xd0\xa2\x71\x22\x0b\x3c\x63\x8b\x8b\x39\x47\x8c\x17\x57\x75\x3b\x2f\x54\x58\xbb\x83\x1d\xdc\x65\xbc\xc6\x6b\xea\x58\x60\xa3\x84\x19\x35\x50\x87\xf5\xf7\x38\x87\x7f", 44) == 0);
 
   if(quic_crypto_decrypt(k, hash, 0, salt, 13, cipher, 28+16)) {
     printf("DECRYPT SUCCES: \n");
@@ -96,6 +171,8 @@ int main(int argc, char **argv)
   } else {
     printf("DECRYPT FAILED.\n");
   }
+  check_iov(k, 0, salt, data, 28);
+  check_inplace(k, 0, salt, data, 28);
   quic_crypto_free_key(k);
 
   s.hash = TLS_hash_SHA256;
@@ -110,6 +187,7 @@ int main(int argc, char **argv)
   printf("\nCHACHA20-POLY1305 encrypt test:\n");
   quic_crypto_encrypt(k, cipher, 0x29e255a7, salt, 13, data, 28);
   dump(cipher, 28+16);
+  assert(memcmp(cipher, "\xef\xd8\x27\x95\xda\x81\xf7\x55\xcc\x95\xbf\xbe\xb8\x23\x4f\x8e\x74\x35\x89\x43\x03\x21\x57\x17\x5c\x70\xd8\xce\x07\xbd\x56\x9c\x91\x7c\x62\x7e\xfc\xb1\x97\x31\xa3\xa7\xdc\x29", 44) == 0);
 
   if(quic_crypto_decrypt(k, hash, 0x29e255a7, salt, 13, cipher, 28+16)) {
     printf("DECRYPT SUCCES: \n");
@@ -117,6 +195,9 @@ int main(int argc, char **argv)
   } else {
     printf("DECRYPT FAILED.\n");
   }
+  check_iov(k, 0x29e255a7, salt, data, 28);
+  check_inplace(k, 0x29e255a7, salt, data, 28);
+  printf("\nScatter-gather and in-place encrypt and decrypt match for AES-128-GCM and CHACHA20-POLY1305\n");
 
   quic_crypto_free_key(k);
 
@@ -36,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string.h>
 #include <stdint.h>
 
+#if defined(__i386__) || defined(__x86_64__)
+
 int _is_intel_cpu ()
 {
 	static int intel_cpu= -1;
@@ -112,3 +114,4 @@ void cpuid (cpuid_t *info, unsigned int leaf, unsigned int subleaf)
 #endif
 }
 
+#endif
@@ -45,7 +45,7 @@ typedef struct cpuid_struct {
 void cpuid (cpuid_t *info, unsigned int leaf, unsigned int subleaf);
 
 #ifdef __i386__
-int _has_cpuid ();
+int _have_cpuid ();
 #endif
 int _is_intel_cpu ();
 
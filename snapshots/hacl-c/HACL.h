@@ -55,6 +55,27 @@
 #include "Hacl_SHA2_256.h"
 #include "Hacl_SHA2_384.h"
 #include "Hacl_SHA2_512.h"
+#include "Hacl_SHA2_256_Multi.h"
+#include "Hacl_SHA2_State.h"
+#include "Hacl_SHA2_Streaming.h"
+#include "Hacl_HMAC_SHA2.h"
+#include "Hacl_SHA2_256_Tree.h"
+#include "Hacl_SHA2_Fixed.h"
+#include "Hacl_PBKDF2_SHA2.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Poly1305_Vec256.h"
+#include "Hacl_Chacha20Poly1305_Stitched.h"
+#include "Hacl_Chacha20Poly1305_Streaming.h"
+#include "Hacl_Chacha20Poly1305_IOVec.h"
+#include "Hacl_Chacha20Poly1305_Batch.h"
+#include "Hacl_Chacha20Poly1305_Keyed.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Curve25519_Base.h"
+#include "Hacl_Curve25519_Vec256.h"
+#include "Hacl_Box_Cache.h"
+#include "Hacl_Cpu_Features.h"
 #include "Hacl_Policies.h"
 #include "Hacl_Poly1305_32.h"
 #include "Hacl_Poly1305_64.h"
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Box_Cache.h"
+#include "Hacl_Salsa20.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Util.h"
+
+#if !defined(_MSC_VER)
+#define HACL_BOX_CACHE_PTHREADS 1
+#include <pthread.h>
+#else
+#define HACL_BOX_CACHE_PTHREADS 0
+#include <intrin.h>
+#endif
+
+#if HACL_BOX_CACHE_SETS == 0U || (HACL_BOX_CACHE_SETS & (HACL_BOX_CACHE_SETS - 1U)) != 0U
+#error "HACL_BOX_CACHE_SETS must be a power of two"
+#endif
+
+static uint64_t Hacl_Box_Cache_hits = 0U;
+
+static uint64_t Hacl_Box_Cache_misses = 0U;
+
+/* NaCl_crypto_box_beforenm, with the X25519 backend picked by
+   Hacl_Dispatch_curve25519 */
+void Hacl_Box_Cache_beforenm_uncached(uint8_t *k, uint8_t *pk, uint8_t *sk)
+{
+  uint8_t s[32U];
+  uint8_t n1[16U] = { 0U };
+  Hacl_Dispatch_curve25519(s, sk, pk);
+  Hacl_Salsa20_hsalsa20(k, s, n1);
+  Hacl_Util_wipe(s, 32U);
+}
+
+#if HACL_BOX_CACHE_PTHREADS
+
+typedef struct
+{
+  uint8_t pk[32U];
+  uint8_t sk[32U];
+  uint8_t k[32U];
+  /* Value of Hacl_Box_Cache_clock at the last use, 0 for an empty entry */
+  uint64_t used;
+}
+Hacl_Box_Cache_entry;
+
+static Hacl_Box_Cache_entry Hacl_Box_Cache_table[HACL_BOX_CACHE_SETS][HACL_BOX_CACHE_WAYS];
+
+static uint64_t Hacl_Box_Cache_clock = 0U;
+
+static pthread_mutex_t Hacl_Box_Cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Public keys are public, so the set can depend on them; secret keys are
+   compared without branching on their bytes */
+static uint32_t Hacl_Box_Cache_set(uint8_t *pk)
+{
+  return load32_le(pk) & (HACL_BOX_CACHE_SETS - 1U);
+}
+
+static bool Hacl_Box_Cache_matches(Hacl_Box_Cache_entry *e, uint8_t *pk, uint8_t *sk)
+{
+  uint8_t diff = (uint8_t)0U;
+  for (uint32_t i = 0U; i < 32U; i++)
+    diff |= (uint8_t)((e->pk[i] ^ pk[i]) | (e->sk[i] ^ sk[i]));
+  return e->used != 0U && diff == (uint8_t)0U;
+}
+
+static bool Hacl_Box_Cache_lookup(uint8_t *k, uint8_t *pk, uint8_t *sk)
+{
+  Hacl_Box_Cache_entry *set = Hacl_Box_Cache_table[Hacl_Box_Cache_set(pk)];
+  bool found = false;
+  pthread_mutex_lock(&Hacl_Box_Cache_lock);
+  for (uint32_t w = 0U; w < HACL_BOX_CACHE_WAYS; w++)
+    if (Hacl_Box_Cache_matches(set + w, pk, sk))
+    {
+      memcpy(k, set[w].k, 32U);
+      set[w].used = ++Hacl_Box_Cache_clock;
+      found = true;
+      break;
+    }
+  if (found)
+    Hacl_Box_Cache_hits++;
+  else
+    Hacl_Box_Cache_misses++;
+  pthread_mutex_unlock(&Hacl_Box_Cache_lock);
+  return found;
+}
+
+/* Another thread may have inserted the same keys while k was computed; the
+   entry is then only refreshed */
+static void Hacl_Box_Cache_insert(uint8_t *k, uint8_t *pk, uint8_t *sk)
+{
+  Hacl_Box_Cache_entry *set = Hacl_Box_Cache_table[Hacl_Box_Cache_set(pk)];
+  Hacl_Box_Cache_entry *victim = set;
+  pthread_mutex_lock(&Hacl_Box_Cache_lock);
+  for (uint32_t w = 0U; w < HACL_BOX_CACHE_WAYS; w++)
+  {
+    if (Hacl_Box_Cache_matches(set + w, pk, sk))
+    {
+      victim = set + w;
+      break;
+    }
+    if (set[w].used < victim->used)
+      victim = set + w;
+  }
+  Hacl_Util_wipe(victim, sizeof (Hacl_Box_Cache_entry));
+  memcpy(victim->pk, pk, 32U);
+  memcpy(victim->sk, sk, 32U);
+  memcpy(victim->k, k, 32U);
+  victim->used = ++Hacl_Box_Cache_clock;
+  pthread_mutex_unlock(&Hacl_Box_Cache_lock);
+}
+
+void Hacl_Box_Cache_beforenm(uint8_t *k, uint8_t *pk, uint8_t *sk)
+{
+  if (!Hacl_Box_Cache_lookup(k, pk, sk))
+  {
+    /* Computed outside the lock, so that misses on different peers run in
+       parallel */
+    Hacl_Box_Cache_beforenm_uncached(k, pk, sk);
+    Hacl_Box_Cache_insert(k, pk, sk);
+  }
+}
+
+void Hacl_Box_Cache_stats(uint64_t *hits, uint64_t *misses)
+{
+  pthread_mutex_lock(&Hacl_Box_Cache_lock);
+  *hits = Hacl_Box_Cache_hits;
+  *misses = Hacl_Box_Cache_misses;
+  pthread_mutex_unlock(&Hacl_Box_Cache_lock);
+}
+
+void Hacl_Box_Cache_clear(void)
+{
+  pthread_mutex_lock(&Hacl_Box_Cache_lock);
+  Hacl_Util_wipe(Hacl_Box_Cache_table, sizeof Hacl_Box_Cache_table);
+  pthread_mutex_unlock(&Hacl_Box_Cache_lock);
+}
+
+#else
+
+/* There is no lock to count under: the miss counter is updated and read
+   with interlocked operations instead (64-bit, so also on 32-bit targets) */
+void Hacl_Box_Cache_beforenm(uint8_t *k, uint8_t *pk, uint8_t *sk)
+{
+  _InterlockedIncrement64((volatile __int64 *)&Hacl_Box_Cache_misses);
+  Hacl_Box_Cache_beforenm_uncached(k, pk, sk);
+}
+
+void Hacl_Box_Cache_stats(uint64_t *hits, uint64_t *misses)
+{
+  *hits = Hacl_Box_Cache_hits;
+  *misses = (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)&Hacl_Box_Cache_misses, 0, 0);
+}
+
+void Hacl_Box_Cache_clear(void)
+{
+}
+
+#endif
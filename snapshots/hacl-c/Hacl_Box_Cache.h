@@ -0,0 +1,61 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Box_Cache_H
+#define __Hacl_Box_Cache_H
+
+#include <inttypes.h>
+
+/* Cache of crypto_box_beforenm keys (unverified).
+ *
+ * A server boxing many messages for the same peers would otherwise pay one
+ * X25519 and one HSalsa20 per message. Keys are kept in a process-wide
+ * table of HACL_BOX_CACHE_SETS sets of HACL_BOX_CACHE_WAYS entries, indexed
+ * by the peer public key and tagged with both keys; each set evicts its
+ * least recently used entry. Entries hold a copy of the secret key and the
+ * derived key, and are overwritten with zeros when evicted or cleared.
+ * Lookups are serialized by a mutex; without pthreads (MSVC) every call
+ * recomputes the key and counts as a miss. */
+
+#ifndef HACL_BOX_CACHE_SETS
+#define HACL_BOX_CACHE_SETS 64U
+#endif
+
+#define HACL_BOX_CACHE_WAYS 4U
+
+/* k = crypto_box_beforenm(pk, sk), from the cache when possible */
+void Hacl_Box_Cache_beforenm(uint8_t *k, uint8_t *pk, uint8_t *sk);
+
+/* Same result, always computed and never cached: for callers that keep the
+   key themselves (crypto_box_beforenm) */
+void Hacl_Box_Cache_beforenm_uncached(uint8_t *k, uint8_t *pk, uint8_t *sk);
+
+/* Lookups answered from the cache, and lookups that computed the key, since
+   the start of the process */
+void Hacl_Box_Cache_stats(uint64_t *hits, uint64_t *misses);
+
+/* Zeroes every entry, e.g. after rotating a secret key. The counters are
+   kept. */
+void Hacl_Box_Cache_clear(void);
+
+#endif
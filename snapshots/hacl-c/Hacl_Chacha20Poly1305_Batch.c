@@ -0,0 +1,731 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Policies.h"
+#include "Hacl_Util.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Chacha20Poly1305_Stitched.h"
+#include "Hacl_Chacha20Poly1305_Batch.h"
+
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_encrypt_serial(
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint8_t *k1
+)
+{
+  for (uint32_t i = 0U; i < n; i++)
+    Hacl_Chacha20Poly1305_Stitched_aead_encrypt(p[i].output,
+      p[i].mac,
+      p[i].input,
+      p[i].len,
+      p[i].aad,
+      p[i].aadlen,
+      k1,
+      p[i].nonce);
+}
+
+static uint32_t
+Hacl_Impl_Chacha20Poly1305_Batch_decrypt_serial(
+  uint32_t *res,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint8_t *k1
+)
+{
+  uint32_t bad = 0U;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    res[i] =
+      Hacl_Chacha20Poly1305_Stitched_aead_decrypt(p[i].output,
+        p[i].input,
+        p[i].len,
+        p[i].mac,
+        p[i].aad,
+        p[i].aadlen,
+        k1,
+        p[i].nonce);
+    bad = bad + res[i];
+  }
+  return bad;
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+
+#include <immintrin.h>
+
+/* Only these functions use AVX2; the rest of the file must run anywhere */
+#define HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET __attribute__((target("avx2")))
+
+/* Packets whose Poly1305 keys and tags are kept at a time */
+#define HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP 32U
+
+/* ChaCha20 blocks waiting for a lane. A block without input is a Poly1305
+   key block: the first 32 bytes of its keystream go to output. */
+typedef struct
+{
+  uint32_t n;
+  uint32_t ctr[8U];
+  uint32_t nonce[3U][8U];
+  uint8_t *input[8U];
+  uint8_t *output[8U];
+  uint32_t len[8U];
+}
+Hacl_Impl_Chacha20Poly1305_Batch_queue;
+
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static inline __m256i Hacl_Impl_Chacha20Poly1305_Batch_rotl16(__m256i x)
+{
+  return
+    _mm256_shuffle_epi8(x,
+      _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+        13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+}
+
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static inline __m256i Hacl_Impl_Chacha20Poly1305_Batch_rotl8(__m256i x)
+{
+  return
+    _mm256_shuffle_epi8(x,
+      _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+        14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3));
+}
+
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static inline void
+Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(
+  __m256i *x,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d
+)
+{
+  x[a] = _mm256_add_epi32(x[a], x[b]);
+  x[d] = Hacl_Impl_Chacha20Poly1305_Batch_rotl16(_mm256_xor_si256(x[d], x[a]));
+  x[c] = _mm256_add_epi32(x[c], x[d]);
+  x[b] = _mm256_xor_si256(x[b], x[c]);
+  x[b] = _mm256_or_si256(_mm256_slli_epi32(x[b], 12), _mm256_srli_epi32(x[b], 20));
+  x[a] = _mm256_add_epi32(x[a], x[b]);
+  x[d] = Hacl_Impl_Chacha20Poly1305_Batch_rotl8(_mm256_xor_si256(x[d], x[a]));
+  x[c] = _mm256_add_epi32(x[c], x[d]);
+  x[b] = _mm256_xor_si256(x[b], x[c]);
+  x[b] = _mm256_or_si256(_mm256_slli_epi32(x[b], 7), _mm256_srli_epi32(x[b], 25));
+}
+
+/* x[i] holds word i of the 8 lanes; o[l] gets words 0..7 of lane l */
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static inline void Hacl_Impl_Chacha20Poly1305_Batch_transpose(__m256i *o, __m256i *x)
+{
+  __m256i t0 = _mm256_unpacklo_epi32(x[0U], x[1U]);
+  __m256i t1 = _mm256_unpackhi_epi32(x[0U], x[1U]);
+  __m256i t2 = _mm256_unpacklo_epi32(x[2U], x[3U]);
+  __m256i t3 = _mm256_unpackhi_epi32(x[2U], x[3U]);
+  __m256i t4 = _mm256_unpacklo_epi32(x[4U], x[5U]);
+  __m256i t5 = _mm256_unpackhi_epi32(x[4U], x[5U]);
+  __m256i t6 = _mm256_unpacklo_epi32(x[6U], x[7U]);
+  __m256i t7 = _mm256_unpackhi_epi32(x[6U], x[7U]);
+  __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+  o[0U] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  o[1U] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  o[2U] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  o[3U] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  o[4U] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  o[5U] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  o[6U] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  o[7U] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/* Computes one ChaCha20 block per lane, each with its own nonce and
+   counter, and empties the queue */
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_flush(uint32_t *kw, Hacl_Impl_Chacha20Poly1305_Batch_queue *q)
+{
+  __m256i s[16U], x[16U], lo[8U], hi[8U];
+  s[0U] = _mm256_set1_epi32(0x61707865);
+  s[1U] = _mm256_set1_epi32(0x3320646e);
+  s[2U] = _mm256_set1_epi32(0x79622d32);
+  s[3U] = _mm256_set1_epi32(0x6b206574);
+  for (uint32_t i = 0U; i < 8U; i++)
+    s[4U + i] = _mm256_set1_epi32((int)kw[i]);
+  s[12U] = _mm256_loadu_si256((const __m256i *)q->ctr);
+  for (uint32_t i = 0U; i < 3U; i++)
+    s[13U + i] = _mm256_loadu_si256((const __m256i *)q->nonce[i]);
+  for (uint32_t i = 0U; i < 16U; i++)
+    x[i] = s[i];
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 0U, 4U, 8U, 12U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 1U, 5U, 9U, 13U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 2U, 6U, 10U, 14U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 3U, 7U, 11U, 15U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 0U, 5U, 10U, 15U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 1U, 6U, 11U, 12U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 2U, 7U, 8U, 13U);
+    Hacl_Impl_Chacha20Poly1305_Batch_quarter_round(x, 3U, 4U, 9U, 14U);
+  }
+  for (uint32_t i = 0U; i < 16U; i++)
+    x[i] = _mm256_add_epi32(x[i], s[i]);
+  Hacl_Impl_Chacha20Poly1305_Batch_transpose(lo, x);
+  Hacl_Impl_Chacha20Poly1305_Batch_transpose(hi, x + 8U);
+  for (uint32_t l = 0U; l < q->n; l++)
+  {
+    uint8_t *in = q->input[l];
+    uint8_t *out = q->output[l];
+    if (in == NULL)
+      _mm256_storeu_si256((__m256i *)out, lo[l]);
+    else if (q->len[l] == 64U)
+    {
+      __m256i m0 = _mm256_loadu_si256((const __m256i *)in);
+      __m256i m1 = _mm256_loadu_si256((const __m256i *)(in + 32U));
+      _mm256_storeu_si256((__m256i *)out, _mm256_xor_si256(m0, lo[l]));
+      _mm256_storeu_si256((__m256i *)(out + 32U), _mm256_xor_si256(m1, hi[l]));
+    }
+    else
+    {
+      uint8_t ks[64U];
+      _mm256_storeu_si256((__m256i *)ks, lo[l]);
+      _mm256_storeu_si256((__m256i *)(ks + 32U), hi[l]);
+      for (uint32_t i = 0U; i < q->len[l]; i++)
+        out[i] = in[i] ^ ks[i];
+      Hacl_Util_wipe(ks, sizeof (ks));
+    }
+  }
+  q->n = 0U;
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_push(
+  uint32_t *kw,
+  Hacl_Impl_Chacha20Poly1305_Batch_queue *q,
+  uint8_t *nonce,
+  uint32_t ctr,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t len
+)
+{
+  uint32_t i = q->n;
+  q->ctr[i] = ctr;
+  q->nonce[0U][i] = load32_le(nonce);
+  q->nonce[1U][i] = load32_le(nonce + 4U);
+  q->nonce[2U][i] = load32_le(nonce + 8U);
+  q->input[i] = input;
+  q->output[i] = output;
+  q->len[i] = len;
+  q->n = i + 1U;
+  if (q->n == 8U)
+    Hacl_Impl_Chacha20Poly1305_Batch_flush(kw, q);
+}
+
+/* Block 0 of every packet: the Poly1305 keys */
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_keys(
+  uint32_t *kw,
+  uint8_t (*otk)[32U],
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Batch_queue q = { 0U };
+  for (uint32_t i = 0U; i < n; i++)
+    Hacl_Impl_Chacha20Poly1305_Batch_push(kw, &q, p[i].nonce, 0U, otk[i], NULL, 32U);
+  if (q.n > 0U)
+    Hacl_Impl_Chacha20Poly1305_Batch_flush(kw, &q);
+}
+
+/* Blocks 1.. of every packet, except those marked in skip (if not NULL) */
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_stream(
+  uint32_t *kw,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint32_t *skip
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Batch_queue q = { 0U };
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    if (skip != NULL && skip[i] != 0U)
+      continue;
+    for (uint32_t j = 0U; j * 64U < p[i].len; j++)
+    {
+      uint32_t rem = p[i].len - j * 64U;
+      Hacl_Impl_Chacha20Poly1305_Batch_push(kw,
+        &q,
+        p[i].nonce,
+        j + 1U,
+        p[i].output + j * 64U,
+        p[i].input + j * 64U,
+        rem < 64U ? rem : 64U);
+    }
+  }
+  if (q.n > 0U)
+    Hacl_Impl_Chacha20Poly1305_Batch_flush(kw, &q);
+}
+
+/* A Poly1305 lane walks the padded RFC 7539 input of one packet: AAD
+   blocks, last AAD block, text blocks, last text block, lengths */
+typedef struct
+{
+  uint8_t *seg[5U];
+  uint32_t nb[5U];
+  uint32_t cur;
+  uint32_t left;
+  uint32_t pkt;
+  bool busy;
+  uint8_t pad[48U];
+}
+Hacl_Impl_Chacha20Poly1305_Batch_lane;
+
+static const uint8_t Hacl_Impl_Chacha20Poly1305_Batch_zero_block[16U] = { 0U };
+
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_lane_start(
+  Hacl_Impl_Chacha20Poly1305_Batch_lane *ln,
+  uint32_t pkt,
+  uint8_t *aad,
+  uint32_t aadlen,
+  uint8_t *text,
+  uint32_t len
+)
+{
+  memset(ln->pad, 0, 32U);
+  memcpy(ln->pad, aad + aadlen / 16U * 16U, aadlen % 16U);
+  memcpy(ln->pad + 16U, text + len / 16U * 16U, len % 16U);
+  store64_le(ln->pad + 32U, (uint64_t)aadlen);
+  store64_le(ln->pad + 40U, (uint64_t)len);
+  ln->seg[0U] = aad;
+  ln->nb[0U] = aadlen / 16U;
+  ln->seg[1U] = ln->pad;
+  ln->nb[1U] = aadlen % 16U != 0U;
+  ln->seg[2U] = text;
+  ln->nb[2U] = len / 16U;
+  ln->seg[3U] = ln->pad + 16U;
+  ln->nb[3U] = len % 16U != 0U;
+  ln->seg[4U] = ln->pad + 32U;
+  ln->nb[4U] = 1U;
+  ln->cur = 0U;
+  ln->left = ln->nb[0U] + ln->nb[1U] + ln->nb[2U] + ln->nb[3U] + 1U;
+  ln->pkt = pkt;
+  ln->busy = true;
+}
+
+/* Poly1305 state of 8 lanes in 26-bit limbs: limb i of lane l is at
+   h[i][l], with s = 5 * r for the reduction */
+typedef struct
+{
+  uint64_t h[5U][8U];
+  uint64_t r[5U][8U];
+  uint64_t s[5U][8U];
+}
+Hacl_Impl_Chacha20Poly1305_Batch_poly;
+
+/* Absorbs k blocks in every lane, lane l reading from b[l] onwards (or the
+   same block k times if step[l] is 0). The two vectors of four lanes are
+   independent, so that their multiplications overlap. */
+HACL_IMPL_CHACHA20POLY1305_BATCH_TARGET
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_poly_blocks(
+  Hacl_Impl_Chacha20Poly1305_Batch_poly *st,
+  const uint8_t **b,
+  uint32_t *step,
+  uint32_t k
+)
+{
+  __m256i h[2U][5U], r[2U][5U], s[2U][5U];
+  __m256i mask = _mm256_set1_epi64x(0x3ffffff);
+  __m256i hibit = _mm256_set1_epi64x(1 << 24);
+  for (uint32_t v = 0U; v < 2U; v++)
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+      h[v][i] = _mm256_loadu_si256((const __m256i *)(st->h[i] + 4U * v));
+      r[v][i] = _mm256_loadu_si256((const __m256i *)(st->r[i] + 4U * v));
+      s[v][i] = _mm256_loadu_si256((const __m256i *)(st->s[i] + 4U * v));
+    }
+  for (uint32_t it = 0U; it < k; it++)
+    for (uint32_t v = 0U; v < 2U; v++)
+    {
+      const uint8_t **b4 = b + 4U * v;
+      uint32_t *step4 = step + 4U * v;
+      __m128i b0 = _mm_loadu_si128((const __m128i *)b4[0U]);
+      __m128i b1 = _mm_loadu_si128((const __m128i *)b4[1U]);
+      __m128i b2 = _mm_loadu_si128((const __m128i *)b4[2U]);
+      __m128i b3 = _mm_loadu_si128((const __m128i *)b4[3U]);
+      for (uint32_t l = 0U; l < 4U; l++)
+        b4[l] = b4[l] + step4[l];
+      __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(b0), b2, 1);
+      __m256i y = _mm256_inserti128_si256(_mm256_castsi128_si256(b1), b3, 1);
+      __m256i lo = _mm256_unpacklo_epi64(x, y);
+      __m256i hi = _mm256_unpackhi_epi64(x, y);
+      __m256i *hv = h[v], *rv = r[v], *sv = s[v];
+      hv[0U] = _mm256_add_epi64(hv[0U], _mm256_and_si256(lo, mask));
+      hv[1U] = _mm256_add_epi64(hv[1U], _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask));
+      hv[2U] =
+        _mm256_add_epi64(hv[2U],
+          _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask));
+      hv[3U] = _mm256_add_epi64(hv[3U], _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask));
+      hv[4U] = _mm256_add_epi64(hv[4U], _mm256_or_si256(_mm256_srli_epi64(hi, 40), hibit));
+      __m256i d[5U];
+      for (uint32_t i = 0U; i < 5U; i++)
+      {
+        __m256i acc = _mm256_mul_epu32(hv[0U], rv[i]);
+        for (uint32_t j = 1U; j <= i; j++)
+          acc = _mm256_add_epi64(acc, _mm256_mul_epu32(hv[j], rv[i - j]));
+        for (uint32_t j = i + 1U; j < 5U; j++)
+          acc = _mm256_add_epi64(acc, _mm256_mul_epu32(hv[j], sv[5U + i - j]));
+        d[i] = acc;
+      }
+      __m256i c;
+      c = _mm256_srli_epi64(d[0U], 26);
+      hv[0U] = _mm256_and_si256(d[0U], mask);
+      d[1U] = _mm256_add_epi64(d[1U], c);
+      c = _mm256_srli_epi64(d[1U], 26);
+      hv[1U] = _mm256_and_si256(d[1U], mask);
+      d[2U] = _mm256_add_epi64(d[2U], c);
+      c = _mm256_srli_epi64(d[2U], 26);
+      hv[2U] = _mm256_and_si256(d[2U], mask);
+      d[3U] = _mm256_add_epi64(d[3U], c);
+      c = _mm256_srli_epi64(d[3U], 26);
+      hv[3U] = _mm256_and_si256(d[3U], mask);
+      d[4U] = _mm256_add_epi64(d[4U], c);
+      c = _mm256_srli_epi64(d[4U], 26);
+      hv[4U] = _mm256_and_si256(d[4U], mask);
+      hv[0U] = _mm256_add_epi64(hv[0U], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));
+      c = _mm256_srli_epi64(hv[0U], 26);
+      hv[0U] = _mm256_and_si256(hv[0U], mask);
+      hv[1U] = _mm256_add_epi64(hv[1U], c);
+    }
+  for (uint32_t v = 0U; v < 2U; v++)
+    for (uint32_t i = 0U; i < 5U; i++)
+      _mm256_storeu_si256((__m256i *)(st->h[i] + 4U * v), h[v][i]);
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_poly_init(
+  Hacl_Impl_Chacha20Poly1305_Batch_poly *st,
+  uint32_t l,
+  uint8_t *k1
+)
+{
+  uint64_t lo = load64_le(k1) & (uint64_t)0x0ffffffc0fffffffU;
+  uint64_t hi = load64_le(k1 + 8U) & (uint64_t)0x0ffffffc0ffffffcU;
+  st->r[0U][l] = lo & (uint64_t)0x3ffffffU;
+  st->r[1U][l] = lo >> 26U & (uint64_t)0x3ffffffU;
+  st->r[2U][l] = (lo >> 52U | hi << 12U) & (uint64_t)0x3ffffffU;
+  st->r[3U][l] = hi >> 14U & (uint64_t)0x3ffffffU;
+  st->r[4U][l] = hi >> 40U;
+  for (uint32_t i = 0U; i < 5U; i++)
+  {
+    st->s[i][l] = st->r[i][l] * (uint64_t)5U;
+    st->h[i][l] = (uint64_t)0U;
+  }
+}
+
+/* Fully reduces the accumulator of lane l and adds s */
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_poly_finish(
+  Hacl_Impl_Chacha20Poly1305_Batch_poly *st,
+  uint32_t l,
+  uint8_t *tag,
+  uint8_t *s
+)
+{
+  uint32_t h0 = (uint32_t)st->h[0U][l];
+  uint32_t h1 = (uint32_t)st->h[1U][l];
+  uint32_t h2 = (uint32_t)st->h[2U][l];
+  uint32_t h3 = (uint32_t)st->h[3U][l];
+  uint32_t h4 = (uint32_t)st->h[4U][l];
+  uint32_t c;
+  c = h1 >> 26U;
+  h1 = h1 & 0x3ffffffU;
+  h2 = h2 + c;
+  c = h2 >> 26U;
+  h2 = h2 & 0x3ffffffU;
+  h3 = h3 + c;
+  c = h3 >> 26U;
+  h3 = h3 & 0x3ffffffU;
+  h4 = h4 + c;
+  c = h4 >> 26U;
+  h4 = h4 & 0x3ffffffU;
+  h0 = h0 + c * 5U;
+  c = h0 >> 26U;
+  h0 = h0 & 0x3ffffffU;
+  h1 = h1 + c;
+  /* h - p = h + 5 - 2^130, kept if it does not borrow */
+  uint32_t g0 = h0 + 5U;
+  c = g0 >> 26U;
+  g0 = g0 & 0x3ffffffU;
+  uint32_t g1 = h1 + c;
+  c = g1 >> 26U;
+  g1 = g1 & 0x3ffffffU;
+  uint32_t g2 = h2 + c;
+  c = g2 >> 26U;
+  g2 = g2 & 0x3ffffffU;
+  uint32_t g3 = h3 + c;
+  c = g3 >> 26U;
+  g3 = g3 & 0x3ffffffU;
+  uint32_t g4 = h4 + c - (1U << 26U);
+  uint32_t mask = (g4 >> 31U) - 1U;
+  h0 = (h0 & ~mask) | (g0 & mask);
+  h1 = (h1 & ~mask) | (g1 & mask);
+  h2 = (h2 & ~mask) | (g2 & mask);
+  h3 = (h3 & ~mask) | (g3 & mask);
+  h4 = (h4 & ~mask) | (g4 & mask);
+  /* Added, not ORed: the last carry may leave h1 equal to 2^26 */
+  uint64_t f;
+  f = (uint64_t)h0 + ((uint64_t)h1 << 26U) + (uint64_t)load32_le(s);
+  store32_le(tag, (uint32_t)f);
+  f = (f >> 32U) + ((uint64_t)h2 << 20U) + (uint64_t)load32_le(s + 4U);
+  store32_le(tag + 4U, (uint32_t)f);
+  f = (f >> 32U) + ((uint64_t)h3 << 14U) + (uint64_t)load32_le(s + 8U);
+  store32_le(tag + 8U, (uint32_t)f);
+  f = (f >> 32U) + ((uint64_t)h4 << 8U) + (uint64_t)load32_le(s + 12U);
+  store32_le(tag + 12U, (uint32_t)f);
+}
+
+/* Tags of n packets, over their outputs (encryption) or inputs
+   (decryption). Each lane takes the next packet as soon as it is free. */
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_macs(
+  uint8_t (*tags)[16U],
+  uint8_t (*otk)[32U],
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  bool decrypt
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Batch_poly st;
+  Hacl_Impl_Chacha20Poly1305_Batch_lane ln[8U];
+  const uint8_t *b[8U];
+  uint32_t step[8U];
+  uint32_t next = 0U;
+  memset(&st, 0, sizeof (st));
+  for (uint32_t l = 0U; l < 8U; l++)
+    ln[l].busy = false;
+  while (true)
+  {
+    uint32_t k = 0U;
+    for (uint32_t l = 0U; l < 8U; l++)
+    {
+      if (ln[l].busy && ln[l].left == 0U)
+      {
+        Hacl_Impl_Chacha20Poly1305_Batch_poly_finish(&st, l, tags[ln[l].pkt], otk[ln[l].pkt] + 16U);
+        ln[l].busy = false;
+      }
+      if (!ln[l].busy && next < n)
+      {
+        Hacl_Chacha20Poly1305_Batch_packet *q = p + next;
+        Hacl_Impl_Chacha20Poly1305_Batch_lane_start(ln + l,
+          next,
+          q->aad,
+          q->aadlen,
+          decrypt ? q->input : q->output,
+          q->len);
+        Hacl_Impl_Chacha20Poly1305_Batch_poly_init(&st, l, otk[next]);
+        next = next + 1U;
+      }
+      if (ln[l].busy)
+      {
+        while (ln[l].nb[ln[l].cur] == 0U)
+          ln[l].cur = ln[l].cur + 1U;
+        b[l] = ln[l].seg[ln[l].cur];
+        step[l] = 16U;
+        if (k == 0U || ln[l].nb[ln[l].cur] < k)
+          k = ln[l].nb[ln[l].cur];
+      }
+      else
+      {
+        b[l] = Hacl_Impl_Chacha20Poly1305_Batch_zero_block;
+        step[l] = 0U;
+      }
+    }
+    if (k == 0U)
+      break;
+    /* Up to the end of the shortest current segment */
+    Hacl_Impl_Chacha20Poly1305_Batch_poly_blocks(&st, b, step, k);
+    for (uint32_t l = 0U; l < 8U; l++)
+      if (ln[l].busy)
+      {
+        ln[l].seg[ln[l].cur] = ln[l].seg[ln[l].cur] + 16U * k;
+        ln[l].nb[ln[l].cur] = ln[l].nb[ln[l].cur] - k;
+        ln[l].left = ln[l].left - k;
+      }
+  }
+  Hacl_Util_wipe(&st, sizeof (st));
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_Batch_encrypt_group(
+  uint32_t *kw,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n
+)
+{
+  uint8_t otk[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP][32U];
+  uint8_t tags[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP][16U];
+  Hacl_Impl_Chacha20Poly1305_Batch_keys(kw, otk, p, n);
+  Hacl_Impl_Chacha20Poly1305_Batch_stream(kw, p, n, NULL);
+  Hacl_Impl_Chacha20Poly1305_Batch_macs(tags, otk, p, n, false);
+  for (uint32_t i = 0U; i < n; i++)
+    memcpy(p[i].mac, tags[i], 16U);
+  Hacl_Util_wipe(otk, 32U * n);
+}
+
+static uint32_t
+Hacl_Impl_Chacha20Poly1305_Batch_decrypt_group(
+  uint32_t *kw,
+  uint32_t *res,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n
+)
+{
+  uint8_t otk[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP][32U];
+  uint8_t tags[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP][16U];
+  uint32_t bad = 0U;
+  Hacl_Impl_Chacha20Poly1305_Batch_keys(kw, otk, p, n);
+  Hacl_Impl_Chacha20Poly1305_Batch_macs(tags, otk, p, n, true);
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    res[i] = Hacl_Policies_cmp_bytes(tags[i], p[i].mac, 16U) != 0U;
+    bad = bad + res[i];
+  }
+  /* Only authentic packets are decrypted */
+  Hacl_Impl_Chacha20Poly1305_Batch_stream(kw, p, n, res);
+  for (uint32_t i = 0U; i < n; i++)
+    if (res[i] != 0U)
+      memset(p[i].output, 0, p[i].len);
+  Hacl_Util_wipe(otk, 32U * n);
+  Hacl_Util_wipe(tags, 16U * n);
+  return bad;
+}
+
+static bool Hacl_Impl_Chacha20Poly1305_Batch_avx2(void)
+{
+  Hacl_Dispatch_chacha20_impl impl = Hacl_Dispatch_chacha20_get();
+  return impl == Hacl_Dispatch_Chacha20_Vec256 || impl == Hacl_Dispatch_Chacha20_Vec512;
+}
+
+void Hacl_Chacha20Poly1305_Batch_aead_encrypt(Hacl_Chacha20Poly1305_Batch_packet *p, uint32_t n, uint8_t *k1)
+{
+  Hacl_Chacha20Poly1305_Batch_packet q[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP];
+  uint32_t kw[8U];
+  uint32_t m = 0U;
+  if (!Hacl_Impl_Chacha20Poly1305_Batch_avx2())
+  {
+    Hacl_Impl_Chacha20Poly1305_Batch_encrypt_serial(p, n, k1);
+    return;
+  }
+  for (uint32_t i = 0U; i < 8U; i++)
+    kw[i] = load32_le(k1 + 4U * i);
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    if (p[i].len >= HACL_CHACHA20POLY1305_BATCH_MAX_LEN)
+    {
+      Hacl_Impl_Chacha20Poly1305_Batch_encrypt_serial(p + i, 1U, k1);
+      continue;
+    }
+    q[m] = p[i];
+    m = m + 1U;
+    if (m == HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP)
+    {
+      Hacl_Impl_Chacha20Poly1305_Batch_encrypt_group(kw, q, m);
+      m = 0U;
+    }
+  }
+  if (m > 0U)
+    Hacl_Impl_Chacha20Poly1305_Batch_encrypt_group(kw, q, m);
+  Hacl_Util_wipe(kw, sizeof (kw));
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Batch_aead_decrypt(
+  uint32_t *res,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint8_t *k1
+)
+{
+  Hacl_Chacha20Poly1305_Batch_packet q[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP];
+  uint32_t idx[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP];
+  uint32_t qres[HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP];
+  uint32_t kw[8U];
+  uint32_t m = 0U;
+  uint32_t bad = 0U;
+  if (!Hacl_Impl_Chacha20Poly1305_Batch_avx2())
+    return Hacl_Impl_Chacha20Poly1305_Batch_decrypt_serial(res, p, n, k1);
+  for (uint32_t i = 0U; i < 8U; i++)
+    kw[i] = load32_le(k1 + 4U * i);
+  for (uint32_t i = 0U; i <= n; i++)
+  {
+    if (i < n && p[i].len >= HACL_CHACHA20POLY1305_BATCH_MAX_LEN)
+    {
+      bad = bad + Hacl_Impl_Chacha20Poly1305_Batch_decrypt_serial(res + i, p + i, 1U, k1);
+      continue;
+    }
+    if (i < n)
+    {
+      q[m] = p[i];
+      idx[m] = i;
+      m = m + 1U;
+    }
+    if (m == HACL_IMPL_CHACHA20POLY1305_BATCH_GROUP || (i == n && m > 0U))
+    {
+      bad = bad + Hacl_Impl_Chacha20Poly1305_Batch_decrypt_group(kw, qres, q, m);
+      for (uint32_t j = 0U; j < m; j++)
+        res[idx[j]] = qres[j];
+      m = 0U;
+    }
+  }
+  Hacl_Util_wipe(kw, sizeof (kw));
+  return bad;
+}
+
+#else
+
+void Hacl_Chacha20Poly1305_Batch_aead_encrypt(Hacl_Chacha20Poly1305_Batch_packet *p, uint32_t n, uint8_t *k1)
+{
+  Hacl_Impl_Chacha20Poly1305_Batch_encrypt_serial(p, n, k1);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Batch_aead_decrypt(
+  uint32_t *res,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint8_t *k1
+)
+{
+  return Hacl_Impl_Chacha20Poly1305_Batch_decrypt_serial(res, p, n, k1);
+}
+
+#endif
@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20Poly1305_Batch_H
+#define __Hacl_Chacha20Poly1305_Batch_H
+
+#include <inttypes.h>
+
+/* Batched ChaCha20-Poly1305 for many short packets under one key
+ * (unverified).
+ *
+ * Encrypting a 100-byte packet with Hacl_Chacha20Poly1305 leaves most of a
+ * vectorized ChaCha20 unused and runs one serial Poly1305 instance. These
+ * entry points schedule the keystream blocks of all packets (the Poly1305
+ * key block and the message blocks) eight at a time into the AVX2 lanes,
+ * whatever packet each block belongs to, and run the Poly1305 instances
+ * of eight packets side by side, each lane refilled with the next packet
+ * as soon as its tag is done.
+ *
+ * Packets of HACL_CHACHA20POLY1305_BATCH_MAX_LEN bytes or more, where one
+ * packet already fills the vectors, go through Hacl_Chacha20Poly1305_Stitched
+ * on their own; so does the whole batch without AVX2 (or when Hacl_Dispatch
+ * selects a narrower ChaCha20 backend). Results are those of
+ * Hacl_Chacha20Poly1305 (RFC 7539) on each packet; input and output may be
+ * the same buffer. */
+
+/* Past this length the per-packet AVX2 code (Poly1305 with precomputed
+   powers of r) is faster than one Poly1305 lane per packet */
+#define HACL_CHACHA20POLY1305_BATCH_MAX_LEN 1024U
+
+typedef struct
+{
+  uint8_t *nonce;  /* 12 bytes */
+  uint8_t *aad;
+  uint32_t aadlen;
+  uint8_t *input;  /* len bytes: plaintext to encrypt, ciphertext to decrypt */
+  uint8_t *output; /* len bytes */
+  uint32_t len;
+  uint8_t *mac;    /* 16 bytes: written by encryption, checked by decryption */
+}
+Hacl_Chacha20Poly1305_Batch_packet;
+
+/* Encrypts and authenticates the n packets of p under the 32-byte key k1 */
+void Hacl_Chacha20Poly1305_Batch_aead_encrypt(Hacl_Chacha20Poly1305_Batch_packet *p, uint32_t n, uint8_t *k1);
+
+/* Decrypts the n packets of p under k1. res[i] is 0 if packet i verifies and
+   1 otherwise, in which case its output is zeroed. Returns the number of
+   packets that did not verify. */
+uint32_t
+Hacl_Chacha20Poly1305_Batch_aead_decrypt(
+  uint32_t *res,
+  Hacl_Chacha20Poly1305_Batch_packet *p,
+  uint32_t n,
+  uint8_t *k1
+);
+
+#endif
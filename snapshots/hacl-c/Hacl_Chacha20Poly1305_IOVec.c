@@ -0,0 +1,148 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Chacha20Poly1305_Streaming.h"
+#include "Hacl_Chacha20Poly1305_IOVec.h"
+#include "Hacl_Util.h"
+
+static uint64_t Hacl_Impl_Chacha20Poly1305_IOVec_total(Hacl_Chacha20Poly1305_IOVec_iovec *v, uint32_t cnt)
+{
+  uint64_t len = 0U;
+  for (uint32_t i = 0U; i < cnt; i++)
+    len = len + (uint64_t)v[i].len;
+  return len;
+}
+
+/* Runs the cipher over in, writing to out, one piece per pair of
+   overlapping segments */
+static void
+Hacl_Impl_Chacha20Poly1305_IOVec_crypt(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  bool decrypt,
+  Hacl_Chacha20Poly1305_IOVec_iovec *out,
+  Hacl_Chacha20Poly1305_IOVec_iovec *in,
+  uint32_t in_cnt
+)
+{
+  uint32_t i = 0U;
+  uint32_t ioff = 0U;
+  uint32_t j = 0U;
+  uint32_t ooff = 0U;
+  while (i < in_cnt)
+  {
+    uint32_t ilen = in[i].len - ioff;
+    uint32_t olen;
+    uint32_t n;
+    /* Input left implies output left, so out[j] exists past this test */
+    if (ilen == 0U)
+    {
+      i++;
+      ioff = 0U;
+      continue;
+    }
+    olen = out[j].len - ooff;
+    if (olen == 0U)
+    {
+      j++;
+      ooff = 0U;
+      continue;
+    }
+    n = ilen < olen ? ilen : olen;
+    if (decrypt)
+      Hacl_Chacha20Poly1305_Streaming_decrypt_update(ctx, out[j].buf + ooff, in[i].buf + ioff, n);
+    else
+      Hacl_Chacha20Poly1305_Streaming_encrypt_update(ctx, out[j].buf + ooff, in[i].buf + ioff, n);
+    ioff = ioff + n;
+    ooff = ooff + n;
+  }
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_IOVec_start(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  Hacl_Chacha20Poly1305_IOVec_iovec *aad1,
+  uint32_t aad_cnt,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  Hacl_Chacha20Poly1305_Streaming_init(ctx, k1, n1);
+  for (uint32_t i = 0U; i < aad_cnt; i++)
+    Hacl_Chacha20Poly1305_Streaming_aad(ctx, aad1[i].buf, (uint64_t)aad1[i].len);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_IOVec_aead_encrypt(
+  Hacl_Chacha20Poly1305_IOVec_iovec *c,
+  uint32_t c_cnt,
+  uint8_t *mac,
+  Hacl_Chacha20Poly1305_IOVec_iovec *m,
+  uint32_t m_cnt,
+  Hacl_Chacha20Poly1305_IOVec_iovec *aad1,
+  uint32_t aad_cnt,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  if (Hacl_Impl_Chacha20Poly1305_IOVec_total(c, c_cnt) < Hacl_Impl_Chacha20Poly1305_IOVec_total(m, m_cnt))
+    return (uint32_t)1U;
+  Hacl_Chacha20Poly1305_Streaming_state ctx;
+  Hacl_Impl_Chacha20Poly1305_IOVec_start(&ctx, aad1, aad_cnt, k1, n1);
+  Hacl_Impl_Chacha20Poly1305_IOVec_crypt(&ctx, false, c, m, m_cnt);
+  Hacl_Chacha20Poly1305_Streaming_encrypt_finish(&ctx, mac);
+  Hacl_Util_wipe(&ctx, sizeof ctx);
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_IOVec_aead_decrypt(
+  Hacl_Chacha20Poly1305_IOVec_iovec *m,
+  uint32_t m_cnt,
+  Hacl_Chacha20Poly1305_IOVec_iovec *c,
+  uint32_t c_cnt,
+  uint8_t *mac,
+  Hacl_Chacha20Poly1305_IOVec_iovec *aad1,
+  uint32_t aad_cnt,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  uint64_t len = Hacl_Impl_Chacha20Poly1305_IOVec_total(c, c_cnt);
+  if (Hacl_Impl_Chacha20Poly1305_IOVec_total(m, m_cnt) < len)
+    return (uint32_t)1U;
+  Hacl_Chacha20Poly1305_Streaming_state ctx;
+  Hacl_Impl_Chacha20Poly1305_IOVec_start(&ctx, aad1, aad_cnt, k1, n1);
+  Hacl_Impl_Chacha20Poly1305_IOVec_crypt(&ctx, true, m, c, c_cnt);
+  uint32_t r = Hacl_Chacha20Poly1305_Streaming_decrypt_finish(&ctx, mac);
+  Hacl_Util_wipe(&ctx, sizeof ctx);
+  if (r == (uint32_t)0U)
+    return (uint32_t)0U;
+  for (uint32_t j = 0U; len > 0U; j++)
+  {
+    uint32_t n = (uint64_t)m[j].len < len ? m[j].len : (uint32_t)len;
+    memset(m[j].buf, 0, n);
+    len = len - n;
+  }
+  return (uint32_t)1U;
+}
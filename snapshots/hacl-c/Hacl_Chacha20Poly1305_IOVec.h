@@ -0,0 +1,79 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20Poly1305_IOVec_H
+#define __Hacl_Chacha20Poly1305_IOVec_H
+
+#include <inttypes.h>
+
+/* Scatter-gather ChaCha20-Poly1305 (unverified).
+ *
+ * The AAD, the input and the output are each given as an array of
+ * segments, whose concatenations are the AAD, message and ciphertext of
+ * Hacl_Chacha20Poly1305 (same results). Input and output segments need not
+ * line up: the work is cut at every boundary of either side and carried
+ * over by a Hacl_Chacha20Poly1305_Streaming context, so nothing is copied
+ * into a staging buffer.
+ *
+ * The output segments must hold at least as many bytes as the input ones;
+ * otherwise 1 is returned and nothing is written. An output byte may be the
+ * input byte at the same position (in place), but the two sides must not
+ * overlap otherwise. */
+
+typedef struct
+{
+  uint8_t *buf;
+  uint32_t len;
+}
+Hacl_Chacha20Poly1305_IOVec_iovec;
+
+/* Returns 0, or 1 if the output is too short */
+uint32_t
+Hacl_Chacha20Poly1305_IOVec_aead_encrypt(
+  Hacl_Chacha20Poly1305_IOVec_iovec *c,
+  uint32_t c_cnt,
+  uint8_t *mac,
+  Hacl_Chacha20Poly1305_IOVec_iovec *m,
+  uint32_t m_cnt,
+  Hacl_Chacha20Poly1305_IOVec_iovec *aad1,
+  uint32_t aad_cnt,
+  uint8_t *k1,
+  uint8_t *n1
+);
+
+/* Returns 0, or 1 if the output is too short or the tag does not verify.
+   In the latter case the plaintext already written is zeroed. */
+uint32_t
+Hacl_Chacha20Poly1305_IOVec_aead_decrypt(
+  Hacl_Chacha20Poly1305_IOVec_iovec *m,
+  uint32_t m_cnt,
+  Hacl_Chacha20Poly1305_IOVec_iovec *c,
+  uint32_t c_cnt,
+  uint8_t *mac,
+  Hacl_Chacha20Poly1305_IOVec_iovec *aad1,
+  uint32_t aad_cnt,
+  uint8_t *k1,
+  uint8_t *n1
+);
+
+#endif
@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Poly1305_64.h"
+#include "Hacl_Poly1305_Vec256.h"
+#include "Hacl_Policies.h"
+#include "Hacl_Chacha20Poly1305_Keyed.h"
+#include "Hacl_Util.h"
+
+/* Messages up to this length are encrypted together with block 0: with
+   it, at most 8 blocks, one pass of the main loop of Hacl_Chacha20_Vec256.
+   Longer messages start at block 1, so as not to shift them against the
+   passes of the vector code. */
+#define HACL_IMPL_CHACHA20POLY1305_KEYED_HEAD 448U
+
+/* Size of the stack buffers: block 0 and a head, or one in-place pass */
+#define HACL_IMPL_CHACHA20POLY1305_KEYED_BUF (64U + HACL_IMPL_CHACHA20POLY1305_KEYED_HEAD)
+
+/* Poly1305 state on either backend */
+typedef struct
+{
+  bool vec256;
+  Hacl_Poly1305_Vec256_state poly;
+  uint64_t poly64[6U];
+}
+Hacl_Impl_Chacha20Poly1305_Keyed_mac_state;
+
+static void
+Hacl_Impl_Chacha20Poly1305_Keyed_mac_blocks(
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_state *st,
+  uint8_t *m,
+  uint32_t nblocks
+)
+{
+  if (st->vec256)
+    Hacl_Poly1305_Vec256_update(&st->poly, m, nblocks);
+  else
+    Hacl_Poly1305_64_update(Hacl_Poly1305_64_mk_state(st->poly64, st->poly64 + 3U), m, nblocks);
+}
+
+/* Absorbs len bytes, the last block padded with zeros (RFC 7539) */
+static void
+Hacl_Impl_Chacha20Poly1305_Keyed_mac_padded(
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_state *st,
+  uint8_t *m,
+  uint32_t len
+)
+{
+  uint8_t last[16U] = { 0U };
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_blocks(st, m, len / 16U);
+  if (len % 16U > 0U)
+  {
+    memcpy(last, m + len / 16U * 16U, len % 16U);
+    Hacl_Impl_Chacha20Poly1305_Keyed_mac_blocks(st, last, 1U);
+  }
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_Keyed_mac(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *tag,
+  uint8_t *otk,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *c,
+  uint32_t mlen
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_state st;
+  uint8_t lb[16U];
+  st.vec256 = k->vec256;
+  if (st.vec256)
+    Hacl_Poly1305_Vec256_init(&st.poly, otk);
+  else
+    Hacl_Poly1305_64_init(Hacl_Poly1305_64_mk_state(st.poly64, st.poly64 + 3U), otk);
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_padded(&st, aad1, aadlen);
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_padded(&st, c, mlen);
+  store64_le(lb, (uint64_t)aadlen);
+  store64_le(lb + 8U, (uint64_t)mlen);
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac_blocks(&st, lb, 1U);
+  if (st.vec256)
+    Hacl_Poly1305_Vec256_finish(&st.poly, tag, otk);
+  else
+  {
+    Hacl_Impl_Poly1305_64_State_poly1305_state p = Hacl_Poly1305_64_mk_state(st.poly64, st.poly64 + 3U);
+    Hacl_Poly1305_64_update_last(p, NULL, 0U);
+    Hacl_Poly1305_64_finish(p, tag, otk + 16U);
+  }
+  Hacl_Util_wipe(&st, sizeof st);
+}
+
+/* Puts the Poly1305 key (block 0) in buf[0..32] and, for a short message,
+   the encryption of m in buf[64..64 + mlen]; returns whether it did. The
+   backends are only specified for disjoint buffers, so block 0 and m are
+   staged in tmp first. */
+static bool
+Hacl_Impl_Chacha20Poly1305_Keyed_head(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *buf,
+  uint8_t *tmp,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n1
+)
+{
+  if (mlen > HACL_IMPL_CHACHA20POLY1305_KEYED_HEAD)
+  {
+    Hacl_Chacha20_chacha20_key_block(buf, k->key, n1, 0U);
+    return false;
+  }
+  memset(tmp, 0, 64U);
+  memcpy(tmp + 64U, m, mlen);
+  Hacl_Chacha20Poly1305_Keyed_chacha20(k, buf, tmp, 64U + mlen, n1, 0U);
+  return true;
+}
+
+/* Encrypts a long message from block 1. In place, each pass is copied to
+   tmp first, for the same reason. */
+static void
+Hacl_Impl_Chacha20Poly1305_Keyed_body(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *tmp,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t len,
+  uint8_t *n1
+)
+{
+  uint32_t ctr = 1U;
+  if (output != input)
+  {
+    Hacl_Chacha20Poly1305_Keyed_chacha20(k, output, input, len, n1, ctr);
+    return;
+  }
+  while (len > 0U)
+  {
+    uint32_t n = len < HACL_IMPL_CHACHA20POLY1305_KEYED_BUF ? len : HACL_IMPL_CHACHA20POLY1305_KEYED_BUF;
+    memcpy(tmp, input, n);
+    Hacl_Chacha20Poly1305_Keyed_chacha20(k, output, tmp, n, n1, ctr);
+    ctr = ctr + n / 64U;
+    output = output + n;
+    input = input + n;
+    len = len - n;
+  }
+}
+
+/* Zeroes what head and body may have left in buf and tmp: the Poly1305 key,
+   keystream, and plaintext or a pass of it */
+static void Hacl_Impl_Chacha20Poly1305_Keyed_wipe(uint8_t *buf, uint8_t *tmp, uint32_t mlen)
+{
+  uint32_t n = 64U + (mlen < HACL_IMPL_CHACHA20POLY1305_KEYED_HEAD ? mlen : HACL_IMPL_CHACHA20POLY1305_KEYED_HEAD);
+  Hacl_Util_wipe(buf, n);
+  Hacl_Util_wipe(tmp, n);
+}
+
+void Hacl_Chacha20Poly1305_Keyed_init_key(Hacl_Chacha20Poly1305_Keyed_key *k, uint8_t *k1)
+{
+  memcpy(k->key, k1, 32U);
+  k->chacha20 = Hacl_Dispatch_chacha20_get();
+  k->vec256 = Hacl_Dispatch_poly1305_get() == Hacl_Dispatch_Poly1305_Vec256;
+}
+
+void
+Hacl_Chacha20Poly1305_Keyed_chacha20(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  Hacl_Dispatch_chacha20_lookup(k->chacha20)(output, plain, len, k->key, n1, ctr);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Keyed_aead_encrypt(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *c,
+  uint8_t *mac,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *n1
+)
+{
+  uint8_t buf[HACL_IMPL_CHACHA20POLY1305_KEYED_BUF];
+  uint8_t tmp[HACL_IMPL_CHACHA20POLY1305_KEYED_BUF];
+  if (Hacl_Impl_Chacha20Poly1305_Keyed_head(k, buf, tmp, m, mlen, n1))
+    memcpy(c, buf + 64U, mlen);
+  else
+    Hacl_Impl_Chacha20Poly1305_Keyed_body(k, tmp, c, m, mlen, n1);
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac(k, mac, buf, aad1, aadlen, c, mlen);
+  Hacl_Impl_Chacha20Poly1305_Keyed_wipe(buf, tmp, mlen);
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Keyed_aead_decrypt(
+  Hacl_Chacha20Poly1305_Keyed_key *k,
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t mlen,
+  uint8_t *mac,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *n1
+)
+{
+  uint8_t buf[HACL_IMPL_CHACHA20POLY1305_KEYED_BUF];
+  uint8_t tmp[HACL_IMPL_CHACHA20POLY1305_KEYED_BUF];
+  uint8_t rmac[16U];
+  bool short_msg = Hacl_Impl_Chacha20Poly1305_Keyed_head(k, buf, tmp, c, mlen, n1);
+  Hacl_Impl_Chacha20Poly1305_Keyed_mac(k, rmac, buf, aad1, aadlen, c, mlen);
+  uint8_t verify = Hacl_Policies_cmp_bytes(mac, rmac, 16U);
+  Hacl_Util_wipe(rmac, sizeof rmac);
+  if (verify != (uint8_t)0U)
+  {
+    /* buf + 64 holds the unauthenticated plaintext of a short message */
+    Hacl_Impl_Chacha20Poly1305_Keyed_wipe(buf, tmp, mlen);
+    if (m != c)
+      memset(m, 0, mlen);
+    return (uint32_t)1U;
+  }
+  if (short_msg)
+    memcpy(m, buf + 64U, mlen);
+  else
+    Hacl_Impl_Chacha20Poly1305_Keyed_body(k, tmp, m, c, mlen, n1);
+  Hacl_Impl_Chacha20Poly1305_Keyed_wipe(buf, tmp, mlen);
+  return (uint32_t)0U;
+}
@@ -0,0 +1,75 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Chacha20Poly1305_Streaming.h"
+#include "Hacl_Chacha20Poly1305_Stitched.h"
+#include "Hacl_Util.h"
+
+/* The streaming context does the chunking; a one-shot call is a single
+   update */
+
+uint32_t
+Hacl_Chacha20Poly1305_Stitched_aead_encrypt(
+  uint8_t *c,
+  uint8_t *mac,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  Hacl_Chacha20Poly1305_Streaming_state ctx;
+  Hacl_Chacha20Poly1305_Streaming_init(&ctx, k1, n1);
+  Hacl_Chacha20Poly1305_Streaming_aad(&ctx, aad1, (uint64_t)aadlen);
+  Hacl_Chacha20Poly1305_Streaming_encrypt_update(&ctx, c, m, (uint64_t)mlen);
+  Hacl_Chacha20Poly1305_Streaming_encrypt_finish(&ctx, mac);
+  Hacl_Util_wipe(&ctx, sizeof ctx);
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Stitched_aead_decrypt(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t mlen,
+  uint8_t *mac,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  Hacl_Chacha20Poly1305_Streaming_state ctx;
+  Hacl_Chacha20Poly1305_Streaming_init(&ctx, k1, n1);
+  Hacl_Chacha20Poly1305_Streaming_aad(&ctx, aad1, (uint64_t)aadlen);
+  Hacl_Chacha20Poly1305_Streaming_decrypt_update(&ctx, m, c, (uint64_t)mlen);
+  uint32_t r = Hacl_Chacha20Poly1305_Streaming_decrypt_finish(&ctx, mac);
+  Hacl_Util_wipe(&ctx, sizeof ctx);
+  if (r == (uint32_t)0U)
+    return (uint32_t)0U;
+  memset(m, 0, mlen);
+  return (uint32_t)1U;
+}
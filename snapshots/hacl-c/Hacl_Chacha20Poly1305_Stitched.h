@@ -0,0 +1,70 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20Poly1305_Stitched_H
+#define __Hacl_Chacha20Poly1305_Stitched_H
+
+#include <inttypes.h>
+
+/* Single-pass ChaCha20-Poly1305 (unverified).
+ *
+ * Hacl_Chacha20Poly1305 encrypts the whole message and then reads the
+ * ciphertext back for Poly1305, so a large record makes two trips through
+ * the cache hierarchy. These entry points walk the message in chunks of
+ * HACL_CHACHA20POLY1305_STITCHED_CHUNK bytes and MAC each chunk right after
+ * it is encrypted (before it is decrypted), while it is still in L1. Both
+ * primitives use the backends selected by Hacl_Dispatch.
+ *
+ * Ciphertexts, tags and return values are those of Hacl_Chacha20Poly1305
+ * (RFC 7539). Decryption writes the plaintext as it goes; if the tag does
+ * not verify, the mlen bytes of m are zeroed before returning 1. */
+
+/* A multiple of 64, so that every chunk starts on a ChaCha20 block; a chunk
+   and its output fit together in a 32 KiB L1 data cache */
+#define HACL_CHACHA20POLY1305_STITCHED_CHUNK 8192U
+
+uint32_t
+Hacl_Chacha20Poly1305_Stitched_aead_encrypt(
+  uint8_t *c,
+  uint8_t *mac,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *k1,
+  uint8_t *n1
+);
+
+uint32_t
+Hacl_Chacha20Poly1305_Stitched_aead_decrypt(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t mlen,
+  uint8_t *mac,
+  uint8_t *aad1,
+  uint32_t aadlen,
+  uint8_t *k1,
+  uint8_t *n1
+);
+
+#endif
@@ -0,0 +1,264 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Poly1305_64.h"
+#include "Hacl_Poly1305_Vec256.h"
+#include "Hacl_Policies.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Chacha20Poly1305_Stitched.h"
+#include "Hacl_Chacha20Poly1305_Streaming.h"
+#include "Hacl_Util.h"
+
+/* Poly1305 on nblocks full blocks */
+static void
+Hacl_Impl_Chacha20Poly1305_Streaming_mac_blocks(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *m,
+  uint32_t nblocks
+)
+{
+  if (ctx->vec256)
+    Hacl_Poly1305_Vec256_update(&ctx->poly, m, nblocks);
+  else
+    Hacl_Poly1305_64_update(Hacl_Poly1305_64_mk_state(ctx->poly64, ctx->poly64 + 3U), m, nblocks);
+}
+
+static void
+Hacl_Impl_Chacha20Poly1305_Streaming_mac(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *m,
+  uint32_t len
+)
+{
+  if (ctx->buf_len > 0U)
+  {
+    uint32_t fill = 16U - ctx->buf_len;
+    if (len < fill)
+    {
+      memcpy(ctx->buf + ctx->buf_len, m, len);
+      ctx->buf_len = ctx->buf_len + len;
+      return;
+    }
+    memcpy(ctx->buf + ctx->buf_len, m, fill);
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac_blocks(ctx, ctx->buf, 1U);
+    m = m + fill;
+    len = len - fill;
+  }
+  Hacl_Impl_Chacha20Poly1305_Streaming_mac_blocks(ctx, m, len / 16U);
+  ctx->buf_len = len % 16U;
+  memcpy(ctx->buf, m + len / 16U * 16U, ctx->buf_len);
+}
+
+/* Ends the AAD or the ciphertext: RFC 7539 pads each to a block with zeros */
+static void Hacl_Impl_Chacha20Poly1305_Streaming_mac_pad(Hacl_Chacha20Poly1305_Streaming_state *ctx)
+{
+  if (ctx->buf_len > 0U)
+  {
+    memset(ctx->buf + ctx->buf_len, 0, 16U - ctx->buf_len);
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac_blocks(ctx, ctx->buf, 1U);
+    ctx->buf_len = 0U;
+  }
+}
+
+static void Hacl_Impl_Chacha20Poly1305_Streaming_close_aad(Hacl_Chacha20Poly1305_Streaming_state *ctx)
+{
+  if (!ctx->aad_done)
+  {
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac_pad(ctx);
+    ctx->aad_done = true;
+  }
+}
+
+/* XORs len bytes with the keystream: first what is left of the current
+   block, then whole blocks, then a new block kept for the next call */
+static void
+Hacl_Impl_Chacha20Poly1305_Streaming_xor(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t len
+)
+{
+  uint32_t n = ctx->ks_len < len ? ctx->ks_len : len;
+  uint8_t *ks = ctx->ks + 64U - ctx->ks_len;
+  for (uint32_t i = 0U; i < n; i++)
+    output[i] = input[i] ^ ks[i];
+  ctx->ks_len = ctx->ks_len - n;
+  output = output + n;
+  input = input + n;
+  len = len - n;
+  uint32_t nblocks = len / 64U;
+  uint32_t rem = len % 64U;
+  if (nblocks > 0U)
+  {
+    Hacl_Dispatch_chacha20(output, input, nblocks * 64U, ctx->key, ctx->nonce, ctx->ctr);
+    ctx->ctr = ctx->ctr + nblocks;
+    output = output + nblocks * 64U;
+    input = input + nblocks * 64U;
+  }
+  if (rem > 0U)
+  {
+    Hacl_Chacha20_chacha20_key_block(ctx->ks, ctx->key, ctx->nonce, ctx->ctr);
+    ctx->ctr = ctx->ctr + 1U;
+    for (uint32_t i = 0U; i < rem; i++)
+      output[i] = input[i] ^ ctx->ks[i];
+    ctx->ks_len = 64U - rem;
+  }
+}
+
+/* Writes the tag of everything absorbed so far */
+static void
+Hacl_Impl_Chacha20Poly1305_Streaming_tag(Hacl_Chacha20Poly1305_Streaming_state *ctx, uint8_t *tag)
+{
+  uint8_t lb[16U];
+  Hacl_Impl_Chacha20Poly1305_Streaming_close_aad(ctx);
+  Hacl_Impl_Chacha20Poly1305_Streaming_mac_pad(ctx);
+  store64_le(lb, ctx->aad_len);
+  store64_le(lb + 8U, ctx->msg_len);
+  Hacl_Impl_Chacha20Poly1305_Streaming_mac_blocks(ctx, lb, 1U);
+  if (ctx->vec256)
+    Hacl_Poly1305_Vec256_finish(&ctx->poly, tag, ctx->otk);
+  else
+  {
+    Hacl_Impl_Poly1305_64_State_poly1305_state p = Hacl_Poly1305_64_mk_state(ctx->poly64, ctx->poly64 + 3U);
+    Hacl_Poly1305_64_update_last(p, NULL, 0U);
+    Hacl_Poly1305_64_finish(p, tag, ctx->otk + 16U);
+  }
+}
+
+void
+Hacl_Chacha20Poly1305_Streaming_init(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *k1,
+  uint8_t *n1
+)
+{
+  uint8_t block[64U];
+  memcpy(ctx->key, k1, 32U);
+  memcpy(ctx->nonce, n1, 12U);
+  Hacl_Chacha20_chacha20_key_block(block, k1, n1, 0U);
+  memcpy(ctx->otk, block, 32U);
+  Hacl_Util_wipe(block, sizeof block);
+  ctx->ctr = 1U;
+  ctx->ks_len = 0U;
+  ctx->vec256 = Hacl_Dispatch_poly1305_get() == Hacl_Dispatch_Poly1305_Vec256;
+  if (ctx->vec256)
+    Hacl_Poly1305_Vec256_init(&ctx->poly, ctx->otk);
+  else
+    Hacl_Poly1305_64_init(Hacl_Poly1305_64_mk_state(ctx->poly64, ctx->poly64 + 3U), ctx->otk);
+  ctx->buf_len = 0U;
+  ctx->aad_done = false;
+  ctx->aad_len = 0U;
+  ctx->msg_len = 0U;
+}
+
+void
+Hacl_Chacha20Poly1305_Streaming_aad(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *aad1,
+  uint64_t len
+)
+{
+  ctx->aad_len = ctx->aad_len + len;
+  while (len > 0U)
+  {
+    uint32_t n = len < HACL_CHACHA20POLY1305_STITCHED_CHUNK ? (uint32_t)len : HACL_CHACHA20POLY1305_STITCHED_CHUNK;
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac(ctx, aad1, n);
+    aad1 = aad1 + n;
+    len = len - n;
+  }
+}
+
+void
+Hacl_Chacha20Poly1305_Streaming_encrypt_update(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *c,
+  uint8_t *m,
+  uint64_t len
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Streaming_close_aad(ctx);
+  ctx->msg_len = ctx->msg_len + len;
+  while (len > 0U)
+  {
+    uint32_t n = len < HACL_CHACHA20POLY1305_STITCHED_CHUNK ? (uint32_t)len : HACL_CHACHA20POLY1305_STITCHED_CHUNK;
+    Hacl_Impl_Chacha20Poly1305_Streaming_xor(ctx, c, m, n);
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac(ctx, c, n);
+    c = c + n;
+    m = m + n;
+    len = len - n;
+  }
+}
+
+void
+Hacl_Chacha20Poly1305_Streaming_encrypt_finish(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *mac
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Streaming_tag(ctx, mac);
+}
+
+void
+Hacl_Chacha20Poly1305_Streaming_decrypt_update(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *m,
+  uint8_t *c,
+  uint64_t len
+)
+{
+  Hacl_Impl_Chacha20Poly1305_Streaming_close_aad(ctx);
+  ctx->msg_len = ctx->msg_len + len;
+  /* MAC first: with m == c the chunk is overwritten by the decryption */
+  while (len > 0U)
+  {
+    uint32_t n = len < HACL_CHACHA20POLY1305_STITCHED_CHUNK ? (uint32_t)len : HACL_CHACHA20POLY1305_STITCHED_CHUNK;
+    Hacl_Impl_Chacha20Poly1305_Streaming_mac(ctx, c, n);
+    Hacl_Impl_Chacha20Poly1305_Streaming_xor(ctx, m, c, n);
+    c = c + n;
+    m = m + n;
+    len = len - n;
+  }
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_Streaming_decrypt_finish(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *mac
+)
+{
+  uint8_t rmac[16U];
+  Hacl_Impl_Chacha20Poly1305_Streaming_tag(ctx, rmac);
+  uint8_t verify = Hacl_Policies_cmp_bytes(mac, rmac, 16U);
+  Hacl_Util_wipe(rmac, sizeof rmac);
+  if (verify == (uint8_t)0U)
+    return (uint32_t)0U;
+  return (uint32_t)1U;
+}
+
+void Hacl_Chacha20Poly1305_Streaming_wipe(Hacl_Chacha20Poly1305_Streaming_state *ctx)
+{
+  Hacl_Util_wipe(ctx, sizeof *ctx);
+}
@@ -0,0 +1,121 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20Poly1305_Streaming_H
+#define __Hacl_Chacha20Poly1305_Streaming_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "Hacl_Poly1305_Vec256.h"
+
+/* Streaming ChaCha20-Poly1305 contexts (unverified).
+ *
+ * A context takes the AAD, then the message, in pieces of any length, and
+ * produces the same ciphertext and tag as Hacl_Chacha20Poly1305 (RFC 7539)
+ * on the concatenation. Every update writes its output at once: unused
+ * keystream and a partial Poly1305 block are carried to the next call.
+ * Long updates are processed chunk by chunk, MACing each chunk while it is
+ * still in cache (see Hacl_Chacha20Poly1305_Stitched).
+ *
+ * All AAD must be given before the first update. Lengths are 64-bit, but
+ * ChaCha20 limits a message to 2^38 - 64 bytes under one nonce. Streaming
+ * decryption releases plaintext before the tag is checked: the caller must
+ * not use it until decrypt_finish has returned 0. A context is as sensitive
+ * as the key (it holds the key, the Poly1305 key and unused keystream): it
+ * must be initialized again after finish, and cleared with
+ * Hacl_Chacha20Poly1305_Streaming_wipe once no longer used. */
+
+typedef struct
+{
+  uint8_t key[32U];
+  uint8_t nonce[12U];
+  /* One-time Poly1305 key, from ChaCha20 block 0 */
+  uint8_t otk[32U];
+  /* Next ChaCha20 block, and the unused keystream in the last ks_len bytes
+     of ks */
+  uint32_t ctr;
+  uint32_t ks_len;
+  uint8_t ks[64U];
+  /* Poly1305 on the AVX2 code if Hacl_Dispatch selected it, on
+     Hacl_Poly1305_64 (r, then h, in poly64) otherwise */
+  bool vec256;
+  Hacl_Poly1305_Vec256_state poly;
+  uint64_t poly64[6U];
+  /* Bytes not yet absorbed by Poly1305 (less than a block) */
+  uint32_t buf_len;
+  uint8_t buf[16U];
+  bool aad_done;
+  uint64_t aad_len;
+  uint64_t msg_len;
+}
+Hacl_Chacha20Poly1305_Streaming_state;
+
+void
+Hacl_Chacha20Poly1305_Streaming_init(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *k1,
+  uint8_t *n1
+);
+
+void
+Hacl_Chacha20Poly1305_Streaming_aad(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *aad1,
+  uint64_t len
+);
+
+void
+Hacl_Chacha20Poly1305_Streaming_encrypt_update(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *c,
+  uint8_t *m,
+  uint64_t len
+);
+
+/* Writes the 16-byte tag */
+void
+Hacl_Chacha20Poly1305_Streaming_encrypt_finish(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *mac
+);
+
+void
+Hacl_Chacha20Poly1305_Streaming_decrypt_update(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *m,
+  uint8_t *c,
+  uint64_t len
+);
+
+/* Compares the tag with mac in constant time: 0 if they match, 1 otherwise */
+uint32_t
+Hacl_Chacha20Poly1305_Streaming_decrypt_finish(
+  Hacl_Chacha20Poly1305_Streaming_state *ctx,
+  uint8_t *mac
+);
+
+/* Zeroes the whole context */
+void Hacl_Chacha20Poly1305_Streaming_wipe(Hacl_Chacha20Poly1305_Streaming_state *ctx);
+
+#endif
@@ -0,0 +1,212 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* AVX2 code whatever the global compiler flags: Hacl_Dispatch checks for
+   AVX2 and for OS support of the YMM state before selecting it */
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__i386__) || defined(__x86_64__))
+#pragma GCC target("avx2")
+#endif
+
+#include "kremlib.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "vec256.h"
+#include "Hacl_Util.h"
+
+#if defined(VEC256)
+
+inline static void
+Hacl_Impl_Chacha20_Vec256_state_setup(vec256 *st, uint8_t *k, uint8_t *n1, uint32_t c)
+{
+  uint32_t n0 = load32_le(n1);
+  uint32_t n10 = load32_le(n1 + 4U);
+  uint32_t n2 = load32_le(n1 + 8U);
+  st[0U] = vec256_load_32x4(0x61707865U, 0x3320646eU, 0x79622d32U, 0x6b206574U);
+  st[1U] = vec256_load128_le(k);
+  st[2U] = vec256_load128_le(k + 16U);
+  st[3U] = vec256_load_32x8(c, n0, n10, n2, c + 1U, n0, n10, n2);
+}
+
+inline static void Hacl_Impl_Chacha20_Vec256_round(vec256 *st)
+{
+  st[0U] = vec256_add(st[0U], st[1U]);
+  st[3U] = vec256_rotate_left(vec256_xor(st[3U], st[0U]), 16U);
+  st[2U] = vec256_add(st[2U], st[3U]);
+  st[1U] = vec256_rotate_left(vec256_xor(st[1U], st[2U]), 12U);
+  st[0U] = vec256_add(st[0U], st[1U]);
+  st[3U] = vec256_rotate_left(vec256_xor(st[3U], st[0U]), 8U);
+  st[2U] = vec256_add(st[2U], st[3U]);
+  st[1U] = vec256_rotate_left(vec256_xor(st[1U], st[2U]), 7U);
+}
+
+inline static void Hacl_Impl_Chacha20_Vec256_double_round(vec256 *st)
+{
+  Hacl_Impl_Chacha20_Vec256_round(st);
+  st[1U] = vec256_shuffle_right(st[1U], 1U);
+  st[2U] = vec256_shuffle_right(st[2U], 2U);
+  st[3U] = vec256_shuffle_right(st[3U], 3U);
+  Hacl_Impl_Chacha20_Vec256_round(st);
+  st[1U] = vec256_shuffle_right(st[1U], 3U);
+  st[2U] = vec256_shuffle_right(st[2U], 2U);
+  st[3U] = vec256_shuffle_right(st[3U], 1U);
+}
+
+/* k[4 * j .. 4 * j + 3] = state of blocks 2j, 2j + 1 after the 20 rounds and
+   the feed-forward, for j < n; st is advanced by 2n blocks */
+inline static void Hacl_Impl_Chacha20_Vec256_chacha20_core(vec256 *k, vec256 *st, uint32_t n)
+{
+  for (uint32_t j = 0U; j < n; j++) {
+    memcpy(k + 4U * j, st, 4U * sizeof st[0U]);
+    k[4U * j + 3U] = vec256_add_counter(st[3U], 2U * j);
+  }
+  for (uint32_t i = 0U; i < 10U; i++)
+    for (uint32_t j = 0U; j < n; j++)
+      Hacl_Impl_Chacha20_Vec256_double_round(k + 4U * j);
+  for (uint32_t j = 0U; j < n; j++) {
+    for (uint32_t r = 0U; r < 3U; r++)
+      k[4U * j + r] = vec256_add(k[4U * j + r], st[r]);
+    k[4U * j + 3U] = vec256_add(k[4U * j + 3U], vec256_add_counter(st[3U], 2U * j));
+  }
+  st[3U] = vec256_add_counter(st[3U], 2U * n);
+}
+
+/* Reorders the rows of a state into the 128-byte keystream of its two blocks */
+inline static void Hacl_Impl_Chacha20_Vec256_state_to_key(vec256 *k)
+{
+  vec256 k0 = k[0U];
+  vec256 k1 = k[1U];
+  vec256 k2 = k[2U];
+  vec256 k3 = k[3U];
+  k[0U] = vec256_choose_128(k0, k1, 0U, 2U);
+  k[1U] = vec256_choose_128(k2, k3, 0U, 2U);
+  k[2U] = vec256_choose_128(k0, k1, 1U, 3U);
+  k[3U] = vec256_choose_128(k2, k3, 1U, 3U);
+}
+
+inline static void Hacl_Impl_Chacha20_Vec256_xor_block2(uint8_t *output, uint8_t *plain, vec256 *k)
+{
+  Hacl_Impl_Chacha20_Vec256_state_to_key(k);
+  for (uint32_t i = 0U; i < 4U; i++)
+    vec256_store_le(output + 32U * i, vec256_xor(vec256_load_le(plain + 32U * i), k[i]));
+}
+
+static void Hacl_Impl_Chacha20_Vec256_update8(uint8_t *output, uint8_t *plain, vec256 *st)
+{
+  vec256 k[16U];
+  Hacl_Impl_Chacha20_Vec256_chacha20_core(k, st, 4U);
+  for (uint32_t j = 0U; j < 4U; j++)
+    Hacl_Impl_Chacha20_Vec256_xor_block2(output + 128U * j, plain + 128U * j, k + 4U * j);
+}
+
+static void Hacl_Impl_Chacha20_Vec256_update2(uint8_t *output, uint8_t *plain, vec256 *st)
+{
+  vec256 k[4U];
+  Hacl_Impl_Chacha20_Vec256_chacha20_core(k, st, 1U);
+  Hacl_Impl_Chacha20_Vec256_xor_block2(output, plain, k);
+}
+
+/* Fewer than two blocks left: one state, keystream through a buffer */
+static void
+Hacl_Impl_Chacha20_Vec256_update_last(uint8_t *output, uint8_t *plain, uint32_t len, vec256 *st)
+{
+  uint8_t block[32U];
+  vec256 k[4U];
+  uint32_t full = len / 32U;
+  Hacl_Impl_Chacha20_Vec256_chacha20_core(k, st, 1U);
+  Hacl_Impl_Chacha20_Vec256_state_to_key(k);
+  for (uint32_t i = 0U; i < full; i++)
+    vec256_store_le(output + 32U * i, vec256_xor(vec256_load_le(plain + 32U * i), k[i]));
+  if (len % 32U > 0U)
+  {
+    vec256_store_le(block, k[full]);
+    for (uint32_t i = 32U * full; i < len; i++)
+      output[i] = plain[i] ^ block[i - 32U * full];
+    Hacl_Util_wipe(block, 32U);
+  }
+}
+
+static void
+Hacl_Impl_Chacha20_Vec256_chacha20_counter_mode(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  vec256 *st
+)
+{
+  uint32_t len8 = len / 512U;
+  uint32_t rest = len % 512U;
+  for (uint32_t i = 0U; i < len8; i++)
+    Hacl_Impl_Chacha20_Vec256_update8(output + 512U * i, plain + 512U * i, st);
+  output = output + 512U * len8;
+  plain = plain + 512U * len8;
+  if (rest > 256U)
+  {
+    /* A single state is latency-bound: past two of its passes, the four
+       interleaved states of update8 cost less, even through a buffer */
+    uint8_t block[512U];
+    memcpy(block, plain, rest);
+    Hacl_Impl_Chacha20_Vec256_update8(block, block, st);
+    memcpy(output, block, rest);
+    Hacl_Util_wipe(block, 512U);
+    return;
+  }
+  for (; rest >= 128U; rest -= 128U) {
+    Hacl_Impl_Chacha20_Vec256_update2(output, plain, st);
+    output = output + 128U;
+    plain = plain + 128U;
+  }
+  if (rest > 0U)
+    Hacl_Impl_Chacha20_Vec256_update_last(output, plain, rest, st);
+}
+
+void
+Hacl_Chacha20_Vec256_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  vec256 st[4U];
+  Hacl_Impl_Chacha20_Vec256_state_setup(st, k, n1, ctr);
+  Hacl_Impl_Chacha20_Vec256_chacha20_counter_mode(output, plain, len, st);
+}
+
+#else
+
+void
+Hacl_Chacha20_Vec256_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  Hacl_Chacha20_Vec128_chacha20(output, plain, len, k, n1, ctr);
+}
+
+#endif
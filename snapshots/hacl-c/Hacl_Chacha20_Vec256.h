@@ -0,0 +1,55 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20_Vec256_H
+#define __Hacl_Chacha20_Vec256_H
+
+#include <inttypes.h>
+
+/* ChaCha20 with 256-bit vectors (unverified), promoted from the
+ * experimental vec256 / Hacl.Impl.Chacha20_state256 code.
+ *
+ * Each state row holds two consecutive blocks, and four states are kept in
+ * flight, so the main loop produces 8 blocks (512 bytes) per iteration.
+ * A remainder of more than 256 bytes gets one more such iteration through
+ * a buffer; shorter ones go through a single state, pair of blocks by pair
+ * of blocks, and a final partial block is XORed from a stored keystream.
+ * Both buffers are wiped after use. Same interface, counter and nonce
+ * semantics as Hacl_Chacha20_Vec128_chacha20 (RFC 7539: 32-bit block
+ * counter, 96-bit nonce).
+ *
+ * GCC builds for x86 always compile this code for AVX2, so callers must
+ * check the CPU first; Hacl_Dispatch_chacha20 does. Other compilers fall
+ * back to Hacl_Chacha20_Vec128_chacha20 unless they target AVX2. */
+
+void
+Hacl_Chacha20_Vec256_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+);
+
+#endif
@@ -0,0 +1,157 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Built for AVX-512F whatever -march says. The sub-1 KiB tail runs the
+   Vec256 code, which carries its own AVX2 target. */
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__i386__) || defined(__x86_64__))
+#pragma GCC target("avx512f")
+#endif
+
+#include "kremlib.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "vec512.h"
+
+#if defined(VEC512)
+
+/* Row 3 holds the base counter in every lane; the per-lane offsets are
+   added by vec512_add_counter when a state is instantiated */
+inline static void
+Hacl_Impl_Chacha20_Vec512_state_setup(vec512 *st, uint8_t *k, uint8_t *n1, uint32_t c)
+{
+  st[0U] = vec512_load_32x4(0x61707865U, 0x3320646eU, 0x79622d32U, 0x6b206574U);
+  st[1U] = vec512_load128_le(k);
+  st[2U] = vec512_load128_le(k + 16U);
+  st[3U] = vec512_load_32x4(c, load32_le(n1), load32_le(n1 + 4U), load32_le(n1 + 8U));
+}
+
+inline static void Hacl_Impl_Chacha20_Vec512_round(vec512 *st)
+{
+  st[0U] = vec512_add(st[0U], st[1U]);
+  st[3U] = vec512_rotate_left(vec512_xor(st[3U], st[0U]), 16U);
+  st[2U] = vec512_add(st[2U], st[3U]);
+  st[1U] = vec512_rotate_left(vec512_xor(st[1U], st[2U]), 12U);
+  st[0U] = vec512_add(st[0U], st[1U]);
+  st[3U] = vec512_rotate_left(vec512_xor(st[3U], st[0U]), 8U);
+  st[2U] = vec512_add(st[2U], st[3U]);
+  st[1U] = vec512_rotate_left(vec512_xor(st[1U], st[2U]), 7U);
+}
+
+inline static void Hacl_Impl_Chacha20_Vec512_double_round(vec512 *st)
+{
+  Hacl_Impl_Chacha20_Vec512_round(st);
+  st[1U] = vec512_shuffle_right(st[1U], 1U);
+  st[2U] = vec512_shuffle_right(st[2U], 2U);
+  st[3U] = vec512_shuffle_right(st[3U], 3U);
+  Hacl_Impl_Chacha20_Vec512_round(st);
+  st[1U] = vec512_shuffle_right(st[1U], 3U);
+  st[2U] = vec512_shuffle_right(st[2U], 2U);
+  st[3U] = vec512_shuffle_right(st[3U], 1U);
+}
+
+/* k[4 * j .. 4 * j + 3] = state of blocks 4j .. 4j + 3 after the 20 rounds
+   and the feed-forward, for j < 4; st is advanced by 16 blocks */
+inline static void Hacl_Impl_Chacha20_Vec512_chacha20_core(vec512 *k, vec512 *st)
+{
+  for (uint32_t j = 0U; j < 4U; j++) {
+    memcpy(k + 4U * j, st, 3U * sizeof st[0U]);
+    k[4U * j + 3U] = vec512_add_counter(st[3U], 4U * j);
+  }
+  for (uint32_t i = 0U; i < 10U; i++)
+    for (uint32_t j = 0U; j < 4U; j++)
+      Hacl_Impl_Chacha20_Vec512_double_round(k + 4U * j);
+  for (uint32_t j = 0U; j < 4U; j++) {
+    for (uint32_t r = 0U; r < 3U; r++)
+      k[4U * j + r] = vec512_add(k[4U * j + r], st[r]);
+    k[4U * j + 3U] = vec512_add(k[4U * j + 3U], vec512_add_counter(st[3U], 4U * j));
+  }
+  st[3U] = vec512_add(st[3U], vec512_load_32x4(16U, 0U, 0U, 0U));
+}
+
+/* Transposes the rows of a state into the 256-byte keystream of its four
+   blocks */
+inline static void Hacl_Impl_Chacha20_Vec512_state_to_key(vec512 *k)
+{
+  vec512 t0 = vec512_choose_128(k[0U], k[1U], 0, 1, 0, 1);
+  vec512 t1 = vec512_choose_128(k[2U], k[3U], 0, 1, 0, 1);
+  vec512 t2 = vec512_choose_128(k[0U], k[1U], 2, 3, 2, 3);
+  vec512 t3 = vec512_choose_128(k[2U], k[3U], 2, 3, 2, 3);
+  k[0U] = vec512_choose_128(t0, t1, 0, 2, 0, 2);
+  k[1U] = vec512_choose_128(t0, t1, 1, 3, 1, 3);
+  k[2U] = vec512_choose_128(t2, t3, 0, 2, 0, 2);
+  k[3U] = vec512_choose_128(t2, t3, 1, 3, 1, 3);
+}
+
+static void Hacl_Impl_Chacha20_Vec512_update16(uint8_t *output, uint8_t *plain, vec512 *st)
+{
+  vec512 k[16U];
+  Hacl_Impl_Chacha20_Vec512_chacha20_core(k, st);
+  for (uint32_t j = 0U; j < 4U; j++) {
+    Hacl_Impl_Chacha20_Vec512_state_to_key(k + 4U * j);
+    for (uint32_t i = 0U; i < 4U; i++)
+      vec512_store_le(output + 256U * j + 64U * i,
+        vec512_xor(vec512_load_le(plain + 256U * j + 64U * i), k[4U * j + i]));
+  }
+}
+
+void
+Hacl_Chacha20_Vec512_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  vec512 st[4U];
+  uint32_t len16 = len / 1024U;
+  uint32_t rest = len % 1024U;
+  Hacl_Impl_Chacha20_Vec512_state_setup(st, k, n1, ctr);
+  for (uint32_t i = 0U; i < len16; i++)
+    Hacl_Impl_Chacha20_Vec512_update16(output + 1024U * i, plain + 1024U * i, st);
+  if (rest > 0U)
+    Hacl_Chacha20_Vec256_chacha20(output + 1024U * len16,
+      plain + 1024U * len16,
+      rest,
+      k,
+      n1,
+      ctr + 16U * len16);
+}
+
+#else
+
+void
+Hacl_Chacha20_Vec512_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  Hacl_Chacha20_Vec256_chacha20(output, plain, len, k, n1, ctr);
+}
+
+#endif
@@ -0,0 +1,53 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Chacha20_Vec512_H
+#define __Hacl_Chacha20_Vec512_H
+
+#include <inttypes.h>
+
+/* ChaCha20 with 512-bit vectors (unverified).
+ *
+ * Each state row holds four consecutive blocks and four states are kept in
+ * flight, so the main loop produces 16 blocks (1 KiB) per iteration, with
+ * rotations done by vprold. The remaining bytes (under 1 KiB) go through
+ * Hacl_Chacha20_Vec256_chacha20 at the right block counter, which itself
+ * covers the 8-block, 2-block and partial-block cases. Same interface,
+ * counter and nonce semantics as Hacl_Chacha20_Vec128_chacha20.
+ *
+ * As for Vec256, GCC builds for x86 always contain the AVX-512F code and
+ * the CPU check is left to the caller (Hacl_Dispatch_chacha20). Other
+ * compilers fall back to Hacl_Chacha20_Vec256_chacha20 unless they target
+ * AVX-512F. */
+
+void
+Hacl_Chacha20_Vec512_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+);
+
+#endif
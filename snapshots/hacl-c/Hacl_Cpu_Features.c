@@ -0,0 +1,121 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Hacl_Cpu_Features.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+
+#include "cpuid.h"
+
+/* XCR0: SSE and AVX state (YMM), plus opmask and upper ZMM state for AVX-512 */
+#define HACL_CPU_FEATURES_XCR0_YMM 0x06U
+#define HACL_CPU_FEATURES_XCR0_ZMM 0xe6U
+
+static uint32_t Hacl_Cpu_Features_xcr0(void)
+{
+  uint32_t eax;
+  uint32_t edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0U));
+  (void)edx;
+  return eax;
+}
+
+static uint32_t Hacl_Cpu_Features_probe(void)
+{
+  cpuid_t info;
+  uint32_t features = 0U;
+  uint32_t ecx1;
+  uint32_t ebx7 = 0U;
+  uint32_t xcr0 = 0U;
+#ifdef __i386__
+  if (!_have_cpuid())
+    return 0U;
+#endif
+  cpuid(&info, 0, 0);
+  if (info.eax < 1U)
+    return 0U;
+  if (info.eax >= 7U) {
+    cpuid(&info, 7, 0);
+    ebx7 = info.ebx;
+  }
+  cpuid(&info, 1, 0);
+  ecx1 = info.ecx;
+  /* OSXSAVE: CPUID.1:ECX[27] */
+  if (ecx1 & (1U << 27))
+    xcr0 = Hacl_Cpu_Features_xcr0();
+  /* SSSE3: CPUID.1:ECX[9], SSE4.1: CPUID.1:ECX[19], AVX: CPUID.1:ECX[28] */
+  if (ecx1 & (1U << 9))
+    features |= HACL_CPU_SSSE3;
+  if (ecx1 & (1U << 19))
+    features |= HACL_CPU_SSE41;
+  if ((xcr0 & HACL_CPU_FEATURES_XCR0_YMM) == HACL_CPU_FEATURES_XCR0_YMM) {
+    if (ecx1 & (1U << 28))
+      features |= HACL_CPU_AVX;
+    /* AVX2: CPUID.7.0:EBX[5] */
+    if ((features & HACL_CPU_AVX) && (ebx7 & (1U << 5)))
+      features |= HACL_CPU_AVX2;
+  }
+  /* AVX512F: CPUID.7.0:EBX[16], AVX512VL: CPUID.7.0:EBX[31] */
+  if ((xcr0 & HACL_CPU_FEATURES_XCR0_ZMM) == HACL_CPU_FEATURES_XCR0_ZMM && (features & HACL_CPU_AVX2)) {
+    if (ebx7 & (1U << 16))
+      features |= HACL_CPU_AVX512F;
+    if ((features & HACL_CPU_AVX512F) && (ebx7 & (1U << 31)))
+      features |= HACL_CPU_AVX512VL;
+  }
+  /* SHA: CPUID.7.0:EBX[29], BMI2: CPUID.7.0:EBX[8], ADX: CPUID.7.0:EBX[19] */
+  if (ebx7 & (1U << 29))
+    features |= HACL_CPU_SHA;
+  if (ebx7 & (1U << 8))
+    features |= HACL_CPU_BMI2;
+  if (ebx7 & (1U << 19))
+    features |= HACL_CPU_ADX;
+  return features;
+}
+
+/* -1 until probed. Threads may probe concurrently: they all store the same
+   value, with relaxed atomics. */
+static int32_t Hacl_Cpu_Features_cached = -1;
+
+uint32_t Hacl_Cpu_Features_get(void)
+{
+  int32_t features = __atomic_load_n(&Hacl_Cpu_Features_cached, __ATOMIC_RELAXED);
+  if (features == -1) {
+    features = (int32_t)Hacl_Cpu_Features_probe();
+    __atomic_store_n(&Hacl_Cpu_Features_cached, features, __ATOMIC_RELAXED);
+  }
+  return (uint32_t)features;
+}
+
+#else
+
+uint32_t Hacl_Cpu_Features_get(void)
+{
+  return 0U;
+}
+
+#endif
+
+bool Hacl_Cpu_Features_has(uint32_t required)
+{
+  return (Hacl_Cpu_Features_get() & required) == required;
+}
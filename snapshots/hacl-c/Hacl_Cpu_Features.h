@@ -0,0 +1,56 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Cpu_Features_H
+#define __Hacl_Cpu_Features_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* CPU feature detection (unverified).
+ *
+ * The CPU is probed once per process (CPUID, and XGETBV for the register
+ * state the OS saves) and every runtime-selected backend checks its
+ * requirements here. This file only depends on cpuid.c, so a module can
+ * test for its instructions without linking Hacl_Dispatch and the backends
+ * it references. */
+
+/* Feature bits. AVX, AVX2 and the AVX-512 bits are only reported if the OS
+   saves the wider registers. */
+#define HACL_CPU_SSSE3    (1U << 0)
+#define HACL_CPU_SSE41    (1U << 1)
+#define HACL_CPU_AVX      (1U << 2)
+#define HACL_CPU_AVX2     (1U << 3)
+#define HACL_CPU_AVX512F  (1U << 4)
+#define HACL_CPU_AVX512VL (1U << 5)
+#define HACL_CPU_SHA      (1U << 6)
+#define HACL_CPU_BMI2     (1U << 7)
+#define HACL_CPU_ADX      (1U << 8)
+
+/* Features of the running CPU (0 on non-x86 targets) */
+uint32_t Hacl_Cpu_Features_get(void);
+
+/* True if the running CPU has every feature in required */
+bool Hacl_Cpu_Features_has(uint32_t required);
+
+#endif
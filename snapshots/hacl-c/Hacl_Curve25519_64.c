@@ -0,0 +1,532 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Curve25519.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+
+#include "Hacl_Cpu_Features.h"
+
+/* Cleared by Hacl_Dispatch_curve25519_set to force the 5x51-bit code */
+static int Hacl_Curve25519_64_enabled = 1;
+
+bool Hacl_Curve25519_64_is_supported(void)
+{
+  return __atomic_load_n(&Hacl_Curve25519_64_enabled, __ATOMIC_RELAXED)
+    && Hacl_Cpu_Features_has(HACL_CPU_BMI2 | HACL_CPU_ADX);
+}
+
+void Hacl_Curve25519_64_set_enabled(bool enabled)
+{
+  __atomic_store_n(&Hacl_Curve25519_64_enabled, enabled ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+/* Field arithmetic modulo p = 2^255 - 19 on four 64-bit words. Inputs and
+   outputs are below 2^256; 2^256 = 38 mod p folds the high words back. */
+
+/* out = a + b */
+inline static void Hacl_Impl_Curve25519_64_fadd(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  __asm__ volatile(
+    "movq 0(%1), %%r8\n\t"
+    "addq 0(%2), %%r8\n\t"
+    "movq 8(%1), %%r9\n\t"
+    "adcq 8(%2), %%r9\n\t"
+    "movq 16(%1), %%r10\n\t"
+    "adcq 16(%2), %%r10\n\t"
+    "movq 24(%1), %%r11\n\t"
+    "adcq 24(%2), %%r11\n\t"
+    /* A carry out is worth 38 */
+    "movl $0, %%eax\n\t"
+    "movl $38, %%edx\n\t"
+    "cmovcq %%rdx, %%rax\n\t"
+    "addq %%rax, %%r8\n\t"
+    "adcq $0, %%r9\n\t"
+    "adcq $0, %%r10\n\t"
+    "adcq $0, %%r11\n\t"
+    /* If it carries again, the low word is small enough to absorb 38 */
+    "movl $0, %%eax\n\t"
+    "cmovcq %%rdx, %%rax\n\t"
+    "addq %%rax, %%r8\n\t"
+    "movq %%r8, 0(%0)\n\t"
+    "movq %%r9, 8(%0)\n\t"
+    "movq %%r10, 16(%0)\n\t"
+    "movq %%r11, 24(%0)\n\t"
+    :
+    : "r" (out), "r" (a), "r" (b)
+    : "memory", "cc", "rax", "rdx", "r8", "r9", "r10", "r11");
+}
+
+/* out = a - b */
+inline static void Hacl_Impl_Curve25519_64_fsub(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  __asm__ volatile(
+    "movq 0(%1), %%r8\n\t"
+    "subq 0(%2), %%r8\n\t"
+    "movq 8(%1), %%r9\n\t"
+    "sbbq 8(%2), %%r9\n\t"
+    "movq 16(%1), %%r10\n\t"
+    "sbbq 16(%2), %%r10\n\t"
+    "movq 24(%1), %%r11\n\t"
+    "sbbq 24(%2), %%r11\n\t"
+    /* A borrow added 2^256, i.e. 38 too much */
+    "movl $0, %%eax\n\t"
+    "movl $38, %%edx\n\t"
+    "cmovcq %%rdx, %%rax\n\t"
+    "subq %%rax, %%r8\n\t"
+    "sbbq $0, %%r9\n\t"
+    "sbbq $0, %%r10\n\t"
+    "sbbq $0, %%r11\n\t"
+    "movl $0, %%eax\n\t"
+    "cmovcq %%rdx, %%rax\n\t"
+    "subq %%rax, %%r8\n\t"
+    "movq %%r8, 0(%0)\n\t"
+    "movq %%r9, 8(%0)\n\t"
+    "movq %%r10, 16(%0)\n\t"
+    "movq %%r11, 24(%0)\n\t"
+    :
+    : "r" (out), "r" (a), "r" (b)
+    : "memory", "cc", "rax", "rdx", "r8", "r9", "r10", "r11");
+}
+
+/* out = a * 121665 + b, with 121665 = (A - 2) / 4 the ladder constant */
+inline static void
+Hacl_Impl_Curve25519_64_fmul_a24_add(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  __asm__ volatile(
+    "movl $121665, %%edx\n\t"
+    "mulxq 0(%1), %%r8, %%rcx\n\t"
+    "mulxq 8(%1), %%r9, %%rax\n\t"
+    "addq %%rcx, %%r9\n\t"
+    "mulxq 16(%1), %%r10, %%rcx\n\t"
+    "adcq %%rax, %%r10\n\t"
+    "mulxq 24(%1), %%r11, %%rax\n\t"
+    "adcq %%rcx, %%r11\n\t"
+    "adcq $0, %%rax\n\t"
+    "addq 0(%2), %%r8\n\t"
+    "adcq 8(%2), %%r9\n\t"
+    "adcq 16(%2), %%r10\n\t"
+    "adcq 24(%2), %%r11\n\t"
+    "adcq $0, %%rax\n\t"
+    "imulq $38, %%rax, %%rax\n\t"
+    "addq %%rax, %%r8\n\t"
+    "adcq $0, %%r9\n\t"
+    "adcq $0, %%r10\n\t"
+    "adcq $0, %%r11\n\t"
+    "movl $0, %%eax\n\t"
+    "movl $38, %%edx\n\t"
+    "cmovcq %%rdx, %%rax\n\t"
+    "addq %%rax, %%r8\n\t"
+    "movq %%r8, 0(%0)\n\t"
+    "movq %%r9, 8(%0)\n\t"
+    "movq %%r10, 16(%0)\n\t"
+    "movq %%r11, 24(%0)\n\t"
+    :
+    : "r" (out), "r" (a), "r" (b)
+    : "memory", "cc", "rax", "rcx", "rdx", "r8", "r9", "r10", "r11");
+}
+
+/* Reduces the 512-bit product t[0..7] into out, as t[0..3] + 38 * t[4..7],
+   with t[0..2] in tmp[0..2] and t[3..7] in registers. The two carry chains
+   add the low and high halves of the 38 * t[4 + i] products; what spills
+   over 2^256 (at most 39) is folded once more. x and y are scratch. */
+#define HACL_CURVE25519_64_REDUCE(t3, t4, t5, t6, t7, x, y)                    \
+  "movl $38, %%edx\n\t"                                                        \
+  "xorl %%eax, %%eax\n\t"                                                      \
+  "mulxq " t4 ", " x ", " y "\n\t"                                             \
+  "adcxq 0(%3), " x "\n\t"                                                     \
+  "mulxq " t5 ", " t4 ", " t5 "\n\t"                                           \
+  "adcxq 8(%3), " t4 "\n\t"                                                    \
+  "adoxq " y ", " t4 "\n\t"                                                    \
+  "mulxq " t6 ", " y ", " t6 "\n\t"                                            \
+  "adcxq 16(%3), " y "\n\t"                                                    \
+  "adoxq " t5 ", " y "\n\t"                                                    \
+  "mulxq " t7 ", " t5 ", " t7 "\n\t"                                           \
+  "adcxq " t5 ", " t3 "\n\t"                                                   \
+  "adoxq " t6 ", " t3 "\n\t"                                                   \
+  "adcxq %%rax, " t7 "\n\t"                                                    \
+  "adoxq %%rax, " t7 "\n\t"                                                    \
+  "imulq $38, " t7 ", " t7 "\n\t"                                              \
+  "addq " t7 ", " x "\n\t"                                                     \
+  "adcq %%rax, " t4 "\n\t"                                                     \
+  "adcq %%rax, " y "\n\t"                                                      \
+  "adcq %%rax, " t3 "\n\t"                                                     \
+  "cmovcq %%rdx, %%rax\n\t"                                                    \
+  "addq %%rax, " x "\n\t"                                                      \
+  "movq " x ", 0(%0)\n\t"                                                      \
+  "movq " t4 ", 8(%0)\n\t"                                                     \
+  "movq " y ", 16(%0)\n\t"                                                     \
+  "movq " t3 ", 24(%0)\n\t"
+
+/* Accumulates the row a[i] * b into the running sum t[i..i+4]: ADCX adds
+   the low halves of the products and ADOX the high halves, one word up.
+   The top word t[i+4] is fresh, and receives both final carries. */
+#define HACL_CURVE25519_64_MUL_ROW(off, t0, t1, t2, t3, t4)                    \
+  "movq " #off "(%1), %%rdx\n\t"                                               \
+  "xorl %%eax, %%eax\n\t"                                                      \
+  "mulxq 0(%2), %%r13, %%r14\n\t"                                              \
+  "adcxq %%r13, " t0 "\n\t"                                                    \
+  "adoxq %%r14, " t1 "\n\t"                                                    \
+  "mulxq 8(%2), %%r13, %%r14\n\t"                                              \
+  "adcxq %%r13, " t1 "\n\t"                                                    \
+  "adoxq %%r14, " t2 "\n\t"                                                    \
+  "mulxq 16(%2), %%r13, %%r14\n\t"                                             \
+  "adcxq %%r13, " t2 "\n\t"                                                    \
+  "adoxq %%r14, " t3 "\n\t"                                                    \
+  "mulxq 24(%2), %%r13, " t4 "\n\t"                                            \
+  "adcxq %%r13, " t3 "\n\t"                                                    \
+  "adoxq %%rax, " t4 "\n\t"                                                    \
+  "adcxq %%rax, " t4 "\n\t"
+
+/* out = a * b, with tmp a 3-word scratch buffer */
+inline static void
+Hacl_Impl_Curve25519_64_fmul(uint64_t *out, const uint64_t *a, const uint64_t *b, uint64_t *tmp)
+{
+  __asm__ volatile(
+    /* Row 0 starts the sum t[0..4] in r8, r9, r10, r11, r12 */
+    "movq 0(%1), %%rdx\n\t"
+    "mulxq 0(%2), %%r8, %%r9\n\t"
+    "mulxq 8(%2), %%r13, %%r10\n\t"
+    "addq %%r13, %%r9\n\t"
+    "mulxq 16(%2), %%r13, %%r11\n\t"
+    "adcq %%r13, %%r10\n\t"
+    "mulxq 24(%2), %%r13, %%r12\n\t"
+    "adcq %%r13, %%r11\n\t"
+    "adcq $0, %%r12\n\t"
+    "movq %%r8, 0(%3)\n\t"
+    /* Each row completes one more word, whose register holds the new top */
+    HACL_CURVE25519_64_MUL_ROW(8, "%%r9", "%%r10", "%%r11", "%%r12", "%%r8")
+    "movq %%r9, 8(%3)\n\t"
+    HACL_CURVE25519_64_MUL_ROW(16, "%%r10", "%%r11", "%%r12", "%%r8", "%%r9")
+    "movq %%r10, 16(%3)\n\t"
+    HACL_CURVE25519_64_MUL_ROW(24, "%%r11", "%%r12", "%%r8", "%%r9", "%%r10")
+    HACL_CURVE25519_64_REDUCE("%%r11", "%%r12", "%%r8", "%%r9", "%%r10", "%%r13", "%%r14")
+    :
+    : "r" (out), "r" (a), "r" (b), "r" (tmp)
+    : "memory", "cc", "rax", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14");
+}
+
+/* out = a * a, with tmp a 3-word scratch buffer. The six cross products
+   a[i] * a[j] (i < j) are summed once and doubled, then the squares a[i]^2
+   are added on the diagonal. */
+inline static void Hacl_Impl_Curve25519_64_fsqr(uint64_t *out, const uint64_t *a, uint64_t *tmp)
+{
+  __asm__ volatile(
+    /* a[0] * a[1..3] into t[1..4] = r9, r10, r11, r12 */
+    "movq 0(%1), %%rdx\n\t"
+    "mulxq 8(%1), %%r9, %%r10\n\t"
+    "mulxq 16(%1), %%r13, %%r11\n\t"
+    "addq %%r13, %%r10\n\t"
+    "mulxq 24(%1), %%r13, %%r12\n\t"
+    "adcq %%r13, %%r11\n\t"
+    "adcq $0, %%r12\n\t"
+    /* a[1] * a[2..3] into t[3..5], t[5] = r8 */
+    "movq 8(%1), %%rdx\n\t"
+    "xorl %%eax, %%eax\n\t"
+    "mulxq 16(%1), %%r13, %%r14\n\t"
+    "adcxq %%r13, %%r11\n\t"
+    "adoxq %%r14, %%r12\n\t"
+    "mulxq 24(%1), %%r13, %%r8\n\t"
+    "adcxq %%r13, %%r12\n\t"
+    "adoxq %%rax, %%r8\n\t"
+    "adcxq %%rax, %%r8\n\t"
+    /* a[2] * a[3] into t[5..6], t[6] = r14 */
+    "movq 16(%1), %%rdx\n\t"
+    "mulxq 24(%1), %%r13, %%r14\n\t"
+    "addq %%r13, %%r8\n\t"
+    "adcq $0, %%r14\n\t"
+    /* Double t[1..6] into t[1..7], t[7] = r15 */
+    "xorl %%r15d, %%r15d\n\t"
+    "addq %%r9, %%r9\n\t"
+    "adcq %%r10, %%r10\n\t"
+    "adcq %%r11, %%r11\n\t"
+    "adcq %%r12, %%r12\n\t"
+    "adcq %%r8, %%r8\n\t"
+    "adcq %%r14, %%r14\n\t"
+    "adcq $0, %%r15\n\t"
+    /* Add the squares, carrying along t[0..7] */
+    "movq 0(%1), %%rdx\n\t"
+    "mulxq %%rdx, %%rax, %%r13\n\t"
+    "movq %%rax, 0(%3)\n\t"
+    "addq %%r13, %%r9\n\t"
+    "movq %%r9, 8(%3)\n\t"
+    "movq 8(%1), %%rdx\n\t"
+    "mulxq %%rdx, %%rax, %%r13\n\t"
+    "adcq %%rax, %%r10\n\t"
+    "movq %%r10, 16(%3)\n\t"
+    "adcq %%r13, %%r11\n\t"
+    "movq 16(%1), %%rdx\n\t"
+    "mulxq %%rdx, %%rax, %%r13\n\t"
+    "adcq %%rax, %%r12\n\t"
+    "adcq %%r13, %%r8\n\t"
+    "movq 24(%1), %%rdx\n\t"
+    "mulxq %%rdx, %%rax, %%r13\n\t"
+    "adcq %%rax, %%r14\n\t"
+    "adcq %%r13, %%r15\n\t"
+    HACL_CURVE25519_64_REDUCE("%%r11", "%%r12", "%%r8", "%%r14", "%%r15", "%%r13", "%%r9")
+    :
+    : "r" (out), "r" (a), "i" (0), "r" (tmp)
+    : "memory", "cc", "rax", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15");
+}
+
+static void Hacl_Impl_Curve25519_64_fsqr_times(uint64_t *out, const uint64_t *a, uint32_t n, uint64_t *tmp)
+{
+  Hacl_Impl_Curve25519_64_fsqr(out, a, tmp);
+  for (uint32_t i = 1U; i < n; i++)
+    Hacl_Impl_Curve25519_64_fsqr(out, out, tmp);
+}
+
+/* out = z^(p - 2), with the addition chain of Hacl_Bignum_Crecip_crecip */
+static void Hacl_Impl_Curve25519_64_finv(uint64_t *out, const uint64_t *z)
+{
+  uint64_t tmp[8U];
+  uint64_t a[4U], b[4U], c[4U], t0[4U];
+  Hacl_Impl_Curve25519_64_fsqr(a, z, tmp);                  /* 2 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, a, 2U, tmp);       /* 8 */
+  Hacl_Impl_Curve25519_64_fmul(b, t0, z, tmp);              /* 9 */
+  Hacl_Impl_Curve25519_64_fmul(a, b, a, tmp);               /* 11 */
+  Hacl_Impl_Curve25519_64_fsqr(t0, a, tmp);                 /* 22 */
+  Hacl_Impl_Curve25519_64_fmul(b, t0, b, tmp);              /* 2^5 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, b, 5U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(b, t0, b, tmp);              /* 2^10 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, b, 10U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(c, t0, b, tmp);              /* 2^20 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, c, 20U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(t0, t0, c, tmp);             /* 2^40 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, t0, 10U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(b, t0, b, tmp);              /* 2^50 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, b, 50U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(c, t0, b, tmp);              /* 2^100 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, c, 100U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(t0, t0, c, tmp);             /* 2^200 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, t0, 50U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(t0, t0, b, tmp);             /* 2^250 - 2^0 */
+  Hacl_Impl_Curve25519_64_fsqr_times(t0, t0, 5U, tmp);
+  Hacl_Impl_Curve25519_64_fmul(out, t0, a, tmp);            /* 2^255 - 21 */
+}
+
+static void Hacl_Impl_Curve25519_64_fexpand(uint64_t *out, const uint8_t *b)
+{
+  out[0U] = load64_le((uint8_t *)b);
+  out[1U] = load64_le((uint8_t *)b + 8U);
+  out[2U] = load64_le((uint8_t *)b + 16U);
+  /* The top bit of u is ignored (RFC 7748, section 5) */
+  out[3U] = load64_le((uint8_t *)b + 24U) & (uint64_t)0x7fffffffffffffffU;
+}
+
+/* Encodes the representative of a below p, in constant time */
+static void Hacl_Impl_Curve25519_64_fcontract(uint8_t *b, const uint64_t *a)
+{
+  uint64_t r[4U], s[4U];
+  FStar_UInt128_t c;
+  /* Fold bit 255: r < 2^255 + 19 */
+  uint64_t top = a[3U] >> 63U;
+  c = (FStar_UInt128_t)a[0U] + top * 19U;
+  r[0U] = (uint64_t)c;
+  c = (FStar_UInt128_t)a[1U] + (uint64_t)(c >> 64U);
+  r[1U] = (uint64_t)c;
+  c = (FStar_UInt128_t)a[2U] + (uint64_t)(c >> 64U);
+  r[2U] = (uint64_t)c;
+  r[3U] = (a[3U] & (uint64_t)0x7fffffffffffffffU) + (uint64_t)(c >> 64U);
+  /* r >= p iff r + 19 reaches 2^255, in which case r - p = r + 19 - 2^255 */
+  c = (FStar_UInt128_t)r[0U] + 19U;
+  s[0U] = (uint64_t)c;
+  c = (FStar_UInt128_t)r[1U] + (uint64_t)(c >> 64U);
+  s[1U] = (uint64_t)c;
+  c = (FStar_UInt128_t)r[2U] + (uint64_t)(c >> 64U);
+  s[2U] = (uint64_t)c;
+  s[3U] = r[3U] + (uint64_t)(c >> 64U);
+  uint64_t mask = (uint64_t)0U - (s[3U] >> 63U);
+  s[3U] = s[3U] & (uint64_t)0x7fffffffffffffffU;
+  for (uint32_t i = 0U; i < 4U; i++)
+    store64_le(b + 8U * i, (s[i] & mask) | (r[i] & ~mask));
+}
+
+static void Hacl_Impl_Curve25519_64_cswap(uint64_t *p, uint64_t *q, uint64_t bit)
+{
+  uint64_t mask = (uint64_t)0U - bit;
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    uint64_t x = mask & (p[i] ^ q[i]);
+    p[i] = p[i] ^ x;
+    q[i] = q[i] ^ x;
+  }
+}
+
+/* One step of the Montgomery ladder (RFC 7748, section 5) on the projective
+   points p2 = (x2 : z2) and p3 = (x3 : z3), with x1 the affine input */
+static void
+Hacl_Impl_Curve25519_64_ladder_step(uint64_t *p2, uint64_t *p3, const uint64_t *x1, uint64_t *tmp)
+{
+  uint64_t *x2 = p2;
+  uint64_t *z2 = p2 + 4U;
+  uint64_t *x3 = p3;
+  uint64_t *z3 = p3 + 4U;
+  uint64_t a[4U], b[4U], c[4U], d[4U], aa[4U], bb[4U], e[4U];
+  Hacl_Impl_Curve25519_64_fadd(a, x2, z2);
+  Hacl_Impl_Curve25519_64_fsub(b, x2, z2);
+  Hacl_Impl_Curve25519_64_fadd(c, x3, z3);
+  Hacl_Impl_Curve25519_64_fsub(d, x3, z3);
+  Hacl_Impl_Curve25519_64_fmul(d, d, a, tmp);               /* DA */
+  Hacl_Impl_Curve25519_64_fmul(c, c, b, tmp);               /* CB */
+  Hacl_Impl_Curve25519_64_fsqr(aa, a, tmp);
+  Hacl_Impl_Curve25519_64_fsqr(bb, b, tmp);
+  Hacl_Impl_Curve25519_64_fadd(x3, d, c);
+  Hacl_Impl_Curve25519_64_fsqr(x3, x3, tmp);
+  Hacl_Impl_Curve25519_64_fsub(z3, d, c);
+  Hacl_Impl_Curve25519_64_fsqr(z3, z3, tmp);
+  Hacl_Impl_Curve25519_64_fmul(z3, z3, x1, tmp);
+  Hacl_Impl_Curve25519_64_fsub(e, aa, bb);
+  Hacl_Impl_Curve25519_64_fmul(x2, aa, bb, tmp);
+  Hacl_Impl_Curve25519_64_fmul_a24_add(z2, e, aa);
+  Hacl_Impl_Curve25519_64_fmul(z2, z2, e, tmp);
+}
+
+/* Runs the ladder for secret * basepoint, leaving the projective result
+   (x2 : z2) in p2 */
+static void Hacl_Impl_Curve25519_64_ladder(uint64_t *p2, uint8_t *secret, uint8_t *basepoint)
+{
+  uint8_t e[32U];
+  uint64_t x1[4U];
+  uint64_t p3[8U] = { 0U, 0U, 0U, 0U, 1U, 0U, 0U, 0U };
+  uint64_t tmp[8U];
+  uint64_t swap = 0U;
+  memset(p2, 0, 8U * sizeof p2[0U]);
+  p2[0U] = 1U;
+  memcpy(e, secret, 32U);
+  e[0U] = e[0U] & (uint8_t)248U;
+  e[31U] = (e[31U] & (uint8_t)127U) | (uint8_t)64U;
+  Hacl_Impl_Curve25519_64_fexpand(x1, basepoint);
+  memcpy(p3, x1, 4U * sizeof x1[0U]);
+  /* Bit 255 of the clamped scalar is 0 */
+  for (uint32_t i = 255U; i > 0U; i--)
+  {
+    uint32_t t = i - 1U;
+    uint64_t bit = (uint64_t)(e[t >> 3U] >> (t & 7U) & 1U);
+    Hacl_Impl_Curve25519_64_cswap(p2, p3, swap ^ bit);
+    swap = bit;
+    Hacl_Impl_Curve25519_64_ladder_step(p2, p3, x1, tmp);
+  }
+  Hacl_Impl_Curve25519_64_cswap(p2, p3, swap);
+}
+
+void Hacl_Curve25519_64_crypto_scalarmult(uint8_t *mypublic, uint8_t *secret, uint8_t *basepoint)
+{
+  uint64_t p2[8U];
+  uint64_t zinv[4U];
+  uint64_t tmp[8U];
+  Hacl_Impl_Curve25519_64_ladder(p2, secret, basepoint);
+  Hacl_Impl_Curve25519_64_finv(zinv, p2 + 4U);
+  Hacl_Impl_Curve25519_64_fmul(p2, p2, zinv, tmp);
+  Hacl_Impl_Curve25519_64_fcontract(mypublic, p2);
+}
+
+/* Replaces a point at infinity (z = 0 mod p) by (0 : 1), in constant time,
+   so that it does not zero the product of a batch; its x-coordinate is 0
+   either way */
+static void Hacl_Impl_Curve25519_64_fix_infinity(uint64_t *p)
+{
+  uint8_t z[32U];
+  uint64_t acc = 0U;
+  Hacl_Impl_Curve25519_64_fcontract(z, p + 4U);
+  for (uint32_t i = 0U; i < 32U; i++)
+    acc = acc | (uint64_t)z[i];
+  uint64_t is_zero = ((acc | ((uint64_t)0U - acc)) >> 63U) - 1U;
+  for (uint32_t i = 0U; i < 8U; i++)
+    p[i] = p[i] & ~is_zero;
+  p[4U] = p[4U] | (is_zero & 1U);
+}
+
+void
+Hacl_Curve25519_64_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+)
+{
+  uint64_t p[HACL_CURVE25519_64_BATCH][8U];
+  uint64_t prod[HACL_CURVE25519_64_BATCH][4U];
+  uint64_t inv[4U], zinv[4U];
+  uint64_t tmp[8U];
+  for (uint32_t off = 0U; off < n; off = off + HACL_CURVE25519_64_BATCH)
+  {
+    uint32_t len = n - off < HACL_CURVE25519_64_BATCH ? n - off : HACL_CURVE25519_64_BATCH;
+    for (uint32_t i = 0U; i < len; i++)
+    {
+      Hacl_Impl_Curve25519_64_ladder(p[i], secret[off + i], basepoint[off + i]);
+      Hacl_Impl_Curve25519_64_fix_infinity(p[i]);
+    }
+    /* Montgomery's trick: prod[i] = z_0 ... z_i, a single inversion of
+       prod[len - 1], then z_i^-1 = (z_0 ... z_i)^-1 * prod[i - 1] */
+    memcpy(prod[0U], p[0U] + 4U, 4U * sizeof inv[0U]);
+    for (uint32_t i = 1U; i < len; i++)
+      Hacl_Impl_Curve25519_64_fmul(prod[i], prod[i - 1U], p[i] + 4U, tmp);
+    Hacl_Impl_Curve25519_64_finv(inv, prod[len - 1U]);
+    for (uint32_t i = len - 1U; i > 0U; i--)
+    {
+      Hacl_Impl_Curve25519_64_fmul(zinv, inv, prod[i - 1U], tmp);
+      Hacl_Impl_Curve25519_64_fmul(inv, inv, p[i] + 4U, tmp);
+      Hacl_Impl_Curve25519_64_fmul(p[i], p[i], zinv, tmp);
+    }
+    Hacl_Impl_Curve25519_64_fmul(p[0U], p[0U], inv, tmp);
+    /* Outputs may alias inputs of this chunk: they are all consumed */
+    for (uint32_t i = 0U; i < len; i++)
+      Hacl_Impl_Curve25519_64_fcontract(mypublic[off + i], p[i]);
+  }
+}
+
+#else
+
+bool Hacl_Curve25519_64_is_supported(void)
+{
+  return false;
+}
+
+void Hacl_Curve25519_64_set_enabled(bool enabled)
+{
+  (void)enabled;
+}
+
+/* Only the x86-64 code has a radix-2^64 backend: elsewhere both entry
+   points run the 5x51-bit code */
+void Hacl_Curve25519_64_crypto_scalarmult(uint8_t *mypublic, uint8_t *secret, uint8_t *basepoint)
+{
+  Hacl_Curve25519_crypto_scalarmult(mypublic, secret, basepoint);
+}
+
+void
+Hacl_Curve25519_64_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+)
+{
+  for (uint32_t i = 0U; i < n; i++)
+    Hacl_Curve25519_crypto_scalarmult(mypublic[i], secret[i], basepoint[i]);
+}
+
+#endif
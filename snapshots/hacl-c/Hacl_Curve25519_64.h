@@ -0,0 +1,73 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Curve25519_64_H
+#define __Hacl_Curve25519_64_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* Curve25519 in radix 2^64 with MULX, ADCX and ADOX (unverified).
+ *
+ * Field elements are four 64-bit words, kept below 2^256 but only reduced
+ * modulo 2^255 - 19 when encoded. Products are computed with MULX and two
+ * independent carry chains (ADCX on CF, ADOX on OF), in x86-64 inline
+ * assembly that does not depend on compiler target options. Results are
+ * identical to the 5x51-bit code.
+ *
+ * The verified Hacl_Curve25519_crypto_scalarmult always runs the 5x51-bit
+ * code. Hacl_Dispatch_curve25519 selects this backend at runtime, after
+ * CPUID reports BMI2 and ADX support, and haclnacl, Hacl_Box_Cache and
+ * Hacl_Curve25519_Vec256 go through the same check. */
+
+/* True if the running CPU can execute this backend and it has not been
+   disabled */
+bool Hacl_Curve25519_64_is_supported(void);
+
+/* Disabling makes the dispatching callers above use the 5x51-bit code,
+   e.g. for benchmarking; see Hacl_Dispatch_curve25519_set */
+void Hacl_Curve25519_64_set_enabled(bool enabled);
+
+/* Same interface as Hacl_Curve25519_crypto_scalarmult. On x86-64, only
+   callable when Hacl_Curve25519_64_is_supported; on other targets, it runs
+   Hacl_Curve25519_crypto_scalarmult */
+void Hacl_Curve25519_64_crypto_scalarmult(uint8_t *mypublic, uint8_t *secret, uint8_t *basepoint);
+
+/* Operations that Hacl_Curve25519_64_scalarmult_batch shares one inversion
+   between */
+#define HACL_CURVE25519_64_BATCH 32U
+
+/* mypublic[i] = secret[i] * basepoint[i] for i < n. The ladders stop at
+   projective (x : z) and all the z are inverted together (Montgomery's
+   trick: one inversion and 3 (n - 1) multiplications per
+   HACL_CURVE25519_64_BATCH operations). Same restriction and fallback as
+   Hacl_Curve25519_64_crypto_scalarmult */
+void
+Hacl_Curve25519_64_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+);
+
+#endif
@@ -0,0 +1,355 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Curve25519_Base.h"
+
+#ifndef HACL_CURVE25519_BASE_SPACING
+#define HACL_CURVE25519_BASE_SPACING 2
+#endif
+
+#if HACL_CURVE25519_BASE_SPACING < 1 || HACL_CURVE25519_BASE_SPACING > 32 \
+  || 64 % HACL_CURVE25519_BASE_SPACING != 0
+#error "HACL_CURVE25519_BASE_SPACING must be a power of two between 1 and 32"
+#endif
+
+#include "Hacl_Curve25519_Base_Table.h"
+
+/* Field arithmetic modulo p = 2^255 - 19 on five 51-bit limbs. Additions
+   and subtractions are carried, so every limb stays below 2^52 and any
+   result can be fed to a multiplication. */
+
+#define HACL_CURVE25519_BASE_MASK51 ((uint64_t)0x7ffffffffffffU)
+
+static void Hacl_Impl_Curve25519_Base_fcarry(uint64_t *a)
+{
+  uint64_t c;
+  c = a[0U] >> 51U;
+  a[0U] = a[0U] & HACL_CURVE25519_BASE_MASK51;
+  a[1U] = a[1U] + c;
+  c = a[1U] >> 51U;
+  a[1U] = a[1U] & HACL_CURVE25519_BASE_MASK51;
+  a[2U] = a[2U] + c;
+  c = a[2U] >> 51U;
+  a[2U] = a[2U] & HACL_CURVE25519_BASE_MASK51;
+  a[3U] = a[3U] + c;
+  c = a[3U] >> 51U;
+  a[3U] = a[3U] & HACL_CURVE25519_BASE_MASK51;
+  a[4U] = a[4U] + c;
+  c = a[4U] >> 51U;
+  a[4U] = a[4U] & HACL_CURVE25519_BASE_MASK51;
+  a[0U] = a[0U] + c * (uint64_t)19U;
+}
+
+/* out = a + b */
+static void Hacl_Impl_Curve25519_Base_fadd(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i = i + (uint32_t)1U)
+    out[i] = a[i] + b[i];
+  Hacl_Impl_Curve25519_Base_fcarry(out);
+}
+
+/* out = a - b, computed as a + 4p - b */
+static void Hacl_Impl_Curve25519_Base_fsub(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  out[0U] = a[0U] + (uint64_t)0x1fffffffffffb4U - b[0U];
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)5U; i = i + (uint32_t)1U)
+    out[i] = a[i] + (uint64_t)0x1ffffffffffffcU - b[i];
+  Hacl_Impl_Curve25519_Base_fcarry(out);
+}
+
+static void Hacl_Impl_Curve25519_Base_fcarry_wide(uint64_t *out, FStar_UInt128_t *t)
+{
+  uint64_t c = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i = i + (uint32_t)1U)
+  {
+    FStar_UInt128_t ti = FStar_UInt128_add(t[i], FStar_UInt128_uint64_to_uint128(c));
+    out[i] = FStar_UInt128_uint128_to_uint64(ti) & HACL_CURVE25519_BASE_MASK51;
+    c = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(ti, (uint32_t)51U));
+  }
+  out[0U] = out[0U] + c * (uint64_t)19U;
+  out[1U] = out[1U] + (out[0U] >> 51U);
+  out[0U] = out[0U] & HACL_CURVE25519_BASE_MASK51;
+}
+
+inline static FStar_UInt128_t
+Hacl_Impl_Curve25519_Base_mac(FStar_UInt128_t acc, uint64_t a, uint64_t b)
+{
+  return FStar_UInt128_add(acc, FStar_UInt128_mul_wide(a, b));
+}
+
+/* out = a * b */
+static void Hacl_Impl_Curve25519_Base_fmul(uint64_t *out, const uint64_t *a, const uint64_t *b)
+{
+  uint64_t b1_19 = b[1U] * (uint64_t)19U;
+  uint64_t b2_19 = b[2U] * (uint64_t)19U;
+  uint64_t b3_19 = b[3U] * (uint64_t)19U;
+  uint64_t b4_19 = b[4U] * (uint64_t)19U;
+  FStar_UInt128_t t[5U];
+  t[0U] = FStar_UInt128_mul_wide(a[0U], b[0U]);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a[1U], b4_19);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a[2U], b3_19);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a[3U], b2_19);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a[4U], b1_19);
+  t[1U] = FStar_UInt128_mul_wide(a[0U], b[1U]);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a[1U], b[0U]);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a[2U], b4_19);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a[3U], b3_19);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a[4U], b2_19);
+  t[2U] = FStar_UInt128_mul_wide(a[0U], b[2U]);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a[1U], b[1U]);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a[2U], b[0U]);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a[3U], b4_19);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a[4U], b3_19);
+  t[3U] = FStar_UInt128_mul_wide(a[0U], b[3U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a[1U], b[2U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a[2U], b[1U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a[3U], b[0U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a[4U], b4_19);
+  t[4U] = FStar_UInt128_mul_wide(a[0U], b[4U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a[1U], b[3U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a[2U], b[2U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a[3U], b[1U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a[4U], b[0U]);
+  Hacl_Impl_Curve25519_Base_fcarry_wide(out, t);
+}
+
+/* out = a^2 */
+static void Hacl_Impl_Curve25519_Base_fsqr(uint64_t *out, const uint64_t *a)
+{
+  uint64_t a0_2 = a[0U] * (uint64_t)2U;
+  uint64_t a1_2 = a[1U] * (uint64_t)2U;
+  uint64_t a1_38 = a[1U] * (uint64_t)38U;
+  uint64_t a2_38 = a[2U] * (uint64_t)38U;
+  uint64_t a3_19 = a[3U] * (uint64_t)19U;
+  uint64_t a3_38 = a[3U] * (uint64_t)38U;
+  uint64_t a4_19 = a[4U] * (uint64_t)19U;
+  FStar_UInt128_t t[5U];
+  t[0U] = FStar_UInt128_mul_wide(a[0U], a[0U]);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a1_38, a[4U]);
+  t[0U] = Hacl_Impl_Curve25519_Base_mac(t[0U], a2_38, a[3U]);
+  t[1U] = FStar_UInt128_mul_wide(a0_2, a[1U]);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a2_38, a[4U]);
+  t[1U] = Hacl_Impl_Curve25519_Base_mac(t[1U], a3_19, a[3U]);
+  t[2U] = FStar_UInt128_mul_wide(a0_2, a[2U]);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a[1U], a[1U]);
+  t[2U] = Hacl_Impl_Curve25519_Base_mac(t[2U], a3_38, a[4U]);
+  t[3U] = FStar_UInt128_mul_wide(a0_2, a[3U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a1_2, a[2U]);
+  t[3U] = Hacl_Impl_Curve25519_Base_mac(t[3U], a4_19, a[4U]);
+  t[4U] = FStar_UInt128_mul_wide(a0_2, a[4U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a1_2, a[3U]);
+  t[4U] = Hacl_Impl_Curve25519_Base_mac(t[4U], a[2U], a[2U]);
+  Hacl_Impl_Curve25519_Base_fcarry_wide(out, t);
+}
+
+static void Hacl_Impl_Curve25519_Base_fsqr_times(uint64_t *out, const uint64_t *a, uint32_t n)
+{
+  Hacl_Impl_Curve25519_Base_fsqr(out, a);
+  for (uint32_t i = (uint32_t)1U; i < n; i = i + (uint32_t)1U)
+    Hacl_Impl_Curve25519_Base_fsqr(out, out);
+}
+
+/* out = z^(p - 2), with the addition chain of Hacl_Bignum_crecip */
+static void Hacl_Impl_Curve25519_Base_finv(uint64_t *out, const uint64_t *z)
+{
+  uint64_t z2[5U], z9[5U], z11[5U], z_5_0[5U], z_10_0[5U], z_20_0[5U];
+  uint64_t z_50_0[5U], z_100_0[5U], t[5U];
+  Hacl_Impl_Curve25519_Base_fsqr(z2, z);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z2, (uint32_t)2U);
+  Hacl_Impl_Curve25519_Base_fmul(z9, t, z);
+  Hacl_Impl_Curve25519_Base_fmul(z11, z9, z2);
+  Hacl_Impl_Curve25519_Base_fsqr(t, z11);
+  Hacl_Impl_Curve25519_Base_fmul(z_5_0, t, z9);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z_5_0, (uint32_t)5U);
+  Hacl_Impl_Curve25519_Base_fmul(z_10_0, t, z_5_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z_10_0, (uint32_t)10U);
+  Hacl_Impl_Curve25519_Base_fmul(z_20_0, t, z_10_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z_20_0, (uint32_t)20U);
+  Hacl_Impl_Curve25519_Base_fmul(t, t, z_20_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, t, (uint32_t)10U);
+  Hacl_Impl_Curve25519_Base_fmul(z_50_0, t, z_10_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z_50_0, (uint32_t)50U);
+  Hacl_Impl_Curve25519_Base_fmul(z_100_0, t, z_50_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, z_100_0, (uint32_t)100U);
+  Hacl_Impl_Curve25519_Base_fmul(t, t, z_100_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, t, (uint32_t)50U);
+  Hacl_Impl_Curve25519_Base_fmul(t, t, z_50_0);
+  Hacl_Impl_Curve25519_Base_fsqr_times(t, t, (uint32_t)5U);
+  Hacl_Impl_Curve25519_Base_fmul(out, t, z11);
+}
+
+/* Fully reduces a modulo p, in constant time, and encodes it little-endian */
+static void Hacl_Impl_Curve25519_Base_fcontract(uint8_t *b, const uint64_t *a)
+{
+  uint64_t t[5U];
+  memcpy(t, a, (uint32_t)5U * sizeof a[0U]);
+  Hacl_Impl_Curve25519_Base_fcarry(t);
+  Hacl_Impl_Curve25519_Base_fcarry(t);
+  /* t < 2^255 now, and t + 19 overflows 2^255 (folding back as +19) exactly
+     when t >= p */
+  t[0U] = t[0U] + (uint64_t)19U;
+  Hacl_Impl_Curve25519_Base_fcarry(t);
+  /* Either way t is offset by 19: adding 2^255 - 19 and dropping bit 255
+     removes it */
+  t[0U] = t[0U] + (uint64_t)0x8000000000000U - (uint64_t)19U;
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)5U; i = i + (uint32_t)1U)
+    t[i] = t[i] + (uint64_t)0x8000000000000U - (uint64_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i = i + (uint32_t)1U)
+  {
+    t[i + (uint32_t)1U] = t[i + (uint32_t)1U] + (t[i] >> 51U);
+    t[i] = t[i] & HACL_CURVE25519_BASE_MASK51;
+  }
+  t[4U] = t[4U] & HACL_CURVE25519_BASE_MASK51;
+  store64_le(b, t[0U] | t[1U] << 51U);
+  store64_le(b + (uint32_t)8U, t[1U] >> 13U | t[2U] << 38U);
+  store64_le(b + (uint32_t)16U, t[2U] >> 26U | t[3U] << 25U);
+  store64_le(b + (uint32_t)24U, t[3U] >> 39U | t[4U] << 12U);
+}
+
+/* Points on edwards25519 in extended coordinates (X : Y : Z : T), x = X/Z,
+   y = Y/Z, x * y = T/Z, as four consecutive field elements. Table entries
+   are affine (y + x, y - x, 2 * d * x * y). */
+
+/* p = p + q, for a table entry q (mixed addition, 8 multiplications) */
+static void Hacl_Impl_Curve25519_Base_madd(uint64_t *p, const uint64_t *q)
+{
+  uint64_t *x = p, *y = p + (uint32_t)5U, *z = p + (uint32_t)10U, *t = p + (uint32_t)15U;
+  uint64_t a[5U], b[5U], c[5U], d[5U], e[5U], f[5U], g[5U], h[5U];
+  Hacl_Impl_Curve25519_Base_fadd(a, y, x);
+  Hacl_Impl_Curve25519_Base_fmul(a, a, q);
+  Hacl_Impl_Curve25519_Base_fsub(b, y, x);
+  Hacl_Impl_Curve25519_Base_fmul(b, b, q + (uint32_t)5U);
+  Hacl_Impl_Curve25519_Base_fmul(c, t, q + (uint32_t)10U);
+  Hacl_Impl_Curve25519_Base_fadd(d, z, z);
+  Hacl_Impl_Curve25519_Base_fsub(e, a, b);
+  Hacl_Impl_Curve25519_Base_fadd(h, a, b);
+  Hacl_Impl_Curve25519_Base_fadd(g, d, c);
+  Hacl_Impl_Curve25519_Base_fsub(f, d, c);
+  Hacl_Impl_Curve25519_Base_fmul(x, e, f);
+  Hacl_Impl_Curve25519_Base_fmul(y, g, h);
+  Hacl_Impl_Curve25519_Base_fmul(z, f, g);
+  Hacl_Impl_Curve25519_Base_fmul(t, e, h);
+}
+
+/* p = 2p; the input T coordinate is not used */
+static void Hacl_Impl_Curve25519_Base_dbl(uint64_t *p)
+{
+  uint64_t *x = p, *y = p + (uint32_t)5U, *z = p + (uint32_t)10U, *t = p + (uint32_t)15U;
+  uint64_t xx[5U], yy[5U], zz2[5U], s[5U], e[5U], f[5U], g[5U], h[5U];
+  Hacl_Impl_Curve25519_Base_fsqr(xx, x);
+  Hacl_Impl_Curve25519_Base_fsqr(yy, y);
+  Hacl_Impl_Curve25519_Base_fsqr(zz2, z);
+  Hacl_Impl_Curve25519_Base_fadd(zz2, zz2, zz2);
+  Hacl_Impl_Curve25519_Base_fadd(s, x, y);
+  Hacl_Impl_Curve25519_Base_fsqr(s, s);
+  Hacl_Impl_Curve25519_Base_fadd(h, yy, xx);
+  Hacl_Impl_Curve25519_Base_fsub(g, yy, xx);
+  Hacl_Impl_Curve25519_Base_fsub(e, s, h);
+  Hacl_Impl_Curve25519_Base_fsub(f, zz2, g);
+  Hacl_Impl_Curve25519_Base_fmul(x, e, f);
+  Hacl_Impl_Curve25519_Base_fmul(y, g, h);
+  Hacl_Impl_Curve25519_Base_fmul(z, f, g);
+  Hacl_Impl_Curve25519_Base_fmul(t, e, h);
+}
+
+/* q = digit * row[.], for digit in [-8, 8], reading every entry of the row */
+static void
+Hacl_Impl_Curve25519_Base_select(uint64_t *q, const uint64_t row[8U][15U], int8_t digit)
+{
+  uint64_t neg = (uint64_t)(int64_t)digit >> 63U;
+  uint64_t babs = ((uint64_t)(int64_t)digit ^ ((uint64_t)0U - neg)) + neg;
+  uint64_t acc[15U] = { 0U }, minus_xy2d[5U], zero[5U] = { 0U };
+  /* Exactly one mask is set when digit != 0; none selects the identity */
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j = j + (uint32_t)1U)
+  {
+    uint64_t x = babs ^ (uint64_t)(j + (uint32_t)1U);
+    uint64_t mask = ((x | ((uint64_t)0U - x)) >> 63U) - (uint64_t)1U;
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)15U; k = k + (uint32_t)1U)
+      acc[k] = acc[k] | (mask & row[j][k]);
+  }
+  memcpy(q, acc, (uint32_t)15U * sizeof q[0U]);
+  uint64_t is_zero = ((babs | ((uint64_t)0U - babs)) >> 63U) ^ (uint64_t)1U;
+  q[0U] = q[0U] | is_zero;
+  q[5U] = q[5U] | is_zero;
+  /* -(x, y) = (-x, y): swap y + x with y - x and negate 2dxy */
+  Hacl_Impl_Curve25519_Base_fsub(minus_xy2d, zero, q + (uint32_t)10U);
+  uint64_t neg_mask = (uint64_t)0U - neg;
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k = k + (uint32_t)1U)
+  {
+    uint64_t sw = neg_mask & (q[k] ^ q[k + (uint32_t)5U]);
+    q[k] = q[k] ^ sw;
+    q[k + (uint32_t)5U] = q[k + (uint32_t)5U] ^ sw;
+    q[k + (uint32_t)10U] =
+      q[k + (uint32_t)10U] ^ (neg_mask & (q[k + (uint32_t)10U] ^ minus_xy2d[k]));
+  }
+}
+
+void Hacl_Curve25519_secret_to_public(uint8_t *pub, uint8_t *secret)
+{
+  uint8_t e[32U];
+  int8_t digit[64U];
+  uint64_t p[20U], q[15U], num[5U], den[5U];
+  memcpy(e, secret, (uint32_t)32U);
+  e[0U] = e[0U] & (uint8_t)248U;
+  e[31U] = (e[31U] & (uint8_t)127U) | (uint8_t)64U;
+  /* Signed radix-16 digits in [-8, 8): the top one is at most 8 since the
+     clamped scalar is below 2^255 */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i = i + (uint32_t)1U)
+  {
+    digit[(uint32_t)2U * i] = (int8_t)(e[i] & (uint8_t)15U);
+    digit[(uint32_t)2U * i + (uint32_t)1U] = (int8_t)(e[i] >> 4U);
+  }
+  int8_t carry = 0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)63U; i = i + (uint32_t)1U)
+  {
+    digit[i] = (int8_t)(digit[i] + carry);
+    carry = (int8_t)((digit[i] + 8) >> 4);
+    digit[i] = (int8_t)(digit[i] - carry * 16);
+  }
+  digit[63U] = (int8_t)(digit[63U] + carry);
+  /* sum_i digit[i] 16^i B = sum_r 16^r (sum_{i = r mod S} digit[i] 16^(i - r) B),
+     evaluated from r = S - 1 down to 0 with four doublings in between */
+  memset(p, 0, (uint32_t)20U * sizeof p[0U]);
+  p[5U] = (uint64_t)1U;
+  p[10U] = (uint64_t)1U;
+  for (uint32_t r = (uint32_t)HACL_CURVE25519_BASE_SPACING; r > (uint32_t)0U; r = r - (uint32_t)1U)
+  {
+    for (uint32_t i = r - (uint32_t)1U; i < (uint32_t)64U; i = i + (uint32_t)HACL_CURVE25519_BASE_SPACING)
+    {
+      Hacl_Impl_Curve25519_Base_select(q,
+        Hacl_Impl_Curve25519_Base_table[i / (uint32_t)HACL_CURVE25519_BASE_SPACING],
+        digit[i]);
+      Hacl_Impl_Curve25519_Base_madd(p, q);
+    }
+    if (r > (uint32_t)1U)
+      for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k = k + (uint32_t)1U)
+        Hacl_Impl_Curve25519_Base_dbl(p);
+  }
+  /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y) */
+  Hacl_Impl_Curve25519_Base_fadd(num, p + (uint32_t)10U, p + (uint32_t)5U);
+  Hacl_Impl_Curve25519_Base_fsub(den, p + (uint32_t)10U, p + (uint32_t)5U);
+  Hacl_Impl_Curve25519_Base_finv(den, den);
+  Hacl_Impl_Curve25519_Base_fmul(num, num, den);
+  Hacl_Impl_Curve25519_Base_fcontract(pub, num);
+}
@@ -0,0 +1,54 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Curve25519_Base_H
+#define __Hacl_Curve25519_Base_H
+
+#include <inttypes.h>
+
+/* Fixed-base X25519 (unverified).
+ *
+ * Computes the public key secret * 9 without a Montgomery ladder: the
+ * clamped scalar is recoded into 64 signed radix-16 digits and multiplied
+ * by the Ed25519 base point with one constant-time table lookup and one
+ * mixed addition per digit, then the Edwards point is mapped to its
+ * Montgomery u-coordinate, u = (1 + y) / (1 - y). The result is identical
+ * to Hacl_Curve25519_crypto_scalarmult with basepoint 9.
+ *
+ * The precomputed table keeps every HACL_CURVE25519_BASE_SPACING-th row of
+ * 16^i * B multiples and fills the gaps with doublings. Define it (1, 2, 4,
+ * 8, 16 or 32) when compiling Hacl_Curve25519_Base.c to trade table size
+ * for speed:
+ *
+ *   spacing  table   doublings
+ *   1        60 KiB   0
+ *   2        30 KiB   4 (default)
+ *   4        15 KiB  12
+ *   8       7.5 KiB  28
+ *
+ * "make unit-tests-base-spacing" runs the unit tests with spacings 1 and
+ * 32. The table itself is generated by mk_curve25519_base_table.py. */
+
+void Hacl_Curve25519_secret_to_public(uint8_t *pub, uint8_t *secret);
+
+#endif
@@ -0,0 +1,2856 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Curve25519_Base_Table_H
+#define __Hacl_Curve25519_Base_Table_H
+
+/* Precomputed multiples of the Ed25519 base point B, included by
+ * Hacl_Curve25519_Base.c only. Generated by mk_curve25519_base_table.py.
+ *
+ * Row i, entry j holds (j + 1) * 16^i * B in affine "Niels" form:
+ * (y + x, y - x, 2 * d * x * y) mod 2^255 - 19, each as five fully reduced
+ * 51-bit limbs, least significant first. Only the rows whose index is a
+ * multiple of HACL_CURVE25519_BASE_SPACING are compiled in. */
+
+static const uint64_t
+Hacl_Impl_Curve25519_Base_table[64U / HACL_CURVE25519_BASE_SPACING][8U][15U] =
+{
+#if 0 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x493c6f58c3b85U, 0x0df7181c325f7U, 0x0f50b0b3e4cb7U, 0x5329385a44c32U, 0x07cf9d3a33d4bU,
+      0x03905d740913eU, 0x0ba2817d673a2U, 0x23e2827f4e67cU, 0x133d2e0c21a34U, 0x44fd2f9298f81U,
+      0x11205877aaa68U, 0x479955893d579U, 0x50d66309b67a0U, 0x2d42d0dbee5eeU, 0x6f117b689f0c6U
+    },
+    {
+      0x4e7fc933c71d7U, 0x2cf41feb6b244U, 0x7581c0a7d1a76U, 0x7172d534d32f0U, 0x590c063fa87d2U,
+      0x1a56042b4d5a8U, 0x189cc159ed153U, 0x5b8deaa3cae04U, 0x2aaf04f11b5d8U, 0x6bb595a669c92U,
+      0x2a8b3a59b7a5fU, 0x3abb359ef087fU, 0x4f5a8c4db05afU, 0x5b9a807d04205U, 0x701af5b13ea50U
+    },
+    {
+      0x5b0a84cee9730U, 0x61d10c97155e4U, 0x4059cc8096a10U, 0x47a608da8014fU, 0x7a164e1b9a80fU,
+      0x11fe8a4fcd265U, 0x7bcb8374faaccU, 0x52f5af4ef4d4fU, 0x5314098f98d10U, 0x2ab91587555bdU,
+      0x6933f0dd0d889U, 0x44386bb4c4295U, 0x3cb6d3162508cU, 0x26368b872a2c6U, 0x5a2826af12b9bU
+    },
+    {
+      0x351b98efc099fU, 0x68fbfa4a7050eU, 0x42a49959d971bU, 0x393e51a469efdU, 0x680e910321e58U,
+      0x6050a056818bfU, 0x62acc1f5532bfU, 0x28141ccc9fa25U, 0x24d61f471e683U, 0x27933f4c7445aU,
+      0x3fbe9c476ff09U, 0x0af6b982e4b42U, 0x0ad1251ba78e5U, 0x715aeedee7c88U, 0x7f9d0cbf63553U
+    },
+    {
+      0x2bc4408a5bb33U, 0x078ebdda05442U, 0x2ffb112354123U, 0x375ee8df5862dU, 0x2945ccf146e20U,
+      0x182c3a447d6baU, 0x22964e536eff2U, 0x192821f540053U, 0x2f9f19e788e5cU, 0x154a7e73eb1b5U,
+      0x3dbf1812a8285U, 0x0fa17ba3f9797U, 0x6f69cb49c3820U, 0x34d5a0db3858dU, 0x43aabe696b3bbU
+    },
+    {
+      0x4eeeb77157131U, 0x1201915f10741U, 0x1669cda6c9c56U, 0x45ec032db346dU, 0x51e57bb6a2cc3U,
+      0x006b67b7d8ca4U, 0x084fa44e72933U, 0x1154ee55d6f8aU, 0x4425d842e7390U, 0x38b64c41ae417U,
+      0x4326702ea4b71U, 0x06834376030b5U, 0x0ef0512f9c380U, 0x0f1a9f2512584U, 0x10b8e91a9f0d6U
+    },
+    {
+      0x25cd0944ea3bfU, 0x75673b81a4d63U, 0x150b925d1c0d4U, 0x13f38d9294114U, 0x461bea69283c9U,
+      0x72c9aaa3221b1U, 0x267774474f74dU, 0x064b0e9b28085U, 0x3f04ef53b27c9U, 0x1d6edd5d2e531U,
+      0x36dc801b8b3a2U, 0x0e0a7d4935e30U, 0x1deb7cecc0d7dU, 0x053a94e20dd2cU, 0x7a9fbb1c6a0f9U
+    },
+    {
+      0x7596604dd3e8fU, 0x6fc510e058b36U, 0x3670c8db2cc0dU, 0x297d899ce332fU, 0x0915e76061bceU,
+      0x75dedf39234d9U, 0x01c36ab1f3c54U, 0x0f08fee58f5daU, 0x0e19613a0d637U, 0x3a9024a1320e0U,
+      0x1f5d9c9a2911aU, 0x7117994fafcf8U, 0x2d8a8cae28dc5U, 0x74ab1b2090c87U, 0x26907c5c2ecc4U
+    }
+  },
+#endif
+#if 1 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x504a52d9021f6U, 0x66eb8d7f38645U, 0x3482c26e7067cU, 0x730ac3d1d21a1U, 0x143b1cf8aa64fU,
+      0x051ca553e2df3U, 0x174c90f166fd9U, 0x223479e9c4a13U, 0x441f35af20c99U, 0x4cf210ec5a9a8U,
+      0x67c7d968acaabU, 0x1c4e124e533f0U, 0x06025d57d5096U, 0x370e853e9a5f5U, 0x21b546a337412U
+    },
+    {
+      0x27a45d185218fU, 0x708c09266a921U, 0x0c787da6854ddU, 0x4b280307504e6U, 0x7e041577f86eeU,
+      0x7f858a2888343U, 0x2ca627da79529U, 0x6fcd3eb383b51U, 0x1b8faae1ee7daU, 0x0a653ca5c9eabU,
+      0x2a496ce5b67f3U, 0x317aad2f2ccd6U, 0x164b343fd524bU, 0x659281e7614a5U, 0x566943650813aU
+    },
+    {
+      0x2f9eb1dabb69dU, 0x6b5fd0a7f8aceU, 0x65b59b6e9c2d4U, 0x13aa3d607ba93U, 0x32a5351794117U,
+      0x0db0c26620798U, 0x32c0dc6a95703U, 0x2a3371d7570c7U, 0x16a04c17d2780U, 0x17e12bcd4653eU,
+      0x644a6df648437U, 0x33101f7fbba74U, 0x4e86a95c0ed95U, 0x23465c292a056U, 0x0900b3f78e4c6U
+    },
+    {
+      0x00fbec816ad31U, 0x37b1cddfc7da5U, 0x3188fd54b6565U, 0x49e07f38bb97bU, 0x4314030b051e2U,
+      0x51b9f679d651bU, 0x42066685e4150U, 0x22cc28f84232dU, 0x38a6b00fabff4U, 0x371f3acaed2ddU,
+      0x0005efbf0bcadU, 0x5da30e18bdaacU, 0x2139a823adc3cU, 0x338100fc819e8U, 0x4c3a5ae1ce7b6U
+    },
+    {
+      0x075e4c93da0ddU, 0x4ee372529b75fU, 0x31b1182e4ca0aU, 0x0c0c06b1fdbfaU, 0x6de9c73dea66cU,
+      0x0a434dcb8fa95U, 0x7ad92d0816827U, 0x5efa0b21c33d9U, 0x2ad6f1c42ba14U, 0x7c814db27262aU,
+      0x104d5a04df8f2U, 0x15620285a68f1U, 0x5742663ebeeb9U, 0x0827b645631aaU, 0x5aac4a412f90bU
+    },
+    {
+      0x20d0abd7f5134U, 0x65c3a75c8cc07U, 0x662f58e022724U, 0x11aef92c89cc3U, 0x1c145cd274ba0U,
+      0x7326b3ac92908U, 0x05ccc7c3c18c9U, 0x0692e0d5546caU, 0x46123b59afaa5U, 0x1b9da3fe189f6U,
+      0x0386475f3d743U, 0x5ed5cbb3de65dU, 0x16da078d96e2eU, 0x2f0c1291c5b1cU, 0x234929c1167d6U
+    },
+    {
+      0x45cc21d099fcfU, 0x259851afca902U, 0x091f80514d706U, 0x1f74073e0f2a4U, 0x4a5f28743b297U,
+      0x5ecaba077ade8U, 0x5a33d6713b309U, 0x5535e50e0fddeU, 0x53d63f635bf14U, 0x59c77b3aeb7c3U,
+      0x5d725225ccf62U, 0x03642a58bba75U, 0x423e1f64468ceU, 0x71dec59cfd6adU, 0x6f05606b4799fU
+    },
+    {
+      0x33149f91b6483U, 0x4ab4597ec4b68U, 0x4a09eceb6d771U, 0x46c43fd420931U, 0x60895e91ab49fU,
+      0x69e92177ba962U, 0x3a1bcb95c33ffU, 0x60c411262bb9cU, 0x5641ffa574a16U, 0x714de12e58533U,
+      0x4f2ed0cf86c18U, 0x240e6bbfa9d3dU, 0x2e5af9ed1b418U, 0x135de4ed04c02U, 0x73e2e62fd96dcU
+    }
+  },
+#endif
+#if 2 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4dd0e632f9c1dU, 0x2ced12622a5d9U, 0x18de9614742daU, 0x79ca96fdbb5d4U, 0x6dd37d49a00eeU,
+      0x3635449aa515eU, 0x3e178d0475dabU, 0x50b4712a19712U, 0x2dcc2860ff4adU, 0x30d76d6f03d31U,
+      0x444172106e4c7U, 0x01251afed2d88U, 0x534fc9bed4f5aU, 0x5d85a39cf5234U, 0x10c697112e864U
+    },
+    {
+      0x62aa08358c805U, 0x46f440848e194U, 0x447b771a8f52bU, 0x377ba3269d31dU, 0x03bf9baf55080U,
+      0x3c4277dbe5fdeU, 0x5a335afd44c92U, 0x0c1164099753eU, 0x70487006fe423U, 0x25e61cabed66fU,
+      0x3e128cc586604U, 0x5968b2e8fc7e2U, 0x049a3d5bd61cfU, 0x116505b1ef6e6U, 0x566d78634586eU
+    },
+    {
+      0x54285c65a2fd0U, 0x55e62ccf87420U, 0x46bb961b19044U, 0x1153405712039U, 0x14fba5f34793bU,
+      0x7a49f9cc10834U, 0x2b513788a22c6U, 0x5ff4b6ef2395bU, 0x2ec8e5af607bfU, 0x33975bca5ecc3U,
+      0x746166985f7d4U, 0x09939000ae79aU, 0x5844c7964f97aU, 0x13617e1f95b3dU, 0x14829cea83fc5U
+    },
+    {
+      0x70b2f4e71ecb8U, 0x728148efc643cU, 0x0753e03995b76U, 0x5bf5fb2ab6767U, 0x05fc3bc4535d7U,
+      0x37b8497dd95c2U, 0x61549d6b4ffe8U, 0x217a22db1d138U, 0x0b9cf062eb09eU, 0x2fd9c71e5f758U,
+      0x0b3ae52afdeddU, 0x19da76619e497U, 0x6fa0654d2558eU, 0x78219d25e41d4U, 0x373767475c651U
+    },
+    {
+      0x095cb14246590U, 0x002d82aa6ac68U, 0x442f183bc4851U, 0x6464f1c0a0644U, 0x6bf5905730907U,
+      0x299fd40d1add9U, 0x5f2de9a04e5f7U, 0x7c0eebacc1c59U, 0x4cca1b1f8290aU, 0x1fbea56c3b18fU,
+      0x778f1e1415b8aU, 0x6f75874efc1f4U, 0x28a694019027fU, 0x52b37a96bdc4dU, 0x02521cf67a635U
+    },
+    {
+      0x46720772f5ee4U, 0x632c0f359d622U, 0x2b2092ba3e252U, 0x662257c112680U, 0x001753d9f7cd6U,
+      0x7ee0b0a9d5294U, 0x381fbeb4cca27U, 0x7841f3a3e639dU, 0x676ea30c3445fU, 0x3fa00a7e71382U,
+      0x1232d963ddb34U, 0x35692e70b078dU, 0x247ca14777a1fU, 0x6db556be8fcd0U, 0x12b5fe2fa048eU
+    },
+    {
+      0x37c26ad6f1e92U, 0x46a0971227be5U, 0x4722f0d2d9b4cU, 0x3dc46204ee03aU, 0x6f7e93c20796cU,
+      0x0fbc496fce34dU, 0x575be6b7dae3eU, 0x4a31585cee609U, 0x037e9023930ffU, 0x749b76f96fb12U,
+      0x2f604aea6ae05U, 0x637dc939323ebU, 0x3fdad9b048d47U, 0x0a8b0d4045af7U, 0x0fcec10f01e02U
+    },
+    {
+      0x2d29dc4244e45U, 0x6927b1bc147beU, 0x0308534ac0839U, 0x4853664033f41U, 0x413779166feabU,
+      0x558a649fe1e44U, 0x44635aeefcc89U, 0x1ff434887f2baU, 0x0f981220e2d44U, 0x4901aa7183c51U,
+      0x1b7548c1af8f0U, 0x7848c53368116U, 0x01b64e7383de9U, 0x109fbb0587c8fU, 0x41bb887b726d1U
+    }
+  },
+#endif
+#if 3 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x180e0aa39f7d2U, 0x04a58d6a392fbU, 0x73556a8d740e1U, 0x1b13ea1fa4983U, 0x56bd36cfb78acU,
+      0x7806c567c49d8U, 0x1994f23cd524cU, 0x730e52c19b413U, 0x669534fab22f1U, 0x5c95b686a0788U,
+      0x519c10d14a954U, 0x69296bf520558U, 0x7e1e96babd1d2U, 0x04a7357c1c154U, 0x0dea6db1879beU
+    },
+    {
+      0x2eb74d6a8797aU, 0x63f5882e642b7U, 0x22c1715fbd573U, 0x67d94800fad1eU, 0x0ad7cc8752eacU,
+      0x6bf547344e5abU, 0x111e36861354cU, 0x5592cbf684962U, 0x0eeaf43e959feU, 0x5b2c78885483bU,
+      0x51362793408cfU, 0x06332c7b28a42U, 0x0f6519bac3c5cU, 0x63c5419d97d44U, 0x093a7fa775003U
+    },
+    {
+      0x1604460a91286U, 0x08eef1a7bd71dU, 0x62978b5fcff60U, 0x29f33e80f18dfU, 0x7b038a06c27b6U,
+      0x07de63a16d7beU, 0x3935e6659fca2U, 0x02d9dfe8ddfffU, 0x201b86adf8c22U, 0x6a252b19a4a31U,
+      0x119d5d36990f3U, 0x77b69d73e53dbU, 0x2e644d5484ebaU, 0x72b63847502a6U, 0x58ded57f72260U
+    },
+    {
+      0x553265b0fd48bU, 0x63277f5311b4dU, 0x755f8a2258208U, 0x0a1ebc5649930U, 0x79f2942d3a5c8U,
+      0x79dade9413d77U, 0x2b2e53ccfaf1cU, 0x5ea9f9bc95fe7U, 0x1ce2cedc88771U, 0x6aa11b5bbb9e0U,
+      0x22f25b6c88de9U, 0x5559e402d32fbU, 0x53ad390946e9fU, 0x6d284da27c3f7U, 0x7d90ab1bbc6a7U
+    },
+    {
+      0x7a3f496b3c397U, 0x311e9c4a64340U, 0x5d46fc0473aa8U, 0x4503eca4c6ad3U, 0x19ed161f508ddU,
+      0x4a683a7016bfeU, 0x1be58a16db359U, 0x390d6aa41417dU, 0x7cb35b086afe6U, 0x19a10d446198fU,
+      0x22cd687dce6caU, 0x090cc99e9aac1U, 0x200e8e1fcd5a3U, 0x1fe43a0f4a911U, 0x483bdab159565U
+    },
+    {
+      0x74d0ab4da80f6U, 0x0bf060ffc1ad9U, 0x1be76920920f9U, 0x3bd02802934d7U, 0x1c7052909cf78U,
+      0x00f148734fa49U, 0x606c0a69c1f4fU, 0x78c1ef441bc2dU, 0x07f11083bb7f1U, 0x3286c109dde6aU,
+      0x67de2874e98d4U, 0x5372fc18c065dU, 0x1828e28530d8bU, 0x4202bc0ee6f35U, 0x217dd5eaaa7aaU
+    },
+    {
+      0x71fb9be8c0ec8U, 0x71c614050517bU, 0x5b13db002eb9fU, 0x30524b1cc8ed6U, 0x07058a6e5df6fU,
+      0x7c4d0248e1eb0U, 0x429ae97ea53b6U, 0x1588d5381da5fU, 0x4b28f354d8b9eU, 0x7fa7c21f795a4U,
+      0x302c4db31f67fU, 0x122179f657d3dU, 0x17376d3b497f6U, 0x5e72364098faeU, 0x33b21c13a0cb9U
+    },
+    {
+      0x7b9b05ee38c5bU, 0x1c0e34278f355U, 0x4cca42afe74b5U, 0x38bc7773736f4U, 0x1c3bab17ae109U,
+      0x692f8087d8e31U, 0x6fa4e2c7ee6c0U, 0x7a9658fd37318U, 0x06c92d2731032U, 0x659bf72e5ac16U,
+      0x2b216c7cab7b0U, 0x680f778798393U, 0x1296355f5974dU, 0x4c8293a23a828U, 0x09f2606b131a2U
+    }
+  },
+#endif
+#if 4 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x34c597c6691aeU, 0x7a150b6990fc4U, 0x52beb9d922274U, 0x70eed7164861aU, 0x0a871e070c6a9U,
+      0x07d44744346beU, 0x282b6a564a81dU, 0x4ed80f875236bU, 0x6fbbe1d450c50U, 0x4eb728c12fcdbU,
+      0x1b5994bbc8989U, 0x74b7ba84c0660U, 0x75678f1cdaeb8U, 0x23206b0d6f10cU, 0x3ee7300f2685dU
+    },
+    {
+      0x27947841e7518U, 0x32c7388dae87fU, 0x414add3971be9U, 0x01850832f0ef1U, 0x7d47c6a2cfb89U,
+      0x255e49e7dd6b7U, 0x38c2163d59ebaU, 0x3861f2a005845U, 0x2e11e4ccbaec9U, 0x1381576297912U,
+      0x2d0148ef0d6e0U, 0x3522a8de787fbU, 0x2ee055e74f9d2U, 0x64038f6310813U, 0x148cf58d34c9eU
+    },
+    {
+      0x72f7d9ae4756dU, 0x7711e690ffc4aU, 0x582a2355b0d16U, 0x0dccfe885b6b4U, 0x278febad4eaeaU,
+      0x492f67934f027U, 0x7ded0815528d4U, 0x58461511a6612U, 0x5ea2e50de1544U, 0x3ff2fa1ebd5dbU,
+      0x2681f8c933966U, 0x3840521931635U, 0x674f14a308652U, 0x3bd9c88a94890U, 0x4104dd02fe9c6U
+    },
+    {
+      0x14e06db096ab8U, 0x1219c89e6b024U, 0x278abd486a2dbU, 0x240b292609520U, 0x0165b5a48efcaU,
+      0x2bf5e1124422aU, 0x673146756ae56U, 0x14ad99a87e830U, 0x1eaca65b080fdU, 0x2c863b00afaf5U,
+      0x0a474a0846a76U, 0x099a5ef981e32U, 0x2a8ae3c4bbfe6U, 0x45c34af14832cU, 0x591b67d9bffecU
+    },
+    {
+      0x1b3719f18b55dU, 0x754318c83d337U, 0x27c17b7919797U, 0x145b084089b61U, 0x489b4f8670301U,
+      0x70d1c80b49bfaU, 0x3d57e7d914625U, 0x3c0722165e545U, 0x5e5b93819e04fU, 0x3de02ec7ca8f7U,
+      0x2102d3aeb92efU, 0x68c22d50c3a46U, 0x42ea89385894eU, 0x75f9ebf55f38cU, 0x49f5fbba496cbU
+    },
+    {
+      0x5628c1e9c572eU, 0x598b108e822abU, 0x55d8fae29361aU, 0x0adc8d1a97b28U, 0x06a1a6c288675U,
+      0x49a108a5bcfd4U, 0x6178c8e7d6612U, 0x1f03473710375U, 0x73a49614a6098U, 0x5604a86dcbfa6U,
+      0x0d1d47c1764b6U, 0x01c08316a2e51U, 0x2b3db45c95045U, 0x1634f818d300cU, 0x20989e89fe274U
+    },
+    {
+      0x4278b85eaec2eU, 0x0ef59657be2ceU, 0x72fd169588770U, 0x2e9b205260b30U, 0x730b9950f7059U,
+      0x777fd3a2dcc7fU, 0x594a9fb124932U, 0x01f8e80ca15f0U, 0x714d13cec3269U, 0x0403ed1d0ca67U,
+      0x32d35874ec552U, 0x1f3048df1b929U, 0x300d73b179b23U, 0x6e67be5a37d0bU, 0x5bd7454308303U
+    },
+    {
+      0x4932115e7792aU, 0x457b9bbb930b8U, 0x68f5d8b193226U, 0x4164e8f1ed456U, 0x5bb7db123067fU,
+      0x2d19528b24cc2U, 0x4ac66b8302ff3U, 0x701c8d9fdad51U, 0x6c1b35c5b3727U, 0x133a78007380aU,
+      0x1f467c6ca62beU, 0x2c4232a5dc12cU, 0x7551dc013b087U, 0x0690c11b03bcdU, 0x740dca6d58f0eU
+    }
+  },
+#endif
+#if 5 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6c72aed261ae5U, 0x3311c201ee720U, 0x4d8065e6ada3fU, 0x6a3faf482cd79U, 0x0e53dc78bf2b6U,
+      0x70bf5d3f0af0bU, 0x15c65ce3eea16U, 0x56ef4d13fabd2U, 0x0f6b0742769d2U, 0x00ed489b3f50dU,
+      0x029bf7971877aU, 0x46da2fcc63721U, 0x09da24d791111U, 0x57aa682e2970cU, 0x27632d9a5a4a4U
+    },
+    {
+      0x285d187eaffdbU, 0x77b1a150c9530U, 0x0998fde96d3eeU, 0x1415b2c793f81U, 0x3bbc2b22d99ceU,
+      0x7f05154b260ceU, 0x1ce5f2a4e1a23U, 0x1f304e361b70eU, 0x666b00fe68693U, 0x2b67916429e90U,
+      0x7c952583c0a58U, 0x701fc98de7722U, 0x37cf03194ffe6U, 0x3074d86d3ebdeU, 0x43a0eeb6ab54dU
+    },
+    {
+      0x6322357875fe8U, 0x59ebf7971e758U, 0x0aed8836753d3U, 0x7ee46f742499cU, 0x50c5eaa14c799U,
+      0x166a46d4a5487U, 0x155857677472dU, 0x0a2c9afe04686U, 0x5c93372342dabU, 0x70a477029d929U,
+      0x6dc8bd6f2fb3cU, 0x4f398f6f41ba1U, 0x2367c695318eaU, 0x3fdd705819596U, 0x6f9ce10760296U
+    },
+    {
+      0x693063520e0b5U, 0x7911d407fc272U, 0x72566f10dff3dU, 0x76cfbea6205e9U, 0x699154d1f893dU,
+      0x054b1cde1c22aU, 0x0491d665bf5a2U, 0x33703ab12a3a4U, 0x31f2f9f3d99d6U, 0x72364713fc799U,
+      0x55c75b4b27526U, 0x5a046db54a62bU, 0x17fba3b332e10U, 0x5f6917864519aU, 0x73975a617d39dU
+    },
+    {
+      0x7f392f4433e46U, 0x423eacd630de6U, 0x74759883866e6U, 0x4a69107dbc50fU, 0x362a4258a381cU,
+      0x24df96375da10U, 0x34306190e1c80U, 0x6336471e34c94U, 0x1c548158ca432U, 0x7e18b10b29b74U,
+      0x1d9132b6beb2fU, 0x5a5083048f20eU, 0x7b249743c9ba6U, 0x16f755c8f64deU, 0x4be65bc8f48afU
+    },
+    {
+      0x0fba257c26234U, 0x75bd60cf163aaU, 0x14e2bd5ef5208U, 0x39f61586e3753U, 0x5665eec6351daU,
+      0x07feba36e7028U, 0x003bb19c68f09U, 0x4c312257cfc4cU, 0x515c9a7d896a5U, 0x056c244d397f0U,
+      0x6e00943bfb210U, 0x0e41001585b67U, 0x6f6199d25c806U, 0x49c1355aeb0b9U, 0x20b209c2ab204U
+    },
+    {
+      0x4a94516bd3289U, 0x54828408503f9U, 0x2957589123596U, 0x66c2ce1dbd90bU, 0x49992cc64e612U,
+      0x6342ac07fb34bU, 0x10426e7b26a93U, 0x347d59c0b6088U, 0x3c25e1316b856U, 0x7a92c9fdfbcacU,
+      0x51bea70f801deU, 0x01fc93c514cb7U, 0x6cab9286fbedfU, 0x504d4318366d8U, 0x3b7ac0cd265c2U
+    },
+    {
+      0x54e4f22ed39a7U, 0x3cac102a15e1aU, 0x76ba1d68aaba4U, 0x4c97a10d974f6U, 0x31bc531d6b7deU,
+      0x3ee438c01bcecU, 0x4b81f78e77045U, 0x654ffa54c32d4U, 0x7ada428c81a60U, 0x265cc261e09a0U,
+      0x5134da980f971U, 0x224434454fbe7U, 0x6ab5b61e93ee3U, 0x12f1efbea101aU, 0x2a14edcc6a1a1U
+    }
+  },
+#endif
+#if 6 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x28c570478433cU, 0x1d8502873a463U, 0x7641e7eded49cU, 0x1ecedd54cf571U, 0x2c03f5256c2b0U,
+      0x0ee0752cfce4eU, 0x660dd8116fbe9U, 0x55167130fffebU, 0x1c682b885955cU, 0x161d25fa963eaU,
+      0x718757b53a47dU, 0x619e18b0f2f21U, 0x5fbdfe4c1ec04U, 0x5d798c81ebb92U, 0x699468bdbd96bU
+    },
+    {
+      0x53de66aa91948U, 0x045f81a599b1bU, 0x3f7a8bd214193U, 0x71d4da412331aU, 0x293e1c4e6c4a2U,
+      0x72f46f4dafecfU, 0x2948ffadef7a3U, 0x11ecdfdf3bc04U, 0x3c2e98ffeed25U, 0x525219a473905U,
+      0x6134b925112e1U, 0x6bb942bb406edU, 0x070c445c0dde2U, 0x411d822c4d7a3U, 0x5b605c447f032U
+    },
+    {
+      0x1fec6f0e7f04cU, 0x3cebc692c477dU, 0x077986a19a95eU, 0x6eaaaa1778b0fU, 0x2f12fef4cc5abU,
+      0x5805920c47c89U, 0x1924771f9972cU, 0x38bbddf9fc040U, 0x1f7000092b281U, 0x24a76dcea8aebU,
+      0x522b2dfc0c740U, 0x7e8193480e148U, 0x33fd9a04341b9U, 0x3c863678a20bcU, 0x5e607b2518a43U
+    },
+    {
+      0x4431ca596cf14U, 0x015da7c801405U, 0x03c9b6f8f10b5U, 0x0346922934017U, 0x201f33139e457U,
+      0x31d8f6cdf1818U, 0x1f86c4b144b16U, 0x39875b8d73e9dU, 0x2fbf0d9ffa7b3U, 0x5067acab6ccddU,
+      0x27f6b08039d51U, 0x4802f8000dfaaU, 0x09692a062c525U, 0x1baea91075817U, 0x397cba8862460U
+    },
+    {
+      0x5c3fbc81379e7U, 0x41bbc255e2f02U, 0x6a3f756998650U, 0x1297fd4e07c42U, 0x771b4022c1e1cU,
+      0x13093f05959b2U, 0x1bd352f2ec618U, 0x075789b88ea86U, 0x61d1117ea48b9U, 0x2339d320766e6U,
+      0x5d986513a2fa7U, 0x63f3a99e11b0fU, 0x28a0ecfd6b26dU, 0x53b6835e18d8fU, 0x331a189219971U
+    },
+    {
+      0x12f3a9d7572afU, 0x10d00e953c4caU, 0x603df116f2f8aU, 0x33dc276e0e088U, 0x1ac9619ff649aU,
+      0x66f45fb4f80c6U, 0x3cc38eeb9fea2U, 0x107647270db1fU, 0x710f1ea740dc8U, 0x31167c6b83bdfU,
+      0x33842524b1068U, 0x77dd39d30fe45U, 0x189432141a0d0U, 0x088fe4eb8c225U, 0x612436341f08bU
+    },
+    {
+      0x349e31a2d2638U, 0x0137a7fa6b16cU, 0x681ae92777edcU, 0x222bfc5f8dc51U, 0x1522aa3178d90U,
+      0x541db874e898dU, 0x62d80fb841b33U, 0x03e6ef027fa97U, 0x7a03c9e9633e8U, 0x46ebe2309e5efU,
+      0x02f5369614938U, 0x356e5ada20587U, 0x11bc89f6bf902U, 0x036746419c8dbU, 0x45fe70f505243U
+    },
+    {
+      0x24920c8951491U, 0x107ec61944c5eU, 0x72752e017c01fU, 0x122b7dda2e97aU, 0x16619f6db57a2U,
+      0x075a6960c0b8cU, 0x6dde1c5e41b49U, 0x42e3f516da341U, 0x16a03fda8e79eU, 0x428d1623a0e39U,
+      0x74a4401a308fdU, 0x06ed4b9558109U, 0x746f1f6a08867U, 0x4636f5c6f2321U, 0x1d81592d60bd3U
+    }
+  },
+#endif
+#if 7 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x2369a2f89c8a1U, 0x3af91bd01a749U, 0x3b680558c4de8U, 0x01fde5600453cU, 0x2cb8b3a5b483bU,
+      0x3d7beec2a4c38U, 0x06159841dbb06U, 0x37dd604b2458aU, 0x540f49d23d549U, 0x702d67a3333c4U,
+      0x417cbcb1b90a1U, 0x54fe22f29c6dcU, 0x16f181ccecf76U, 0x1069fa8840444U, 0x24141dc0e6a80U
+    },
+    {
+      0x25dccbd83157dU, 0x2645990129232U, 0x6435b90f28481U, 0x33d9472bf8c1fU, 0x1a4714cede2e7U,
+      0x73c773fefee9dU, 0x13839f313ab3eU, 0x0b9517ecfc7beU, 0x23e71aefda170U, 0x5766120b47a1bU,
+      0x0ba0fb8b6b7ffU, 0x6ceea23f43b64U, 0x7c0b626dccb0eU, 0x2f8d495a8e04cU, 0x4f3875ad489caU
+    },
+    {
+      0x513f6ee73eec0U, 0x5ad2221762f3dU, 0x00e1832971949U, 0x4faf2449461c3U, 0x722a1446fd705U,
+      0x4762f4932ab22U, 0x6e5e9878378ffU, 0x2a257a1eb03b7U, 0x040afb5aad54dU, 0x3680274dad0a0U,
+      0x59fe9a8cf8819U, 0x2108eb5339a12U, 0x2c2731742a655U, 0x04ab7560b9990U, 0x628ecf04331b1U
+    },
+    {
+      0x1acf85c74ccf1U, 0x02104ca4a3368U, 0x6b6c51ed9ccc6U, 0x207cce4957688U, 0x7a47d70d34ecbU,
+      0x4b118a9d0ddbcU, 0x6811690057317U, 0x29ac413b91278U, 0x0aec38449135cU, 0x685f349a45c79U,
+      0x0c4cbcc43a4f5U, 0x146cef7d52c14U, 0x7e3d7b5dd719bU, 0x6e050bd50ba97U, 0x11ded9020e01fU
+    },
+    {
+      0x795b03bea93b7U, 0x28662757a68e3U, 0x5f8fdec154b5fU, 0x5f65ec9b87170U, 0x7b120f1db20e5U,
+      0x67809caefe704U, 0x5bc61d18d9121U, 0x2bac7261ca0a5U, 0x18fa62e6951c9U, 0x194263d157715U,
+      0x2fb3d86502d7aU, 0x08a14d26a42faU, 0x03b5d76d59361U, 0x3553ed4b16453U, 0x00d0f85b31873U
+    },
+    {
+      0x53c1efd7621c1U, 0x4e88ace3eb4ceU, 0x6c8f045a702d2U, 0x3e6cb8fa93a02U, 0x387bc74851a8cU,
+      0x3142e777c84fdU, 0x0e0b5180c52f1U, 0x7984b1fd00991U, 0x519d33d6a8df3U, 0x2f7b459698dd6U,
+      0x14b4d4a52a9a8U, 0x25ed71065f031U, 0x06f58e2b764f8U, 0x3668c26c2a45bU, 0x3f1c62dbd6c9fU
+    },
+    {
+      0x53e40148f693dU, 0x4329d734e47f5U, 0x13d38bc14995bU, 0x0c597a6e5fe8cU, 0x406f8db1c482eU,
+      0x71f0091910c1fU, 0x417fe5c2585d1U, 0x249d0e2937d3fU, 0x47d30632b0577U, 0x6338283facefcU,
+      0x30d2c7f191ee4U, 0x03787fece13ccU, 0x3edcf113efe0cU, 0x7d2bc3ec7273dU, 0x50d83d5be8f58U
+    },
+    {
+      0x4cf90b4d3b66dU, 0x4ac2e65cc1815U, 0x31ac2ea9c1677U, 0x372019e8fbc38U, 0x584161cd26d94U,
+      0x03916c11a1897U, 0x5fca0da0110adU, 0x192f404b5a693U, 0x3e31cd789bc7bU, 0x6594213136151U,
+      0x2b1a072d27ca2U, 0x33f7bd8e0977eU, 0x18ae07afce4f1U, 0x2c4f4c6dde771U, 0x02eebd0b3029bU
+    }
+  },
+#endif
+#if 8 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5b69f7b85c5e8U, 0x17a2d175650ecU, 0x4cc3e6dbfc19eU, 0x73e1d3873be0eU, 0x3a5f6d51b0af8U,
+      0x68756a60dac5fU, 0x55d757b8aec26U, 0x3383df45f80bdU, 0x6783f8c9f96a6U, 0x20234a7789ecdU,
+      0x20db67178b252U, 0x73aa3da2c0edaU, 0x79045c01c70d3U, 0x1b37b15251059U, 0x7cd682353cffeU
+    },
+    {
+      0x5cd6068acf4f3U, 0x3079afc7a74ccU, 0x58097650b64b4U, 0x47fabac9c4e99U, 0x3ef0253b2b2cdU,
+      0x1a45bd887fab6U, 0x65748076dc17cU, 0x5b98000aa11a8U, 0x4a1ecc9080974U, 0x2838c8863bdc0U,
+      0x3b0cf4a465030U, 0x022b8aef57a2dU, 0x2ad0677e925adU, 0x4094167d7457aU, 0x21dcb8a606a82U
+    },
+    {
+      0x500fabe7731baU, 0x7cc53c3113351U, 0x7cf65fe080d81U, 0x3c5d966011ba1U, 0x5d840dbf6c6f6U,
+      0x004468c9d9fc8U, 0x5da8554796b8cU, 0x3b8be70950025U, 0x6d5892da6a609U, 0x0bc3d08194a31U,
+      0x6380d309fe18bU, 0x4d73c2cb8ee0dU, 0x6b882adbac0b6U, 0x36eabdddd4cbeU, 0x3a4276232ac19U
+    },
+    {
+      0x0c172db447ecbU, 0x3f8c505b7a77fU, 0x6a857f97f3f10U, 0x4fcc0567fe03aU, 0x0770c9e824e1aU,
+      0x2432c8a7084faU, 0x47bf73ca8a968U, 0x1639176262867U, 0x5e8df4f8010ceU, 0x1ff177cea16deU,
+      0x1d99a45b5b5fdU, 0x523674f2499ecU, 0x0f8fa26182613U, 0x58f7398048c98U, 0x39f264fd41500U
+    },
+    {
+      0x34aabfe097be1U, 0x43bfc03253a33U, 0x29bc7fe91b7f3U, 0x0a761e4844a16U, 0x65c621272c35fU,
+      0x53417dbe7e29cU, 0x54573827394f5U, 0x565eea6f650ddU, 0x42050748dc749U, 0x1712d73468889U,
+      0x389f8ce3193ddU, 0x2d424b8177ce5U, 0x073fa0d3440cdU, 0x139020cd49e97U, 0x22f9800ab19ceU
+    },
+    {
+      0x29fdd9a6efdacU, 0x7c694a9282840U, 0x6f7cdeee44b3aU, 0x55a3207b25cc3U, 0x4171a4d38598cU,
+      0x2368a3e9ef8cbU, 0x454aa08e2ac0bU, 0x490923f8fa700U, 0x372aa9ea4582fU, 0x13f416cd64762U,
+      0x758aa99c94c8cU, 0x5f6001700ff44U, 0x7694e488c01bdU, 0x0d5fde948eed6U, 0x508214fa574bdU
+    },
+    {
+      0x215bb53d003d6U, 0x1179e792ca8c3U, 0x1a0e96ac840a2U, 0x22393e2bb3ab6U, 0x3a7758a4c86cbU,
+      0x269153ed6fe4bU, 0x72a23aef89840U, 0x052be5299699cU, 0x3a5e5ef132316U, 0x22f960ec6fabaU,
+      0x111f693ae5076U, 0x3e3bfaa94ca90U, 0x445799476b887U, 0x24a0912464879U, 0x5d9fd15f8de7fU
+    },
+    {
+      0x44d2aeed7521eU, 0x50865d2c2a7e4U, 0x2705b5238ea40U, 0x46c70b25d3b97U, 0x3bc187fa47eb9U,
+      0x408d36d63727fU, 0x5faf8f6a66062U, 0x2bb892da8de6bU, 0x769d4f0c7e2e6U, 0x332f35914f8fbU,
+      0x70115ea86c20cU, 0x16d88da24ada8U, 0x1980622662adfU, 0x501ebbc195a9dU, 0x450d81ce906fbU
+    }
+  },
+#endif
+#if 9 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x64d66b2cae0b5U, 0x67d794caec464U, 0x3492b21f6ebb4U, 0x28801875f6b78U, 0x2a887f78f7635U,
+      0x64d2ad8453902U, 0x1dd1b65a3bf15U, 0x74b0479c06016U, 0x53cd559ccafe3U, 0x53b16d2324cccU,
+      0x3b9e75c012d4fU, 0x2395c3e5d4544U, 0x575c328325d19U, 0x1fa97db1939b3U, 0x0ba7250b86440U
+    },
+    {
+      0x3589386f86d9cU, 0x6dc2750b49bacU, 0x2a9f55d85a645U, 0x6fd972888caa7U, 0x32c21b57fb60bU,
+      0x518fd029c6421U, 0x4312531e05761U, 0x4943a5af0b450U, 0x0e4c1a3fc7345U, 0x7b9f2fe8032d7U,
+      0x023cd319e0780U, 0x0312eeeb8bb0fU, 0x02acfdfbf133fU, 0x1b8a42a7d894dU, 0x12c49d417238cU
+    },
+    {
+      0x3a01783799542U, 0x1f55abdc7e136U, 0x5c0527d89b742U, 0x264dd005e7775U, 0x1421b246a0a44U,
+      0x0b533ffe83769U, 0x3b1c3ad7a212aU, 0x40b9440861870U, 0x55a78116c1c09U, 0x2509200c6391cU,
+      0x43a8e8c24a7c7U, 0x01b1e0bdea954U, 0x4fae7701307d5U, 0x671d6dd2f0605U, 0x2ab5504448a49U
+    },
+    {
+      0x7ac631c5d3afaU, 0x63f3bf18d9b80U, 0x5cf8ac1618545U, 0x0aeb9503cec4eU, 0x7301f4ceb4eaeU,
+      0x227266f0f5decU, 0x02bdaa10485daU, 0x1a350566093b9U, 0x11fc03df63e4aU, 0x7093bae1b521eU,
+      0x1e759d6722c41U, 0x1ee57ee536c81U, 0x08795a699d387U, 0x591de0512759eU, 0x390167d24ebacU
+    },
+    {
+      0x3054ba2f2120bU, 0x5d620b136faf7U, 0x703b6fb8ae73aU, 0x5b49ff45d6479U, 0x4cbd40767112cU,
+      0x58e3bba353f1cU, 0x1b7ed486c24feU, 0x1589941311dd9U, 0x22ed7dde272b7U, 0x07db2ee6aae1aU,
+      0x03cc029c58176U, 0x04b962bac216cU, 0x3c2b63566238eU, 0x14395db0a09eeU, 0x7b8eec6c74183U
+    },
+    {
+      0x6e570fc386b73U, 0x03b475198e65fU, 0x25a0d676a2c05U, 0x42acbaffe8564U, 0x6ee809a1b132aU,
+      0x240782cd27cb0U, 0x47f7d2cf7bc99U, 0x3507a7b6be70cU, 0x726d94de9a545U, 0x72810497626edU,
+      0x4bb31fcfd863aU, 0x147c9c918b288U, 0x223e894bf8da4U, 0x4976e14e433e8U, 0x13bd1e38d1732U
+    },
+    {
+      0x7b5cf1dfac521U, 0x62deaa88a0447U, 0x645deb0c97094U, 0x25e8185cc6bb2U, 0x1ed018b64f88aU,
+      0x34cd8696149b5U, 0x2f03b1556fa65U, 0x048ae539564dfU, 0x4d805e59093d7U, 0x41e86fcfb1409U,
+      0x0dfa1b802a6b0U, 0x0e855a77aa6c6U, 0x3169352203e1dU, 0x2ec857c86b677U, 0x746a247a37cdcU
+    },
+    {
+      0x4d85278d941edU, 0x07a45ef086dd9U, 0x6ff36dc8952baU, 0x271629168173dU, 0x681e3351bff0eU,
+      0x1b8bd2b7b9af6U, 0x6a6ff8b6a3aa6U, 0x64d51b5401424U, 0x7a49197e792e2U, 0x20a365142bb40U,
+      0x4b59d83034f45U, 0x643f441df716cU, 0x1954390be2dc7U, 0x395b4924a4addU, 0x539ef98e45d54U
+    }
+  },
+#endif
+#if 10 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4d8961cae743fU, 0x6bdc38c7dba0eU, 0x7d3b4a7e1b463U, 0x0844bdee2adf3U, 0x4cbad279663abU,
+      0x3b6a1a6205275U, 0x2e82791d06dcfU, 0x23d72caa93c87U, 0x5f0b7ab68aaf4U, 0x2de25d4ba6345U,
+      0x19024a0d71fcdU, 0x15f65115f101aU, 0x4e99067149708U, 0x119d8d1cba5afU, 0x7d7fbcefe2007U
+    },
+    {
+      0x45dc5f3c29094U, 0x3455220b579afU, 0x070c1631e068aU, 0x26bc0630e9b21U, 0x4f9cd196dcd8dU,
+      0x71e6a266b2801U, 0x09aae73e2df5dU, 0x40dd8b219b1a3U, 0x546fb4517de0dU, 0x5975435e87b75U,
+      0x297d86a7b3768U, 0x4835a2f4c6332U, 0x070305f434160U, 0x183dd014e56aeU, 0x7ccdd084387a0U
+    },
+    {
+      0x484186760cc93U, 0x7435665533361U, 0x02f686336b801U, 0x5225446f64331U, 0x3593ca848190cU,
+      0x6422c6d260417U, 0x212904817bb94U, 0x5a319deb854f5U, 0x7a9d4e060da7dU, 0x428bd0ed61d0cU,
+      0x3189a5e849aa7U, 0x6acbb1f59b242U, 0x7f6ef4753630cU, 0x1f346292a2da9U, 0x27398308da2d6U
+    },
+    {
+      0x10e4c0a702453U, 0x4daafa37bd734U, 0x49f6bdc3e8961U, 0x1feffdcecdae6U, 0x572c2945492c3U,
+      0x38d28435ed413U, 0x4064f19992858U, 0x7680fbef543cdU, 0x1aadd83d58d3cU, 0x269597aebe8c3U,
+      0x7c745d6cd30beU, 0x27c7755df78efU, 0x1776833937fa3U, 0x5405116441855U, 0x7f985498c05bcU
+    },
+    {
+      0x615520fbf6363U, 0x0b9e9bf74da6aU, 0x4fe8308201169U, 0x173f76127de43U, 0x30f2653cd69b1U,
+      0x1ce889f0be117U, 0x36f6a94510709U, 0x7f248720016b4U, 0x1821ed1e1cf91U, 0x76c2ec470a31fU,
+      0x0c938aac10c85U, 0x41b64ed797141U, 0x1beb1c1185e6dU, 0x1ed5490600f07U, 0x2f1273f159647U
+    },
+    {
+      0x08bd755a70bc0U, 0x49e3a885ce609U, 0x16585881b5ad6U, 0x3c27568d34f5eU, 0x38ac1997edc5fU,
+      0x1fc7c8ae01e11U, 0x2094d5573e8e7U, 0x5ca3cbbf549d2U, 0x4f920ecc54143U, 0x5d9e572ad85b6U,
+      0x6b517a751b13bU, 0x0cfd370b180ccU, 0x5377925d1f41aU, 0x34e56566008a2U, 0x22dfcd9cbfe9eU
+    },
+    {
+      0x459b4103be0a1U, 0x59a4b3f2d2addU, 0x7d734c8bb8eebU, 0x2393cbe594a09U, 0x0fe9877824cdeU,
+      0x3d2e0c30d0cd9U, 0x3f597686671bbU, 0x0aa587eb63999U, 0x0e3c7b592c619U, 0x6b2916c05448cU,
+      0x334d10aba913bU, 0x045cdb581cfdbU, 0x5e3e0553a8f36U, 0x50bb3041effb2U, 0x4c303f307ff00U
+    },
+    {
+      0x403580dd94500U, 0x48df77d92653fU, 0x38a9fe3b349eaU, 0x0ea89850aafe1U, 0x416b151ab706aU,
+      0x23bd617b28c85U, 0x6e72ee77d5a61U, 0x1a972ff174ddeU, 0x3e2636373c60fU, 0x0d61b8f78b2abU,
+      0x0d7efe9c136b0U, 0x1ab1c89640ad5U, 0x55f82aef41f97U, 0x46957f317ed0dU, 0x191a2af74277eU
+    }
+  },
+#endif
+#if 11 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4b60b2fe09a14U, 0x5fb762e8fc13aU, 0x2d7f5bb0e13c2U, 0x5852c717544bcU, 0x519ef577b5e09U,
+      0x0095bab6f4985U, 0x369f7f5e35aaaU, 0x031d50013d335U, 0x1434ec7176895U, 0x2bc24e04b2212U,
+      0x3d7d91124cca9U, 0x0b7114e11c30cU, 0x5c0c7d5eb0205U, 0x57295e6b984c2U, 0x62337a6e8ab8fU
+    },
+    {
+      0x3324e1b3a1273U, 0x63020aa681a35U, 0x63065b86251f3U, 0x7341daecab3d4U, 0x7fa00425802e1U,
+      0x6f17f06ffca16U, 0x36d255c2d4979U, 0x53d0ac3781b87U, 0x16803a9b816b0U, 0x5f6041b45b921U,
+      0x31574028c2705U, 0x53b61aebfcfaaU, 0x632377600c5f5U, 0x4cc187fd67477U, 0x7e9de97bb6c3eU
+    },
+    {
+      0x4be62a24d40ddU, 0x2208a5a83fe00U, 0x29108d2e81966U, 0x377c0e22f70b1U, 0x4cb829d8a2226U,
+      0x0967b9e6585a3U, 0x4131d317242abU, 0x2ceb6b65f2673U, 0x67d08578a4db7U, 0x42181fe8f4d38U,
+      0x4aa8407b86681U, 0x3d164cea763b7U, 0x0123a04207c00U, 0x1161e6be73542U, 0x78af11633f25fU
+    },
+    {
+      0x1c00e7d65318cU, 0x39a1d0dbce648U, 0x702309b9afb97U, 0x6e188c596e17dU, 0x680d04a7fc603U,
+      0x6ebd40b50babcU, 0x4c504117dd082U, 0x7070db45421c8U, 0x6aed18a47d7dcU, 0x0d07daacd32d7U,
+      0x2414a695aa3ebU, 0x180b4d1e43f38U, 0x64e58fb6a90b1U, 0x271be3611cc3fU, 0x210e8cd30c395U
+    },
+    {
+      0x0f16137fe6c26U, 0x30adc809b056aU, 0x1587daf840af3U, 0x648895878a0a6U, 0x51b17bc8d028eU,
+      0x201f210a71c06U, 0x5de77f6043588U, 0x4d8cbdda99782U, 0x3a15e2161ae1cU, 0x56ea8db1865f0U,
+      0x5fb4bcf535119U, 0x73be221141ffeU, 0x0ee8c97d26275U, 0x3795efe7532cdU, 0x18a11f1174d1aU
+    },
+    {
+      0x63cdad27a5f2cU, 0x7915420daff7aU, 0x19290c3c03f12U, 0x742a9fdae0d47U, 0x04eaabe50c1a2U,
+      0x375ab3f6bba29U, 0x31323c905c80eU, 0x57e4ba67b0edbU, 0x570cce4074172U, 0x307c13b6fb0c0U,
+      0x51021cb8ab5e7U, 0x12b8a021d648eU, 0x1584287f08d11U, 0x66aaf8f38bda7U, 0x44da5f18c2710U
+    },
+    {
+      0x6fe6b89d8eaccU, 0x23c4624d4322aU, 0x513ad3b9ade51U, 0x1d75eba31ec9cU, 0x726373f676720U,
+      0x4c55ff1b82eb5U, 0x5a82395ca4067U, 0x7eeb34ec56b8dU, 0x30fdd205b0cc7U, 0x768edce1532e8U,
+      0x5ca72eb7ef68aU, 0x3ee1d5b647c60U, 0x3116da198b3ccU, 0x65e8c78137edaU, 0x513b5384b5d2eU
+    },
+    {
+      0x702878af34cebU, 0x13728dad5cbc4U, 0x2f6144a402c10U, 0x7c0b28975fbedU, 0x61d9b76988258U,
+      0x46280c729989eU, 0x20a6d14bba8daU, 0x5d96a252e4fefU, 0x111b1ef9fc0e8U, 0x34cebd64b9a0aU,
+      0x5a71349b7d94bU, 0x3047d7288d4d8U, 0x52120d28fcf45U, 0x097820b7de93bU, 0x69d45e6f2c708U
+    }
+  },
+#endif
+#if 12 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x62b434f460efbU, 0x294c6c0fad3fcU, 0x68368937b4c0fU, 0x5c9f82910875bU, 0x237e7dbe00545U,
+      0x6f74bc53c1431U, 0x1c40e5dbbd9c2U, 0x6c8fb9cae5c97U, 0x4845c5ce1b7daU, 0x7e2e0e450b5ccU,
+      0x575ed6701b430U, 0x4d3e17fa20026U, 0x791fc888c4253U, 0x2f1ba99078ac1U, 0x71afa699b1115U
+    },
+    {
+      0x23c1c473b50d6U, 0x3e7671de21d48U, 0x326fa5547a1e8U, 0x50e4dc25fafd9U, 0x00731fbc78f89U,
+      0x66f9b3953b61dU, 0x555f4283cccb9U, 0x7dd67fb1960e7U, 0x14707a1affed4U, 0x021142e9c2b1cU,
+      0x0c71848f81880U, 0x44bd9d8233c86U, 0x6e8578efe5830U, 0x4045b6d7041b5U, 0x4c4d6f3347e15U
+    },
+    {
+      0x4ddfc988f1970U, 0x4f6173ea365e1U, 0x645daf9ae4588U, 0x7d43763db623bU, 0x38bf9500a88f9U,
+      0x7eccfc17d1fc9U, 0x4ca280782831eU, 0x7b8337db1d7d6U, 0x5116def3895fbU, 0x193fddaaa7e47U,
+      0x2c93c37e8876fU, 0x3431a28c583faU, 0x49049da8bd879U, 0x4b4a8407ac11cU, 0x6a6fb99ebf0d4U
+    },
+    {
+      0x122b5b6e423c6U, 0x21e50dff1ddd6U, 0x73d76324e75c0U, 0x588485495418eU, 0x136fda9f42c5eU,
+      0x6c1bb560855ebU, 0x71f127e13ad48U, 0x5c6b304905aecU, 0x3756b8e889bc7U, 0x75f76914a3189U,
+      0x4dfb1a305bdd1U, 0x3b3ff05811f29U, 0x6ed62283cd92eU, 0x65d1543ec52e1U, 0x022183510be8dU
+    },
+    {
+      0x2710143307a7fU, 0x3d88fb48bf3abU, 0x249eb4ec18f7aU, 0x136115dff295fU, 0x1387c441fd404U,
+      0x766385ead2d14U, 0x0194f8b06095eU, 0x08478f6823b62U, 0x6018689d37308U, 0x6a071ce17b806U,
+      0x3c3d187978af8U, 0x7afe1c88276baU, 0x51df281c8ad68U, 0x64906bda4245dU, 0x3171b26aaf1edU
+    },
+    {
+      0x5b7d8b28a47d1U, 0x2c2ee149e34c1U, 0x776f5629afc53U, 0x1f4ea50fc49a9U, 0x6c514a6334424U,
+      0x7319097564ca8U, 0x1844ebc233525U, 0x21d4543fdeee1U, 0x1ad27aaff1bd2U, 0x221fd4873cf08U,
+      0x2204f3a156341U, 0x537414065a464U, 0x43c0c3bedcf83U, 0x5557e706ea620U, 0x48daa596fb924U
+    },
+    {
+      0x61d5dc84c9793U, 0x47de83040c29eU, 0x189deb26507e7U, 0x4d4e6fadc479aU, 0x58c837fa0e8a7U,
+      0x28e665ca59cc7U, 0x165c715940dd9U, 0x0785f3aa11c95U, 0x57b98d7e38469U, 0x676dd6fccad84U,
+      0x1688596fc9058U, 0x66f6ad403619fU, 0x4d759a87772efU, 0x7856e6173bea4U, 0x1c4f73f2c6a57U
+    },
+    {
+      0x6706efc7c3484U, 0x6987839ec366dU, 0x0731f95cf7f26U, 0x3ae758ebce4bcU, 0x70459adb7daf6U,
+      0x24fbd305fa0bbU, 0x40a98cc75a1cfU, 0x78ce1220a7533U, 0x6217a10e1c197U, 0x795ac80d1bf64U,
+      0x1db4991b42bb3U, 0x469605b994372U, 0x631e3715c9a58U, 0x7e9cfefcf728fU, 0x5fe162848ce21U
+    }
+  },
+#endif
+#if 13 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x429c795115389U, 0x0f0c5ee99c62bU, 0x649d0cb5f8394U, 0x0f206253b10c2U, 0x72de6c984a25aU,
+      0x10aae4d077c41U, 0x61b6e8d347c4fU, 0x2f45a8a2e4e09U, 0x5b9375b196e45U, 0x720814ecaa064U,
+      0x2b553bf6aa310U, 0x5300dadc375d3U, 0x7fd44e4142942U, 0x0c5c95dba01d6U, 0x0394d27645be6U
+    },
+    {
+      0x16425b23545a4U, 0x7d31f7652dea7U, 0x5bf7618569e89U, 0x27755b6295e31U, 0x79d995a841933U,
+      0x72251857eedf4U, 0x3bc33d278a9aaU, 0x5e5c0d78dc93bU, 0x3a1c538a10705U, 0x3b3c833687abeU,
+      0x28ea61195dd75U, 0x503bb3505f9b1U, 0x561e6da941362U, 0x5452a06e540d1U, 0x60dd16a379c86U
+    },
+    {
+      0x1d6f8153e47b8U, 0x282945ec186a0U, 0x576548edea59dU, 0x5450897745b22U, 0x4e62a3c18112eU,
+      0x2c8487381e559U, 0x4daf0105966b4U, 0x69ed94d65bffaU, 0x342e5cbb8f5edU, 0x5a08b5019b4daU,
+      0x4ac04516ab786U, 0x42a52b647b91aU, 0x408c305656bccU, 0x0e66b76e91a6dU, 0x0929efe8825b4U
+    },
+    {
+      0x172b7ad56651dU, 0x747f57ae2f166U, 0x137db9005606dU, 0x42796e4a6fb21U, 0x30376e5d2c292U,
+      0x601d1cbd0f2d3U, 0x5ec26576febe0U, 0x6377a1dcdb904U, 0x29e41b0221911U, 0x1e3a5272f5c07U,
+      0x18da78159a59cU, 0x327e0e27e7a52U, 0x3359641af7073U, 0x0942b2fbd49a5U, 0x53daacec4cb4cU
+    },
+    {
+      0x52bc3852cfdb0U, 0x2ab3adda17330U, 0x56b09ecb304baU, 0x74cb87cf15fcdU, 0x4f3b8c117959aU,
+      0x73bd79cc8a7d6U, 0x1e8fd35364994U, 0x3d7f8013529ceU, 0x3a97a65f894a1U, 0x01a13ff9bdbf0U,
+      0x6c9c82ff26412U, 0x123f6ccf50ab6U, 0x5de2fc86b12a3U, 0x1df6a93dfe7f5U, 0x303337da7012aU
+    },
+    {
+      0x53ccbfad2fdd1U, 0x2e6f4c81512edU, 0x4d32c972e220eU, 0x69597f8060eb3U, 0x269ff4dc789c2U,
+      0x422228c1c9d7cU, 0x6e3536681f2aaU, 0x16d235c07eb04U, 0x18dbf46c8bbc9U, 0x53f8ad5661b3eU,
+      0x03fbdc08d678dU, 0x46fd5a562e180U, 0x3960bc53660beU, 0x522603f35e6d9U, 0x296c7291df412U
+    },
+    {
+      0x23205dab8b59eU, 0x41901244a1bf6U, 0x1c97461196baaU, 0x3e8e899e08c4dU, 0x2327370261f11U,
+      0x3de2b33daf397U, 0x33934c4966f20U, 0x56cf86343fc18U, 0x3e0450e9295aaU, 0x2b6d581c52e0bU,
+      0x543d3623e7986U, 0x0584f146a87a0U, 0x1865bd99e5053U, 0x55d5721f86639U, 0x7836c41f8245eU
+    },
+    {
+      0x51e848011937cU, 0x5cdde8345194cU, 0x4fe354b1ac311U, 0x4fedb810dd3afU, 0x119dff99ead7bU,
+      0x254db49e95a81U, 0x2011615ae7cf4U, 0x02bf01d464b57U, 0x79c269072d8e8U, 0x5d55f8012cf25U,
+      0x2dfcbf4b31d4dU, 0x682229112487dU, 0x034ec5f1940fdU, 0x5647f77346283U, 0x329293b3dd4a0U
+    }
+  },
+#endif
+#if 14 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x1852d5d7cb208U, 0x60d0fbe5ce50fU, 0x5a1e246e37b75U, 0x51aee05ffd590U, 0x2b44c043677daU,
+      0x1214fe194961aU, 0x0e1ae39a9e9cbU, 0x543c8b526f9f7U, 0x119498067e91dU, 0x4789d446fc917U,
+      0x487ab074eb78eU, 0x1d33b5e8ce343U, 0x13e419feb1b46U, 0x2721f565de6a4U, 0x60c52eef2bb9aU
+    },
+    {
+      0x3c5c27cae6d11U, 0x36a9491956e05U, 0x124bac9131da6U, 0x3b6f7de202b5dU, 0x70d77248d9b66U,
+      0x589bc3bfd8bf1U, 0x6f93e6aa3416bU, 0x4c0a3d6c1ae48U, 0x55587260b586aU, 0x10bc9c312ccfcU,
+      0x2e84b3ec2a05bU, 0x69da2f03c1551U, 0x23a174661a67bU, 0x209bca289f238U, 0x63755bd3a976fU
+    },
+    {
+      0x7101897f1acb7U, 0x3d82cb77b07b8U, 0x684083d7769f5U, 0x52b28472dce07U, 0x2763751737c52U,
+      0x7a03e2ad10853U, 0x213dcc6ad36abU, 0x1a6e240d5bdd6U, 0x7c24ffcf8fedfU, 0x0d8cc1c48bc16U,
+      0x402d36eb419a9U, 0x7cef68c14a052U, 0x0f1255bc2d139U, 0x373e7d431186aU, 0x70c2dd8a7ad16U
+    },
+    {
+      0x4967db8ed7e13U, 0x15aeed02f523aU, 0x6149591d094bcU, 0x672f204c17006U, 0x32b8613816a53U,
+      0x194509f6fec0eU, 0x528d8ca31acacU, 0x7826d73b8b9faU, 0x24acb99e0f9b3U, 0x2e0fac6363948U,
+      0x7f7bee448cd64U, 0x4e10f10da0f3cU, 0x3936cb9ab20e9U, 0x7a0fc4fea6cd0U, 0x4179215c735a4U
+    },
+    {
+      0x633b9286bcd34U, 0x6cab3badb9c95U, 0x74e387edfbdfaU, 0x14313c58a0fd9U, 0x31fa85662241cU,
+      0x094e7d7dced2aU, 0x068fa738e118eU, 0x41b640a5fee2bU, 0x6bb709df019d4U, 0x700344a30cd99U,
+      0x26c422e3622f4U, 0x0f3066a05b5f0U, 0x4e2448f0480a6U, 0x244cde0dbf095U, 0x24bb2312a9952U
+    },
+    {
+      0x00c2af5f85c6bU, 0x0609f4cf2883fU, 0x6e86eb5a1ca13U, 0x68b44a2efccd1U, 0x0d1d2af9ffeb5U,
+      0x0ed1732de67c3U, 0x308c369291635U, 0x33ef348f2d250U, 0x004475ea1a1bbU, 0x0fee3e871e188U,
+      0x28aa132621edfU, 0x42b244caf353bU, 0x66b064cc2e08aU, 0x6bb20020cbdd3U, 0x16acd79718531U
+    },
+    {
+      0x1c6c57887b6adU, 0x5abf21fd7592bU, 0x50bd41253867aU, 0x3800b71273151U, 0x164ed34b18161U,
+      0x772af2d9b1d3dU, 0x6d486448b4e5bU, 0x2ce58dd8d18a8U, 0x1849f67503c8bU, 0x123e0ef6b9302U,
+      0x6d94c192fe69aU, 0x5475222a2690fU, 0x693789d86b8b3U, 0x1f5c3bdfb69dcU, 0x78da0fc61073fU
+    },
+    {
+      0x780f1680c3a94U, 0x2a35d3cfcd453U, 0x005e5cdc7ddf8U, 0x6ee888078ac24U, 0x054aa4b316b38U,
+      0x15d28e52bc66aU, 0x30e1e0351cb7eU, 0x30a2f74b11f8cU, 0x39d120cd7de03U, 0x2d25deeb256b1U,
+      0x0468d19267cb8U, 0x38cdca9b5fbf9U, 0x1bbb05c2ca1e2U, 0x3b015758e9533U, 0x134610a6ab7daU
+    }
+  },
+#endif
+#if 15 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x430e0dc028c3cU, 0x50a42f8ee3b22U, 0x26687e83ae556U, 0x21e2584f0f696U, 0x42881af2bd6a7U,
+      0x55ec27c59b23fU, 0x7c2a9a09e595eU, 0x50507d266bbb4U, 0x05134220eb970U, 0x140345133932aU,
+      0x6c69aab5cad3dU, 0x2699659f5af7fU, 0x4df5a8b08fa33U, 0x50c342ee8a5fdU, 0x0ad6d64415677U
+    },
+    {
+      0x4892847927e9fU, 0x5e6e1550eef22U, 0x4489c0ccf6b5bU, 0x2c90fc7927d08U, 0x5265ac2f2adf9U,
+      0x2439e417becb5U, 0x19a21c04ccf03U, 0x24ab0912b164eU, 0x119aed1c28883U, 0x11b065a2ade31U,
+      0x7dd309afcb346U, 0x0851cc7ea880bU, 0x596aabb65c8f5U, 0x404ca600ef82fU, 0x43e4dc3ae14c0U
+    },
+    {
+      0x77ac3adc2c6a3U, 0x6dd2e2f929d4dU, 0x117abd743a4a3U, 0x5df7169bcf56bU, 0x46dd8785c51ffU,
+      0x2c7f1a938a517U, 0x56630165c3782U, 0x73495291cc0a2U, 0x4879fbc2b8f7dU, 0x74e534426ff6fU,
+      0x001be375c8898U, 0x6bc7fb0690e13U, 0x48c1c512c1b6aU, 0x6213ac4067693U, 0x2b09468fdd2f4U
+    },
+    {
+      0x7946582ffa02aU, 0x23fd51ea92b72U, 0x5debe6f6825a9U, 0x73b5031a89bafU, 0x1bcfde61201d1U,
+      0x749eeb701cb96U, 0x296d46d3872f8U, 0x100b3660fd0e3U, 0x7bdb14b15c5cdU, 0x6976c7509888dU,
+      0x25490246a59a2U, 0x3dd0ffbb20949U, 0x48dc7eb58faf7U, 0x76b6ca1be3386U, 0x69e87308d30f8U
+    },
+    {
+      0x0bf028bc80303U, 0x66f4319df61f0U, 0x4b35a8daab85aU, 0x4d56ea3f523ebU, 0x61943588f4ed3U,
+      0x28bb15656beb0U, 0x749e9ab79486bU, 0x52301d7e3eb26U, 0x3115cd93c620aU, 0x3eb0ef76e892bU,
+      0x65c3e91039f85U, 0x7bede67553a4dU, 0x019aa4f03a79dU, 0x6eef44b462ab8U, 0x3c34d1881faaaU
+    },
+    {
+      0x30b8f2fffe0d9U, 0x207da49f737abU, 0x1a08711aa8950U, 0x1b51563ebde59U, 0x605b394b60dcaU,
+      0x52b5ea09f9ec0U, 0x5f6c4751207f3U, 0x3649b1076acedU, 0x1b6d04dd1f539U, 0x374193513fd8bU,
+      0x056e45a9d1ed2U, 0x6cd92f534569dU, 0x17bb9f7bfa121U, 0x647d88267b20fU, 0x2f50b81c88a71U
+    },
+    {
+      0x52ca0a7da522aU, 0x6c893604a056aU, 0x2e67ee4c8c2ccU, 0x511796262de52U, 0x7b2c674958074U,
+      0x23c61fc6811bbU, 0x10c423001e62eU, 0x6655d4e72d141U, 0x7e6bb4499e9a3U, 0x3491a53502752U,
+      0x165883ed28cdfU, 0x25a6c5bc73aaaU, 0x4de393c4b613fU, 0x73a0543a569f1U, 0x000d2b1f7c763U
+    },
+    {
+      0x4778c3e94a8abU, 0x1dd34f17d92c4U, 0x5d0f13c2b5bcfU, 0x6664a4563c086U, 0x76627935aaecfU,
+      0x20811d06d4a67U, 0x0b21c1ffc67a8U, 0x521ef7afbf012U, 0x5147c38635bdeU, 0x6e2a7316319afU,
+      0x0ac24d6d59a9fU, 0x7c612de00cad5U, 0x5314a67236dd4U, 0x08a23bfa0f347U, 0x588d851cf6c86U
+    }
+  },
+#endif
+#if 16 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x265e777d1f515U, 0x0f1f54c1e39a5U, 0x2f01b95522646U, 0x4fdd8db9dde6dU, 0x654878cba97ccU,
+      0x38ec78df6b0feU, 0x13caebea36a22U, 0x5ebc6e54e5f6aU, 0x32804903d0eb8U, 0x2102fdba2b20dU,
+      0x6e405055ce6a1U, 0x5024a35a532d3U, 0x1f69054daf29dU, 0x15d1d0d7a8bd5U, 0x0ad725db29ecbU
+    },
+    {
+      0x7bc0c9b056f85U, 0x51cfebffaffd8U, 0x44abbe94df549U, 0x7ecbbd7e33121U, 0x4f675f5302399U,
+      0x267b1834e2457U, 0x6ae19c378bb88U, 0x7457b5ed9d512U, 0x3280d783d05fbU, 0x4aefcffb71a03U,
+      0x536360415171eU, 0x2313309077865U, 0x251444334afbcU, 0x2b0c3853756e8U, 0x0bccbb72a2a86U
+    },
+    {
+      0x55e4c50fe1296U, 0x05fdd13efc30dU, 0x1c0c6c380e5eeU, 0x3e11de3fb62a8U, 0x6678fd69108f3U,
+      0x6962feab1a9c8U, 0x6aca28fb9a30bU, 0x56db7ca1b9f98U, 0x39f58497018ddU, 0x4024f0ab59d6bU,
+      0x6fa31636863c2U, 0x10ae5a67e42b0U, 0x27abbf01fda31U, 0x380a7b9e64fbcU, 0x2d42e2108ead4U
+    },
+    {
+      0x17b0d0f537593U, 0x16263c0c9842eU, 0x4ab827e4539a4U, 0x6370ddb43d73aU, 0x420bf3a79b423U,
+      0x5131594dfd29bU, 0x3a627e98d52feU, 0x1154041855661U, 0x19175d09f8384U, 0x676b2608b8d2dU,
+      0x0ba651c5b2b47U, 0x5862363701027U, 0x0c4d6c219c6dbU, 0x0f03dff8658deU, 0x745d2ffa9c0cfU
+    },
+    {
+      0x6df5721d34e6aU, 0x4f32f767a0c06U, 0x1d5abeac76e20U, 0x41ce9e104e1e4U, 0x06e15be54c1dcU,
+      0x25a1e2bc9c8bdU, 0x104c8f3b037eaU, 0x405576fa96c98U, 0x2e86a88e3876fU, 0x1ae23ceb960cfU,
+      0x25d871932994aU, 0x6b9d63b560b6eU, 0x2df2814c8d472U, 0x0fbbee20aa4edU, 0x58ded861278ecU
+    },
+    {
+      0x35ba8b6c2c9a8U, 0x1dea58b3185bfU, 0x4b455cd23bbbeU, 0x5ec19c04883f8U, 0x08ba696b531d5U,
+      0x73793f266c55cU, 0x0b988a9c93b02U, 0x09b0ea32325dbU, 0x37cae71c17c5eU, 0x2ff39de85485fU,
+      0x53eeec3efc57aU, 0x2fa9fe9022efdU, 0x699c72c138154U, 0x72a751ebd1ff8U, 0x120633b4947cfU
+    },
+    {
+      0x531474912100aU, 0x5afcdf7c0d057U, 0x7a9e71b788dedU, 0x5ef708f3b0c88U, 0x07433be3cb393U,
+      0x4987891610042U, 0x79d9d7f5d0172U, 0x3c293013b9ec4U, 0x0c2b85f39cacaU, 0x35d30a99b4d59U,
+      0x144c05ce997f4U, 0x4960b8a347fefU, 0x1da11f15d74f7U, 0x54fac19c0feadU, 0x2d873ede7af6dU
+    },
+    {
+      0x202e14e5df981U, 0x2ea02bc3eb54cU, 0x38875b2883564U, 0x1298c513ae9ddU, 0x0543618a01600U,
+      0x2316443373409U, 0x5de95503b22afU, 0x699201beae2dfU, 0x3db5849ff737aU, 0x2e773654707faU,
+      0x2bdf4974c23c1U, 0x4b3b9c8d261bdU, 0x26ae8b2a9bc28U, 0x3068210165c51U, 0x4b1443362d079U
+    }
+  },
+#endif
+#if 17 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x31c3f57c5715eU, 0x3cd6d0db20533U, 0x48d6ace5b2e4aU, 0x7f09802403223U, 0x2c435c24a44d9U,
+      0x037f753242cecU, 0x19808425e48f7U, 0x764a31495b712U, 0x603f1117dfdf0U, 0x48ea295bad8a2U,
+      0x7c97c80f8833fU, 0x71944bd8b60c0U, 0x07aedbc3a1455U, 0x4072a7ba2858bU, 0x7bcb4792a0defU
+    },
+    {
+      0x4d0a0045224c2U, 0x36d3ca72a439dU, 0x227da05d5fc6cU, 0x0a43badbd4929U, 0x1b6cc62016736U,
+      0x7e3d02bc73659U, 0x0a0b32f3bf090U, 0x2b5befd2ebe11U, 0x35b68be4bad6eU, 0x57369f0bdefc9U,
+      0x1990175638698U, 0x7ddd54c1a7e35U, 0x26e9220d4f746U, 0x188c24a3899a6U, 0x63fa6e6843adeU
+    },
+    {
+      0x5becdd24b5eb7U, 0x19819a89f2432U, 0x72a7b797907c6U, 0x6b3ef9403a220U, 0x07073b98f35b7U,
+      0x420536597c168U, 0x0131a50f13a2bU, 0x15ee87e7dcdd0U, 0x78a0c5773f899U, 0x3418bfda07346U,
+      0x4676c4ce530d4U, 0x0e76bbf3e9a07U, 0x6ce8c782d9301U, 0x164832e77c58cU, 0x3084d66153310U
+    },
+    {
+      0x4e876760321fdU, 0x213d6c75b134dU, 0x3201649ff8ad4U, 0x11d0073ea5745U, 0x73d86b7abb6f7U,
+      0x6b79ebf8469adU, 0x09c4cc626bc3eU, 0x5d0606c560040U, 0x39e4d24c19857U, 0x3ba2504f049b6U,
+      0x2b5606dba5ab6U, 0x1f7763db5616aU, 0x41298d6a44d3cU, 0x2ed9854a906cdU, 0x6813b8f37973eU
+    },
+    {
+      0x4ca56f3157e29U, 0x60bdea514be32U, 0x41666f04db4d5U, 0x1f6eea677bbc5U, 0x7d5472af24f83U,
+      0x4b054334127c1U, 0x7105f7fe4b30aU, 0x061bd3c417411U, 0x4806da4fbfca2U, 0x1768e838bed0bU,
+      0x7874daf33da47U, 0x3b6dc673f3a1dU, 0x273bb38034ef9U, 0x1ad1f954517ceU, 0x5d1aeb7923524U
+    },
+    {
+      0x7bfaeb61ba775U, 0x3fc4c77ffa258U, 0x210373ee13988U, 0x31a05a3d2e1aeU, 0x7e83be0bccaf8U,
+      0x66bb319cd63caU, 0x2443a0d073eb3U, 0x5432ad99c3056U, 0x151d836ab2d90U, 0x20fb199d104f1U,
+      0x43dee6d99c120U, 0x5c8c173fc0c32U, 0x3a1663618407cU, 0x2e635d978a8c7U, 0x76b76289fcc47U
+    },
+    {
+      0x5f1a1522ec0b3U, 0x6454eacada848U, 0x286cf01561e16U, 0x04f8ea42d12a4U, 0x60959eccd58feU,
+      0x34cc1756286faU, 0x2fae942af8f23U, 0x1caf79b6f3b4cU, 0x474bf399210f5U, 0x01fe18491131cU,
+      0x7eb7ba8ed7a09U, 0x77ca04f1387d7U, 0x04650a127f70aU, 0x7a52275e72e9eU, 0x35e1eb55be947U
+    },
+    {
+      0x56dfa726ccc74U, 0x7c5ea772ca29fU, 0x28b22d0ec2133U, 0x335799d727aa9U, 0x59aab07a0d401U,
+      0x2e701c5738dd3U, 0x6b64de37ddb7bU, 0x3c57bd3e71bd8U, 0x26c30f4b54021U, 0x3aa1d11faf60aU,
+      0x4ec4c925eac25U, 0x08c026ee70ef7U, 0x2a7d1446121c6U, 0x5232d9ba19bffU, 0x1865e78ec8e6aU
+    }
+  },
+#endif
+#if 18 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x454e91c529ccbU, 0x24c98c6bf72cfU, 0x0486594c3d89aU, 0x7ae13a3d7fa3cU, 0x17038418eaf66U,
+      0x4b7c7b66e1f7aU, 0x4bea185efd998U, 0x4fabc711055f8U, 0x1fb9f7836fe38U, 0x582f446752da6U,
+      0x17bd320324ce4U, 0x51489117898c6U, 0x1684d92a0410bU, 0x6e4d90f78c5a7U, 0x0c2a1c4bcda28U
+    },
+    {
+      0x4814869bd6945U, 0x7b7c391a45db8U, 0x57316ac35b641U, 0x641e31de9096aU, 0x5a6a9b30a314dU,
+      0x5c7d06f1f0447U, 0x7db70f80b3a49U, 0x6cb4a3ec89a78U, 0x43be8ad81397dU, 0x7c558bd1c6f64U,
+      0x41524d396463dU, 0x1586b449e1a1dU, 0x2f17e904aed8aU, 0x7e1d2861d3c8eU, 0x0404a5ca0afbaU
+    },
+    {
+      0x49e1b2a416fd1U, 0x51c6a0b316c57U, 0x575a59ed71bdcU, 0x74c021a1fec1eU, 0x39527516e7f8eU,
+      0x740070aa743d6U, 0x16b64cbdd1183U, 0x23f4b7b32eb43U, 0x319aba58235b3U, 0x46395bfdcadd9U,
+      0x7db2d1a5d9a9cU, 0x79a200b85422fU, 0x355bfaa71dd16U, 0x00b77ea5f78aaU, 0x76579a29e822dU
+    },
+    {
+      0x4b51352b434f2U, 0x1327bd01c2667U, 0x434d73b60c8a1U, 0x3e0daa89443baU, 0x02c514bb2a277U,
+      0x68e7e49c02a17U, 0x45795346fe8b6U, 0x089306c8f3546U, 0x6d89f6b2f88f6U, 0x43a384dc9e05bU,
+      0x3d5da8bf1b645U, 0x7ded6a96a6d09U, 0x6c3494fee2f4dU, 0x02c989c8b6bd4U, 0x1160920961548U
+    },
+    {
+      0x05616369b4dcdU, 0x4ecab86ac6f47U, 0x3c60085d700b2U, 0x0213ee10dfceaU, 0x2f637d7491e6eU,
+      0x5166929dacfaaU, 0x190826b31f689U, 0x4f55567694a7dU, 0x705f4f7b1e522U, 0x351e125bc5698U,
+      0x49b461af67bbeU, 0x75915712c3a96U, 0x69a67ef580c0dU, 0x54d38ef70cffcU, 0x7f182d06e7ce2U
+    },
+    {
+      0x54b728e217522U, 0x69a90971b0128U, 0x51a40f2a963a3U, 0x10be9ac12a6bfU, 0x44acc043241c5U,
+      0x48e64ab0168ecU, 0x2a2bdb8a86f4fU, 0x7343b6b2d6929U, 0x1d804aa8ce9a3U, 0x67d4ac8c343e9U,
+      0x56bbb4f7a5777U, 0x29230627c238fU, 0x5ad1a122cd7fbU, 0x0dea56e50e364U, 0x556d1c8312ad7U
+    },
+    {
+      0x06756b11be821U, 0x462147e7bb03eU, 0x26519743ebfe0U, 0x782fc59682ab5U, 0x097abe38cc8c7U,
+      0x740e30c8d3982U, 0x7c2b47f4682fdU, 0x5cd91b8c7dc1cU, 0x77fa790f9e583U, 0x746c6c6d1d824U,
+      0x1c9877ea52da4U, 0x2b37b83a86189U, 0x733af49310da5U, 0x25e81161c04fbU, 0x577e14a34bee8U
+    },
+    {
+      0x6cebebd4dd72bU, 0x340c1e442329fU, 0x32347ffd1a93fU, 0x14a89252cbbe0U, 0x705304b8fb009U,
+      0x268ac61a73b0aU, 0x206f234bebe1cU, 0x5b403a7cbebe8U, 0x7a160f09f4135U, 0x60fa7ee96fd78U,
+      0x51d354d296ec6U, 0x7cbf5a63b16c7U, 0x2f50bb3cf0c14U, 0x1feb385cac65aU, 0x21398e0ca1635U
+    }
+  },
+#endif
+#if 19 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5fc16861b7e9aU, 0x0ed44f88a30d8U, 0x7a4d65fda8cc1U, 0x7f580b33933d0U, 0x05ffb9cd6082dU,
+      0x2b2ca8da7d2efU, 0x3b33e8504e42dU, 0x774f1d4d9ab67U, 0x73157325c8027U, 0x403a395b53909U,
+      0x7fa9ff53f6139U, 0x4a27ccd96d4c2U, 0x5122a9183cad7U, 0x0c96bd45f77d9U, 0x7a2932856f5eaU
+    },
+    {
+      0x4444879639302U, 0x26a18cfe59713U, 0x06be7192b93c6U, 0x00bf859aed464U, 0x39d0003546871U,
+      0x1d761b02de888U, 0x7da4829c3e167U, 0x386a5017d5439U, 0x5ccd35fd22c11U, 0x050a2f7dfd447U,
+      0x43b33a650db77U, 0x3b758a576486fU, 0x6df4c61aebfa0U, 0x3677f4ca01696U, 0x2b5b7eec372baU
+    },
+    {
+      0x4404d613ac8f4U, 0x57f52fce594d2U, 0x73b08414030f0U, 0x47743a082690fU, 0x1b205fb38604aU,
+      0x44bbd83f50eefU, 0x331924f0cd677U, 0x2df99b9423c32U, 0x46ca1f3b2c3e4U, 0x0f7655a3a47f9U,
+      0x4ad37d24b133cU, 0x7ac0719216abdU, 0x0b1bfb9107851U, 0x65732b341d0ebU, 0x0157d5dc87e0eU
+    },
+    {
+      0x65514d71eb524U, 0x02bbe28b272a4U, 0x5379adf980f62U, 0x4280a3e6fa086U, 0x5293b1730437cU,
+      0x7af510354c13dU, 0x0b546e56c1e54U, 0x68f51c35e82c5U, 0x0b99434dcb502U, 0x6528e42d82460U,
+      0x0e0814bccf226U, 0x1b032df72647aU, 0x550796e4b1d17U, 0x4bc45b0bcb62cU, 0x40a44df0c021fU
+    },
+    {
+      0x16e514bc5d095U, 0x31f94d00950d9U, 0x09ba977c83502U, 0x567939b1ec4e4U, 0x39ca36565719cU,
+      0x069894f20ea6aU, 0x2298c40c31b55U, 0x42fe2fba8528fU, 0x6783000fe6584U, 0x35f4e822947e9U,
+      0x06f2f6f87b75cU, 0x400695c0e12eaU, 0x34d375b1892baU, 0x2c78f642b71d5U, 0x055b0be0e440eU
+    },
+    {
+      0x2a04b6ea33da2U, 0x2bc6c24dba9a2U, 0x113659d5f3d30U, 0x55648764b3af7U, 0x64ca348d2a985U,
+      0x1a17d89735d12U, 0x2bccc573e2c8dU, 0x0e55a076dbc9fU, 0x792cfe5d19435U, 0x363b8004d269aU,
+      0x08e19e4c4912dU, 0x1c394b9cd732bU, 0x16e6357bf30edU, 0x40ca29175307dU, 0x7064bbab1de4aU
+    },
+    {
+      0x0c06142542129U, 0x5d7d1ab721452U, 0x2aff86fcb8b0aU, 0x35fe7922c6dbbU, 0x02157ade83d62U,
+      0x1e1515a770641U, 0x0e9cff0073723U, 0x7c8c426a68b8bU, 0x3c5ba9392859eU, 0x756a7330ac27bU,
+      0x6972a1b9a038bU, 0x54fdc07f687c8U, 0x36ed328b93b99U, 0x2b1c0d1243bb7U, 0x1a944ee88ecd0U
+    },
+    {
+      0x0a859182362d6U, 0x6f149a3577768U, 0x61567dae67d55U, 0x1ad468c5a13baU, 0x26c20fe74d262U,
+      0x11d1151039372U, 0x6f33944dbdab5U, 0x4d9adacbb4ddeU, 0x4cad0b901567eU, 0x0730291bd6901U,
+      0x51d9fe9cc22f5U, 0x3251baaef8c91U, 0x490e7459af158U, 0x5a4a3e9f690b2U, 0x49d271acedaf8U
+    }
+  },
+#endif
+#if 20 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x0aaf9b4b75601U, 0x26b91b5ae44f3U, 0x6de808d7ab1c8U, 0x6a769675530b0U, 0x1bbfb284e98f7U,
+      0x5058a382b33f3U, 0x175a91816913eU, 0x4f6cdb96b8ae8U, 0x17347c9da81d2U, 0x5aa3ed9d95a23U,
+      0x777e9c7d96561U, 0x28e58f006ccacU, 0x541bbbb2cac49U, 0x3e63282994cecU, 0x4a07e14e5e895U
+    },
+    {
+      0x358cdc477a49bU, 0x3cc88fe02e481U, 0x721aab7f4e36bU, 0x0408cc9469953U, 0x50af7aed84afaU,
+      0x412cb980df999U, 0x5e78dd8ee29dcU, 0x171dff68c575dU, 0x2015dd2f6ef49U, 0x3f0bac391d313U,
+      0x7de0115f65be5U, 0x4242c21364dc9U, 0x6b75b64a66098U, 0x0033c0102c085U, 0x1921a316baebdU
+    },
+    {
+      0x2ad9ad9f3c18bU, 0x5ec1638339aebU, 0x5703b6559a83bU, 0x3fa9f4d05d612U, 0x7b049deca062cU,
+      0x22f7edfb870fcU, 0x569eed677b128U, 0x30937dcb0a5afU, 0x758039c78ea1bU, 0x6458df41e273aU,
+      0x3e37a35444483U, 0x661fdb7d27b99U, 0x317761dd621e4U, 0x7323c30026189U, 0x6093dccbc2950U
+    },
+    {
+      0x6eebe6084034bU, 0x6cf01f70a8d7bU, 0x0b41a54c6670aU, 0x6c84b99bb55dbU, 0x6e3180c98b647U,
+      0x39a8585e0706dU, 0x3167ce72663feU, 0x63d14ecdb4297U, 0x4be21dcf970b8U, 0x57d1ea084827aU,
+      0x2b6e7a128b071U, 0x5b27511755dcfU, 0x08584c2930565U, 0x68c7bda6f4159U, 0x363e999ddd97bU
+    },
+    {
+      0x048dce24baec6U, 0x2b75795ec05e3U, 0x3bfa4c5da6dc9U, 0x1aac8659e371eU, 0x231f979bc6f9bU,
+      0x043c135ee1fc4U, 0x2a11c9919f2d5U, 0x6334cc25dbacdU, 0x295da17b400daU, 0x48ee9b78693a0U,
+      0x1de4bcc2af3c6U, 0x61fc411a3eb86U, 0x53ed19ac12ec0U, 0x209dbc6b804e0U, 0x079bfa9b08792U
+    },
+    {
+      0x1ed80a2d54245U, 0x70efec72a5e79U, 0x42151d42a822dU, 0x1b5ebb6d631e8U, 0x1ef4fb1594706U,
+      0x03a51da300df4U, 0x467b52b561c72U, 0x4d5920210e590U, 0x0ca769e789685U, 0x038c77f684817U,
+      0x65ee65b167becU, 0x052da19b850a9U, 0x0408665656429U, 0x7ab39596f9a4cU, 0x575ee92a4a0bfU
+    },
+    {
+      0x6bc450aa4d801U, 0x4f4a6773b0ba8U, 0x6241b0b0ebc48U, 0x40d9c4f1d9315U, 0x200a1e7e382f5U,
+      0x080908a182fcfU, 0x0532913b7ba98U, 0x3dccf78c385c3U, 0x68002dd5eaba9U, 0x43d4e7112cd3fU,
+      0x5b967eaf93ac5U, 0x360acca580a31U, 0x1c65fd5c6f262U, 0x71c7f15c2ecabU, 0x050eca52651e4U
+    },
+    {
+      0x4397660e668eaU, 0x7c2a75692f2f5U, 0x3b29e7e6c66efU, 0x72ba658bcda9aU, 0x6151c09fa131aU,
+      0x31ade453f0c9cU, 0x3dfee07737868U, 0x611ecf7a7d411U, 0x2637e6cbd64f6U, 0x4b0ee6c21c58fU,
+      0x55c0dfdf05d96U, 0x405569dcf475eU, 0x05c5c277498bbU, 0x18588d95dc389U, 0x1fef24fa800f0U
+    }
+  },
+#endif
+#if 21 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x1a66a90166220U, 0x5cb7e3c013ff2U, 0x6437df3c8954aU, 0x7dcbeffc2ec3fU, 0x4f620ffe0c736U,
+      0x6123a6b6c6609U, 0x0b0156b271692U, 0x709e97e9d43faU, 0x49e7a38df9cdbU, 0x507903ce77ac1U,
+      0x10d65dfde3e34U, 0x2573f4bf5ac5fU, 0x05914433ca316U, 0x6424ce4377ce3U, 0x25d448044a256U
+    },
+    {
+      0x44415c9022b55U, 0x03025d63fc58fU, 0x6d978355a8349U, 0x593781750e4ebU, 0x4180512fd5323U,
+      0x0230ec7e9b16fU, 0x03838af2bb7adU, 0x6dac7fc3ac6e7U, 0x7af3ca1e4624aU, 0x2f9faf620bbacU,
+      0x73e698a48a5dbU, 0x0d7b2a807749fU, 0x756d976e9a8e0U, 0x17dcfbe70d7a3U, 0x15e087e55939dU
+    },
+    {
+      0x4186efb963f38U, 0x01b8c737ab112U, 0x5b0726522803aU, 0x330d2740495f4U, 0x5a097d54ca573U,
+      0x07543745c1496U, 0x7bb470c218244U, 0x1c70d3f6bfcf3U, 0x6f4f273cb9396U, 0x39c07b1934bdeU,
+      0x5892b17c9e755U, 0x6512611bf05a8U, 0x16e2f6740cff5U, 0x03cb617f4eca9U, 0x2edbecf1c11ccU
+    },
+    {
+      0x70fddd087a25fU, 0x2ab87c69dddc1U, 0x6acead671d4c5U, 0x1d933062b9747U, 0x0854fc44544cdU,
+      0x6a4e3c715a0d2U, 0x61f0683a9a2c2U, 0x7a2672d4d88f2U, 0x5534b77a994e3U, 0x3d4e8dbba668bU,
+      0x3a0c555edad19U, 0x7de1507bccc3dU, 0x6ea97e092d4cfU, 0x7469dbb821441U, 0x678f82b898a47U
+    },
+    {
+      0x1d94057775696U, 0x3879b2a3b63c1U, 0x2f385bfbb4499U, 0x4fa7d4ed61590U, 0x0f7f76e0e8d08U,
+      0x11d0bd6900c54U, 0x593a264c6d629U, 0x4d8af24d4e5c8U, 0x4efa6dc944905U, 0x4d7cd1fea68b6U,
+      0x1ebc5d485b00cU, 0x25c95b66ca6dbU, 0x0467336896592U, 0x6afe0b2ca4061U, 0x45306349186e0U
+    },
+    {
+      0x414ec2b072491U, 0x024f4f6cb72d4U, 0x2292bc06ec886U, 0x32fb69424acb7U, 0x65f3b08ccd277U,
+      0x5d0c1a6cdff1dU, 0x2bd084275d29bU, 0x4bf3da957dbc4U, 0x0b7b649afc2ccU, 0x067ee0f54a37fU,
+      0x29fff199801f7U, 0x3f4541ee5fd96U, 0x7f4bd2674d874U, 0x7f112f88e91baU, 0x124cefe80fe10U
+    },
+    {
+      0x0e85b31b16489U, 0x6fb6e217f62a3U, 0x52b88e63eab72U, 0x0609cd85efa50U, 0x05f4cbea503d2U,
+      0x26cf9d18df255U, 0x5228f4c76c982U, 0x724ed7f0751c7U, 0x35116369e39f9U, 0x6be3a6a2e3ff8U,
+      0x40e9ec04145bcU, 0x4411ed06999c0U, 0x6211e8f1c7fd3U, 0x5d2deaa3746d5U, 0x64666aa0a4d2aU
+    },
+    {
+      0x53bf73337e94cU, 0x7c23c29e2b618U, 0x4c31d41f2d5a5U, 0x23425c255d60cU, 0x28dd4abfe0640U,
+      0x1435a7c06d912U, 0x43767f0616d08U, 0x72f89e32848f0U, 0x0236a59bd93d8U, 0x1d753b84c76f5U,
+      0x0b64c44cb9f44U, 0x59c724bb7efb8U, 0x4115f10628f86U, 0x4973d181a4316U, 0x4c498bf78a0c8U
+    }
+  },
+#endif
+#if 22 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x2aff530976b86U, 0x0d85a48c0845aU, 0x796eb963642e0U, 0x60bee50c4b626U, 0x28005fe6c8340U,
+      0x653fb1aa73196U, 0x607faec8306faU, 0x4e85ec83e5254U, 0x09f56900584fdU, 0x544d49292fc86U,
+      0x7ba9f34528688U, 0x284a20fb42d5dU, 0x3652cd9706ffeU, 0x6fd7baddde6b3U, 0x72e472930f316U
+    },
+    {
+      0x3f635d32a7627U, 0x0cbecacde00feU, 0x3411141eaa936U, 0x21c1e42f3cb94U, 0x1fee7f000fe06U,
+      0x5208c9781084fU, 0x16468a1dc24d2U, 0x7bf780ac540a8U, 0x1a67eced75301U, 0x5a9d2e8c2733aU,
+      0x305da03dbf7e5U, 0x1228699b7aecaU, 0x12a23b2936bc9U, 0x2a1bda56ae6e9U, 0x00f94051ee040U
+    },
+    {
+      0x793bb07af9753U, 0x1e7b6ecd4fafdU, 0x02c7b1560fb43U, 0x2296734cc5fb7U, 0x47b7ffd25dd40U,
+      0x56b23c3d330b2U, 0x37608e360d1a6U, 0x10ae0f3c8722eU, 0x086d9b618b637U, 0x07d79c7e8beabU,
+      0x3fb9cbc08dd12U, 0x75c3dd85370ffU, 0x47f06fe2819acU, 0x5db06ab9215edU, 0x1c3520a35ea64U
+    },
+    {
+      0x06f40216bc059U, 0x3a2579b0fd9b5U, 0x71c26407eec8cU, 0x72ada4ab54f0bU, 0x38750c3b66d12U,
+      0x253a6bccba34aU, 0x427070433701aU, 0x20b8e58f9870eU, 0x337c861db00ccU, 0x1c3d05775d0eeU,
+      0x6f1409422e51aU, 0x7856bbece2d25U, 0x13380a72f031cU, 0x43e1080a7f3baU, 0x0621e2c7d3304U
+    },
+    {
+      0x61796b0dbf0f3U, 0x73c2f9c32d6f5U, 0x6aa8ed1537ebeU, 0x74e92c91838f4U, 0x5d8e589ca1002U,
+      0x060cc8259838dU, 0x038d3f35b95f3U, 0x56078c243a923U, 0x2de3293241bb2U, 0x0007d6097bd3aU,
+      0x71d950842a94bU, 0x46b11e5c7d817U, 0x5478bbecb4f0dU, 0x7c3054b0a1c5dU, 0x1583d7783c1cbU
+    },
+    {
+      0x34704cc9d28c7U, 0x3dee598b1f200U, 0x16e1c98746d9eU, 0x4050b7095afdfU, 0x4958064e83c55U,
+      0x6a2ef5da27ae1U, 0x28aace02e9d9dU, 0x02459e965f0e8U, 0x7b864d3150933U, 0x252a5f2e81ed8U,
+      0x094265066e80dU, 0x0a60f918d61a5U, 0x0444bf7f30fdeU, 0x1c40da9ed3c06U, 0x079c170bd843bU
+    },
+    {
+      0x6cd50c0d5d056U, 0x5b7606ae779baU, 0x70fbd226bdda1U, 0x5661e53391ff9U, 0x6768c0d7317b8U,
+      0x6ece464fa6fffU, 0x3cc40bca460a0U, 0x6e3a90afb8d0cU, 0x5801abca11228U, 0x6dec05e34ac9fU,
+      0x625e5f155c1b3U, 0x4f32f6f723296U, 0x5ac980105efceU, 0x17a61165eee36U, 0x51445e14ddcd5U
+    },
+    {
+      0x147ab2bbea455U, 0x1f240f2253126U, 0x0c3de9e314e89U, 0x21ea5a4fca45fU, 0x12e990086e4fdU,
+      0x02b4b3b144951U, 0x5688977966aeaU, 0x18e176e399ffdU, 0x2e45c5eb4938bU, 0x13186f31e3929U,
+      0x496b37fdfbb2eU, 0x3c2439d5f3e21U, 0x16e60fe7e6a4dU, 0x4d7ef889b621dU, 0x77b2e3f05d3e9U
+    }
+  },
+#endif
+#if 23 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x2f48fcc5cd29bU, 0x7d479c6ce32a6U, 0x448a504aea146U, 0x279196d655028U, 0x478d99d935000U,
+      0x575879cf12657U, 0x29ca741c53fa1U, 0x6ed2f9fa0bfbeU, 0x451661a53f82dU, 0x0b251172a50c3U,
+      0x2d94890bb02c0U, 0x621d84a22a3abU, 0x3c85c09438822U, 0x402d1351144a7U, 0x4dc923343b524U
+    },
+    {
+      0x3e3ebf36c4975U, 0x4a6f0c424a75aU, 0x096945b5d7496U, 0x423f439ca1ed0U, 0x6bbc7cb4c411cU,
+      0x28c400f8086b6U, 0x6f2f3e1b91c70U, 0x7d0b2d0fddf9bU, 0x3c23f7b6f1826U, 0x5265797cb6abdU,
+      0x79cd1d4a50d56U, 0x6f8dfd56fc78dU, 0x6025cbad89101U, 0x67db7fcdfa41aU, 0x00375883b332aU
+    },
+    {
+      0x3ec856c75c99cU, 0x0001c679e9931U, 0x241d8d3910613U, 0x4eb8533b5cdddU, 0x669e2cb571f37U,
+      0x1b2cd28cb0940U, 0x40de384992000U, 0x35728c58fed46U, 0x3305ad6c348eeU, 0x67238dbd8c450U,
+      0x16b73a49bd308U, 0x564724e53d962U, 0x55766c4096ab5U, 0x5dcda3c9f7d1fU, 0x72a1056140678U
+    },
+    {
+      0x52909e2e505b6U, 0x57805224601b1U, 0x6c48c9e6329e2U, 0x5a3bbf7aab4d4U, 0x7c77897b81439U,
+      0x6812b1cc9249dU, 0x5c42423eb1456U, 0x7c43b398a19bbU, 0x700165ae2dc2eU, 0x03a6b259e263aU,
+      0x1b5e2de331cb5U, 0x1c2bf94841e38U, 0x764cac56a7d76U, 0x373cfd21c78bdU, 0x2a381bf01c614U
+    },
+    {
+      0x0be32b534166fU, 0x48339ee1a9ef8U, 0x55e9d649f9b29U, 0x15549a6fbebd4U, 0x5701461dabdecU,
+      0x39879cfc811c1U, 0x026eadcacf593U, 0x1c3b7f22df4a6U, 0x05b286d27303eU, 0x5dbca62f88440U,
+      0x747402c915c25U, 0x50161a681458cU, 0x6d0fd7c6f7346U, 0x1212f2b00de83U, 0x2555b4e05539aU
+    },
+    {
+      0x09b1d87e463d4U, 0x359bf6c73af08U, 0x4966e72b536a5U, 0x055f6143b9baaU, 0x69c806e9c3123U,
+      0x09f5266ddd216U, 0x4f91c6e090df8U, 0x37d8bf7739582U, 0x0c97632c9ced1U, 0x7a869ae7e52edU,
+      0x0f57414bb3f22U, 0x495db99910f69U, 0x7b602f9a31f3bU, 0x625f697c9b0bcU, 0x25d70b885f77bU
+    },
+    {
+      0x59d29bb1ae4d4U, 0x0e73f2a9d9308U, 0x26d2cf95ae713U, 0x3c54193a1fb61U, 0x21ea8e2798b68U,
+      0x1c3d9762bf4deU, 0x3e4e8bb05682aU, 0x48f775420fd0dU, 0x59214bbad1706U, 0x138e3a6269a5dU,
+      0x6f4b46a5a7b9cU, 0x36bf83a0c50f7U, 0x4c8592348a674U, 0x01ec1204c0c6eU, 0x5c5abeb1e5a2eU
+    },
+    {
+      0x5e6de1306a233U, 0x4422df1d8e059U, 0x458ed6ded694aU, 0x321f0e340fa60U, 0x241d350660d32U,
+      0x22af4b73c2ddbU, 0x3eb40a0c1a28eU, 0x606c0baf11c31U, 0x647804a1f5612U, 0x0e434b3b1f499U,
+      0x4404d0ebc52c7U, 0x77634f23ead7cU, 0x176d0aeb9188cU, 0x34a15760b8769U, 0x1d8dfd966645dU
+    }
+  },
+#endif
+#if 24 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x0639c12ddb0a4U, 0x6180490cd7ab3U, 0x3f3918297467cU, 0x74568be1781acU, 0x07a195152e095U,
+      0x7a9c59c2ec4deU, 0x7e9f09e79652dU, 0x6a3e422f22d86U, 0x2ae8e3b836c8bU, 0x63b795fc7ad32U,
+      0x68f02389e5fc8U, 0x059f1bc877506U, 0x504990e410cecU, 0x09bd7d0feaee2U, 0x3e8fe83d032f0U
+    },
+    {
+      0x04c8de8efd13cU, 0x1c67c06e6210eU, 0x183378f7f146aU, 0x64352ceaed289U, 0x22d60899a6258U,
+      0x315b90570a294U, 0x60ce108a925f1U, 0x6eff61253c909U, 0x003ef0e2d70b0U, 0x75ba3b797fac4U,
+      0x1dbc070cdd196U, 0x16d8fb1534c47U, 0x500498183fa2aU, 0x72f59c423de75U, 0x0904d07b87779U
+    },
+    {
+      0x22d6648f940b9U, 0x197a5a1873e86U, 0x207e4c41a54bcU, 0x5360b3b4bd6d0U, 0x6240aacebaf72U,
+      0x61fd4ddba919cU, 0x7d8e991b55699U, 0x61b31473cc76cU, 0x7039631e631d6U, 0x43e2143fbc1ddU,
+      0x4749c5ba295a0U, 0x37946fa4b5f06U, 0x724c5ab5a51f1U, 0x65633789dd3f3U, 0x56bdaf238db40U
+    },
+    {
+      0x0d36cc19d3bb2U, 0x6ec4470d72262U, 0x6853d7018a9aeU, 0x3aa3e4dc2c8ebU, 0x03aa31507e1e5U,
+      0x2b9e3f53533ebU, 0x2add727a806c5U, 0x56955c8ce15a3U, 0x18c4f070a290eU, 0x1d24a86d83741U,
+      0x47648ffd4ce1fU, 0x60a9591839e9dU, 0x424d5f38117abU, 0x42cc46912c10eU, 0x43b261dc9aeb4U
+    },
+    {
+      0x13d8b6c951364U, 0x4c0017e8f632aU, 0x53e559e53f9c4U, 0x4b20146886eeaU, 0x02b4d5e242940U,
+      0x31e1988bb79bbU, 0x7b82f46b3bcabU, 0x0f7a8ce827b41U, 0x5e15816177130U, 0x326055cf5b276U,
+      0x155cb28d18df2U, 0x0c30d9ca11694U, 0x2090e27ab3119U, 0x208624e7a49b6U, 0x27a6c809ae5d3U
+    },
+    {
+      0x4270ac43d6954U, 0x2ed4cd95659a5U, 0x75c0db37528f9U, 0x2ccbcfd2c9234U, 0x221503603d8c2U,
+      0x6ebcd1f0db188U, 0x74ceb4b7d1174U, 0x7d56168df4f5cU, 0x0bf79176fd18aU, 0x2cb67174ff60aU,
+      0x6cdf9390be1d0U, 0x08e519c7e2b3dU, 0x253c3d2a50881U, 0x21b41448e333dU, 0x7b1df4b73890fU
+    },
+    {
+      0x6221807f8f58cU, 0x3fa92813a8be5U, 0x6da98c38d5572U, 0x01ed95554468fU, 0x68698245d352eU,
+      0x2f2e0b3b2a224U, 0x0c56aa22c1c92U, 0x5fdec39f1b278U, 0x4c90af5c7f106U, 0x61fcef2658fc5U,
+      0x15d852a18187aU, 0x270dbb59afb76U, 0x7db120bcf92abU, 0x0e7a25d714087U, 0x46cf4c473daf0U
+    },
+    {
+      0x46ea7f1498140U, 0x70725690a8427U, 0x0a73ae9f079fbU, 0x2dd924461c62bU, 0x1065aae50d8ccU,
+      0x525ed9ec4e5f9U, 0x022d20660684cU, 0x7972b70397b68U, 0x7a03958d3f965U, 0x29387bcd14eb5U,
+      0x44525df200d57U, 0x2d7f94ce94385U, 0x60d00c170ecb7U, 0x38b0503f3d8f0U, 0x69a198e64f1ceU
+    }
+  },
+#endif
+#if 25 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6e56b9e2d4734U, 0x57038c2ceaf64U, 0x27379ff131c4cU, 0x1d6f7ae4a92f6U, 0x39c80b16e7174U,
+      0x4d613efa9d697U, 0x48380cf2b2f5fU, 0x7eb6a5833116aU, 0x1b2d2b7f08260U, 0x3a73b70472e40U,
+      0x16e0d1b826c68U, 0x4492c1c7b61e3U, 0x6dd0db3dc7fc3U, 0x14130898b3811U, 0x0cf0ea5877da7U
+    },
+    {
+      0x2ced43ba6945aU, 0x43d10380bbc66U, 0x19fb4ef782c4dU, 0x6ae8d6a0784afU, 0x5da8acdab8c63U,
+      0x480a4ddd4ccbdU, 0x3b2be5bb3a32dU, 0x35b1c6c8b9bd5U, 0x217e3af19e3a0U, 0x7bb51279cb3c0U,
+      0x6664a3a70159fU, 0x1e15209c29896U, 0x025b04dd8653cU, 0x676d2b0a61cd2U, 0x6cd0ff50979feU
+    },
+    {
+      0x4fabdb04ba18eU, 0x7877bb79eeffdU, 0x5e84c7343f1efU, 0x530d20ea43702U, 0x641a4391f2223U,
+      0x067e78f4428acU, 0x614c226bc781cU, 0x018a4d4520d6aU, 0x24e790e8a799cU, 0x6390a4c8df048U,
+      0x6b95aa606a8dbU, 0x3d60d04be38b8U, 0x3f27bfe452dfeU, 0x67e15398fb5a2U, 0x30ddf38562705U
+    },
+    {
+      0x6f2bd68bcd52cU, 0x60d2905de4677U, 0x72c6bbb19276eU, 0x3f2dadb770620U, 0x5c294d270212aU,
+      0x5cbdad1bff7f9U, 0x0440c8ae2e9c7U, 0x462755b24463aU, 0x3345d66675e07U, 0x1b4822e9d4467U,
+      0x60a7f25563781U, 0x14901ef2b1566U, 0x452d38c94488aU, 0x71563ae8293b0U, 0x222d9625d976fU
+    },
+    {
+      0x4be7e0a344f85U, 0x190fe458701f2U, 0x385bc3facbeaaU, 0x6f54e70f3af27U, 0x43e64e5418a08U,
+      0x17f85b372ace1U, 0x528c717e3038eU, 0x7022d62064c39U, 0x7fa11ce5682b5U, 0x0b34271c87f8fU,
+      0x5e2521a35ce63U, 0x1bf224051d02aU, 0x5f773b2f84035U, 0x3725ffc05fc52U, 0x57342dc96d6bcU
+    },
+    {
+      0x3bcb71e707bf6U, 0x18e5234ec5e78U, 0x35a68ccd4766eU, 0x03f802817376dU, 0x522f521f1ec88U,
+      0x6f065c8ce5998U, 0x216b97d545dfdU, 0x2df1162fc0a54U, 0x42ac632508310U, 0x35134fb231c24U,
+      0x41f46f9a3902bU, 0x6f32caf7984e5U, 0x628703b246e8eU, 0x0bdd730a59827U, 0x7afcaad70b990U
+    },
+    {
+      0x141ecef842b6bU, 0x0f2f57cd8b510U, 0x5e13ff9579ec5U, 0x05bc63a47cb81U, 0x5b50a1f7afcd0U,
+      0x5ed54a4b8be41U, 0x423761c5bb84bU, 0x7a0aaca40b44fU, 0x3e5a0fa1919e6U, 0x1085faa5c3aaeU,
+      0x40f66f1361315U, 0x04e02007d3370U, 0x2894200611889U, 0x19032f6a2fd72U, 0x0a2862393fda7U
+    },
+    {
+      0x6737b6ecb9d17U, 0x11acf9d5c32c1U, 0x5786e27ebc925U, 0x4f59bf3d4da6aU, 0x5cb7173cb46c5U,
+      0x313c8347cbc9dU, 0x29338247068d5U, 0x7592b24e127a3U, 0x773a67518a043U, 0x1f354134b1a29U,
+      0x1e68b82b7abf0U, 0x4f374d6f72951U, 0x6361dbfd07364U, 0x4e30b73610870U, 0x7cacdb0f7f1b0U
+    }
+  },
+#endif
+#if 26 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x14434dcc5caedU, 0x2c7909f667c20U, 0x61a839d1fb576U, 0x4f23800cabb76U, 0x25b2697bd267fU,
+      0x2b2e0d91a78bcU, 0x3990a12ccf20cU, 0x141c2e11f2622U, 0x0dfcefaa53320U, 0x7369e6a92493aU,
+      0x73ffb13986864U, 0x3282bb8f713acU, 0x49ced78f297efU, 0x6697027661defU, 0x1420683db54e4U
+    },
+    {
+      0x6bb6fc1cc5ad0U, 0x532c8d591669dU, 0x1af794da86c33U, 0x0e0e9d86d24d3U, 0x31e83b4161d08U,
+      0x0bd1e249dd197U, 0x00bcb1820568fU, 0x2eab1718830d4U, 0x396fd816997e6U, 0x60b63bebf508aU,
+      0x0c7129e062b4fU, 0x1e526415b12fdU, 0x461a0fd27923dU, 0x18badf670a5b7U, 0x55cf1eb62d550U
+    },
+    {
+      0x6b5e37df58c52U, 0x3bcf33986c60eU, 0x44fb8835ceae7U, 0x099dec18e71a4U, 0x1a56fbaa62ba0U,
+      0x1101065c23d58U, 0x5aa1290338b0fU, 0x3157e9e2e7421U, 0x0ea712017d489U, 0x669a656457089U,
+      0x66b505c9dc9ecU, 0x774ef86e35287U, 0x4d1d944c0955eU, 0x52e4c39d72b20U, 0x13c4836799c58U
+    },
+    {
+      0x4fb6a5d8bd080U, 0x58ae34908589bU, 0x3954d977baf13U, 0x413ea597441dcU, 0x50bdc87dc8e5bU,
+      0x25d465ab3e1b9U, 0x0f8fe27ec2847U, 0x2d6e6dbf04f06U, 0x3038cfc1b3276U, 0x66f80c93a637bU,
+      0x537836edfe111U, 0x2be02357b2c0dU, 0x6dcee58c8d4f8U, 0x2d732581d6192U, 0x1dd56444725fdU
+    },
+    {
+      0x7e60008bac89aU, 0x23d5c387c1852U, 0x79e5df1f533a8U, 0x2e6f9f1c5f0cfU, 0x3a3a450f63a30U,
+      0x47ff83362127dU, 0x08e39af82b1f4U, 0x488322ef27dabU, 0x1973738a2a1a4U, 0x0e645912219f7U,
+      0x72f31d8394627U, 0x07bd294a200f1U, 0x665be00e274c6U, 0x43de8f1b6368bU, 0x318c8d9393a9aU
+    },
+    {
+      0x69e29ab1dd398U, 0x30685b3c76bacU, 0x565cf37f24859U, 0x57b2ac28efef9U, 0x509a41c325950U,
+      0x45d032afffe19U, 0x12fe49b6cde4eU, 0x21663bc327cf1U, 0x18a5e4c69f1ddU, 0x224c7c679a1d5U,
+      0x06edca6f925e9U, 0x68c8363e677b8U, 0x60cfa25e4fbcfU, 0x1c4c17609404eU, 0x05bff02328a11U
+    },
+    {
+      0x1a0dd0dc512e4U, 0x10894bf5fcd10U, 0x52949013f9c37U, 0x1f50fba4735c7U, 0x576277cdee01aU,
+      0x2137023cae00bU, 0x15a3599eb26c6U, 0x0687221512b3cU, 0x253cb3a0824e9U, 0x780b8cc3fa2a4U,
+      0x38abc234f305fU, 0x7a280bbc103deU, 0x398a836695dfeU, 0x3d0af41528a1aU, 0x5ff418726271bU
+    },
+    {
+      0x347e813b69540U, 0x76864c21c3cbbU, 0x1e049dbcd74a8U, 0x5b4d60f93749cU, 0x29d4db8ca0a0cU,
+      0x6080c1789db9dU, 0x4be7cef1ea731U, 0x2f40d769d8080U, 0x35f7d4c44a603U, 0x106a03dc25a96U,
+      0x50aaf333353d0U, 0x4b59a613cbb35U, 0x223dfc0e19a76U, 0x77d1e2bb2c564U, 0x4ab38a51052cbU
+    }
+  },
+#endif
+#if 27 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x7e2e8809de054U, 0x55390575a3ed1U, 0x2b6fd178ef025U, 0x2cf03b1a9ea05U, 0x7b9b1fb5dea19U,
+      0x2cbee4324c0e9U, 0x107f2ab76fbfbU, 0x0c5827c15110aU, 0x67fef7bd55475U, 0x68aee70642287U,
+      0x4c8f17471cc0cU, 0x6eaf210577e03U, 0x791ad7e5490b8U, 0x2fd93bbb049e9U, 0x2d13d55a28bd8U
+    },
+    {
+      0x19cce7aee7a52U, 0x6dc8a9d5a77e0U, 0x6a2ec66a37b4aU, 0x36c1e30cf85c3U, 0x3619b5d756091U,
+      0x5d2065b35b8daU, 0x350ac4976ff58U, 0x487343ea36a2aU, 0x6ac666965489eU, 0x6b8341ee8bf90U,
+      0x1f26b0282c4b2U, 0x649f5fdf5c6afU, 0x3231f0193564bU, 0x46bdbe6f6bd94U, 0x6a927b6b7173aU
+    },
+    {
+      0x040863ece88ebU, 0x5301dd81191aeU, 0x5e23f6bc38c1eU, 0x3c6d611283086U, 0x056d92a43a0d4U,
+      0x5b24f986e4656U, 0x5da3d220b63edU, 0x3028dd4408700U, 0x2c97c7f9fff96U, 0x1d2a6bf8c6c82U,
+      0x5a196fc3da5a1U, 0x04876b3da0360U, 0x745e461df5ea3U, 0x1fb836d1eb14bU, 0x66fbb494f1235U
+    },
+    {
+      0x70996f12309d6U, 0x0bd387aa73adaU, 0x55490476fec8eU, 0x706236b01587bU, 0x270a0b0557843U,
+      0x250b9d85c0fb8U, 0x4b179e12f6ea3U, 0x426a5a746bf70U, 0x32c978b5351c1U, 0x14ddff9ee5b00U,
+      0x70640a7862bccU, 0x34be2357fcc3fU, 0x744aaee072b02U, 0x439c823c1822aU, 0x19a4bde1945aeU
+    },
+    {
+      0x709dec076c49fU, 0x64fe7ca7ec818U, 0x2810b1195efebU, 0x78220331198f6U, 0x14b375487eb4dU,
+      0x726f520a6200aU, 0x079e27d5f1373U, 0x0c7b74d920111U, 0x6e0c531b39fc3U, 0x72bbbce11ed39U,
+      0x53c94ab66dc47U, 0x7dbeec5add5d0U, 0x6cbdf47ad88d0U, 0x1bd7847070c37U, 0x4f0b1c02700abU
+    },
+    {
+      0x521ccc1b2e23fU, 0x028a7bea54f3fU, 0x54521ad2b9f0aU, 0x29a640b9764e8U, 0x68abe9443e0a7U,
+      0x06787d81951faU, 0x1d65218ef7c2eU, 0x3599dce8428b2U, 0x5aa739c17d01fU, 0x0a4d84710bcc4U,
+      0x2c6c407831dcbU, 0x2e9ab8a21bb42U, 0x75013843688c3U, 0x077a558a98f35U, 0x4106b166bcf44U
+    },
+    {
+      0x5ccd539e4ecf2U, 0x5a0aab756b490U, 0x5f7e0b56a8fceU, 0x41f8a2f1a1cc9U, 0x1238b51e12142U,
+      0x57a421cd23668U, 0x3a1d5dedfa05cU, 0x49112012b67edU, 0x198caa73393d8U, 0x7f792f9d2699fU,
+      0x06b925fd4d924U, 0x746c4d501a171U, 0x62af4498241bdU, 0x267f669b3da5cU, 0x2876beb1def34U
+    },
+    {
+      0x4b3333a8a85f8U, 0x13cf1afab1ab2U, 0x238d47d3a8ddaU, 0x5da39dfcfa2afU, 0x5507d7d2bc41eU,
+      0x4e93563144691U, 0x41ac3e47e9b90U, 0x2a6a3558cbfa2U, 0x469a655400309U, 0x48f9dbfa0e991U,
+      0x32903299572fcU, 0x452a05a1dc39dU, 0x73399edf2332aU, 0x0f3c8dfd21a08U, 0x5784481964a83U
+    }
+  },
+#endif
+#if 28 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x7d1ef5fddc09cU, 0x7beeaebb9dad9U, 0x058d30ba0acfbU, 0x5cd92eab5ae90U, 0x3041c6bb04ed2U,
+      0x42b256768d593U, 0x2e88459427b4fU, 0x02b3876630701U, 0x34878d405eae5U, 0x29cdd1adc088aU,
+      0x2f2f9d956e148U, 0x6b3e6ad65c1feU, 0x5b00972b79e5dU, 0x53d8d234c5dafU, 0x104bbd6814049U
+    },
+    {
+      0x59a5fd67ff163U, 0x3a998ead0352bU, 0x083c95fa4af9aU, 0x6fadbfc01266fU, 0x204f2a20fb072U,
+      0x0fd3168f1ed67U, 0x1bb0de7784a3eU, 0x34bcb78b20477U, 0x0a4a26e2e2182U, 0x5be8cc57092a7U,
+      0x43b3d30ebb079U, 0x357aca5c61902U, 0x5b570c5d62455U, 0x30fb29e1e18c7U, 0x2570fb17c2791U
+    },
+    {
+      0x6a9550bb8245aU, 0x511f20a1a2325U, 0x29324d7239beeU, 0x3343cc37516c4U, 0x241c5f91de018U,
+      0x2367f2cb61575U, 0x6c39ac04d87dfU, 0x6d4958bd7e5bdU, 0x566f4638a1532U, 0x3dcb65ea53030U,
+      0x0172940de6caaU, 0x6045b2e67451bU, 0x56c07463efcb3U, 0x0728b6bfe6e91U, 0x08420edd5fcdfU
+    },
+    {
+      0x0c34e04f410ceU, 0x344edc0d0a06bU, 0x6e45486d84d6dU, 0x44e2ecb3863f5U, 0x04d654f321db8U,
+      0x720ab8362fa4aU, 0x29c4347cdd9bfU, 0x0e798ad5f8463U, 0x4fef18bcb0bfeU, 0x0d9a53efbc176U,
+      0x5c116ddbdb5d5U, 0x6d1b4bba5abcfU, 0x4d28a48a5537aU, 0x56b8e5b040b99U, 0x4a7a4f2618991U
+    },
+    {
+      0x3b291af372a4bU, 0x60e3028fe4498U, 0x2267bca4f6a09U, 0x719eec242b243U, 0x4a96314223e0eU,
+      0x718025fb15f95U, 0x68d6b8371fe94U, 0x3804448f7d97cU, 0x42466fe784280U, 0x11b50c4cddd31U,
+      0x0274408a4ffd6U, 0x7d382aedb34ddU, 0x40acfc9ce385dU, 0x628bb99a45b1eU, 0x4f4bce4dce6bcU
+    },
+    {
+      0x2616ec49d0b6fU, 0x1f95d8462e61cU, 0x1ad3e9b9159c6U, 0x79ba475a04df9U, 0x3042cee561595U,
+      0x7ce5ae2242584U, 0x2d25eb153d4e3U, 0x3a8f3d09ba9c9U, 0x0f3690d04eb8eU, 0x73fcdd14b71c0U,
+      0x67079449bac41U, 0x5b79c4621484fU, 0x61069f2156b8dU, 0x0eb26573b10afU, 0x389e740c9a9ceU
+    },
+    {
+      0x578f6570eac28U, 0x644f2339c3937U, 0x66e47b7956c2cU, 0x34832fe1f55d0U, 0x25c425e5d6263U,
+      0x4b3ae34dcb9ceU, 0x47c691a15ac9fU, 0x318e06e5d400cU, 0x3c422d9f83eb1U, 0x61545379465a6U,
+      0x606a6f1d7de6eU, 0x4f1c0c46107e7U, 0x229b1dcfbe5d8U, 0x3acc60a7b1327U, 0x6539a08915484U
+    },
+    {
+      0x4dbd414bb4a19U, 0x7930849f1dbb8U, 0x329c5a466caf0U, 0x6c824544feb9bU, 0x0f65320ef019bU,
+      0x21f74c3d2f773U, 0x024b88d08bd3aU, 0x6e678cf054151U, 0x43631272e747cU, 0x11c5e4aac5cd1U,
+      0x6d1b1cafde0c6U, 0x462c76a303a90U, 0x3ca4e693cff9bU, 0x3952cd45786fdU, 0x4cabc7bdec330U
+    }
+  },
+#endif
+#if 29 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x0a19c1a54a044U, 0x48ef7b3f77ef8U, 0x3c8a5c9287178U, 0x706d371e508adU, 0x1819bb953f2e9U,
+      0x2a8fb532f7428U, 0x408d49c4e42dfU, 0x67a92036f50baU, 0x781a99bb29dc5U, 0x4065947223973U,
+      0x7bb795e042e84U, 0x34ed316e28931U, 0x7f98a55f43762U, 0x29245fd85d213U, 0x36ba82e721200U
+    },
+    {
+      0x69d0a57274ed5U, 0x64c100962f91aU, 0x1577eb116ea00U, 0x19cef9e6d0811U, 0x77d221232709bU,
+      0x6cbb74245ec41U, 0x3c68690e2dac1U, 0x08a137bf66fa2U, 0x6da6492057f72U, 0x4472f648d0531U,
+      0x26d7064ad94d8U, 0x7b35ec44c6931U, 0x70507d296d723U, 0x2c646547682a2U, 0x2c63bec3662d3U
+    },
+    {
+      0x18b3a8586f8bfU, 0x6d97632de134aU, 0x0e173ca7b9c6bU, 0x468d50312f351U, 0x1deb2176ddd7cU,
+      0x60d8bea787955U, 0x7d6be8036effcU, 0x4d5733ae77045U, 0x76fc8e3e04d0cU, 0x22692ef59442bU,
+      0x3d19a2066cf6cU, 0x189b98f9af0acU, 0x4363d89006ff6U, 0x02f6cbb535f66U, 0x67cfd773a278bU
+    },
+    {
+      0x7a9855a4e586aU, 0x48937d56fc5abU, 0x074cf4d97e3deU, 0x6f75503a6eef9U, 0x185cba721bcb9U,
+      0x431faef3ee475U, 0x153c45fb251bdU, 0x09b2ac6676ffeU, 0x05ca89688aca7U, 0x0cde561eec431U,
+      0x69da3f4e3cb41U, 0x6a81ef2efd270U, 0x118ee0efc0e4bU, 0x7768131027e68U, 0x3ec91a769eec6U
+    },
+    {
+      0x52fb7b0a3402fU, 0x17f6d3e9501f5U, 0x7e3aa9919857bU, 0x44b7ba2de6462U, 0x7a5fa8794a94eU,
+      0x5f75bf78166adU, 0x71d619af5e3d3U, 0x7abe62137f6a0U, 0x67e5d00176c60U, 0x13fedb3e11f33U,
+      0x58faa13cd67a1U, 0x0317b76a2ea52U, 0x22116ce597b82U, 0x5478b72c6d517U, 0x357d397d5499dU
+    },
+    {
+      0x5acb4194bfbf8U, 0x6375cb0532903U, 0x44dca8135df8fU, 0x4f08f7a30973eU, 0x3a8d867e70ff6U,
+      0x7a05fb0bace6cU, 0x18395f343c3d7U, 0x60ad86b24d188U, 0x7f6663b8e620eU, 0x2d94a16aa5f74U,
+      0x0cd5d55aff958U, 0x38eaacee42debU, 0x59489f6e8faa9U, 0x1af3ae091ccc8U, 0x69be1343c2f2bU
+    },
+    {
+      0x3bdac684b8de3U, 0x207f940e31057U, 0x25aaaa28bd31fU, 0x1bb19bfc97df0U, 0x200d4d8c63587U,
+      0x11d5ee197c92aU, 0x3e528a233e1c1U, 0x0d3a6713d4406U, 0x34b0a1b3cdcf8U, 0x7d88112e4d24cU,
+      0x2ed4b4893b32bU, 0x7d7cb372c8411U, 0x697941cfbefc8U, 0x6ca6bb16f586dU, 0x69607bd681bd9U
+    },
+    {
+      0x73bd49323a902U, 0x2cd658dca676fU, 0x1e14a9df086d5U, 0x70072dd47fa9dU, 0x28bc77a5838ecU,
+      0x6021068de1ce1U, 0x4e1db9783fed7U, 0x5541697a35463U, 0x7e871f7fee80dU, 0x35f63353d3ec3U,
+      0x278a8e25d8036U, 0x0128666920c77U, 0x23394c98d9478U, 0x292246c179014U, 0x3a31abfa36b57U
+    }
+  },
+#endif
+#if 30 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x7788f3f78d289U, 0x5942809b3f811U, 0x5973277f8c29cU, 0x010f93bc5fe67U, 0x7ee498165acb2U,
+      0x69624089c0a2eU, 0x0075fc8e70473U, 0x13e84ab1d2313U, 0x2c10bedf6953bU, 0x639b93f0321c8U,
+      0x508e39111a1c3U, 0x290120e912f7aU, 0x1cbf464acae43U, 0x15373e9576157U, 0x0edf493c85b60U
+    },
+    {
+      0x7c4d284764113U, 0x7fefebf06acecU, 0x39afb7a824100U, 0x1b48e47e7fd65U, 0x04c00c54d1dfaU,
+      0x48158599b5a68U, 0x1fd75bc41d5d9U, 0x2d9fc1fa95d3cU, 0x7da27f20eba11U, 0x403b92e3019d4U,
+      0x22f818b465cf8U, 0x342901dff09b8U, 0x31f595dc683cdU, 0x37a57745fd682U, 0x355bb12ab2617U
+    },
+    {
+      0x1dac75a8c7318U, 0x3b679d5423460U, 0x6b8fcb7b6400eU, 0x6c73783be5f9dU, 0x7518eaf8e052aU,
+      0x664cc7493bbf4U, 0x33d94761874e3U, 0x0179e1796f613U, 0x1890535e2867dU, 0x0f9b8132182ecU,
+      0x059c41b7f6c32U, 0x79e8706531491U, 0x6c747643cb582U, 0x2e20c0ad494e4U, 0x47c3871bbb175U
+    },
+    {
+      0x65d50c85066b0U, 0x6167453361f7cU, 0x06ba3818bb312U, 0x6aff29baa7522U, 0x08fea02ce8d48U,
+      0x4539771ec4f48U, 0x7b9318badca28U, 0x70f19afe016c5U, 0x4ee7bb1608d23U, 0x00b89b8576469U,
+      0x5dd7668deead0U, 0x4096d0ba47049U, 0x6275997219114U, 0x29bda8a67e6aeU, 0x473829a74f75dU
+    },
+    {
+      0x1533aad3902c9U, 0x1dde06b11e47bU, 0x784bed1930b77U, 0x1c80a92b9c867U, 0x6c668b4d44e4dU,
+      0x2da754679c418U, 0x3164c31be105aU, 0x11fac2b98ef5fU, 0x35a1aaf779256U, 0x2078684c4833cU,
+      0x0cf217a78820cU, 0x65024e7d2e769U, 0x23bb5efdda82aU, 0x19fd4b632d3c6U, 0x7411a6054f8a4U
+    },
+    {
+      0x2e53d18b175b4U, 0x33e7254204af3U, 0x3bcd7d5a1c4c5U, 0x4c7c22af65d0fU, 0x1ec9a872458c3U,
+      0x59d32b99dc86dU, 0x6ac075e22a9acU, 0x30b9220113371U, 0x27fd9a638966eU, 0x7c136574fb813U,
+      0x6a4d400a2509bU, 0x041791056971cU, 0x655d5866e075cU, 0x2302bf3e64df8U, 0x3add88a5c7cd6U
+    },
+    {
+      0x298d459393046U, 0x30bfecb3d90b8U, 0x3d9b8ea3df8d6U, 0x3900e96511579U, 0x61ba1131a406aU,
+      0x15770b635dcf2U, 0x59ecd83f79571U, 0x2db461c0b7fbdU, 0x73a42a981345fU, 0x249929fccc879U,
+      0x0a0f116959029U, 0x5974fd7b1347aU, 0x1e0cc1c08edadU, 0x673bdf8ad1f13U, 0x5620310cbbd8eU
+    },
+    {
+      0x6b5f477e285d6U, 0x4ed91ec326cc8U, 0x6d6537503a3fdU, 0x626d3763988d5U, 0x7ec846f3658ceU,
+      0x193434934d643U, 0x0d4a2445eaa51U, 0x7d0708ae76fe0U, 0x39847b6c3c7e1U, 0x37676a2a4d9d9U,
+      0x68f3f1da22ec7U, 0x6ed8039a2736bU, 0x2627ee04c3c75U, 0x6ea90a647e7d1U, 0x6daaf723399b9U
+    }
+  },
+#endif
+#if 31 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6bbdd2cd13070U, 0x4bf0b41d3d035U, 0x37ffb2e58b90cU, 0x0736f49c8d565U, 0x53177fda52c23U,
+      0x64a5610628564U, 0x795169be68b23U, 0x68e390ca92ee1U, 0x2376f1512b973U, 0x3cbdabd9fee50U,
+      0x4970650b9de79U, 0x7786036b374f7U, 0x5ab8e30f44a9fU, 0x4ee0132973469U, 0x79d739835a619U
+    },
+    {
+      0x1d9920d591737U, 0x25d368d9ac439U, 0x626ff2a6fa907U, 0x7fc7107421006U, 0x79d99f946eae5U,
+      0x54df64131c1bdU, 0x430dd8b045b26U, 0x167cf09d60252U, 0x1412232770972U, 0x6c11fce4cb133U,
+      0x3483568673205U, 0x507955b2d9e2fU, 0x3ff8e18e1f7abU, 0x2ccb0da38feabU, 0x31741195b745aU
+    },
+    {
+      0x0ba683b02a047U, 0x2dfddf6d902ffU, 0x55b2f89408482U, 0x0adb809cdf10aU, 0x203e44a11d989U,
+      0x10190b77a360bU, 0x41332bce05d1aU, 0x0091eaa66e60cU, 0x543dea7effc7dU, 0x2772e344e0d36U,
+      0x63eba37b9e39fU, 0x52e476b447ad0U, 0x1701d88416f05U, 0x46a0827b22cd3U, 0x567951295b4d3U
+    },
+    {
+      0x42eb30d4b497fU, 0x0d7379990e0e4U, 0x045bd147be58cU, 0x5821bca849a6cU, 0x05468d6201405U,
+      0x7d60613037524U, 0x6d61f784d4a6bU, 0x7a642bb8842b7U, 0x5fcd646854d91U, 0x47204d08d72fdU,
+      0x565a9f93267deU, 0x1b81ab1d1401eU, 0x4638a3b3b3f5eU, 0x1a9510af16e79U, 0x4599ee919b633U
+    },
+    {
+      0x46d6b861ae579U, 0x21ed5d53b958eU, 0x095b530c6ac19U, 0x2ef120eb308a0U, 0x2f485e853d21aU,
+      0x220ca70e0e76bU, 0x31d53e6129a78U, 0x49c4a0ac4afa9U, 0x01414a6ef6461U, 0x0c3539e1a1d1dU,
+      0x744839c0833f3U, 0x7fa5578908652U, 0x4d6205dbf9895U, 0x4de2993e8c0a5U, 0x65712585893feU
+    },
+    {
+      0x29f1bd708ee3fU, 0x0b5cc80fa1038U, 0x28fae9f772d68U, 0x418cbd760ebe9U, 0x1590521a91d50U,
+      0x02fb732a61161U, 0x3a69aa4151382U, 0x66a45db923843U, 0x0031b2e31aa37U, 0x32f6fe4c046f6U,
+      0x3a11ec7910accU, 0x71e2da4f5c814U, 0x6c65752404f7fU, 0x2318d4b906c55U, 0x1bb9fe452ea98U
+    },
+    {
+      0x66c95cc36747cU, 0x26d617861b9ebU, 0x1e5ebc0a50805U, 0x1e4a29d633e77U, 0x5eae6ab32a8bbU,
+      0x1d950b3d54f9eU, 0x7dc01a6783d3aU, 0x13f1ab0b57e72U, 0x664a8e1632b50U, 0x65c091ee3c1cbU,
+      0x3661114f118eaU, 0x772869395ae10U, 0x3a67d00acdee1U, 0x34c3939fa8e5aU, 0x78a2a95823d75U
+    },
+    {
+      0x23c425ef83207U, 0x279352696b69eU, 0x7f61fdeafe253U, 0x098683846099cU, 0x1876789117166U,
+      0x072e95c8c2aceU, 0x2cca3d3897456U, 0x39ed0ada73ff2U, 0x759a219477c21U, 0x5dd996c122aadU,
+      0x35ef0670c507cU, 0x057278677f24bU, 0x37400fe066f21U, 0x63a083c974d38U, 0x59ad4b7a6e28dU
+    }
+  },
+#endif
+#if 32 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x304bfacad8ea2U, 0x502917d108b07U, 0x043176ca6dd0fU, 0x5d5158f2c1d84U, 0x2b5449e58eb3bU,
+      0x27562eb3dbe47U, 0x291d7b4170be7U, 0x5d1ca67dfa8e1U, 0x2a88061f298a2U, 0x1304e9e71627dU,
+      0x014d26adc9cfeU, 0x7f1691ba16f13U, 0x5e71828f06eacU, 0x349ed07f0fffcU, 0x4468de2d7c2ddU
+    },
+    {
+      0x2d8c6f86307ceU, 0x6286ba1850973U, 0x5e9dcb08444d4U, 0x1a96a543362b2U, 0x5da6427e63247U,
+      0x3355e9419469eU, 0x1847bb8ea8a37U, 0x1fe6588cf9b71U, 0x6b1c9d2db6b22U, 0x6cce7c6ffb44bU,
+      0x4c688deac22caU, 0x6f775c3ff0352U, 0x565603ee419bbU, 0x6544456c61c46U, 0x58f29abfe79f2U
+    },
+    {
+      0x264bf710ecdf6U, 0x708c58527896bU, 0x42ceae6c53394U, 0x4381b21e82b6aU, 0x6af93724185b4U,
+      0x6cfab8de73e68U, 0x3e6efced4bd21U, 0x0056609500dbeU, 0x71b7824ad85dfU, 0x577629c4a7f41U,
+      0x0024509c6a888U, 0x2696ab12e6644U, 0x0cca27f4b80d8U, 0x0c7c1f11b119eU, 0x701f25bb0caecU
+    },
+    {
+      0x0f6d97cbec113U, 0x4ce97fb7c93a3U, 0x139835a11281bU, 0x728907ada9156U, 0x720a5bc050955U,
+      0x0b0f8e4616cedU, 0x1d3c4b50fb875U, 0x2f29673dc0198U, 0x5f4b0f1830ffaU, 0x2e0c92bfbdc40U,
+      0x709439b805a35U, 0x6ec48557f8187U, 0x08a4d1ba13a2cU, 0x076348a0bf9aeU, 0x0e9b9cbb144efU
+    },
+    {
+      0x69bd55db1beeeU, 0x6e14e47f731bdU, 0x1a35e47270eacU, 0x66f225478df8eU, 0x366d44191cfd3U,
+      0x2d48ffb5720adU, 0x57b7f21a1df77U, 0x5550effba0645U, 0x5ec6a4098a931U, 0x221104eb3f337U,
+      0x41743f2bc8c14U, 0x796b0ad8773c7U, 0x29fee5cbb689bU, 0x122665c178734U, 0x4167a4e6bc593U
+    },
+    {
+      0x62665f8ce8feeU, 0x29d101ac59857U, 0x4d93bbba59ffcU, 0x17b7897373f17U, 0x34b33370cb7edU,
+      0x39d2876f62700U, 0x001cecd1d6c87U, 0x7f01a11747675U, 0x2350da5a18190U, 0x7938bb7e22552U,
+      0x591ee8681d6ccU, 0x39db0b4ea79b8U, 0x202220f380842U, 0x2f276ba42e0acU, 0x1176fc6e2dfe6U
+    },
+    {
+      0x0e28949770eb8U, 0x5559e88147b72U, 0x35e1e6e63ef30U, 0x35b109aa7ff6fU, 0x1f6a3e54f2690U,
+      0x76cd05b9c619bU, 0x69654b0901695U, 0x7a53710b77f27U, 0x79a1ea7d28175U, 0x08fc3a4c677d5U,
+      0x4c199d30734eaU, 0x6c622cb9acc14U, 0x5660a55030216U, 0x068f1199f11fbU, 0x4f2fad0116b90U
+    },
+    {
+      0x4d91db73bb638U, 0x55f82538112c5U, 0x6d85a279815deU, 0x740b7b0cd9cf9U, 0x3451995f2944eU,
+      0x6b24194ae4e54U, 0x2230afded8897U, 0x23412617d5071U, 0x3d5d30f35969bU, 0x445484a4972efU,
+      0x2fcd09fea7d7cU, 0x296126b9ed22aU, 0x4a171012a05b2U, 0x1db92c74d5523U, 0x10b89ca604289U
+    }
+  },
+#endif
+#if 33 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4ded679d34aa0U, 0x01989b673facfU, 0x574643f302e7bU, 0x7f7d29ad22b71U, 0x2e05d9eaf61f6U,
+      0x2426e3b646025U, 0x2070b9c99f365U, 0x5b7a914c849c6U, 0x73ad12e7fe16eU, 0x06409010bea8dU,
+      0x7901ad61beb59U, 0x79cbb91015888U, 0x729a09d987c66U, 0x79312342a415bU, 0x293c778cefe07U
+    },
+    {
+      0x795d6a11ff200U, 0x4562b02b922d8U, 0x54e56d72dc343U, 0x5a7c4f949904dU, 0x50b8c2d031e47U,
+      0x09e7007069096U, 0x2bc9ca03130d0U, 0x068051eab5d6cU, 0x6af03f9ab8ad1U, 0x0487f3f112815U,
+      0x50c08068a4962U, 0x26a2125934906U, 0x5bf2375bff741U, 0x2c58bd7a7a557U, 0x4b0553b53cdbaU
+    },
+    {
+      0x5211b27c152d4U, 0x137a35ec737e0U, 0x1beae617b09a1U, 0x4202f05965547U, 0x054c8bdd50bd0U,
+      0x5fcbe1b32ff79U, 0x3e076a1f3738cU, 0x01f981badd7aaU, 0x4847e76953636U, 0x35106cd551717U,
+      0x0b12f1dcf073dU, 0x476fed44ec714U, 0x5013e692d82a2U, 0x114ff6ad612e9U, 0x72e82d5e5505cU
+    },
+    {
+      0x1cdfd69771d02U, 0x1ad9f7e2fc01bU, 0x2c4bb1d0409dbU, 0x430a62298360eU, 0x2857bf1627500U,
+      0x3697ff0d844c8U, 0x39b2f39692d61U, 0x7683c7eec4be1U, 0x108e952a0e360U, 0x7b7c242958ce7U,
+      0x1903f0101689eU, 0x277f0c200b3e4U, 0x7ac3c6f5de77fU, 0x06a5091772f9eU, 0x510df84b485a0U
+    },
+    {
+      0x3c887c70ac15eU, 0x2ff7036e64496U, 0x5e3306ec3ce95U, 0x7c74d966f17f2U, 0x4cf7ed0703b54U,
+      0x133bb9277a1faU, 0x44c732246f4a8U, 0x74bc569d3b0edU, 0x51d0d1e2a6e1aU, 0x2d347144e482bU,
+      0x47c6598fbee0fU, 0x4556ab7c5ad7aU, 0x1d84316791ccfU, 0x5520849fb1209U, 0x4e05e26ad0a1eU
+    },
+    {
+      0x3c773e18fe6c0U, 0x35a790e4ca306U, 0x45aca0f8f11c4U, 0x6dc1dfe9e2780U, 0x1955875eb4cd4U,
+      0x36b624b531f20U, 0x1ceea13577b53U, 0x08f2e010a69d8U, 0x7c16df4fa9174U, 0x618f1856880c8U,
+      0x6de8f0e399799U, 0x4881fb42f0db4U, 0x0d58f75eb586aU, 0x05759966c082fU, 0x15f6beae2ae34U
+    },
+    {
+      0x20f7b9245e215U, 0x5bb3181b77753U, 0x082c083cda184U, 0x76d17427265f9U, 0x6ba92fe962d90U,
+      0x3cb0c31ec3a62U, 0x0a2271e7850c5U, 0x76b0a920438adU, 0x140bc47625c1cU, 0x28f76867ae2a9U,
+      0x5f9655884e2aaU, 0x37b7a8cb4a7c9U, 0x7a79492f58befU, 0x1ebebacb65506U, 0x6e8042ccb2b1bU
+    },
+    {
+      0x0653616521f7eU, 0x712c407b742a6U, 0x17c21e598341aU, 0x3d8169cc4de2aU, 0x4b5303af78ebdU,
+      0x53c29ce28ca6eU, 0x01f96c127be21U, 0x3a8b4feeb4d15U, 0x45cf3a1376bd1U, 0x08af9d4e4ff29U,
+      0x0a6c3bebcbde8U, 0x15b8751d12e5fU, 0x6ff7de93c3f29U, 0x75bb7d4ea7463U, 0x0dcf2d679b624U
+    }
+  },
+#endif
+#if 34 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x141be5a45f06eU, 0x5adb38becaea7U, 0x3fd46db41f2bbU, 0x6d488bbb5ce39U, 0x17d2d1d9ef0d4U,
+      0x147499718289cU, 0x0a48a67e4c7abU, 0x30fbc544bafe3U, 0x0c701315fe58aU, 0x20b878d577b75U,
+      0x2af18073f3e6aU, 0x33aea420d24feU, 0x298008bf4ff94U, 0x3539171db961eU, 0x72214f63cc65cU
+    },
+    {
+      0x5b7b9f43b29c9U, 0x149ea31eea3b3U, 0x4be7713581609U, 0x2d87960395e98U, 0x1f24ac855a154U,
+      0x37f405307a693U, 0x2e5e66cf2b69cU, 0x5d84266ae9c53U, 0x5e4eb7de853b9U, 0x5fdf48c58171cU,
+      0x608328e9505aaU, 0x22182841dc49aU, 0x3ec96891d2307U, 0x2f363fff22e03U, 0x00ba739e2ae39U
+    },
+    {
+      0x426f5ea88bb26U, 0x33092e77f75c8U, 0x1a53940d819e7U, 0x1132e4f818613U, 0x72297de7d518dU,
+      0x698de5c8790d6U, 0x268b8545beb25U, 0x6d2648b96fedfU, 0x47988ad1db07cU, 0x03283a3e67ad7U,
+      0x41dc7be0cb939U, 0x1b16c66100904U, 0x0a24c20cbc66dU, 0x4a2e9efe48681U, 0x05e1296846271U
+    },
+    {
+      0x7bbc8242c4550U, 0x59a06103b35b7U, 0x7237e4af32033U, 0x726421ab3537aU, 0x78cf25d38258cU,
+      0x2eeb32d9c495aU, 0x79e25772f9750U, 0x6d747833bbf23U, 0x6cdd816d5d749U, 0x39c00c9c13698U,
+      0x66b8e31489d68U, 0x573857e10e2b5U, 0x13be816aa1472U, 0x41964d3ad4bf8U, 0x006b52076b3ffU
+    },
+    {
+      0x37e16b9ce082dU, 0x1882f57853eb9U, 0x7d29eacd01fc5U, 0x2e76a59b5e715U, 0x7de2e9561a9f7U,
+      0x0cfe19d95781cU, 0x312cc621c453cU, 0x145ace6da077cU, 0x0912bef9ce9b8U, 0x4d57e3443bc76U,
+      0x0d4f4b6a55ecbU, 0x7ebb0bb733bceU, 0x7ba6a05200549U, 0x4f6ede4e22069U, 0x6b2a90af1a602U
+    },
+    {
+      0x3f3245bb2d80aU, 0x0e5f720f36efdU, 0x3b9cccf60c06dU, 0x084e323f37926U, 0x465812c8276c2U,
+      0x3f4fc9ae61e97U, 0x3bc07ebfa2d24U, 0x3b744b55cd4a0U, 0x72553b25721f3U, 0x5fd8f4e9d12d3U,
+      0x3beb22a1062d9U, 0x6a7063b82c9a8U, 0x0a5a35dc197edU, 0x3c80c06a53defU, 0x05b32c2b1cb16U
+    },
+    {
+      0x4a42c7ad58195U, 0x5c8667e799effU, 0x02e5e74c850a1U, 0x3f0db614e869aU, 0x31771a4856730U,
+      0x05eccd24da8fdU, 0x580bbfdf07918U, 0x7e73586873c6aU, 0x74ceddf77f93eU, 0x3b5556a37b471U,
+      0x0c524e14dd482U, 0x283457496c656U, 0x0ad6bcfb6cd45U, 0x375d1e8b02414U, 0x4fc079d27a733U
+    },
+    {
+      0x48b440c86c50dU, 0x139929cca3b86U, 0x0f8f2e44cdf2fU, 0x68432117ba6b2U, 0x241170c2bae3cU,
+      0x138b089bf2f7fU, 0x4a05bfd34ea39U, 0x203914c925ef5U, 0x7497fffe04e3cU, 0x124567cecaf98U,
+      0x1ab860ac473b4U, 0x5c0227c86a7ffU, 0x71b12bfc24477U, 0x006a573a83075U, 0x3f8612966c870U
+    }
+  },
+#endif
+#if 35 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x7dffe638c7bf3U, 0x407116932aa53U, 0x6b409277cae79U, 0x276f013d9a78dU, 0x7bc92fc9b9fa7U,
+      0x45303f7957be4U, 0x41c10b828a193U, 0x21401428f0c68U, 0x16d58390eb8e8U, 0x0aba390eab0bfU,
+      0x7ef2e801ad9f9U, 0x28f35fb4753f2U, 0x565ad420da5f5U, 0x470748359ffdeU, 0x02672b37dd3fbU
+    },
+    {
+      0x3a729398ca7f5U, 0x4af49093b7dd3U, 0x3151387ae7298U, 0x16414f594e73fU, 0x232ca21ef736eU,
+      0x2ca8b260885e4U, 0x5905669838916U, 0x7d63dd290a1afU, 0x152c9bf0d130bU, 0x741d1fcbab2caU,
+      0x1423d253fcb17U, 0x55f473d6297ecU, 0x1471ebc2200f3U, 0x0a5f8c3016fccU, 0x0400f3a049e34U
+    },
+    {
+      0x3a412a06e7b06U, 0x0a591a4ac05dfU, 0x1ea471c519e15U, 0x6f9efcb89f5ebU, 0x32830ac7157eaU,
+      0x60476ba61c55bU, 0x2f89a72e2d579U, 0x360b424da8f5bU, 0x37db7592ceaf4U, 0x0c9176e984d75U,
+      0x02a7ab73769e8U, 0x70eb631c581cfU, 0x733ab84128175U, 0x41014a9291375U, 0x0d794f8383ebaU
+    },
+    {
+      0x44ce7a7a2e1acU, 0x7df5a3716ef7cU, 0x57df26d047f64U, 0x58b0b9a50eb86U, 0x0d6592233127dU,
+      0x5f5cb9e1516f4U, 0x1ec9155c8bfe6U, 0x4ea7bcfba016fU, 0x361786b9e15dcU, 0x097b0bf22092aU,
+      0x3ab1521a9d733U, 0x55ac35764b891U, 0x32d0c169b0babU, 0x533b12e360e63U, 0x7fc90fea93eb3U
+    },
+    {
+      0x7deb59c7cb23dU, 0x52a650809d8a4U, 0x33cb1ea554e45U, 0x508eb21c940beU, 0x6ce97dabf7d8fU,
+      0x0f1fe1f5c5926U, 0x3c764b17e8081U, 0x71c59a46a3cbdU, 0x3bf2054a8d17eU, 0x6598ee93c98b5U,
+      0x5a8e50ef7c48fU, 0x22de59ca644b6U, 0x4f794dfad80d0U, 0x581e2f3a8b9f2U, 0x73119fa08c12bU
+    },
+    {
+      0x5b94d21f4774dU, 0x58f12f6e4ef08U, 0x15948aefd8bc5U, 0x109338c2be01eU, 0x3cd6a85295621U,
+      0x0129453f1a4cbU, 0x1391ea6f0fda6U, 0x2fb9ee6f39887U, 0x1467d6595899cU, 0x3025798a9ea84U,
+      0x4de923aeca999U, 0x00c5d1825e7fdU, 0x2622b7af6a96cU, 0x01b33dccefe4bU, 0x3f52c02852661U
+    },
+    {
+      0x0bf99eec416c6U, 0x2f53a5ece324bU, 0x37a92aeb22940U, 0x2b4b14aa4d58bU, 0x05d0e85c99091U,
+      0x2a48e2a1351c6U, 0x29f4fea7afffdU, 0x60b77c4a1891dU, 0x62c85add4f2baU, 0x60c0104ba696aU,
+      0x5e020de9cbe97U, 0x2d6a179ee80a3U, 0x4477d97e81ff1U, 0x7269bc6764f87U, 0x36853c69ab96dU
+    },
+    {
+      0x3c0b0fac5e7beU, 0x0a9811b97c886U, 0x25e3e6dc92ebaU, 0x7e478f9266223U, 0x4a0aff6d62825U,
+      0x1b8de78f39b2dU, 0x63508f73d86dbU, 0x6f4ff79fd0bb5U, 0x735920e68eb3cU, 0x6a704fec92fbcU,
+      0x7fb9e61095301U, 0x28054125f1d22U, 0x198642f040b7eU, 0x71bdf84f17afdU, 0x681109bee0dcfU
+    }
+  },
+#endif
+#if 36 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x0fcfa36048d13U, 0x66e7133bbb383U, 0x64b42a8a45676U, 0x4ea6e4f9a85cfU, 0x26f57eee878a1U,
+      0x20cc9782a0ddeU, 0x65d4e3070aab3U, 0x7bc8e31547736U, 0x09ebfb1432d98U, 0x504aa77679736U,
+      0x32cd55687efb1U, 0x4448f5e2f6195U, 0x568919d460345U, 0x034c2e0ad1a27U, 0x4041943d9dba3U
+    },
+    {
+      0x17743a26caaddU, 0x48c9156f9c964U, 0x7ef278d1e9ad0U, 0x00ce58ea7bd01U, 0x12d931429800dU,
+      0x0eeba43ebcc96U, 0x384dd5395f878U, 0x1df331a35d272U, 0x207ecfd4af70eU, 0x1420a1d976843U,
+      0x67799d337594fU, 0x01647548f6018U, 0x57fce5578f145U, 0x009220c142a71U, 0x1b4f92314359aU
+    },
+    {
+      0x73030a49866b1U, 0x2442be90b2679U, 0x77bd3d8947dcfU, 0x1fb55c1552028U, 0x5ff191d56f9a2U,
+      0x4109d89150951U, 0x225bd2d2d47cbU, 0x57cc080e73beaU, 0x6d71075721fcbU, 0x239b572a7f132U,
+      0x6d433ac2d9068U, 0x72bf930a47033U, 0x64facf4a20eadU, 0x365f7a2b9402aU, 0x020c526a758f3U
+    },
+    {
+      0x1ef59f042cc89U, 0x3b1c24976dd26U, 0x31d665cb16272U, 0x28656e470c557U, 0x452cfe0a5602cU,
+      0x034f89ed8dbbcU, 0x73b8f948d8ef3U, 0x786c1d323caabU, 0x43bd4a9266e51U, 0x02aacc4615313U,
+      0x0f7a0647877dfU, 0x4e1cc0f93f0d4U, 0x7ec4726ef1190U, 0x3bdd58bf512f8U, 0x4cfb7d7b304b8U
+    },
+    {
+      0x699c29789ef12U, 0x63beae321bc50U, 0x325c340adbb35U, 0x562e1a1e42bf6U, 0x5b1d4cbc434d3U,
+      0x43d6cb89b75feU, 0x3338d5b900e56U, 0x38d327d531a53U, 0x1b25c61d51b9fU, 0x14b4622b39075U,
+      0x32615cc0a9f26U, 0x57711b99cb6dfU, 0x5a69c14e93c38U, 0x6e88980a4c599U, 0x2f98f71258592U
+    },
+    {
+      0x2ae444f54a701U, 0x615397afbc5c2U, 0x60d7783f3f8fbU, 0x2aa675fc486baU, 0x1d8062e9e7614U,
+      0x4a74cb50f9e56U, 0x531d1c2640192U, 0x0c03d9d6c7fd2U, 0x57ccd156610c1U, 0x3a6ae249d806aU,
+      0x2da85a9907c5aU, 0x6b23721ec4cafU, 0x4d2d3a4683aa2U, 0x7f9c6870efdefU, 0x298b8ce8aef25U
+    },
+    {
+      0x272ea0a2165deU, 0x68179ef3ed06fU, 0x4e2b9c0feac1eU, 0x3ee290b1b63bbU, 0x6ba6271803a7dU,
+      0x27953eff70cb2U, 0x54f22ae0ec552U, 0x29f3da92e2724U, 0x242ca0c22bd18U, 0x34b8a8404d5ceU,
+      0x6ecb583693335U, 0x3ec76bfdfb84dU, 0x2c895cf56a04fU, 0x6355149d54d52U, 0x71d62bdd465e1U
+    },
+    {
+      0x5b5dab1f75ef5U, 0x1e2d60cbeb9a5U, 0x527c2175dfe57U, 0x59e8a2b8ff51fU, 0x1c333621262b2U,
+      0x3cc28d378df80U, 0x72141f4968ca6U, 0x407696bdb6d0dU, 0x5d271b22ffcfbU, 0x74d5f317f3172U,
+      0x7e55467d9ca81U, 0x6a5653186f50dU, 0x6b188ece62df1U, 0x4c66d36844971U, 0x4aebcc4547e9dU
+    }
+  },
+#endif
+#if 37 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x1b204a059a445U, 0x54962f5a1e1bdU, 0x5e7155f8572d2U, 0x40df0ddf6290fU, 0x2633f1b9d0710U,
+      0x75a7205d21a77U, 0x45a77269a8a62U, 0x577ab72c30110U, 0x7c656ecf925eeU, 0x074f46e69f10fU,
+      0x34177018b9910U, 0x38d81fc28183fU, 0x5531bfe9ba883U, 0x03d6b30f9f3a1U, 0x5ecb72e6f1a34U
+    },
+    {
+      0x2e106e8e86997U, 0x7f31a12707fddU, 0x01bafbe618ccdU, 0x1684a38240755U, 0x038b6898d4c5cU,
+      0x5a31b2259fb4eU, 0x2e57958a5f4a2U, 0x4d1532c2583ceU, 0x00cf6da97f646U, 0x382e2720c476cU,
+      0x1c51d8ace50a6U, 0x735c5a5291e72U, 0x4932a00c50b42U, 0x7546da6ad0d3fU, 0x21aeba8b59250U
+    },
+    {
+      0x53600f0087f23U, 0x73b4faaf08a70U, 0x07da181311861U, 0x476b57981ef5aU, 0x0a3c16c5c27c1U,
+      0x13b34cf405530U, 0x14861115ee49eU, 0x01a9208f113a9U, 0x436aeeae28b80U, 0x118eb8f8890b0U,
+      0x49c17cc947f3dU, 0x4d5583a4f62fcU, 0x3c2395b331bb6U, 0x1b5efb0496758U, 0x4909b3e22c67cU
+    },
+    {
+      0x16676706ff64eU, 0x3a1b0d4a7ab34U, 0x1702e5842e54fU, 0x6342c2470f367U, 0x2d8b78e712780U,
+      0x485ea63fe2e89U, 0x221d2825d9393U, 0x3eff9eef86ebeU, 0x5b647bdd54543U, 0x0fb17f9fef968U,
+      0x5c62eafc3902bU, 0x2513d00e50f3aU, 0x40482e5dce885U, 0x536e1c5732070U, 0x09ae23717b2b1U
+    },
+    {
+      0x38fa1ad32b1d0U, 0x37c4ef1648215U, 0x4f7a43fa6b3b4U, 0x4cb5442b5e01bU, 0x66f35ddddda53U,
+      0x2192a4e4d083cU, 0x460053c32576dU, 0x3eaebacd2b381U, 0x5564c122d2cd5U, 0x6d9c8a9ada97fU,
+      0x59afb24997323U, 0x7dede03a5da4fU, 0x4bb31fc6edf81U, 0x6e415d3a396faU, 0x03019b4f646f9U
+    },
+    {
+      0x1b214e6b3dc6bU, 0x6b5afa5ecb5e1U, 0x0288ec0fdd5ceU, 0x2fbe80cecc408U, 0x392b63a58b5c3U,
+      0x186b5565345cdU, 0x21798822d4094U, 0x3eca917bb9d98U, 0x289344e39da3cU, 0x387dcbff65697U,
+      0x3addc9c07c205U, 0x2bea6586fc812U, 0x60d00ab1596f8U, 0x19731edf67e8aU, 0x61722b4aef2e0U
+    },
+    {
+      0x07a5581cb0e3cU, 0x0db28892d3ad6U, 0x373687ca43fc0U, 0x72c843405b50bU, 0x5568d2b75a06dU,
+      0x2aafeecbd47afU, 0x7639a8c612002U, 0x59f1cb156899bU, 0x214f901f5b404U, 0x39633944ca3c1U,
+      0x4b88c1b37cfe1U, 0x460a7031e71a1U, 0x61f656416da96U, 0x7b27974de025bU, 0x6beba1249add7U
+    },
+    {
+      0x4ecb943f5a53bU, 0x3a0d811be4b87U, 0x625511e732698U, 0x7eae7dd31cd42U, 0x5a845ae80df09U,
+      0x6005ca5b1b143U, 0x70ffa39b443a0U, 0x7f3ff9db531aeU, 0x752b77acb3b29U, 0x097c29e8c1ce1U,
+      0x17dbe5deb94caU, 0x7118e1389099dU, 0x5a7425ce34290U, 0x3e1e21f676a50U, 0x0a1249fff7e58U
+    }
+  },
+#endif
+#if 38 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x08d9e7354b610U, 0x26b750b6dc168U, 0x162881e01acc9U, 0x7966df31d01a5U, 0x173bd9ddc9a1dU,
+      0x0071b276d01c9U, 0x0b0d8918e025eU, 0x75beea79ee2ebU, 0x3c92984094db8U, 0x5d88fbf95a3dbU,
+      0x00f1efe5872dfU, 0x5da872318256aU, 0x59ceb81635960U, 0x18cf37693c764U, 0x06e1cd13b19eaU
+    },
+    {
+      0x3af629e5b0353U, 0x204f1a088e8e5U, 0x10efc9ceea82eU, 0x589863c2fa34bU, 0x7f3a6a1a8d837U,
+      0x0ad516f166f23U, 0x263f56d57c81aU, 0x13422384638caU, 0x1331ff1af0a50U, 0x3080603526e16U,
+      0x644395d3d800bU, 0x2b9203dbedefcU, 0x4b18ce656a355U, 0x03f3466bc182cU, 0x30d0fded2e513U
+    },
+    {
+      0x4971e68b84750U, 0x52ccc9779f396U, 0x3e904ae8255c8U, 0x4ecae46f39339U, 0x4615084351c58U,
+      0x14d1af21233b3U, 0x1de1989b39c0bU, 0x52669dc6f6f9eU, 0x43434b28c3fc7U, 0x0a9214202c099U,
+      0x019c0aeb9a02eU, 0x1a2c06995d792U, 0x664cbb1571c44U, 0x6ff0736fa80b2U, 0x3bca0d2895ca5U
+    },
+    {
+      0x08eb69ecc01bfU, 0x5b4c8912df38dU, 0x5ea7f8bc2f20eU, 0x120e516caafafU, 0x4ea8b4038df28U,
+      0x031bc3c5d62a4U, 0x7d9fe0f4c081eU, 0x43ed51467f22cU, 0x1e6cc0c1ed109U, 0x5631deddae8f1U,
+      0x5460af1cad202U, 0x0b4919dd0655dU, 0x7c4697d18c14cU, 0x231c890bba2a4U, 0x24ce0930542caU
+    },
+    {
+      0x7a155fdf30b85U, 0x1c6c6e5d487f9U, 0x24be1134bdc5aU, 0x1405970326f32U, 0x549928a7324f4U,
+      0x090f5fd06c106U, 0x6abb1021e43fdU, 0x232bcfad711a0U, 0x3a5c13c047f37U, 0x41d4e3c28a06dU,
+      0x632a763ee1a2eU, 0x6fa4bffbd5e4dU, 0x5fd35a6ba4792U, 0x7b55e1de99de8U, 0x491b66dec0dcfU
+    },
+    {
+      0x04a8ed0da64a1U, 0x5ecfc45096ebeU, 0x5edee93b488b2U, 0x5b3c11a51bc8fU, 0x4cf6b8b0b7018U,
+      0x5b13dc7ea32a7U, 0x18fc2db73131eU, 0x7e3651f8f57e3U, 0x25656055fa965U, 0x08f338d0c85eeU,
+      0x3a821991a73bdU, 0x03be6418f5870U, 0x1ddc18eac9ef0U, 0x54ce09e998dc2U, 0x530d4a82eb078U
+    },
+    {
+      0x173456c9abf9eU, 0x7892015100dadU, 0x33ee14095fecbU, 0x6ad95d67a0964U, 0x0db3e7e00cbfbU,
+      0x43630e1f94825U, 0x4d1956a6b4009U, 0x213fe2df8b5e0U, 0x05ce3a41191e6U, 0x65ea753f10177U,
+      0x6fc3ee2096363U, 0x7ec36b96d67acU, 0x510ec6a0758b1U, 0x0ed87df022109U, 0x02a4ec1921e1aU
+    },
+    {
+      0x06162f1cf795fU, 0x324ddcafe5eb9U, 0x018d5e0463218U, 0x7e78b9092428eU, 0x36d12b5dec067U,
+      0x6259a3b24b8a2U, 0x188b5f4170b9cU, 0x681c0dee15debU, 0x4dfe665f37445U, 0x3d143c5112780U,
+      0x5279179154557U, 0x39f8f0741424dU, 0x45e6eb357923dU, 0x42c9b5edb746fU, 0x2ef517885ba82U
+    }
+  },
+#endif
+#if 39 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x436837c6da1e9U, 0x5e3f737b7c3d4U, 0x1774557e70626U, 0x729181800fe67U, 0x28a7c99ebc57bU,
+      0x5438cd11e0d4aU, 0x1a8799e611117U, 0x64def30c32d84U, 0x106704d071bc8U, 0x4559135b25b17U,
+      0x59399e8d19e9dU, 0x172c4847ff71fU, 0x71d0a8e420647U, 0x262595ca46ba3U, 0x37f33226d7fb4U
+    },
+    {
+      0x12553c821b11dU, 0x0483c603be672U, 0x1088bf59bb50bU, 0x3478337e60888U, 0x307a3b41c1921U,
+      0x68767b55f6e08U, 0x66b64074041b5U, 0x2be31e5290eceU, 0x3d1f1b92d3740U, 0x0f7a7fd1705faU,
+      0x35d076eb55ce0U, 0x7f541b24b51ddU, 0x2db1ba0bf14daU, 0x7a95f40c187eeU, 0x556c7045827baU
+    },
+    {
+      0x390022bf44406U, 0x7dff216a69729U, 0x3e1b4eaaf508dU, 0x771bb0054b07dU, 0x2f45abdac2322U,
+      0x3517302e9d8b7U, 0x52490e29d11c5U, 0x2a582d78f9489U, 0x6d4dea7debba6U, 0x6f4b4199c5ecaU,
+      0x74912c8ef8a6aU, 0x7c87f6dcbcc35U, 0x7509f3f963e93U, 0x0f5dad7e62eb7U, 0x6a5393281e1e1U
+    },
+    {
+      0x704fe149443cfU, 0x330cb9bbae1ffU, 0x47b46dd4f2b1bU, 0x1ce989c2d81a9U, 0x5846a27cacd10U,
+      0x25139a5d1ee89U, 0x79ff26d311e7bU, 0x3862312051515U, 0x51e9fb117f680U, 0x0f513815db8b5U,
+      0x5cdac1eb08717U, 0x2b21e5d3789feU, 0x5ebea659fa2caU, 0x45922049daf11U, 0x0d414bed8708bU
+    },
+    {
+      0x06a92294ac9e8U, 0x0baaaa8f7d031U, 0x5c5660c8c58adU, 0x200ca67de2201U, 0x50eb8fdb134bcU,
+      0x68265fd0e75f6U, 0x517721ce0f9f6U, 0x7e4b1eb916cf8U, 0x16eb921546f4fU, 0x685b320193320U,
+      0x73ec6d6b330cdU, 0x0e265f5fe3816U, 0x2977b86139120U, 0x1693995b9a962U, 0x5d7c7cf1aa7cdU
+    },
+    {
+      0x1013e9b73a562U, 0x2e91d84dc267aU, 0x51a01624973bdU, 0x21c53fe730a6eU, 0x78b0fad41e9aaU,
+      0x346bf7a4aafa2U, 0x589a81a8235e7U, 0x1f0578ede1c17U, 0x6a688a7863565U, 0x3f364faaa9489U,
+      0x6a431ed05b488U, 0x593892b8fd7eaU, 0x7cd946a94cf99U, 0x619f43295d7c3U, 0x0241800059d66U
+    },
+    {
+      0x50c7dcf38ea01U, 0x016522f56c506U, 0x5c20bddf1b36fU, 0x0f05673e7df42U, 0x4d2845aba2d9aU,
+      0x077fea37a5be4U, 0x05cb4bdd6f9d6U, 0x449c2e36d90bcU, 0x14e61736862a3U, 0x4771b65538e45U,
+      0x37fe0447070deU, 0x06dbaaafbf76aU, 0x0036f2f2e9d11U, 0x3fc69dad1a39bU, 0x4aeabbe6f9ffdU
+    },
+    {
+      0x134bcc4a9c8f2U, 0x39159c5c6ed44U, 0x44682ebefe3f4U, 0x5cf000571824cU, 0x046e3a616bc89U,
+      0x0119e40d8f78cU, 0x0a78e21c228c6U, 0x44375e6806a6fU, 0x272a4369592c4U, 0x1e6c47b3db032U,
+      0x65442f03906beU, 0x29c6c57c5429cU, 0x708c31d280675U, 0x30e34666ff646U, 0x7cfb7e3faf6b8U
+    }
+  },
+#endif
+#if 40 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6bffb305b2f51U, 0x5b112b2d712ddU, 0x35774974fe4e2U, 0x04af87a96e3a3U, 0x57968290bb3a0U,
+      0x7974e8c58aedcU, 0x7757e083488c6U, 0x601c62ae7bc8bU, 0x45370c2ecab74U, 0x2f1b78fab143aU,
+      0x2b8430a20e101U, 0x1a49e1d88fee3U, 0x38bbb47ce4d96U, 0x1f0e7ba84d437U, 0x7dc43e35dc2aaU
+    },
+    {
+      0x02a5c273e9718U, 0x32bc9dfb28b4fU, 0x48df4f8d5db1aU, 0x54c87976c028fU, 0x044fb81d82d50U,
+      0x66665887dd9c3U, 0x629760a6ab0b2U, 0x481e6c7243e6cU, 0x097e37046fc77U, 0x7ef72016758ccU,
+      0x718c5a907e3d9U, 0x3b9c98c6b383bU, 0x006ed255eccdcU, 0x6976538229a59U, 0x7f79823f9c30dU
+    },
+    {
+      0x41ff068f587baU, 0x1c00a191bcd53U, 0x7b56f9c209e25U, 0x3781e5fccaabeU, 0x64a9b0431c06dU,
+      0x4d239a3b513e8U, 0x29723f51b1066U, 0x642f4cf04d9c3U, 0x4da095aa09b7aU, 0x0a4e0373d784dU,
+      0x3d6a15b7d2919U, 0x41aa75046a5d6U, 0x691751ec2d3daU, 0x23638ab6721c4U, 0x071a7d0ace183U
+    },
+    {
+      0x4355220e14431U, 0x0e1362a283981U, 0x2757cd8359654U, 0x2e9cd7ab10d90U, 0x7c69bcf761775U,
+      0x72daac887ba0bU, 0x0b7f4ac5dda60U, 0x3bdda2c0498a4U, 0x74e67aa180160U, 0x2c3bcc7146ea7U,
+      0x0d7eb04e8295fU, 0x4a5ea1e6fa0feU, 0x45e635c436c60U, 0x28ef4a8d4d18bU, 0x6f5a9a7322acaU
+    },
+    {
+      0x1d4eba3d944beU, 0x0100f15f3dce5U, 0x61a700e367825U, 0x5922292ab3d23U, 0x02ab9680ee8d3U,
+      0x1000c2f41c6c5U, 0x0219fdf737174U, 0x314727f127de7U, 0x7e5277d23b81eU, 0x494e21a2e147aU,
+      0x48a85dde50d9aU, 0x1c1f734493df4U, 0x47bdb64866889U, 0x59a7d048f8eecU, 0x6b5d76cbea46bU
+    },
+    {
+      0x141171e782522U, 0x6806d26da7c1fU, 0x3f31d1bc79ab9U, 0x09f20459f5168U, 0x16fb869c03dd3U,
+      0x7556cec0cd994U, 0x5eb9a03b7510aU, 0x50ad1dd91cb71U, 0x1aa5780b48a47U, 0x0ae333f685277U,
+      0x6199733b60962U, 0x69b157c266511U, 0x64740f893f1caU, 0x03aa408fbf684U, 0x3f81e38b8f70dU
+    },
+    {
+      0x37f355f17c824U, 0x07ae85334815bU, 0x7e3abddd2e48fU, 0x61eeabe1f45e5U, 0x0ad3e2d34cdedU,
+      0x10fcc7ed9affeU, 0x4248cb0e96ff2U, 0x4311c115172e2U, 0x4c9d41cbf6925U, 0x50510fc104f50U,
+      0x40fc5336e249dU, 0x3386639fb2de1U, 0x7bbf871d17b78U, 0x75f796b7e8004U, 0x127c158bf0fa1U
+    },
+    {
+      0x28fc4ae51b974U, 0x26e89bfd2dbd4U, 0x4e122a07665cfU, 0x7cab1203405c3U, 0x4ed82479d167dU,
+      0x17c422e9879a2U, 0x28a5946c8fec3U, 0x53ab32e912b77U, 0x7b44da09fe0a5U, 0x354ef87d07ef4U,
+      0x3b52260c5d975U, 0x79d6836171fdcU, 0x7d994f140d4bbU, 0x1b6c404561854U, 0x302d92d205392U
+    }
+  },
+#endif
+#if 41 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x38b8b0df53c30U, 0x151cc1e1312afU, 0x15e5b78a871dcU, 0x5e4dde3d3381aU, 0x22a48f9a90c99U,
+      0x1023fcb3efb7cU, 0x338c78552898bU, 0x71f8211b0bf2eU, 0x26cdd20c87161U, 0x0e545daea5187U,
+      0x5c0dc8d3fac58U, 0x59cdc857fad6fU, 0x0034c15525f35U, 0x09b2a17be8dfaU, 0x4159f47f048d9U
+    },
+    {
+      0x515a8bbd24839U, 0x0f5f6056aae90U, 0x68a85fddc4a0dU, 0x078a85d156324U, 0x060525513ad73U,
+      0x5660839e31e32U, 0x2b080b7ca0415U, 0x36af1a7e0786fU, 0x4bafc03202b7aU, 0x14d23dd4ce71bU,
+      0x18e098aa27f82U, 0x7713436049e47U, 0x5374931b5e60aU, 0x0e1fd34a04210U, 0x71ab966fa3230U
+    },
+    {
+      0x08a0702809955U, 0x5416878723621U, 0x01a1bb50ec9cfU, 0x276e54db3d77fU, 0x605eecbf8335fU,
+      0x3d8e34ded02fcU, 0x58b2de45545b9U, 0x00ca3684547cfU, 0x5915e512aa1a7U, 0x35768fbe92411U,
+      0x00a656c340431U, 0x4f1dcb385f064U, 0x4c03e2a7f35c5U, 0x17cbaea309fb8U, 0x7a912faf60f54U
+    },
+    {
+      0x74f8dfa2d5597U, 0x00a8ee26184a7U, 0x5ac4408979271U, 0x62500602972ccU, 0x33cb966e33bb6U,
+      0x4585e5edc1a43U, 0x5cb12f8e79640U, 0x1c120f27c385bU, 0x4df2dc1605727U, 0x624a170e2bddfU,
+      0x028047f116909U, 0x383cac88ceb2eU, 0x085ce1e0a2b10U, 0x1c23820bedef3U, 0x721627aefbac4U
+    },
+    {
+      0x097bc410b2f22U, 0x4f6b9f5089fa6U, 0x55f29d3c68176U, 0x48130944d0ef7U, 0x245ea199bb821U,
+      0x03bc38736add5U, 0x5f8a6562612faU, 0x406ef10bc508aU, 0x7d39d534502b8U, 0x4c946cf7e74f9U,
+      0x4a66978d477f8U, 0x785222ffc35dbU, 0x032f5606262e8U, 0x1a8e7b9fcc1b9U, 0x67da12e6b8b56U
+    },
+    {
+      0x6f3d38ec8308cU, 0x58e3d7295656fU, 0x418aaf60a3f5fU, 0x0a0c03e1d9b62U, 0x0cb64cb831a94U,
+      0x7e187b4bd6e07U, 0x078fa3fce8e0cU, 0x32168c1ba3c08U, 0x3c549e355179cU, 0x76297d1f3d75aU,
+      0x0fc33534c6378U, 0x39ca83d0c2606U, 0x6cb1ca2e58d71U, 0x6e58aecd4df6cU, 0x49233ea3f3775U
+    },
+    {
+      0x185fe1c9f249bU, 0x2b42466526f67U, 0x37d35893f5acbU, 0x2866759a2ca0dU, 0x6987ff6f542deU,
+      0x398fa8dbffc3aU, 0x5baa9b68aac52U, 0x3c94a5784bf94U, 0x5a8f9df08efedU, 0x628b140dce5e7U,
+      0x241428f83753cU, 0x790cd5f32e8fcU, 0x46a60a58c5efaU, 0x596ed5dada19eU, 0x074d8d245287fU
+    },
+    {
+      0x075c6c0e31488U, 0x65c4406968903U, 0x4a0ed948650a6U, 0x3fcb911e4c518U, 0x3420d60b34227U,
+      0x7d9cd440bfc31U, 0x435e631faf066U, 0x4b081c1ca74b2U, 0x4df502052523bU, 0x46002ef03a734U,
+      0x23adeaffe65f7U, 0x28b7c0ec99f54U, 0x459100de0987bU, 0x1caa20e050f17U, 0x5aea8e567a87dU
+    }
+  },
+#endif
+#if 42 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x46fb6e4e0f177U, 0x53497ad5265b7U, 0x1ebdba01386fcU, 0x0302f0cb36a3cU, 0x0edc5f5eb426dU,
+      0x3c1a2bca4283dU, 0x23430c7bb2f02U, 0x1a3ea1bb58bc2U, 0x7265763de5c61U, 0x10e5d3b76f1caU,
+      0x3bfd653da8e67U, 0x584953ec82a8aU, 0x55e288fa7707bU, 0x5395fc3931d81U, 0x45b46c51361cbU
+    },
+    {
+      0x54ddd8a7fe3e4U, 0x2cecc41c619d3U, 0x43a6562ac4d91U, 0x4efa5aca7bdd9U, 0x5c1c0aef32122U,
+      0x02abf314f7fa1U, 0x391d19e8a1528U, 0x6a2fa13895fc7U, 0x09d8eddeaa591U, 0x2177bfa36dcb7U,
+      0x01bbcfa79db8fU, 0x3d84beb3666e1U, 0x20c921d812204U, 0x2dd843d3b32ceU, 0x4ae619387d8abU
+    },
+    {
+      0x17e44985bfb83U, 0x54e32c626cc22U, 0x096412ff38118U, 0x6b241d61a246aU, 0x75685abe5ba43U,
+      0x3f6aa5344a32eU, 0x69683680f11bbU, 0x04c3581f623aaU, 0x701af5875cba5U, 0x1a00d91b17bf3U,
+      0x60933eb61f2b2U, 0x5193fe92a4dd2U, 0x3d995a550f43eU, 0x3556fb93a883dU, 0x135529b623b0eU
+    },
+    {
+      0x716bce22e83feU, 0x33d0130b83eb8U, 0x0952abad0afacU, 0x309f64ed31b8aU, 0x5972ea051590aU,
+      0x0dbd7add1d518U, 0x119f823e2231eU, 0x451d66e5e7de2U, 0x500c39970f838U, 0x79b5b81a65ca3U,
+      0x4ac20dc8f7811U, 0x29589a9f501faU, 0x4d810d26a6b4aU, 0x5ede00d96b259U, 0x4f7e9c95905f3U
+    },
+    {
+      0x0443d355299feU, 0x39b7d7d5aee39U, 0x692519a2f34ecU, 0x6e4404924cf78U, 0x1942eec4a144aU,
+      0x74bbc5781302eU, 0x73135bb81ec4cU, 0x7ef671b61483cU, 0x7264614ccd729U, 0x31993ad92e638U,
+      0x45319ae234992U, 0x2219d47d24fb5U, 0x4f04488b06cf6U, 0x53aaa9e724a12U, 0x2a0a65314ef9cU
+    },
+    {
+      0x61acd3c1c793aU, 0x58b46b78779e6U, 0x3369aacbe7af2U, 0x509b0743074d4U, 0x055dc39b6dea1U,
+      0x7937ff7f927c2U, 0x0c2fa14c6a5b6U, 0x556bddb6dd07cU, 0x6f6acc179d108U, 0x4cf6e218647c2U,
+      0x1227cc28d5bb6U, 0x78ee9bff57623U, 0x28cb2241f893aU, 0x25b541e3c6772U, 0x121a307710aa2U
+    },
+    {
+      0x1713ec77483c9U, 0x6f70572d5facbU, 0x25ef34e22ff81U, 0x54d944f141188U, 0x527bb94a6ced3U,
+      0x35d5e9f034a97U, 0x126069785bc9bU, 0x5474ec7854ff0U, 0x296a302a348caU, 0x333fc76c7a40eU,
+      0x5992a995b482eU, 0x78dc707002ac7U, 0x5936394d01741U, 0x4fba4281aef17U, 0x6b89069b20a7aU
+    },
+    {
+      0x2fa8cb5c7db77U, 0x718e6982aa810U, 0x39e95f81a1a1bU, 0x5e794f3646cfbU, 0x0473d308a7639U,
+      0x2a0416270220dU, 0x75f248b69d025U, 0x1cbbc16656a27U, 0x5b9ffd6e26728U, 0x23bc2103aa73eU,
+      0x6792603589e05U, 0x248db9892595dU, 0x006a53cad2d08U, 0x20d0150f7ba73U, 0x102f73bfde043U
+    }
+  },
+#endif
+#if 43 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6cba293a36247U, 0x4564d1faca6b1U, 0x2807226be3e61U, 0x2922097bf4cb4U, 0x5786f312cd754U,
+      0x2d50c7ec20d3eU, 0x5d4192e4c76b4U, 0x7fdcd37192f75U, 0x55d2b74482960U, 0x4929c6f72b2ffU,
+      0x788ffca14032cU, 0x5088fe3dc666eU, 0x46f32b7ce4840U, 0x3c1c58a038f91U, 0x4c817b4bf2344U
+    },
+    {
+      0x3a057a40b4484U, 0x349ebed486827U, 0x3875872e930b8U, 0x629b0a5d052d7U, 0x78a1531a8b05dU,
+      0x053852871b96eU, 0x56c187e3761ffU, 0x4d1100b84fa7eU, 0x225f77eaca992U, 0x0a37c37075b77U,
+      0x5f1703ad0562bU, 0x61924a4346d97U, 0x610939e3b3d20U, 0x2b7ed75e981feU, 0x72ad82a42e5ecU
+    },
+    {
+      0x0939167024bc3U, 0x5a92a05fb586dU, 0x17d2ca639a745U, 0x5e27e79761e72U, 0x065f669ea3b4cU,
+      0x68e35bafb65f6U, 0x11e4e527427f3U, 0x3da8f40e75a7bU, 0x736b65c66cac6U, 0x1734778173adaU,
+      0x0aec75532db4dU, 0x4887c63763140U, 0x69fd456e1a693U, 0x6042507c2a969U, 0x19adeb7c303d7U
+    },
+    {
+      0x5ba7d43c31794U, 0x7f26644a4d3a0U, 0x065d0e091c323U, 0x5a9c191ef640bU, 0x2852709881569U,
+      0x0cb6153ead9a3U, 0x7ea256c6dd8e4U, 0x00a42c556cb25U, 0x77158f1adafeaU, 0x2fd9ccf13b530U,
+      0x5475b47f796b8U, 0x26a8591ea80f7U, 0x493e1fb4b1ec0U, 0x0eb16de91fa1dU, 0x6551afd77b090U
+    },
+    {
+      0x24ce3a1d5c9acU, 0x7a21fec8c2d14U, 0x74c59baedde8cU, 0x11d87c3672212U, 0x56507c0950b96U,
+      0x6baaf54aac27fU, 0x596548b4508a8U, 0x0af3fa3dbd9bfU, 0x42fac168dadabU, 0x44b123f3920f7U,
+      0x6f0b7d1713e63U, 0x322b75f8e8240U, 0x3676534d4ff8fU, 0x5698ca675cb85U, 0x62fadd7cf9d03U
+    },
+    {
+      0x7bc61e7ce4594U, 0x536fba4cfc79aU, 0x59bbc9f35acd6U, 0x388d04055e421U, 0x6ec7c46f59c79U,
+      0x5967b5598a074U, 0x1d1c927c4b8d6U, 0x4a022217bfa47U, 0x0616a5b9622a4U, 0x20ef1149a2674U,
+      0x7ad636f09a8a2U, 0x1c4840bcfa5e0U, 0x0d684e61a5f9bU, 0x44be0577e02f7U, 0x15e80958b5f9dU
+    },
+    {
+      0x1ed355bb061c4U, 0x5f28380e009baU, 0x618d0390b7033U, 0x221b0982ee0feU, 0x56b2cc930e55aU,
+      0x5ef7d0c3e235bU, 0x7f7c269dce4b4U, 0x7170c9db0e705U, 0x79ce3ba709a16U, 0x021354b892021U,
+      0x79da6a6bfc5a2U, 0x693fbc86d23beU, 0x68e429c0bce89U, 0x1b1d991ecf966U, 0x7be0847b8774dU
+    },
+    {
+      0x6f5af5307fa11U, 0x7bdad815e428cU, 0x6928fee05ff31U, 0x6858536f22761U, 0x74071475bc927U,
+      0x1cc5a8b3f55c3U, 0x4a7fbda541193U, 0x2dc28d818475cU, 0x30cf694caff9bU, 0x1f699a54d78a2U,
+      0x292f373e7ea8aU, 0x259608b463ceeU, 0x49d3f78a594dfU, 0x4b30de8329f69U, 0x2f9a2c4476bd2U
+    }
+  },
+#endif
+#if 44 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4dae0b5511c9aU, 0x5257fffe0d456U, 0x54108d1eb2180U, 0x096cc0f9baefaU, 0x3f6bd725da4eaU,
+      0x0b9ab7f5745c6U, 0x5caf0f8d21d63U, 0x7debea408ea2bU, 0x09edb93896d16U, 0x36597d25ea5c0U,
+      0x58d7b106058acU, 0x3cdf8d20bee69U, 0x00a4cb765015eU, 0x36832337c7cc9U, 0x7b7ecc19da60dU
+    },
+    {
+      0x64a51a77cfa9bU, 0x29cf470ca0db5U, 0x4b60b6e0898d9U, 0x55d04ddffe6c7U, 0x03bedc661bf5cU,
+      0x2373c695c690dU, 0x4c0c8520dcf18U, 0x384af4b7494b9U, 0x4ab4a8ea22225U, 0x4235ad7601743U,
+      0x0cb0d078975f5U, 0x292313e530c4bU, 0x38dbb9124a509U, 0x350d0655a11f1U, 0x0e7ce2b0cdf06U
+    },
+    {
+      0x6fedfd94b70f9U, 0x2383f9745bfd4U, 0x4beae27c4c301U, 0x75aa4416a3f3fU, 0x615256138aeceU,
+      0x4643ac48c85a3U, 0x6878c2735b892U, 0x3a53523f4d877U, 0x3a504ed8bee9dU, 0x666e0a5d8fb46U,
+      0x3f64e4870cb0dU, 0x61548b16d6557U, 0x7a261773596f3U, 0x7724d5f275d3aU, 0x7f0bc810d514dU
+    },
+    {
+      0x49dad737213a0U, 0x745dee5d31075U, 0x7b1a55e7fdbe2U, 0x5ba988f176ea1U, 0x1d3a907ddec5aU,
+      0x06ba426f4136fU, 0x3cafc0606b720U, 0x518f0a2359cdaU, 0x5fae5e46feca7U, 0x0d1f8dbcf8eedU,
+      0x693313ed081dcU, 0x5b0a366901742U, 0x40c872ca4ca7eU, 0x6f18094009e01U, 0x00011b44a31bfU
+    },
+    {
+      0x61f696a0aa75cU, 0x38b0a57ad42caU, 0x1e59ab706fdc9U, 0x01308d46ebfcdU, 0x63d988a2d2851U,
+      0x7a06c3fc66c0cU, 0x1c9bac1ba47fbU, 0x23935c575038eU, 0x3f0bd71c59c13U, 0x3ac48d916e835U,
+      0x20753afbd232eU, 0x71fbb1ed06002U, 0x39cae47a4af3aU, 0x0337c0b34d9c2U, 0x33fad52b2368aU
+    },
+    {
+      0x4c8d0c422cfe8U, 0x760b4275971a5U, 0x3da95bc1cad3dU, 0x0f151ff5b7376U, 0x3cc355ccb90a7U,
+      0x649c6c5e41e16U, 0x60667eee6aa80U, 0x4179d182be190U, 0x653d9567e6979U, 0x16c0f429a256dU,
+      0x69443903e9131U, 0x16f4ac6f9dd36U, 0x2ea4912e29253U, 0x2b4643e68d25dU, 0x631eaf426bae7U
+    },
+    {
+      0x175b9a3700de8U, 0x77c5f00aa48fbU, 0x3917785ca0317U, 0x05aa9b2c79399U, 0x431f2c7f665f8U,
+      0x10410da66fe9fU, 0x24d82dcb4d67dU, 0x3e6fe0e17752dU, 0x4dade1ecbb08fU, 0x5599648b1ea91U,
+      0x26344858f7b19U, 0x5f43d4a295ac0U, 0x242a75c52acd4U, 0x5934480220d10U, 0x7b04715f91253U
+    },
+    {
+      0x6c280c4e6bac6U, 0x3ada3b361766eU, 0x42fe5125c3b4fU, 0x111d84d4aac22U, 0x48d0acfa57cdeU,
+      0x5bd28acf6ae43U, 0x16fab8f56907dU, 0x7acb11218d5f2U, 0x41fe02023b4dbU, 0x59b37bf5c2f65U,
+      0x726e47dabe671U, 0x2ec45e746f6c1U, 0x6580e53c74686U, 0x5eda104673f74U, 0x16234191336d3U
+    }
+  },
+#endif
+#if 45 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5d1fd3d578bbeU, 0x658650c2110a5U, 0x33889ccad9739U, 0x5a032c603fa75U, 0x0933f804ec38aU,
+      0x2eac733a63aefU, 0x3a88848a9de33U, 0x6579104b1fee9U, 0x07aaed43d5023U, 0x413051e1a4e0bU,
+      0x369798d496476U, 0x3df96b57914f5U, 0x54e51ca0486abU, 0x28d52ee0977bdU, 0x07fd47065e453U
+    },
+    {
+      0x211559ae8e7c3U, 0x532891054a608U, 0x6094393ca06c8U, 0x47a4509d6171bU, 0x014afa0954ba4U,
+      0x03c3d258d2bcdU, 0x1b5ec16e7f90bU, 0x5a8de045c0a69U, 0x591fd07e4eb20U, 0x1c1e5fba38b3fU,
+      0x197001bb3666cU, 0x2497ffd973966U, 0x2208cf0cc0181U, 0x1b2149b88cc8dU, 0x291884363d4edU
+    },
+    {
+      0x537c3bc1ab6ebU, 0x269aaf4481f73U, 0x29787d80af851U, 0x0c47a6b9a0afcU, 0x5964f4300ccc8U,
+      0x46805dc4babfaU, 0x3cab2dd982067U, 0x66c74ecb056fdU, 0x7628de383125aU, 0x3ede9850a19f0U,
+      0x223152d096800U, 0x32e10cd32dc89U, 0x2bfedb9702315U, 0x6c4ef96db0523U, 0x579155c1f856fU
+    },
+    {
+      0x16b630817e7a6U, 0x46786a204d6beU, 0x33bc8060231a4U, 0x1a299254c1daaU, 0x53c092084a485U,
+      0x24edd12e0c9efU, 0x1be484052f2c6U, 0x3d5cef91a2e1eU, 0x4950ccd1bbb52U, 0x1e7fbcf18e91eU,
+      0x41481f1cbafbfU, 0x6ce2c2e9cba5aU, 0x29572608c74b6U, 0x2fb05bebb2b71U, 0x3e955cd82aa49U
+    },
+    {
+      0x1f3ef61bb3a3fU, 0x4a5d72327d567U, 0x3047dd23ad001U, 0x24fdaef37661cU, 0x654d7e9626f3cU,
+      0x7535e3ed15433U, 0x541ae4e147c91U, 0x3798e1f41d5a4U, 0x2faa07de90ed5U, 0x14264887cf449U,
+      0x4cfdd5c7d2cebU, 0x3dae6f9973cacU, 0x7e6c2ae0bbabfU, 0x6ddb083edb168U, 0x0b6baac3b4358U
+    },
+    {
+      0x2bad63700a93bU, 0x27b4ef26e6409U, 0x4eadc26f8008fU, 0x2096c2f81a331U, 0x00496dc490820U,
+      0x62bcb8622fe98U, 0x2d9d71235ef5cU, 0x3901ad11dd889U, 0x2808d2d495e79U, 0x7d29401784e41U,
+      0x4b88dc27e6360U, 0x4d1a290a1838eU, 0x0372cc01d2150U, 0x591d0a2fdbd9fU, 0x10843f1b43803U
+    },
+    {
+      0x7672de324689bU, 0x5b67295303aadU, 0x5a33fb7476a2bU, 0x0f46ebdac7f48U, 0x7ce246cd4d56cU,
+      0x10455376276ddU, 0x1baec8b9b38bfU, 0x4d9ace7396456U, 0x362497b2ea88eU, 0x11574b6e52699U,
+      0x4308e7f80be53U, 0x166953a72f71eU, 0x730acb17cf2e3U, 0x3388c54b0de99U, 0x710045fb3a9afU
+    },
+    {
+      0x7c862059d699eU, 0x4334c33cd3407U, 0x608f7ac8dc33eU, 0x227627f1d8917U, 0x1d1b056fa7f08U,
+      0x13d36101b95ebU, 0x729ede890ce7fU, 0x457958bebbccdU, 0x6d0ab28b9afc7U, 0x7fa3f19058b40U,
+      0x64631e56bf61fU, 0x20dca70546378U, 0x5005a374de6acU, 0x47226ac62bf02U, 0x566256628442dU
+    }
+  },
+#endif
+#if 46 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x19cd61ff38640U, 0x060c6c4b41ba9U, 0x75cf70ca7366fU, 0x118a8f16c011eU, 0x4a25707a203b9U,
+      0x499def6267ff6U, 0x76e858108773cU, 0x693cac5ddcb29U, 0x00311d00a9ff4U, 0x2cdfdfecd5d05U,
+      0x7668a53f6ed6aU, 0x303ba2e142556U, 0x3880584c10909U, 0x4fe20000a261dU, 0x5721896d248e4U
+    },
+    {
+      0x55091a1d0da4eU, 0x4f6bfc7c1050bU, 0x64e4ecd2ea9beU, 0x07eb1f28bbe70U, 0x03c935afc4b03U,
+      0x65517fd181baeU, 0x3e5772c76816dU, 0x019189640898aU, 0x1ed2a84de7499U, 0x578edd74f63c1U,
+      0x276c6492b0c3dU, 0x09bfc40bf932eU, 0x588e8f11f330bU, 0x3d16e694dc26eU, 0x3ec2ab590288cU
+    },
+    {
+      0x13a09ae32d1cbU, 0x3e81eb85ab4e4U, 0x07aaca43cae1fU, 0x62f05d7526374U, 0x0e1bf66c6adbaU,
+      0x0d27be4d87bb9U, 0x56c27235db434U, 0x72e6e0ea62d37U, 0x5674cd06ee839U, 0x2dd5c25a200fcU,
+      0x3d5e9792c887eU, 0x319724dabbc55U, 0x2b97c78680800U, 0x7afdfdd34e6ddU, 0x730548b35ae88U
+    },
+    {
+      0x3094ba1d6e334U, 0x6e126a7e3300bU, 0x089c0aefcfbc5U, 0x2eea11f836583U, 0x585a2277d8784U,
+      0x551a3cba8b8eeU, 0x3b6422be2d886U, 0x630e1419689bcU, 0x4653b07a7a955U, 0x3043443b411dbU,
+      0x25f8233d48962U, 0x6bd8f04aff431U, 0x4f907fd9a6312U, 0x40fd3c737d29bU, 0x7656278950ef9U
+    },
+    {
+      0x073a3ea86cf9dU, 0x6e0e2abfb9c2eU, 0x60e2a38ea33eeU, 0x30b2429f3fe18U, 0x28bbf484b613fU,
+      0x3cf59d51fc8c0U, 0x7a0a0d6de4718U, 0x55c3a3e6fb74bU, 0x353135f884fd5U, 0x3f4160a8c1b84U,
+      0x12f5c6f136c7cU, 0x0fedba237de4cU, 0x779bccebfab44U, 0x3aea93f4d6909U, 0x1e79cb358188fU
+    },
+    {
+      0x153d8f5e08181U, 0x08533bbdb2efdU, 0x1149796129431U, 0x17a6e36168643U, 0x478ab52d39d1fU,
+      0x436c3eef7e3f1U, 0x7ffd3c21f0026U, 0x3e77bf20a2da9U, 0x418bffc8472deU, 0x65d7951b3a3b3U,
+      0x6a4d39252d159U, 0x790e35900ecd4U, 0x30725bf977786U, 0x10a5c1635a053U, 0x16d87a411a212U
+    },
+    {
+      0x4d5e2d54e0583U, 0x2e5d7b33f5f74U, 0x3a5de3f887ebfU, 0x6ef24bd6139b7U, 0x1f990b577a5a6U,
+      0x57e5a42066215U, 0x1a18b44983677U, 0x3e652de1e6f8fU, 0x6532be02ed8ebU, 0x28f87c8165f38U,
+      0x44ead1be8f7d6U, 0x5759d4f31f466U, 0x0378149f47943U, 0x69f3be32b4f29U, 0x45882fe1534d6U
+    },
+    {
+      0x49929943c6fe4U, 0x4347072545b15U, 0x3226bced7e7c5U, 0x03a134ced89dfU, 0x7dcf843ce405fU,
+      0x1345d757983d6U, 0x222f54234cccdU, 0x1784a3d8adbb4U, 0x36ebeee8c2bccU, 0x688fe5b8f626fU,
+      0x0d6484a4732c0U, 0x7b94ac6532d92U, 0x5771b8754850fU, 0x48dd9df1461c8U, 0x6739687e73271U
+    }
+  },
+#endif
+#if 47 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5aad0c9cb971fU, 0x533faa945319cU, 0x6be6de0455aaaU, 0x4d520fb92380aU, 0x1fe8cca8420f4U,
+      0x5c5ea200814cfU, 0x42d3462e813ecU, 0x722d2b61014dbU, 0x30ec587689c92U, 0x0080dbafe9363U,
+      0x1848f3c0cc82aU, 0x050ef93ca8e54U, 0x1550500e31583U, 0x6b8a802711467U, 0x042418a103429U
+    },
+    {
+      0x04c6f20816247U, 0x6dc6dfaf26b1dU, 0x521361636cacaU, 0x5ebcbb8c12b0eU, 0x0822024f8632aU,
+      0x5ea51abf3ff5fU, 0x4e5f85b175133U, 0x1baf5726e4ea1U, 0x5ae961c65cbdfU, 0x114d578497263U,
+      0x1bb7c6b1beca3U, 0x5b8dd626eb660U, 0x6db93ad54e4fdU, 0x751c88694084bU, 0x1ad4548d9d479U
+    },
+    {
+      0x7e66d0fe9fed3U, 0x0038b0f21340dU, 0x7e6254ea1cce9U, 0x12c1868a6c006U, 0x41ce5876c7b30U,
+      0x27da0389a48fdU, 0x5534f06e3d9abU, 0x36e39b2ce3e92U, 0x221e36cbb0d96U, 0x35cf51dbc97e1U,
+      0x43bc5d670c022U, 0x213623280cb35U, 0x5e0bf6bab99f0U, 0x0494bcc5ef859U, 0x651e3201fd074U
+    },
+    {
+      0x3a4a01efcae9eU, 0x5db86115294afU, 0x00f2cb9da7d2fU, 0x13c68f887759bU, 0x4099ce5e7e441U,
+      0x58483ef30c5cfU, 0x2c46c39819ac7U, 0x2109ab13352d2U, 0x775f748728052U, 0x0af51d7d18c14U,
+      0x18e4f8a5121e9U, 0x09b7f45fc0359U, 0x10c37e5f6ba55U, 0x7dac1905506ebU, 0x667282652c4a2U
+    },
+    {
+      0x0b6e02946db23U, 0x34f64a756f5b5U, 0x375216c703394U, 0x56fc224642d33U, 0x7f1fc025d0675U,
+      0x621f4d86bc9abU, 0x7cadfcdfd50e8U, 0x6b708b2d531eeU, 0x69c83bd1212bfU, 0x1ab53be419b90U,
+      0x61b18319ea6aaU, 0x107443e1b5b1dU, 0x0e93d2c013620U, 0x68a1deb550ec4U, 0x4db9a3a6dfd9fU
+    },
+    {
+      0x300bbcbb77c68U, 0x5523e2f093b2bU, 0x0a366cf76f211U, 0x79f3e7b80575fU, 0x5ce1285c85d31U,
+      0x7b23bb99c0755U, 0x5b89ea1ef519cU, 0x66d430cd7175bU, 0x6d0bf0f176976U, 0x36305f16e8934U,
+      0x6972d98b0bde8U, 0x0d594dbcb6636U, 0x229967df6481cU, 0x11af339887c48U, 0x50fac2a6efdf0U
+    },
+    {
+      0x31c86f6f449bcU, 0x143e1569ba52bU, 0x239547546cba1U, 0x3316000e59855U, 0x6a28d35944f43U,
+      0x3a9f35b880f5aU, 0x19b607cf85e7aU, 0x7c2c68bb7b014U, 0x252544b4c0ffcU, 0x49a4ae2bac5e3U,
+      0x312ee04a740e0U, 0x7b379d02e8517U, 0x304310050c4eeU, 0x6adb97adaf274U, 0x7cbfb19936adcU
+    },
+    {
+      0x13a7acc36e6e0U, 0x46fab0dddb1cfU, 0x387d393e7eadeU, 0x23f1d27cb495dU, 0x1c14b03eff5f4U,
+      0x1ddc26b89792dU, 0x0db4a24cc9462U, 0x45421646cc2d3U, 0x2040653bda667U, 0x1de443df1b009U,
+      0x47bd114a85291U, 0x642069a75e32cU, 0x675b7e95eddb2U, 0x249b194eda207U, 0x5ef43e586a571U
+    }
+  },
+#endif
+#if 48 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5cc9dc80c1ac0U, 0x683671486d4cdU, 0x76f5f1a5e8173U, 0x6d5d3f5f9df4aU, 0x7da0b8f68d7e7U,
+      0x02014385675a6U, 0x6155fb53d1defU, 0x37ea32e89927cU, 0x059a668f5a82eU, 0x46115aba1d4dcU,
+      0x71953c3b5da76U, 0x6642233d37a81U, 0x2c9658076b1bdU, 0x5a581e63010ffU, 0x5a5f887e83674U
+    },
+    {
+      0x628d3a0a643b9U, 0x01cd8640c93d2U, 0x0b7b0cad70f2cU, 0x3864da98144beU, 0x43e37ae2d5d1cU,
+      0x301cf70a13d11U, 0x2a6a1ba1891ecU, 0x2f291fb3f3ae0U, 0x21a7b814bea52U, 0x3669b656e44d1U,
+      0x63f06eda6e133U, 0x233342758070fU, 0x098e0459cc075U, 0x4df5ead6c7c1bU, 0x6a21e6cd4fd5eU
+    },
+    {
+      0x129126699b2e3U, 0x0ee11a2603de8U, 0x60ac2f5c74c21U, 0x59b192a196808U, 0x45371b07001e8U,
+      0x6170a3046e65fU, 0x5401a46a49e38U, 0x20add5561c4a8U, 0x7abb4edde9e46U, 0x586bf9f1a195fU,
+      0x3088d5ef8790bU, 0x38c2126fcb4dbU, 0x685bae149e3c3U, 0x0bcd601a4e930U, 0x0eafb03790e52U
+    },
+    {
+      0x0805e0f75ae1dU, 0x464cc59860a28U, 0x248e5b7b00befU, 0x5d99675ef8f75U, 0x44ae3344c5435U,
+      0x555c13748042fU, 0x4d041754232c0U, 0x521b430866907U, 0x3308e40fb9c39U, 0x309acc675a02cU,
+      0x289b9bba543eeU, 0x3ab592e28539eU, 0x64d82abcdd83aU, 0x3c78ec172e327U, 0x62d5221b7f946U
+    },
+    {
+      0x5d4263af77a3cU, 0x23fdd2289aeb0U, 0x7dc64f77eb9ecU, 0x01bd28338402cU, 0x14f29a5383922U,
+      0x4299c18d0936dU, 0x5914183418a49U, 0x52a18c721aed5U, 0x2b151ba82976dU, 0x5c0efde4bc754U,
+      0x17edc25b2d7f5U, 0x37336a6081beeU, 0x7b5318887e5c3U, 0x49f6d491a5be1U, 0x5e72365c7bee0U
+    },
+    {
+      0x339062f08b33eU, 0x4bbf3e657cfb2U, 0x67af7f56e5967U, 0x4dbd67f9ed68fU, 0x70b20555cb734U,
+      0x3fc074571217fU, 0x3a0d29b2b6aebU, 0x06478ccdde59dU, 0x55e4d051bddfaU, 0x77f1104c47b4eU,
+      0x113c555112c4cU, 0x7535103f9b7caU, 0x140ed1d9a2108U, 0x02522333bc2afU, 0x0e34398f4a064U
+    },
+    {
+      0x30b093e4b1928U, 0x1ce7e7ec80312U, 0x4e575bdf78f84U, 0x61f7a190bed39U, 0x6f8aded6ca379U,
+      0x522d93ecebde8U, 0x024f045e0f6cfU, 0x16db63426cfa1U, 0x1b93a1fd30fd8U, 0x5e5405368a362U,
+      0x0123dfdb7b29aU, 0x4344356523c68U, 0x79a527921ee5fU, 0x74bfccb3e817eU, 0x780de72ec8d3dU
+    },
+    {
+      0x7eaf300f42772U, 0x5455188354ce3U, 0x4dcca4a3dcbacU, 0x3d314d0bfebcbU, 0x1defc6ad32b58U,
+      0x28545089ae7bcU, 0x1e38fe9a0c15cU, 0x12046e0e2377bU, 0x6721c560aa885U, 0x0eb28bf671928U,
+      0x3be1aef5195a7U, 0x6f22f62bdb5ebU, 0x39768b8523049U, 0x43394c8fbfdbdU, 0x467d201bf8dd2U
+    }
+  },
+#endif
+#if 49 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x79d56296bc318U, 0x29b02a5ccae8bU, 0x0e7a73a64d603U, 0x0e05872d89facU, 0x51fc2b28d4392U,
+      0x6ee72f7bd2e6bU, 0x2c21357e9cf20U, 0x506a2901749c3U, 0x143c6ae7f22dcU, 0x44c218671c974U,
+      0x7d11795e2a98cU, 0x4256d6c522371U, 0x092d5c871397bU, 0x5632d9873883aU, 0x6e6b9de84c4f4U
+    },
+    {
+      0x45f10f80cb088U, 0x38adc842a2d6fU, 0x3be6711cdad53U, 0x7a1615b1052e3U, 0x5f4c802cc3a06U,
+      0x25fce4b1de151U, 0x0fc238804bbfeU, 0x1d2721f610703U, 0x6fc92aa59e42aU, 0x2d292459908e0U,
+      0x5c8f17d0752daU, 0x718efdd00136cU, 0x58be78e20738cU, 0x6a461da8a782dU, 0x66ed5dd5bec10U
+    },
+    {
+      0x5f3c9cbca047dU, 0x17e8aa5ed7e15U, 0x1cd7e4e070ecbU, 0x24667ed0896a2U, 0x1f23a0c77e200U,
+      0x0a1c20bb2089dU, 0x432d99a824fa7U, 0x25f4c4e020cd3U, 0x790625385c636U, 0x2eacf8bc03007U,
+      0x5467be5bc1570U, 0x041b756719e46U, 0x3e782780f4b64U, 0x62813a94d517eU, 0x0840bef29d34bU
+    },
+    {
+      0x4e06b7f37e4ebU, 0x0febd2d9959aaU, 0x565f73a33057eU, 0x0065c1245d869U, 0x246affa060744U,
+      0x5fb35dc10b287U, 0x1ab8ffe53af2dU, 0x6c924149c5dafU, 0x13b3f9ea1f463U, 0x0304f5a191c54U,
+      0x08e68fbe45321U, 0x1181aea0646fbU, 0x52834d61825d5U, 0x192a74d89f7c4U, 0x25a83cac5753dU
+    },
+    {
+      0x766293952b6e2U, 0x1c12684cf73e1U, 0x027fb70cf6d78U, 0x064ffa29295ebU, 0x06be10f5c506eU,
+      0x22f48eed8165eU, 0x4697179e74204U, 0x087a3c188ff04U, 0x3180f0a2e04e1U, 0x7ccfa59fca782U,
+      0x615a9b62a345fU, 0x2c94a5fd98352U, 0x2f037f8881431U, 0x38ed3d13c4294U, 0x5e82770a1a1eeU
+    },
+    {
+      0x2e80a42339c74U, 0x4d4ffff5cbd00U, 0x10232b8d05d45U, 0x2f71a432e8f8eU, 0x2cca982c605bcU,
+      0x25183ad896a5cU, 0x77cf1aa5ec6a8U, 0x28d7d93a19cebU, 0x0811633792fc9U, 0x09d04f3b3b86bU,
+      0x55d35197dbe6eU, 0x5517c9ff47fa5U, 0x16ba46081f0bbU, 0x69f1309ec6d99U, 0x7a325d1727741U
+    },
+    {
+      0x27d017e2a076aU, 0x3e2c6c92bdd9aU, 0x648cf975e21a2U, 0x73229530d7848U, 0x2a479df17bb1aU,
+      0x6b9bbd16dfde2U, 0x2f892f5053a06U, 0x7c4999e88155dU, 0x0c0473664b353U, 0x4d3b1a791239cU,
+      0x6ee8e33db2710U, 0x3dad88794b3cbU, 0x1c604e0626153U, 0x74dd20e1162c9U, 0x27ad5538a43a5U
+    },
+    {
+      0x27d638e47077cU, 0x42414380b396bU, 0x7b7f73236dd4dU, 0x3ceaa4f0f26c5U, 0x080153b7503b1U,
+      0x6dd4b15350d61U, 0x11dd2a436e4e8U, 0x619cb2b40ff2fU, 0x4f174371b2d09U, 0x510e987f7e7d8U,
+      0x69d930a3ed3e3U, 0x639ac14e45bb4U, 0x6a93b98f4e1bbU, 0x395640bd6ac5eU, 0x23be8d554fe73U
+    }
+  },
+#endif
+#if 50 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6f4bd567ae7a9U, 0x65ac89317b783U, 0x07d3b20fd8932U, 0x000f208326916U, 0x2ef9c5a5ba384U,
+      0x6919a74ef4fadU, 0x59ed4611452bfU, 0x691ec04ea09efU, 0x3cbcb2700e984U, 0x71c43c4f5ba3cU,
+      0x56df6fa9e74cdU, 0x79c95e4cf56dfU, 0x7be643bc609e2U, 0x149c12ad9e878U, 0x5a758ca390c5fU
+    },
+    {
+      0x0918b1d61dc94U, 0x0d350260cd19cU, 0x7a2ab4e37b4d9U, 0x21fea735414d7U, 0x0a738027f639dU,
+      0x72710d9462495U, 0x25aafaa007456U, 0x2d21f28eaa31bU, 0x17671ea005fd0U, 0x2dbae244b3eb7U,
+      0x74a2f57ffe1ccU, 0x1bc3073087301U, 0x7ec57f4019c34U, 0x34e082e1fa524U, 0x2698ca635126aU
+    },
+    {
+      0x5702f5e3dd90eU, 0x31c9a4a70c5c7U, 0x136a5aa78fc24U, 0x1992f3b9f7b01U, 0x3c004b0c4afa3U,
+      0x5318832b0ba78U, 0x6f24b9ff17cecU, 0x0a47f30e060c7U, 0x58384540dc8d0U, 0x1fb43dcc49caeU,
+      0x146ac06f4b82bU, 0x4b500d89e7355U, 0x3351e1c728a12U, 0x10b9f69932fe3U, 0x6b43fd01cd1fdU
+    },
+    {
+      0x742583e760ef3U, 0x73dc1573216b8U, 0x4ae48fdd7714aU, 0x4f85f8a13e103U, 0x73420b2d6ff0dU,
+      0x75d4b4697c544U, 0x11be1fff7f8f4U, 0x119e16857f7e1U, 0x38a14345cf5d5U, 0x5a68d7105b52fU,
+      0x4f6cb9e851e06U, 0x278c4471895e5U, 0x7efcdce3d64e4U, 0x64f6d455c4b4cU, 0x3db5632fea34bU
+    },
+    {
+      0x190b1829825d5U, 0x0e7d3513225c9U, 0x1c12be3b7abaeU, 0x58777781e9ca6U, 0x59197ea495df2U,
+      0x6ee2bf75dd9d8U, 0x6c72ceb34be8dU, 0x679c9cc345ec7U, 0x7898df96898a4U, 0x04321adf49d75U,
+      0x16019e4e55aaeU, 0x74fc5f25d209cU, 0x4566a939ded0dU, 0x66063e716e0b7U, 0x45eafdc1f4d70U
+    },
+    {
+      0x64624cfccb1edU, 0x257ab8072b6c1U, 0x0120725676f0aU, 0x4a018d04e8eeeU, 0x3f73ceea5d56dU,
+      0x401858045d72bU, 0x459e5e0ca2d30U, 0x488b719308beaU, 0x56f4a0d1b32b5U, 0x5a5eebc80362dU,
+      0x7bfd10a4e8dc6U, 0x7c899366736f4U, 0x55ebbeaf95c01U, 0x46db060903f8aU, 0x2605889126621U
+    },
+    {
+      0x18e3cc676e542U, 0x26079d995a990U, 0x04a7c217908b2U, 0x1dc7603e6655aU, 0x0dedfa10b2444U,
+      0x704a68360ff04U, 0x3cecc3cde8b3eU, 0x21cd5470f64ffU, 0x6abc18d953989U, 0x54ad0c2e4e615U,
+      0x367d5b82b522aU, 0x0d3f4b83d7dc7U, 0x3067f4cdbc58dU, 0x20452da697937U, 0x62ecb2baa77a9U
+    },
+    {
+      0x72836afb62874U, 0x0af3c2094b240U, 0x0c285297f357aU, 0x7cc2d5680d6e3U, 0x61913d5075663U,
+      0x5795261152b3dU, 0x7a1dbbafa3cbdU, 0x5ad31c52588d5U, 0x45f3a4164685cU, 0x2e59f919a966dU,
+      0x62d361a3231daU, 0x65284004e01b8U, 0x656533be91d60U, 0x6ae016c00a89fU, 0x3ddbc2a131c05U
+    }
+  },
+#endif
+#if 51 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x35ac2004a35d1U, 0x0674cc0f87f6eU, 0x4a35664c7783dU, 0x2863dc2c8dfe2U, 0x55be9a25f5bb0U,
+      0x0a50a4ffb81efU, 0x1277e8417e7eaU, 0x2a8b342c780d4U, 0x5204dd5470e63U, 0x32239861fa237U,
+      0x05acd33db3dbfU, 0x7901586bc41a0U, 0x623afac0446cdU, 0x5e6a4496b3637U, 0x770eadb16508fU
+    },
+    {
+      0x3b681a05071b9U, 0x346b25fe75e3aU, 0x2079038881d96U, 0x3a72f80b494bcU, 0x16bedd0e86ba3U,
+      0x1f9e05e4e89ddU, 0x7f78f2726f08aU, 0x2992573018c0bU, 0x1fdae913a4aabU, 0x09a6755ca0560U,
+      0x4cc4f2c2737b5U, 0x185b996e06bd9U, 0x310f7cd0ede78U, 0x36019f0045e27U, 0x06c1b840f0756U
+    },
+    {
+      0x69e7f9b02805cU, 0x14a8fa2c80d3dU, 0x10c25a32ffe0aU, 0x4b91ec9d434d9U, 0x46b7b8cd3fe26U,
+      0x0a5c6a388f877U, 0x29bd656d58ed1U, 0x630abe00aa5b0U, 0x76b3264f9a18dU, 0x3628435554a1eU,
+      0x12086fe7eebe0U, 0x4e5ea2a86fd30U, 0x5bbeba532e9afU, 0x65c8e820b45a8U, 0x5ea1391043982U
+    },
+    {
+      0x33be4d5d3b002U, 0x32d4139100de5U, 0x2f31332bfb0cfU, 0x4c581afb9d254U, 0x22c5b92846621U,
+      0x25c9cf4702ee1U, 0x3f164b665a922U, 0x07fbdf91482dcU, 0x595998c981328U, 0x656d8997c8d2eU,
+      0x0c8fe433d8939U, 0x5cd51afca196bU, 0x7eef96a26832cU, 0x0833ce54aa984U, 0x0c626616cd7fcU
+    },
+    {
+      0x7c379fbf454b1U, 0x61e3496ee31fbU, 0x34d64551696a5U, 0x0c956490f7bddU, 0x42d088dca81c2U,
+      0x6b80a4879b61fU, 0x5c95b443da3ffU, 0x20096e98e59c9U, 0x3c419e3d8499bU, 0x471aa0c6f3c31U,
+      0x20f37a0165199U, 0x6f9141c6871fbU, 0x1d7a0802b6b6dU, 0x373907dfefe64U, 0x1cf2bea80c220U
+    },
+    {
+      0x56e1a02c0412fU, 0x07b6b1d1fd305U, 0x2c62f0243e932U, 0x63300e17ade6eU, 0x686e0c90216abU,
+      0x5f1deb36202acU, 0x13a5c4f54b85bU, 0x027c74e4a97f8U, 0x4acbe8b247b7eU, 0x74c2cc0513bc4U,
+      0x5badba54395a7U, 0x415c1b4cd43f5U, 0x68df01ed0680aU, 0x186df8cfacc5dU, 0x6a12b8acde484U
+    },
+    {
+      0x3dd801aaeeb5fU, 0x5582a310e2f27U, 0x484dad0028a82U, 0x78cf451b9d18fU, 0x48aab888fc91eU,
+      0x2ea1f39d495d9U, 0x1ca4be3bf9f1bU, 0x664746d64b064U, 0x65bedc65e8264U, 0x11f7fda3d88f0U,
+      0x77e925830f40eU, 0x52f2cc380c083U, 0x411a8b800b5b2U, 0x1e8c36e4ffc95U, 0x760360928b049U
+    },
+    {
+      0x108e5695a0b05U, 0x515a6f4717686U, 0x54dce05b2c03bU, 0x1122f6d6b7751U, 0x3f2602d4b6dc3U,
+      0x341c6120cf9c6U, 0x25bd9b4b36437U, 0x2922cd3aacaa8U, 0x5b460d3968105U, 0x215d4d27e87d3U,
+      0x247b65bcaf19cU, 0x0763658ca5916U, 0x7b38b8925de77U, 0x01cc4d0c05deaU, 0x13f098a3cec8eU
+    }
+  },
+#endif
+#if 52 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x257a22796bb14U, 0x6f360fb443e75U, 0x680e47220eaeaU, 0x2fcf2a5f10c18U, 0x5ee7fb38d8320U,
+      0x40ff9ce5ec54bU, 0x57185e261b35bU, 0x3e254540e70a9U, 0x1b5814003e3f8U, 0x78968314ac04bU,
+      0x5fdcb41446a8eU, 0x5286926ff2a71U, 0x0f231e296b3f6U, 0x684a357c84693U, 0x61d0633c9bca0U
+    },
+    {
+      0x328bcf8fc73dfU, 0x3b4de06ff95b4U, 0x30aa427ba11a5U, 0x5ee31bfda6d9cU, 0x5b23ac2df8067U,
+      0x44935ffdb2566U, 0x12f016d176c6eU, 0x4fbb00f16f5aeU, 0x3fab78d99402aU, 0x6e965fd847aedU,
+      0x2b953ee80527bU, 0x55f5bcdb1b35aU, 0x43a0b3fa23c66U, 0x76e07388b820aU, 0x79b9bbb9dd95dU
+    },
+    {
+      0x17dae8e9f7374U, 0x719f76102da33U, 0x5117c2a80ca8bU, 0x41a66b65d0936U, 0x1ba811460accbU,
+      0x355406a3126c2U, 0x50d1918727d76U, 0x6e5ea0b498e0eU, 0x0a3b6063214f2U, 0x5065f158c9fd2U,
+      0x169fb0c429954U, 0x59aedd9ecee10U, 0x39916eb851802U, 0x57917555cc538U, 0x3981f39e58a4fU
+    },
+    {
+      0x5dfa56de66fdeU, 0x0058809075908U, 0x6d3d8cb854a94U, 0x5b2f4e970b1e3U, 0x30f4452edcbc1U,
+      0x38a7559230a93U, 0x52c1cde8ba31fU, 0x2a4f2d4745a3dU, 0x07e9d42d4a28aU, 0x38dc083705acdU,
+      0x52782c5759740U, 0x53f3397d990adU, 0x3a939c7e84d15U, 0x234c4227e39e0U, 0x632d9a1a593f2U
+    },
+    {
+      0x1fd11ed0c84a7U, 0x021b3ed2757e1U, 0x73e1de58fc1c6U, 0x5d110c84616abU, 0x3a5a7df28af64U,
+      0x36b15b807cba6U, 0x3f78a9e1afed7U, 0x0a59c2c608f1fU, 0x52bdd8ecb81b7U, 0x0b24f48847ed4U,
+      0x2d4be511beac7U, 0x6bda4d99e5b9bU, 0x17e6996914e01U, 0x7b1f0ce7fcf80U, 0x34fcf74475481U
+    },
+    {
+      0x31dab78cfaa98U, 0x4e3216e5e54b7U, 0x249823973b689U, 0x2584984e48885U, 0x0119a3042fb37U,
+      0x7e04c789767caU, 0x1671b28cfb832U, 0x7e57ea2e1c537U, 0x1fbaaef444141U, 0x3d3bdc164dfa6U,
+      0x2d89ce8c2177dU, 0x6cd12ba182cf4U, 0x20a8ac19a7697U, 0x539fab2cc72d9U, 0x56c088f1ede20U
+    },
+    {
+      0x35fac24f38f02U, 0x7d75c6197ab03U, 0x33e4bc2a42fa7U, 0x1c7cd10b48145U, 0x038b7ea483590U,
+      0x53d1110a86e17U, 0x6416eb65f466dU, 0x41ca6235fce20U, 0x5c3fc8a99bb12U, 0x09674c6b99108U,
+      0x6f82199316ff8U, 0x05d54f1a9f3e9U, 0x3bcc5d0bd274aU, 0x5b284b8d2d5adU, 0x6e5e31025969eU
+    },
+    {
+      0x4fb0e63066222U, 0x130f59747e660U, 0x041868fecd41aU, 0x3105e8c923bc6U, 0x3058ad43d1838U,
+      0x462f587e593fbU, 0x3d94ba7ce362dU, 0x330f9b52667b7U, 0x5d45a48e0f00aU, 0x08f5114789a8dU,
+      0x40ffde57663d0U, 0x71445d4c20647U, 0x2653e68170f7cU, 0x64cdee3c55ed6U, 0x26549fa4efe3dU
+    }
+  },
+#endif
+#if 53 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x3bc17f75396b9U, 0x2fa5f0ce8c09bU, 0x4faaf19a79a8bU, 0x2e963204eccfaU, 0x606175f6332e2U,
+      0x338d787ce8f89U, 0x4482f3511ae71U, 0x544c5b6d89963U, 0x2e49839c64e78U, 0x49128c7f72727U,
+      0x1370ef540e7ddU, 0x6b43e3a14a804U, 0x41ae01c24435bU, 0x11aa31a5566adU, 0x6a39e6356944fU
+    },
+    {
+      0x1965774049e9dU, 0x4331fc6a563b4U, 0x148da9bef35baU, 0x37158e5e6a866U, 0x1f5ec83d3f984U,
+      0x55640df90f3e7U, 0x1db7f44bd52d9U, 0x78cf311b0e9d8U, 0x72c1279f784acU, 0x42889e7e530d2U,
+      0x323c3328ccb75U, 0x0fbb0eddd31dfU, 0x7eb9e5abd0a88U, 0x7a8907ded6e2eU, 0x241e246b06bf9U
+    },
+    {
+      0x2fc9a6280bbb8U, 0x25e807b012fd5U, 0x7f234808a9c3cU, 0x1f718e7205d8dU, 0x2bc65635e8bd5U,
+      0x68e57ad6e98f6U, 0x10168c40ca53cU, 0x47aed2d324983U, 0x04b9f80431752U, 0x5bc2c77fb38d9U,
+      0x5dc9fa96bad93U, 0x7bbc328fb9d1aU, 0x4617e8f963ec5U, 0x418340a997532U, 0x1fdd6c3b034a7U
+    },
+    {
+      0x3a6a52dd8f7a9U, 0x187dfb957f382U, 0x023ded4b6ec7eU, 0x4f2cb0f19202fU, 0x48c8a121bbe6cU,
+      0x4e28c55dc18feU, 0x326733d7ba14cU, 0x38b994b8f7e7aU, 0x6073cd62191b8U, 0x35ff7fc33ae4cU,
+      0x15a7c59646445U, 0x2f82516c2bf88U, 0x7eee44b4892cbU, 0x7d5b01ae4e482U, 0x42d7a91274429U
+    },
+    {
+      0x48947933da5bcU, 0x1d85d2f3d9534U, 0x796b131296248U, 0x0a3cb6c400009U, 0x453692d74b48bU,
+      0x213e3eaf72ed3U, 0x348759a9ce9ccU, 0x2d4232d9e5260U, 0x2997faa3e6f37U, 0x6fed19dd10fcbU,
+      0x75d99a8559c6fU, 0x01be007c49baeU, 0x24a299bd0a885U, 0x1162911f114edU, 0x063f46ba6d38fU
+    },
+    {
+      0x43cb737346921U, 0x0e7191288e730U, 0x114c1fa9d1fecU, 0x03465c6c018d1U, 0x67810f8e6d82fU,
+      0x242895f536694U, 0x0a85273659a5aU, 0x776e57328ce8bU, 0x6aecc37d6d363U, 0x5a152c042f712U,
+      0x38fbcd2287db4U, 0x4603407d267ddU, 0x6609969cb1f4eU, 0x201aa39f4465eU, 0x7324aa515921bU
+    },
+    {
+      0x3f6dae82354cbU, 0x556cae34db5a4U, 0x638df45a58940U, 0x097cdb28b1b71U, 0x5cac5005d1a33U,
+      0x142f46c3cbe8eU, 0x628e61808d0afU, 0x0f106fe874d92U, 0x2e90e476c8a69U, 0x0838e161eef6dU,
+      0x154cce9e39904U, 0x1709bcd08d198U, 0x6f975b96ce810U, 0x781626c530e58U, 0x40fb897bd8861U
+    },
+    {
+      0x6d8475ab10761U, 0x40dfa26e8dcafU, 0x40958c9c50d78U, 0x73d9a17c12766U, 0x4b16281ea8791U,
+      0x5aa9062de37a1U, 0x001a3b2dc3098U, 0x2490b65087694U, 0x06d3c41431835U, 0x3c5e464a690d1U,
+      0x101d50b813381U, 0x22eddcd051a38U, 0x0fd90277b983cU, 0x425065b44499cU, 0x6183c565f6ff4U
+    }
+  },
+#endif
+#if 54 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x68549af3f666eU, 0x09e2941d4bb68U, 0x2e8311f5dff3cU, 0x6429ef91ffbd2U, 0x3a10dfe132ce3U,
+      0x55a461e6bf9d6U, 0x78eeef4b02e83U, 0x1d34f648c16cfU, 0x07fea2aba5132U, 0x1926e1dc6401eU,
+      0x74e8aea17cea0U, 0x0c743f83fbc0fU, 0x7cb03c4bf5455U, 0x68a8ba9917e98U, 0x1fa1d01d861e5U
+    },
+    {
+      0x4ac00d1df94abU, 0x3ba2101bd271bU, 0x7578988b9c4afU, 0x0f2bf89f49f7eU, 0x73fced18ee9a0U,
+      0x055947d599832U, 0x346fe2aa41990U, 0x0164c8079195bU, 0x799ccfb7bba27U, 0x773563bc6a75cU,
+      0x1e90863139cb3U, 0x4f8b407d9a0d6U, 0x58e24ca924f69U, 0x7a246bbe76456U, 0x1f426b701b864U
+    },
+    {
+      0x635c891a12552U, 0x26aebd38ede2fU, 0x66dc8faddae05U, 0x21c7d41a03786U, 0x0b76bb1b3fa7eU,
+      0x1264c41911c01U, 0x702f44584bdf9U, 0x43c511fc68edeU, 0x0482c3aed35f9U, 0x4e1af5271d31bU,
+      0x0c1f97f92939bU, 0x17a88956dc117U, 0x6ee005ef99dc7U, 0x4aa9172b231ccU, 0x7b6dd61eb772aU
+    },
+    {
+      0x0abf9ab01d2c7U, 0x3880287630ae6U, 0x32eca045beddbU, 0x57f43365f32d0U, 0x53fa9b659bff6U,
+      0x5c1e850f33d92U, 0x1ec119ab9f6f5U, 0x7f16f6de663e9U, 0x7a7d6cb16dec6U, 0x703e9bceaf1d2U,
+      0x4c8e994885455U, 0x4ccb5da9cad82U, 0x3596bc610e975U, 0x7a80c0ddb9f5eU, 0x398d93e5c4c61U
+    },
+    {
+      0x77c60d2e7e3f2U, 0x4061051763870U, 0x67bc4e0ecd2aaU, 0x2bb941f1373b9U, 0x699c9c9002c30U,
+      0x3d16733e248f3U, 0x0e2b7e14be389U, 0x42c0ddaf6784aU, 0x589ea1fc67850U, 0x53b09b5ddf191U,
+      0x6a7235946f1ccU, 0x6b99cbb2fbe60U, 0x6d3a5d6485c62U, 0x4839466e923c0U, 0x51caf30c6fcddU
+    },
+    {
+      0x2f99a18ac54c7U, 0x398a39661ee6fU, 0x384331e40cde3U, 0x4cd15c4de19a6U, 0x12ae29c189f8eU,
+      0x3a7427674e00aU, 0x6142f4f7e74c1U, 0x4cc93318c3a15U, 0x6d51bac2b1ee7U, 0x5504aa292383fU,
+      0x6c0cb1f0d01cfU, 0x187469ef5d533U, 0x27138883747bfU, 0x2f52ae53a90e8U, 0x5fd14fe958ebaU
+    },
+    {
+      0x2fe5ebf93cb8eU, 0x226da8acbe788U, 0x10883a2fb7ea1U, 0x094707842cf44U, 0x7dd73f960725dU,
+      0x42ddf2845ab2cU, 0x6214ffd3276bbU, 0x00b8d181a5246U, 0x268a6d579eb20U, 0x093ff26e58647U,
+      0x524fe68059829U, 0x65b75e47cb621U, 0x15eb0a5d5cc19U, 0x05209b3929d5aU, 0x2f59bcbc86b47U
+    },
+    {
+      0x1d560b691c301U, 0x7f5bafce3ce08U, 0x4cd561614806cU, 0x4588b6170b188U, 0x2aa55e3d01082U,
+      0x47d429917135fU, 0x3eacfa07af070U, 0x1deab46b46e44U, 0x7a53f3ba46cdfU, 0x5458b42e2e51aU,
+      0x192e60c07444fU, 0x5ae8843a21daaU, 0x6d721910b1538U, 0x3321a95a6417eU, 0x13e9004a8a768U
+    }
+  },
+#endif
+#if 55 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x284c5806b467cU, 0x77cebac0f63ccU, 0x5e3498b17da65U, 0x5b845b3ecac59U, 0x3d88d66a81cd8U,
+      0x5b5556c032bffU, 0x6e5252f475976U, 0x7b606ef7dc646U, 0x1fae0ffb99356U, 0x71ade8bb68be0U,
+      0x67a93204ed789U, 0x173f415c5516eU, 0x739221dd8bf2bU, 0x7d9bb8ff5e636U, 0x343062158ff05U
+    },
+    {
+      0x219072a7b31b4U, 0x6b54af002df9cU, 0x51e4c9135eb71U, 0x5f587613b5343U, 0x6d6d9d5d1fda4U,
+      0x5a1a7e1f5bf49U, 0x5ba8e6c125c0bU, 0x730cbd89915f5U, 0x7e6bbee583bb9U, 0x0a5d94969cdd5U,
+      0x1a58ae9b08183U, 0x6382b87116456U, 0x428145ff65741U, 0x1af54c091bb42U, 0x33384cbabb7f3U
+    },
+    {
+      0x4627a26218b8dU, 0x3f8f5018c2677U, 0x4fa7b9baa02c8U, 0x02cca2c58958bU, 0x076247be0e2f3U,
+      0x7a2680ca2c7b5U, 0x08df6c9fb478dU, 0x0c75b786d4208U, 0x644f5a99a4e2aU, 0x5278b38f6b879U,
+      0x105f61416375aU, 0x6d0b57d748a5cU, 0x699f0dbb25ebcU, 0x58093735a8311U, 0x5cf0e856f3d4fU
+    },
+    {
+      0x6ce313db342a8U, 0x37085b6fdd7d5U, 0x5fc4fbf2e8d8dU, 0x2e37446331040U, 0x1b9438aa4e76dU,
+      0x168731ae8cab4U, 0x3d969f258bed9U, 0x336f0f97881d0U, 0x6fb96d29df2c6U, 0x2dddfea269970U,
+      0x0777e166f031aU, 0x621f6f465114aU, 0x43ef5d819ece7U, 0x4828c92e4d300U, 0x6df9b575cc740U
+    },
+    {
+      0x7c35b48cade41U, 0x3f646504e1d9bU, 0x2806da9aa211cU, 0x794ba05251220U, 0x471e5796003b5U,
+      0x1192927f6bdcfU, 0x74807ac394858U, 0x6787d863e4645U, 0x7c6ee0e2d3345U, 0x1596047804ec0U,
+      0x6bbb3aced37acU, 0x6bd24119d5b52U, 0x2baeb89e8908eU, 0x71792662e181cU, 0x50c356afdc5daU
+    },
+    {
+      0x59cdf1b31b964U, 0x0b194a35e79fdU, 0x2307e13d21aa6U, 0x6000a44b932f5U, 0x784a53dd932acU,
+      0x4bf4341c30318U, 0x2306303b9c13bU, 0x078a687bae818U, 0x2d860bce0676eU, 0x1dbf7b89073f3U,
+      0x1f9df14fc4920U, 0x1988933fca5b3U, 0x73c000ddb32d8U, 0x0755209965df2U, 0x3f93d82354f00U
+    },
+    {
+      0x412d179e14978U, 0x6777d7febdd55U, 0x18f389ffe48ffU, 0x2ffa57b31f203U, 0x0fd381a811a5fU,
+      0x3e7689e04ce85U, 0x3c088ca683030U, 0x223b6b19e3edcU, 0x4cd56c902c7b3U, 0x5da350d3532b0U,
+      0x6aceca436df54U, 0x515cd3add1e4aU, 0x5740db0422d85U, 0x7a8106cc365b5U, 0x655957b9fee2aU
+    },
+    {
+      0x1409bd002d0acU, 0x0b6b99b34d7b8U, 0x37a17b1999809U, 0x786c118bee27dU, 0x02fe934b6ad7dU,
+      0x0b07fa902030fU, 0x55e8c7a2875d5U, 0x1e1e983e231d9U, 0x2540ad841b31eU, 0x08eab1148267aU,
+      0x4f100cfb7ea74U, 0x6743968559debU, 0x3ca17888a25d8U, 0x52aea67062a67U, 0x30408c048a146U
+    }
+  },
+#endif
+#if 56 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x600c9193b877fU, 0x21c1b8a0d7765U, 0x379927fb38ea2U, 0x70d7679dbe01bU, 0x5f46040898de9U,
+      0x58845832fcedbU, 0x135cd7f0c6e73U, 0x53ffbdfe8e35bU, 0x22f195e06e55bU, 0x73937e8814bceU,
+      0x37116297bf48dU, 0x45a9e0d069720U, 0x25af71aa744ecU, 0x41af0cb8aaba3U, 0x2cf8a4e891d5eU
+    },
+    {
+      0x5487e17d06ba2U, 0x3872a032d6596U, 0x65e28c09348e0U, 0x27b6bb2ce40c2U, 0x7a6f7f2891d6aU,
+      0x3fd8707110f67U, 0x26f8716a92db2U, 0x1cdaa1b753027U, 0x504be58b52661U, 0x2049bd6e58252U,
+      0x1fd8d6a9aef49U, 0x7cb67b7216fa1U, 0x67aff53c3b982U, 0x20ea610da9628U, 0x6011aadfc5459U
+    },
+    {
+      0x6d0c802cbf890U, 0x141bfed554c7bU, 0x6dbb667ef4263U, 0x58f3126857edcU, 0x69ce18b779340U,
+      0x7926dcf95f83cU, 0x42e25120e2becU, 0x63de96df1fa15U, 0x4f06b50f3f9ccU, 0x6fc5cc1b0b62fU,
+      0x75528b29879cbU, 0x79a8fd2125a3dU, 0x27c8d4b746ab8U, 0x0f8893f02210cU, 0x15596b3ae5710U
+    },
+    {
+      0x731167e5124caU, 0x17b38e8bbe13fU, 0x3d55b942f9056U, 0x09c1495be913fU, 0x3aa4e241afb6dU,
+      0x739d23f9179a2U, 0x632fadbb9e8c4U, 0x7c8522bfe0c48U, 0x6ed0983ef5aa9U, 0x0d2237687b5f4U,
+      0x138bf2a3305f5U, 0x1f45d24d86598U, 0x5274bad2160feU, 0x1b6041d58d12aU, 0x32fcaa6e4687aU
+    },
+    {
+      0x7a4732787ccdfU, 0x11e427c7f0640U, 0x03659385f8c64U, 0x5f4ead9766bfbU, 0x746f6336c2600U,
+      0x56e8dc57d9af5U, 0x5b3be17be4f78U, 0x3bf928cf82f4bU, 0x52e55600a6f11U, 0x4627e9cefebd6U,
+      0x2f345ab6c971cU, 0x653286e63e7e9U, 0x51061b78a23adU, 0x14999acb54501U, 0x7b4917007ed66U
+    },
+    {
+      0x41b28dd53a2ddU, 0x37be85f87ea86U, 0x74be3d2a85e41U, 0x1be87fac96ca6U, 0x1d03620fe08cdU,
+      0x5fb5cab84b064U, 0x2513e778285b0U, 0x457383125e043U, 0x6bda3b56e223dU, 0x122ba376f844fU,
+      0x232cda2b4e554U, 0x0422ba30ff840U, 0x751e7667b43f5U, 0x6261755da5f3eU, 0x02c70bf52b68eU
+    },
+    {
+      0x532bf458d72e1U, 0x40f96e796b59cU, 0x22ef79d6f9da3U, 0x501ab67beca77U, 0x6b0697e3feb43U,
+      0x7ec4b5d0b2fbbU, 0x200e910595450U, 0x742057105715eU, 0x2f07022530f60U, 0x26334f0a409efU,
+      0x0f04adf62a3c0U, 0x5e0edb48bb6d9U, 0x7c34aa4fbc003U, 0x7d74e4e5cac24U, 0x1cc37f43441b2U
+    },
+    {
+      0x656f1c9ceaeb9U, 0x7031cacad5aecU, 0x1308cd0716c57U, 0x41c1373941942U, 0x3a346f772f196U,
+      0x7565a5cc7324fU, 0x01ca0d5244a11U, 0x116b067418713U, 0x0a57d8c55edaeU, 0x6c6809c103803U,
+      0x55112e2da6ac8U, 0x6363d0a3dba5aU, 0x319c98ba6f40cU, 0x2e84b03a36ec7U, 0x05911b9f6ef7cU
+    }
+  },
+#endif
+#if 57 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x18980c5fe9f94U, 0x52e2dfab90038U, 0x656821b35959dU, 0x4c140b022e1e8U, 0x6e2b7f3266cc7U,
+      0x4d756b637ff2dU, 0x1f930fe189d3bU, 0x7ef1edfb130d2U, 0x543e76ac942f9U, 0x3305354793e1eU,
+      0x02468f7c3568fU, 0x04332e9967990U, 0x6e04d8277a6eaU, 0x53155db914e5aU, 0x44e2017a6fbebU
+    },
+    {
+      0x02cf3b6ca6ecdU, 0x7c31e941850ffU, 0x013955d603e24U, 0x60e82c4980393U, 0x6cab6ac256d19U,
+      0x2a74354dab774U, 0x789d5e0635898U, 0x20e3c5e397530U, 0x2755bb611e921U, 0x749a098f68dceU,
+      0x7e0a02cc1de60U, 0x7ea38aaeb7b9bU, 0x4eafbac0c9997U, 0x3031606197883U, 0x6a882014cd7b8U
+    },
+    {
+      0x1d17caf4feb6eU, 0x0566754947a22U, 0x2d1b0c0142ee9U, 0x6ba8ba8a61e77U, 0x54bedb8b1bc27U,
+      0x292fea4747fb5U, 0x123f4b57134a5U, 0x11e933b704a91U, 0x6276c16d4a5dcU, 0x4d77edce9512cU,
+      0x0e14577e2189cU, 0x55ff33888aef9U, 0x4cd4d0e8f91bdU, 0x35498a26fe436U, 0x3a96559e7c421U
+    },
+    {
+      0x3896880baaa52U, 0x09e50b281c892U, 0x15122d93262bfU, 0x73ff7a553cdd2U, 0x5278c510a57aaU,
+      0x50d37f42ad2eeU, 0x093143f7ea24aU, 0x62532ca2de380U, 0x6862ea983c119U, 0x02c84e4e3e498U,
+      0x5d074294c0b94U, 0x71be31ff6d4a9U, 0x6ba0d9bd5751aU, 0x0b2f837f662c6U, 0x588657668190dU
+    },
+    {
+      0x034f03de25cc3U, 0x5dad02a92d7ebU, 0x207a24ae21f22U, 0x7c9a882910d4aU, 0x6760ed19f7723U,
+      0x712311aef7117U, 0x02453d258fa8eU, 0x4566e5d40d0c4U, 0x4e4bd4af0c24eU, 0x2449959b8b5d2U,
+      0x3a3b7ac35e160U, 0x7f750840accd3U, 0x2013c1cbb33dcU, 0x2738d760f8be0U, 0x0d96bc031856fU
+    },
+    {
+      0x534b0cc7505e1U, 0x682d86a51163aU, 0x58b0a74cb3400U, 0x5fc659b52c003U, 0x5bfe69b9237a0U,
+      0x0be7775c52d82U, 0x6aa9a15572663U, 0x1dcf64532dd92U, 0x44555e79e93e6U, 0x3bf4d18481232U,
+      0x6ab7e78a151abU, 0x1332126ec6307U, 0x31f8cd6efa643U, 0x7c47fb8beb725U, 0x4c5cddb325f39U
+    },
+    {
+      0x50967e7a9f902U, 0x789eb68cfcaeeU, 0x5dee918b0dff7U, 0x195d930b31d18U, 0x3a375e78dc2d5U,
+      0x6b74d6190a6ebU, 0x485b71e9c981eU, 0x4c55d8083aa06U, 0x610d45eb7becbU, 0x33b1d60262ac7U,
+      0x1e72f2d4dddeaU, 0x30c58c0f91028U, 0x4f2bf439babfaU, 0x1a311e1422c2bU, 0x46b9476f4ff97U
+    },
+    {
+      0x5505c0d58359fU, 0x0ff85188d6242U, 0x7a99938a8804fU, 0x70f925050d7c4U, 0x4400b638a1130U,
+      0x7fea44f901e5cU, 0x6e43096f04183U, 0x4536e20ac2dbeU, 0x0a172c3ffc880U, 0x37130f364785aU,
+      0x1b76496ed19c3U, 0x61da64e460740U, 0x72856c4c7802aU, 0x763a905442bc1U, 0x06aab9875accbU
+    }
+  },
+#endif
+#if 58 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x1acf3512eeaefU, 0x2639839692a69U, 0x669a234830507U, 0x68b920c0603d4U, 0x555ef9d1c64b2U,
+      0x39983f5df0ebbU, 0x1ea2589959826U, 0x6ce638703cdd6U, 0x6311678898505U, 0x6b3cecf9aa270U,
+      0x770ba3b73bd08U, 0x11475f7e186d4U, 0x0251bc9892bbcU, 0x24eab9bffcc5aU, 0x675f4de133817U
+    },
+    {
+      0x7f6d93bdab31dU, 0x1f3aca5bfd425U, 0x2fa521c1c9760U, 0x62180ce27f9cdU, 0x60f450b882cd3U,
+      0x452036b1782fcU, 0x02d95b07681c5U, 0x5901cf99205b2U, 0x290686e5eecb4U, 0x13d99df70164cU,
+      0x35ec321e5c0caU, 0x13ae337f44029U, 0x4008e813f2da7U, 0x640272f8e0c3aU, 0x1c06de9e55edaU
+    },
+    {
+      0x52b40ff6d69aaU, 0x31b8809377ffaU, 0x536625cd14c2cU, 0x516af252e17d1U, 0x78096f8e7d32bU,
+      0x77ad6a33ec4e2U, 0x717c5dc11d321U, 0x4a114559823e4U, 0x306ce50a1e2b1U, 0x4cf38a1fec2dbU,
+      0x2aa650dfa5ce7U, 0x54916a8f19415U, 0x00dc96fe71278U, 0x55f2784e63eb8U, 0x373cad3a26091U
+    },
+    {
+      0x6a8fb89ddbbadU, 0x78c35d5d97e37U, 0x66e3674ef2cb2U, 0x34347ac53dd8fU, 0x21547eda5112aU,
+      0x4634d82c9f57cU, 0x4249268a6d652U, 0x6336d687f2ff7U, 0x4fe4f4e26d9a0U, 0x0040f3d945441U,
+      0x5e939fd5986d3U, 0x12a2147019bdfU, 0x4c466e7d09cb2U, 0x6fa5b95d203ddU, 0x63550a334a254U
+    },
+    {
+      0x2584572547b49U, 0x75c58811c1377U, 0x4d3c637cc171bU, 0x33d30747d34e3U, 0x39a92bafaa7d7U,
+      0x7d6edb569cf37U, 0x60194a5dc2ca0U, 0x5af59745e10a6U, 0x7a8f53e004875U, 0x3eea62c7daf78U,
+      0x4c713e693274eU, 0x6ed1b7a6eb3a4U, 0x62ace697d8e15U, 0x266b8292ab075U, 0x68436a0665c9cU
+    },
+    {
+      0x6d317e820107cU, 0x090815d2ca3caU, 0x03ff1eb1499a1U, 0x23960f050e319U, 0x5373669c91611U,
+      0x235e8202f3f27U, 0x44c9f2eb61780U, 0x630905b1d7003U, 0x4fcc8d274ead1U, 0x17b6e7f68ab78U,
+      0x014ab9a0e5257U, 0x09939567f8ba5U, 0x4b47b2a423c82U, 0x688d7e57ac42dU, 0x1cb4b5a678f87U
+    },
+    {
+      0x4aa62a2a007e7U, 0x61e0e38f62d6eU, 0x02f888fcc4782U, 0x7562b83f21c00U, 0x2dc0fd2d82ef6U,
+      0x4c06b394afc6cU, 0x4931b4bf636ccU, 0x72b60d0322378U, 0x25127c6818b25U, 0x330bca78de743U,
+      0x6ff841119744eU, 0x2c560e8e49305U, 0x7254fefe5a57aU, 0x67ae2c560a7dfU, 0x3c31be1b369f1U
+    },
+    {
+      0x0bc93f9cb4272U, 0x3f8f9db73182dU, 0x2b235eabae1c4U, 0x2ddbf8729551aU, 0x41cec1097e7d5U,
+      0x4864d08948aeeU, 0x5d237438df61eU, 0x2b285601f7067U, 0x25dbcbae6d753U, 0x330b61134262dU,
+      0x619d7a26d808aU, 0x3c3b3c2adbef2U, 0x6877c9eec7f52U, 0x3beb9ebe1b66dU, 0x26b44cd91f287U
+    }
+  },
+#endif
+#if 59 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x4842db0285f37U, 0x208fdf91bf5e8U, 0x0825e6a1d4c62U, 0x2bccaba7048fcU, 0x0e378d6069615U,
+      0x29035393aa6d8U, 0x634257639a601U, 0x24f0888ad4044U, 0x5d6bd8ffb3bf8U, 0x4309c1f8cab82U,
+      0x2917183075a55U, 0x24d6013fb9b3fU, 0x0f7bc392f6d6bU, 0x43bbc14d6966bU, 0x078fc54975fd3U
+    },
+    {
+      0x04b5bb833a98aU, 0x585a986661c40U, 0x2b3a44d11dd77U, 0x0549d5122033fU, 0x272630e3d58e0U,
+      0x7bd1428878f2dU, 0x3a3d2843430fbU, 0x5cd068c4d18dbU, 0x65c278be4a892U, 0x5df98d4bad296U,
+      0x78fd0ecc90b54U, 0x3624086b33e6cU, 0x562e26fc00516U, 0x4d713392fde1bU, 0x4325e4aa73a71U
+    },
+    {
+      0x4629acf69f59dU, 0x1dbab577e9da4U, 0x2cb59eca92873U, 0x2169a9ae50fabU, 0x5d8c68d043b1bU,
+      0x5c6ef433c3493U, 0x3f01b7f186cafU, 0x4dcb6b994dd7aU, 0x4a3a3fe96a32dU, 0x4966ab79796e7U,
+      0x32d4de3b42b0aU, 0x562d48c039dc6U, 0x62e8f93613968U, 0x21bbc121c3b83U, 0x77ed1eb4184eeU
+    },
+    {
+      0x543f89e92ed1aU, 0x55fc8e338c30bU, 0x3c0fd3ec1287bU, 0x5eea4cfdf4453U, 0x5d8b0d2f3c859U,
+      0x4e13f201839a0U, 0x447c7be2c37faU, 0x5747f8ebbbfffU, 0x5e05b2d827835U, 0x52e085fb2b62fU,
+      0x079eaa54cf2baU, 0x5600364dce248U, 0x5ebdff75c9197U, 0x6813421de7ee4U, 0x0524b42b55eacU
+    },
+    {
+      0x0dcad9b829eacU, 0x516beaf3a1783U, 0x4e108cc8eb9f4U, 0x644e1a3091534U, 0x1a6110b2e7d4aU,
+      0x55dbee45447b0U, 0x3412400bddfa1U, 0x1d5e72db3b0d4U, 0x522ccd23c222bU, 0x59d242a216e7fU,
+      0x33f6ae66997acU, 0x546c3073489f0U, 0x42ad495a125d8U, 0x2a334c2ef60cbU, 0x53045e89dcb1fU
+    },
+    {
+      0x23cde8d45fe12U, 0x31c889c5a509bU, 0x5f8d662f50b08U, 0x1595428cb3c0fU, 0x7642c93f5616eU,
+      0x3b346d75353dbU, 0x175ca23c45971U, 0x42b9bbff3f2c9U, 0x5aee5d246a06aU, 0x26e3bae5f4f7cU,
+      0x3daa74595f8e4U, 0x170af57d68464U, 0x164c9bb79a232U, 0x45d1fe2474b0eU, 0x0b2e73ca15c9bU
+    },
+    {
+      0x7bfaf79c03a55U, 0x0a9976b59e1c7U, 0x4f78e7cc1debcU, 0x57beae2a922edU, 0x015e68c1476a4U,
+      0x34428c17f5026U, 0x47f6b5394fad7U, 0x46719127ac9c8U, 0x30171bdd2818cU, 0x21ce380db59a6U,
+      0x5285220066a38U, 0x246ae15de783aU, 0x1ae29365580f9U, 0x6e4c1932cd391U, 0x5dd689091f8eeU
+    },
+    {
+      0x22591a5313084U, 0x5dac4e10e43a0U, 0x42ff48328b52aU, 0x3a4435095c297U, 0x56e6c439ad7daU,
+      0x484debfd3c856U, 0x1166bfe489975U, 0x672b41c58930dU, 0x5f45bfc46e52eU, 0x3b0e574da2c2eU,
+      0x4ff4942bdbae6U, 0x4565bc3ef38e0U, 0x14beb617886b7U, 0x5e0f4aed9f9abU, 0x0822b5378f08eU
+    }
+  },
+#endif
+#if 60 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x7f29362730383U, 0x7fd7951459c36U, 0x7504c512d49e7U, 0x087ed7e3bc55fU, 0x7deb10149c726U,
+      0x048478f387475U, 0x69397d9678a3eU, 0x67c8156c976f3U, 0x2eb4d5589226cU, 0x2c709e6c1c10aU,
+      0x2af6a8766ee7aU, 0x08aaa79a1d96cU, 0x42f92d59b2fb0U, 0x1752c40009c07U, 0x08e68e9ff62ceU
+    },
+    {
+      0x509d50ab8f2f9U, 0x1b8ab247be5e5U, 0x5d9b2e6b2e486U, 0x4faa5479a1339U, 0x4cb13bd738f71U,
+      0x5500a4bc130adU, 0x127a17a938695U, 0x02a26fa34e36dU, 0x584d12e1ecc28U, 0x2f1f3f87eeba3U,
+      0x48c75e515b64aU, 0x75b6952071ef0U, 0x5d46d42965406U, 0x7746106989f9fU, 0x19a1e353c0ae2U
+    },
+    {
+      0x172cdd596bdbdU, 0x0731ddf881684U, 0x10426d64f8115U, 0x71a4fd8a9a3daU, 0x736bd3990266aU,
+      0x47560bafa05c3U, 0x418dcabcc2fa3U, 0x35991cecf8682U, 0x24371a94b8c60U, 0x41546b11c20c3U,
+      0x32d509334b3b4U, 0x16c102cae70aaU, 0x1720dd51bf445U, 0x5ae662faf9821U, 0x412295a2b87faU
+    },
+    {
+      0x55261e293eac6U, 0x06426759b65ccU, 0x40265ae116a48U, 0x6c02304bae5bcU, 0x0760bb8d195adU,
+      0x19b88f57ed6e9U, 0x4cdbf1904a339U, 0x42b49cd4e4f2cU, 0x71a2e771909d9U, 0x14e153ebb52d2U,
+      0x61a17cde6818aU, 0x53dad34108827U, 0x32b32c55c55b6U, 0x2f9165f9347a3U, 0x6b34be9bc33acU
+    },
+    {
+      0x469656571f2d3U, 0x0aa61ce6f423fU, 0x3f940d71b27a1U, 0x185f19d73d16aU, 0x01b9c7b62e6ddU,
+      0x72f643a78c0b2U, 0x3de45c04f9e7bU, 0x706d68d30fa5cU, 0x696f63e8e2f24U, 0x2012c18f0922dU,
+      0x355e55ac89d29U, 0x3e8b414ec7101U, 0x39db07c520c90U, 0x6f41e9b77efe1U, 0x08af5b784e4baU
+    },
+    {
+      0x314d289cc2c4bU, 0x23450e2f1bc4eU, 0x0cd93392f92f4U, 0x1370c6a946b7dU, 0x6423c1d5afd98U,
+      0x499dc881f2533U, 0x34ef26476c506U, 0x4d107d2741497U, 0x346c4bd6efdb3U, 0x32b79d71163a1U,
+      0x5f8d9edfcb36aU, 0x1e6e8dcbf3990U, 0x7974f348af30aU, 0x6e6724ef19c7cU, 0x480a5efbc13e2U
+    },
+    {
+      0x14ce442ce221fU, 0x18980a72516ccU, 0x072f80db86677U, 0x703331fda526eU, 0x24b31d47691c8U,
+      0x1e70b01622071U, 0x1f163b5f8a16aU, 0x56aaf341ad417U, 0x7989635d830f7U, 0x47aa27600cb7bU,
+      0x41eedc015f8c3U, 0x7cf8d27ef854aU, 0x289e3584693f9U, 0x04a7857b309a7U, 0x545b585d14ddaU
+    },
+    {
+      0x4e4d0e3b321e1U, 0x7451fe3d2ac40U, 0x666f678eea98dU, 0x038858667feadU, 0x4d22dc3e64c8dU,
+      0x7275ea0d43a0fU, 0x681137dd7ccf7U, 0x1e79cbab79a38U, 0x22a214489a66aU, 0x0f62f9c332ba5U,
+      0x46589d63b5f39U, 0x7eaf979ec3f96U, 0x4ebe81572b9a8U, 0x21b7f5d61694aU, 0x1c0fa01a36371U
+    }
+  },
+#endif
+#if 61 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x6e5e854c53faeU, 0x02569e7fe9823U, 0x2d9e9c9a82c1bU, 0x1f799aa07c070U, 0x15f18fc3cd07eU,
+      0x47449bc7cd692U, 0x55cdee7bbfceaU, 0x20df8a43e6afaU, 0x0c1a5780e5380U, 0x63ab1b5d3f1bcU,
+      0x50763b028f48cU, 0x00aad40cbe64eU, 0x5256d6018081dU, 0x046ea9dec0961U, 0x08706c9b865f5U
+    },
+    {
+      0x11b4138b41246U, 0x24df3584d7993U, 0x72eaef490ee71U, 0x6805cf7a4a6dbU, 0x5fba433dd082eU,
+      0x4a2ab3d343dffU, 0x5b01578c2fe6fU, 0x333ff286a31a8U, 0x0dcc724f01aeaU, 0x48b46beebaa1dU,
+      0x1e355c9941ad0U, 0x3ce8931f09389U, 0x198f972e5cd2bU, 0x059a0e1ff6833U, 0x0ecfedf8e8e71U
+    },
+    {
+      0x77463e9403762U, 0x5d1bf99392e89U, 0x793378fde6a37U, 0x21a8b1d324b2aU, 0x3b61788db284fU,
+      0x30f9f9cd470d9U, 0x37485ec010ec8U, 0x6b6b57ad8ab32U, 0x0400c4c14be2cU, 0x7789dd2db78c5U,
+      0x228190d6ef6b2U, 0x648d9c97f5644U, 0x42db31ea5299aU, 0x467a360d3bd27U, 0x4236ccffeb733U
+    },
+    {
+      0x02dbfda777df6U, 0x1817306d3c77bU, 0x430da65c6c5dfU, 0x0f88e874231c2U, 0x5a71945b48e2dU,
+      0x7404d0d55e274U, 0x33895a56a7092U, 0x6a55cd1b1998fU, 0x39e7617d86cd6U, 0x2617e120cdb8fU,
+      0x03dd5405b4b42U, 0x0821648a12de4U, 0x0aa2118c9fb18U, 0x5b54e1a391856U, 0x77de29fc11ffeU
+    },
+    {
+      0x6138fecced2caU, 0x27d52c773506bU, 0x0583a9a327abcU, 0x44964afdfe059U, 0x575e66f3ad877U,
+      0x457c983b778a8U, 0x53affd2259615U, 0x47d67714f3732U, 0x6d630e15c2a7fU, 0x3a1a2cf0f0de7U,
+      0x03a27c88fcb3aU, 0x124ebd8161330U, 0x5b0af94d1699eU, 0x45922cbc4e87fU, 0x62f882651e70aU
+    },
+    {
+      0x22986698a19e0U, 0x42e9af14e2db0U, 0x32c7d1f726087U, 0x628a0d42f98fbU, 0x352721c2bcda9U,
+      0x2e2c759ff1be4U, 0x12761c816e10bU, 0x7c9cde4524517U, 0x54ae233f3fd3fU, 0x4eeecf0ad5c73U,
+      0x29952213fc985U, 0x1a6d142e8c906U, 0x3056a94421f3cU, 0x610c72930d8b3U, 0x2d5b2d842ed24U
+    },
+    {
+      0x7d13d196ac533U, 0x59b7017c56bd6U, 0x3d6b890ddc8d3U, 0x67670a267fe3eU, 0x5226bcf9c441aU,
+      0x7ebd9ebd3ded1U, 0x6e720432e8059U, 0x0c286df516c85U, 0x3613abb7c09ffU, 0x5691b6f9a34efU,
+      0x66c7223e5b547U, 0x6d0661acf2f3dU, 0x62b73a5bd7d41U, 0x601f6b9f0f4b6U, 0x27c3da1e1d8ccU
+    },
+    {
+      0x02e71630ef9f6U, 0x0656c99dc0506U, 0x58a4afb0b5288U, 0x78c0484101825U, 0x5fca747aa82adU,
+      0x1efb23fe24c74U, 0x3e2ca37c02fd7U, 0x61637a8f943d2U, 0x07c9f53996e10U, 0x17377bd75bb81U,
+      0x203c35c258ea5U, 0x58d79619e2465U, 0x110859a1bc8e8U, 0x3159ed6c68697U, 0x04a8933cab768U
+    }
+  },
+#endif
+#if 62 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x02b0e8c936a50U, 0x6b83b58b6cd21U, 0x37ed8d3e72680U, 0x0a037db9f2a62U, 0x4005419b1d2bcU,
+      0x604b622943dffU, 0x1c899f6741a58U, 0x60219e2f232fbU, 0x35fae92a7f9cbU, 0x0fa3614f3b1caU,
+      0x3febdb9be82f0U, 0x5e74895921400U, 0x553ea38822706U, 0x5a17c24cfc88cU, 0x1fba218aef40aU
+    },
+    {
+      0x657043e7b0194U, 0x5c11b55efe9e7U, 0x7737bc6a074fbU, 0x0eae41ce355ccU, 0x6c535d13ff776U,
+      0x49448fac8f53eU, 0x34f74c6e8356aU, 0x0ad780607dba2U, 0x7213a7eb63eb6U, 0x392e3acaa8c86U,
+      0x534e93e8a35afU, 0x08b10fd02c997U, 0x26ac2acb81e05U, 0x09d8c98ce3b79U, 0x25e17fe4d50acU
+    },
+    {
+      0x77ff576f121a7U, 0x4e5f9b0fc722bU, 0x46f949b0d28c8U, 0x4cde65d17ef26U, 0x6bba828f89698U,
+      0x09bd71e04f676U, 0x25ac841f2a145U, 0x1a47eac823871U, 0x1a8a8c36c581aU, 0x255751442a9fbU,
+      0x1bc6690fe3901U, 0x314132f5abc5aU, 0x611835132d528U, 0x5f24b8eb48a57U, 0x559d504f7f6b7U
+    },
+    {
+      0x091e7f6d266fdU, 0x36060ef037389U, 0x18788ec1d1286U, 0x287441c478eb0U, 0x123ea6a3354bdU,
+      0x38378b3eb54d5U, 0x4d4aaa78f94eeU, 0x4a002e875a74dU, 0x10b851367b17cU, 0x01ab12d5807e3U,
+      0x5189041e32d96U, 0x05b062b090231U, 0x0c91766e7b78fU, 0x0aa0f55a138ecU, 0x4a3961e2c918aU
+    },
+    {
+      0x7d644f3233f1eU, 0x1c69f9e02c064U, 0x36ae5e5266898U, 0x08fc1dad38b79U, 0x68aceead9bd41U,
+      0x43be0f8e6bba0U, 0x68fdffc614e3bU, 0x4e91dab5b3be0U, 0x3b1d4c9212ff0U, 0x2cd6bce3fb1dbU,
+      0x4c90ef3d7c210U, 0x496f5a0818716U, 0x79cf88cc239b8U, 0x2cb9c306cf8dbU, 0x595760d5b508fU
+    },
+    {
+      0x2cbebfd022790U, 0x0b8822aec1105U, 0x4d1cfd226bcccU, 0x515b2fa4971beU, 0x2cb2c5df54515U,
+      0x1bfe104aa6397U, 0x11494ff996c25U, 0x64251623e5800U, 0x0d49fc5e044beU, 0x709fa43edcb29U,
+      0x25d8c63fd2acaU, 0x4c5cd29dffd61U, 0x32ec0eb48af05U, 0x18f9391f9b77cU, 0x70f029ecf0c81U
+    },
+    {
+      0x2afaa5e10b0b9U, 0x61de08355254dU, 0x0eb587de3c28dU, 0x4f0bb9f7dbbd5U, 0x44eca5a2a74bdU,
+      0x307b32eed3e33U, 0x6748ab03ce8c2U, 0x57c0d9ab810bcU, 0x42c64a224e98cU, 0x0b7d5d8a6c314U,
+      0x448327b95d543U, 0x0146681e3a4baU, 0x38714adc34e0cU, 0x4f26f0e298e30U, 0x272224512c7deU
+    },
+    {
+      0x3bb8a42a975fcU, 0x6f2d5b46b17efU, 0x7b6a9223170e5U, 0x053713fe3b7e6U, 0x19735fd7f6bc2U,
+      0x492af49c5342eU, 0x2365cdf5a0357U, 0x32138a7ffbb60U, 0x2a1f7d14646feU, 0x11b5df18a44ccU,
+      0x390d042c84266U, 0x1efe32a8fdc75U, 0x6925ee7ae1238U, 0x4af9281d0e832U, 0x0fef911191df8U
+    }
+  },
+#endif
+#if 63 % HACL_CURVE25519_BASE_SPACING == 0
+  {
+    {
+      0x5dcb85b1c16b7U, 0x5078f64f4ad56U, 0x5545efa5303f3U, 0x7d552588e0d39U, 0x499238d0ba0eaU,
+      0x07ca1ab1c6eb9U, 0x7c2d6d0f6762aU, 0x1ea46aef5123cU, 0x7609a2afdbf96U, 0x7579229e2f2adU,
+      0x46e527aba8b57U, 0x0f17a2c8f7d9eU, 0x5c1bfbc568231U, 0x06abd78e3532fU, 0x6345fa78f03a3U
+    },
+    {
+      0x3cbe9bdd8f0a4U, 0x37fa2ee60527aU, 0x45ea1d76c54b0U, 0x77f3edeee36bfU, 0x3e1a71cc8f426U,
+      0x2f95f1015e7a1U, 0x3b536804c7be0U, 0x7a8441de43b10U, 0x464a69d075099U, 0x54f70be7e33afU,
+      0x4a3e390babd62U, 0x4e05239067907U, 0x5e4031203b78dU, 0x7d0e4401c6669U, 0x2c5fc0231ec31U
+    },
+    {
+      0x2e4d102456e65U, 0x0395a8f723884U, 0x2dbff761d052bU, 0x0078ac9715dd1U, 0x75d9d2bff5c21U,
+      0x2911717038b4fU, 0x4393bddf03fd7U, 0x43620d39448dcU, 0x5e30e4bf273aeU, 0x68afae7a23dc3U,
+      0x1b4763626e81cU, 0x6d79405dbab7bU, 0x7c1dece2659a4U, 0x23885208c9eb0U, 0x3097a24200ce5U
+    },
+    {
+      0x2e7246695c486U, 0x686b512c0f42cU, 0x344a8dc4c758cU, 0x1b198290ab0d0U, 0x56704bada6afbU,
+      0x27734c7f8b84cU, 0x7c0364e1d2ae8U, 0x395929bc50684U, 0x6a40168d6ff5aU, 0x4bb23d92ce83bU,
+      0x44aa752f912b9U, 0x59b0cee1915edU, 0x723356179997dU, 0x53f261ad641d1U, 0x2b7a29c010a58U
+    },
+    {
+      0x10a23bf00086eU, 0x3dce6dfef8670U, 0x1248b52bf3a49U, 0x30d9eb0733871U, 0x11ce9e714f960U,
+      0x07f77d0c1cec3U, 0x6d758925f1880U, 0x1a76abe344082U, 0x670197614eabfU, 0x599408759d95fU,
+      0x6f713d815bac1U, 0x3a90b7c4b8433U, 0x144f147c50519U, 0x1c9b6aa23e627U, 0x174926be5ef44U
+    },
+    {
+      0x5d41593ea022eU, 0x441da1ddac7deU, 0x4e0b23172f306U, 0x0d6c7e9276783U, 0x6fa42ead06d8eU,
+      0x6b2f9fc5bd5bbU, 0x55c3b021c36bbU, 0x4a871664b6a9cU, 0x51257e267ee5bU, 0x497d78813fc22U,
+      0x6824a1f73371fU, 0x389eb6ce6dc4eU, 0x3e91b9dfdf3c0U, 0x64b3f100ff182U, 0x785a36a357808U
+    },
+    {
+      0x442985d517bc3U, 0x0f5cca6cf00e0U, 0x169dd8dab355bU, 0x31580513cc1ccU, 0x5167effae5126U,
+      0x7bdfd63014d2bU, 0x38d94eaf1704bU, 0x02d77c32148daU, 0x647ad97e6942eU, 0x12ab214c58048U,
+      0x6a9e10f53c4b6U, 0x3f159234297a9U, 0x3306ae859cf71U, 0x512d47c0d2715U, 0x33a92a7924332U
+    },
+    {
+      0x15ba0218f2adaU, 0x0e661f7394f75U, 0x31b641f3fd08aU, 0x72a6d6d24b6abU, 0x5380c296f4beeU,
+      0x1f49927996c02U, 0x31c09a2ea53baU, 0x740b0f832cec1U, 0x7588fbf444b3fU, 0x2f964268cb8b3U,
+      0x7270466898d0aU, 0x3215fe7ef53a9U, 0x76ae914f4261eU, 0x34e684f79b133U, 0x7761455e7b1c6U
+    }
+  },
+#endif
+};
+
+#endif
@@ -0,0 +1,642 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* AVX2 code whatever the global compiler flags; the entry point checks
+   that the CPU and the OS support it before taking the vector path */
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__i386__) || defined(__x86_64__))
+#pragma GCC target("avx2")
+#endif
+
+#include "kremlib.h"
+#include "Hacl_Curve25519.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Curve25519_Vec256.h"
+
+#if defined(__AVX2__) && (defined(__GNUC__) || defined(__clang__))
+
+#include <immintrin.h>
+#include "Hacl_Cpu_Features.h"
+
+bool Hacl_Curve25519_Vec256_is_supported(void)
+{
+  return Hacl_Cpu_Features_has(HACL_CPU_AVX2);
+}
+
+/* Field elements modulo p = 2^255 - 19 in radix 2^25.5: ten limbs of
+   alternately 26 and 25 bits, as in ref10. Limb i of the four independent
+   elements sits in the four 64-bit lanes of one vector, so that limb
+   products are single vpmuludq instructions.
+
+   "Carried" elements have every limb within a few bits of its nominal
+   width. Sums and differences of carried elements (at most 3 * 2^26 per
+   limb) may be multiplied without further carrying: products then stay
+   below 2^63. */
+
+#define HACL_CURVE25519_VEC256_MASK26 0x3ffffffU
+#define HACL_CURVE25519_VEC256_MASK25 0x1ffffffU
+
+/* Carries h in place, with the two interleaved chains of ref10 fe_mul */
+static inline void Hacl_Impl_Curve25519_Vec256_carry(__m256i *h)
+{
+  const __m256i mask26 = _mm256_set1_epi64x(HACL_CURVE25519_VEC256_MASK26);
+  const __m256i mask25 = _mm256_set1_epi64x(HACL_CURVE25519_VEC256_MASK25);
+  __m256i c0, c1;
+  c0 = _mm256_srli_epi64(h[0U], 26);
+  c1 = _mm256_srli_epi64(h[4U], 26);
+  h[0U] = _mm256_and_si256(h[0U], mask26);
+  h[4U] = _mm256_and_si256(h[4U], mask26);
+  h[1U] = _mm256_add_epi64(h[1U], c0);
+  h[5U] = _mm256_add_epi64(h[5U], c1);
+  c0 = _mm256_srli_epi64(h[1U], 25);
+  c1 = _mm256_srli_epi64(h[5U], 25);
+  h[1U] = _mm256_and_si256(h[1U], mask25);
+  h[5U] = _mm256_and_si256(h[5U], mask25);
+  h[2U] = _mm256_add_epi64(h[2U], c0);
+  h[6U] = _mm256_add_epi64(h[6U], c1);
+  c0 = _mm256_srli_epi64(h[2U], 26);
+  c1 = _mm256_srli_epi64(h[6U], 26);
+  h[2U] = _mm256_and_si256(h[2U], mask26);
+  h[6U] = _mm256_and_si256(h[6U], mask26);
+  h[3U] = _mm256_add_epi64(h[3U], c0);
+  h[7U] = _mm256_add_epi64(h[7U], c1);
+  c0 = _mm256_srli_epi64(h[3U], 25);
+  c1 = _mm256_srli_epi64(h[7U], 25);
+  h[3U] = _mm256_and_si256(h[3U], mask25);
+  h[7U] = _mm256_and_si256(h[7U], mask25);
+  h[4U] = _mm256_add_epi64(h[4U], c0);
+  h[8U] = _mm256_add_epi64(h[8U], c1);
+  c0 = _mm256_srli_epi64(h[4U], 26);
+  c1 = _mm256_srli_epi64(h[8U], 26);
+  h[4U] = _mm256_and_si256(h[4U], mask26);
+  h[8U] = _mm256_and_si256(h[8U], mask26);
+  h[5U] = _mm256_add_epi64(h[5U], c0);
+  h[9U] = _mm256_add_epi64(h[9U], c1);
+  /* 2^255 = 19: h0 += 19 * c, with c up to 2^39 (too wide for vpmuludq) */
+  c1 = _mm256_srli_epi64(h[9U], 25);
+  h[9U] = _mm256_and_si256(h[9U], mask25);
+  h[0U] = _mm256_add_epi64(h[0U],
+    _mm256_add_epi64(c1, _mm256_add_epi64(_mm256_slli_epi64(c1, 1), _mm256_slli_epi64(c1, 4))));
+  c0 = _mm256_srli_epi64(h[0U], 26);
+  h[0U] = _mm256_and_si256(h[0U], mask26);
+  h[1U] = _mm256_add_epi64(h[1U], c0);
+}
+
+/* out = a + b, not carried */
+static inline void Hacl_Impl_Curve25519_Vec256_fadd(__m256i *out, const __m256i *a, const __m256i *b)
+{
+  for (uint32_t i = 0U; i < 10U; i++)
+    out[i] = _mm256_add_epi64(a[i], b[i]);
+}
+
+/* out = a + 2p - b for carried b, not carried */
+static inline void Hacl_Impl_Curve25519_Vec256_fsub(__m256i *out, const __m256i *a, const __m256i *b)
+{
+  const __m256i p0 = _mm256_set1_epi64x(0x7ffffdaU);
+  const __m256i p_even = _mm256_set1_epi64x(0x7fffffeU);
+  const __m256i p_odd = _mm256_set1_epi64x(0x3fffffeU);
+  out[0U] = _mm256_sub_epi64(_mm256_add_epi64(a[0U], p0), b[0U]);
+  for (uint32_t i = 1U; i < 10U; i++)
+    out[i] = _mm256_sub_epi64(_mm256_add_epi64(a[i], (i & 1U) ? p_odd : p_even), b[i]);
+}
+
+/* out = f * g, carried */
+static inline void Hacl_Impl_Curve25519_Vec256_fmul(__m256i *out, const __m256i *f, const __m256i *g)
+{
+  const __m256i nineteen = _mm256_set1_epi64x(19);
+  __m256i f2[10U], g19[10U], h[10U];
+  for (uint32_t i = 1U; i < 10U; i = i + 2U)
+    f2[i] = _mm256_add_epi64(f[i], f[i]);
+  for (uint32_t i = 1U; i < 10U; i++)
+    g19[i] = _mm256_mul_epu32(g[i], nineteen);
+  h[0U] = _mm256_mul_epu32(f[0U], g[0U]);
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[1U], g19[9U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f[2U], g19[8U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[3U], g19[7U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f[4U], g19[6U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[5U], g19[5U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f[6U], g19[4U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[7U], g19[3U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f[8U], g19[2U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[9U], g19[1U]));
+  h[1U] = _mm256_mul_epu32(f[0U], g[1U]);
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[1U], g[0U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[2U], g19[9U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[3U], g19[8U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[4U], g19[7U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[5U], g19[6U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[6U], g19[5U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[7U], g19[4U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[8U], g19[3U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f[9U], g19[2U]));
+  h[2U] = _mm256_mul_epu32(f[0U], g[2U]);
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[1U], g[1U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f[2U], g[0U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[3U], g19[9U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f[4U], g19[8U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[5U], g19[7U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f[6U], g19[6U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[7U], g19[5U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f[8U], g19[4U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[9U], g19[3U]));
+  h[3U] = _mm256_mul_epu32(f[0U], g[3U]);
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[1U], g[2U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[2U], g[1U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[3U], g[0U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[4U], g19[9U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[5U], g19[8U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[6U], g19[7U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[7U], g19[6U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[8U], g19[5U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f[9U], g19[4U]));
+  h[4U] = _mm256_mul_epu32(f[0U], g[4U]);
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[1U], g[3U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f[2U], g[2U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[3U], g[1U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f[4U], g[0U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[5U], g19[9U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f[6U], g19[8U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[7U], g19[7U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f[8U], g19[6U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[9U], g19[5U]));
+  h[5U] = _mm256_mul_epu32(f[0U], g[5U]);
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[1U], g[4U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[2U], g[3U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[3U], g[2U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[4U], g[1U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[5U], g[0U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[6U], g19[9U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[7U], g19[8U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[8U], g19[7U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f[9U], g19[6U]));
+  h[6U] = _mm256_mul_epu32(f[0U], g[6U]);
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[1U], g[5U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f[2U], g[4U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[3U], g[3U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f[4U], g[2U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[5U], g[1U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f[6U], g[0U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[7U], g19[9U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f[8U], g19[8U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[9U], g19[7U]));
+  h[7U] = _mm256_mul_epu32(f[0U], g[7U]);
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[1U], g[6U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[2U], g[5U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[3U], g[4U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[4U], g[3U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[5U], g[2U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[6U], g[1U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[7U], g[0U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[8U], g19[9U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f[9U], g19[8U]));
+  h[8U] = _mm256_mul_epu32(f[0U], g[8U]);
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[1U], g[7U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f[2U], g[6U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[3U], g[5U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f[4U], g[4U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[5U], g[3U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f[6U], g[2U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[7U], g[1U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f[8U], g[0U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[9U], g19[9U]));
+  h[9U] = _mm256_mul_epu32(f[0U], g[9U]);
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[1U], g[8U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[2U], g[7U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[3U], g[6U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[4U], g[5U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[5U], g[4U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[6U], g[3U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[7U], g[2U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[8U], g[1U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f[9U], g[0U]));
+  Hacl_Impl_Curve25519_Vec256_carry(h);
+  memcpy(out, h, 10U * sizeof h[0U]);
+}
+
+/* out = f^2, carried */
+static inline void Hacl_Impl_Curve25519_Vec256_fsqr(__m256i *out, const __m256i *f)
+{
+  const __m256i nineteen = _mm256_set1_epi64x(19);
+  __m256i f2[10U], f4[10U], f19[10U], h[10U];
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    f2[i] = _mm256_add_epi64(f[i], f[i]);
+    f4[i] = _mm256_add_epi64(f2[i], f2[i]);
+    f19[i] = _mm256_mul_epu32(f[i], nineteen);
+  }
+  h[0U] = _mm256_mul_epu32(f[0U], f[0U]);
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f4[1U], f19[9U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[2U], f19[8U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f4[3U], f19[7U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[4U], f19[6U]));
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_mul_epu32(f2[5U], f19[5U]));
+  h[1U] = _mm256_mul_epu32(f2[0U], f[1U]);
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f2[2U], f19[9U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f2[3U], f19[8U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f2[4U], f19[7U]));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_mul_epu32(f2[5U], f19[6U]));
+  h[2U] = _mm256_mul_epu32(f2[0U], f[2U]);
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[1U], f[1U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f4[3U], f19[9U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f2[4U], f19[8U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f4[5U], f19[7U]));
+  h[2U] = _mm256_add_epi64(h[2U], _mm256_mul_epu32(f[6U], f19[6U]));
+  h[3U] = _mm256_mul_epu32(f2[0U], f[3U]);
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f2[1U], f[2U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f2[4U], f19[9U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f2[5U], f19[8U]));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_mul_epu32(f2[6U], f19[7U]));
+  h[4U] = _mm256_mul_epu32(f2[0U], f[4U]);
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f4[1U], f[3U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f[2U], f[2U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f4[5U], f19[9U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[6U], f19[8U]));
+  h[4U] = _mm256_add_epi64(h[4U], _mm256_mul_epu32(f2[7U], f19[7U]));
+  h[5U] = _mm256_mul_epu32(f2[0U], f[5U]);
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f2[1U], f[4U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f2[2U], f[3U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f2[6U], f19[9U]));
+  h[5U] = _mm256_add_epi64(h[5U], _mm256_mul_epu32(f2[7U], f19[8U]));
+  h[6U] = _mm256_mul_epu32(f2[0U], f[6U]);
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f4[1U], f[5U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[2U], f[4U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f2[3U], f[3U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f4[7U], f19[9U]));
+  h[6U] = _mm256_add_epi64(h[6U], _mm256_mul_epu32(f[8U], f19[8U]));
+  h[7U] = _mm256_mul_epu32(f2[0U], f[7U]);
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f2[1U], f[6U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f2[2U], f[5U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f2[3U], f[4U]));
+  h[7U] = _mm256_add_epi64(h[7U], _mm256_mul_epu32(f2[8U], f19[9U]));
+  h[8U] = _mm256_mul_epu32(f2[0U], f[8U]);
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f4[1U], f[7U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[2U], f[6U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f4[3U], f[5U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f[4U], f[4U]));
+  h[8U] = _mm256_add_epi64(h[8U], _mm256_mul_epu32(f2[9U], f19[9U]));
+  h[9U] = _mm256_mul_epu32(f2[0U], f[9U]);
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f2[1U], f[8U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f2[2U], f[7U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f2[3U], f[6U]));
+  h[9U] = _mm256_add_epi64(h[9U], _mm256_mul_epu32(f2[4U], f[5U]));
+  Hacl_Impl_Curve25519_Vec256_carry(h);
+  memcpy(out, h, 10U * sizeof h[0U]);
+}
+
+static void Hacl_Impl_Curve25519_Vec256_fsqr_times(__m256i *out, const __m256i *f, uint32_t n)
+{
+  Hacl_Impl_Curve25519_Vec256_fsqr(out, f);
+  for (uint32_t i = 1U; i < n; i++)
+    Hacl_Impl_Curve25519_Vec256_fsqr(out, out);
+}
+
+/* out = z^(p - 2) in every lane (crecip's addition chain) */
+static void Hacl_Impl_Curve25519_Vec256_finv(__m256i *out, const __m256i *z)
+{
+  __m256i z2[10U], z9[10U], z11[10U], z_5_0[10U], z_10_0[10U], z_20_0[10U];
+  __m256i z_50_0[10U], z_100_0[10U], t[10U];
+  Hacl_Impl_Curve25519_Vec256_fsqr(z2, z);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z2, 2U);
+  Hacl_Impl_Curve25519_Vec256_fmul(z9, t, z);
+  Hacl_Impl_Curve25519_Vec256_fmul(z11, z9, z2);
+  Hacl_Impl_Curve25519_Vec256_fsqr(t, z11);
+  Hacl_Impl_Curve25519_Vec256_fmul(z_5_0, t, z9);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z_5_0, 5U);
+  Hacl_Impl_Curve25519_Vec256_fmul(z_10_0, t, z_5_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z_10_0, 10U);
+  Hacl_Impl_Curve25519_Vec256_fmul(z_20_0, t, z_10_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z_20_0, 20U);
+  Hacl_Impl_Curve25519_Vec256_fmul(t, t, z_20_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, t, 10U);
+  Hacl_Impl_Curve25519_Vec256_fmul(z_50_0, t, z_10_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z_50_0, 50U);
+  Hacl_Impl_Curve25519_Vec256_fmul(z_100_0, t, z_50_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, z_100_0, 100U);
+  Hacl_Impl_Curve25519_Vec256_fmul(t, t, z_100_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, t, 50U);
+  Hacl_Impl_Curve25519_Vec256_fmul(t, t, z_50_0);
+  Hacl_Impl_Curve25519_Vec256_fsqr_times(t, t, 5U);
+  Hacl_Impl_Curve25519_Vec256_fmul(out, t, z11);
+}
+
+/* Bit offsets of the ten limbs within the 255-bit encoding */
+static const uint32_t Hacl_Impl_Curve25519_Vec256_offset[10U] =
+  { 0U, 26U, 51U, 77U, 102U, 128U, 153U, 179U, 204U, 230U };
+
+/* Loads lane l of out from b, ignoring bit 255 */
+static void Hacl_Impl_Curve25519_Vec256_fexpand(uint64_t out[10U][4U], uint32_t l, const uint8_t *b)
+{
+  uint8_t buf[40U] = { 0U };
+  memcpy(buf, b, 32U);
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    uint32_t off = Hacl_Impl_Curve25519_Vec256_offset[i];
+    uint64_t mask = (i & 1U) ? HACL_CURVE25519_VEC256_MASK25 : HACL_CURVE25519_VEC256_MASK26;
+    out[i][l] = (load64_le(buf + off / 8U) >> (off % 8U)) & mask;
+  }
+}
+
+/* Fully reduces a carried element h (one lane) and encodes it, in constant
+   time, as ref10 fe_tobytes does */
+static void Hacl_Impl_Curve25519_Vec256_fcontract(uint8_t *b, uint64_t *h)
+{
+  uint64_t q = ((uint64_t)19U * h[9U] + ((uint64_t)1U << 24U)) >> 25U;
+  for (uint32_t i = 0U; i < 10U; i++)
+    q = (h[i] + q) >> ((i & 1U) ? 25U : 26U);
+  /* q = 1 iff h >= p: subtract p by adding 19 and dropping bit 255 */
+  h[0U] = h[0U] + (uint64_t)19U * q;
+  for (uint32_t i = 0U; i < 9U; i++)
+  {
+    uint32_t bits = (i & 1U) ? 25U : 26U;
+    h[i + 1U] = h[i + 1U] + (h[i] >> bits);
+    h[i] = h[i] & (((uint64_t)1U << bits) - 1U);
+  }
+  h[9U] = h[9U] & HACL_CURVE25519_VEC256_MASK25;
+  uint64_t w[5U] = { 0U };
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    uint32_t off = Hacl_Impl_Curve25519_Vec256_offset[i];
+    w[off / 64U] = w[off / 64U] | h[i] << (off % 64U);
+    if (off % 64U != 0U)
+      w[off / 64U + 1U] = w[off / 64U + 1U] | h[i] >> (64U - off % 64U);
+  }
+  for (uint32_t i = 0U; i < 4U; i++)
+    store64_le(b + 8U * i, w[i]);
+}
+
+/* Swaps a and b in the lanes where mask is all ones */
+static inline void Hacl_Impl_Curve25519_Vec256_cswap(__m256i *a, __m256i *b, __m256i mask)
+{
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    __m256i t = _mm256_and_si256(mask, _mm256_xor_si256(a[i], b[i]));
+    a[i] = _mm256_xor_si256(a[i], t);
+    b[i] = _mm256_xor_si256(b[i], t);
+  }
+}
+
+/* One step of the RFC 7748 ladder in all four lanes:
+   (x2 : z2) = 2 (x2 : z2), (x3 : z3) = (x2 : z2) + (x3 : z3) */
+static inline void
+Hacl_Impl_Curve25519_Vec256_ladder_step(
+  __m256i *x1,
+  __m256i *x2,
+  __m256i *z2,
+  __m256i *x3,
+  __m256i *z3
+)
+{
+  const __m256i a24 = _mm256_set1_epi64x(121665);
+  __m256i a[10U], aa[10U], b[10U], bb[10U], e[10U], c[10U], d[10U], da[10U], cb[10U], t[10U];
+  Hacl_Impl_Curve25519_Vec256_fadd(a, x2, z2);
+  Hacl_Impl_Curve25519_Vec256_fsub(b, x2, z2);
+  Hacl_Impl_Curve25519_Vec256_fadd(c, x3, z3);
+  Hacl_Impl_Curve25519_Vec256_fsub(d, x3, z3);
+  Hacl_Impl_Curve25519_Vec256_fsqr(aa, a);
+  Hacl_Impl_Curve25519_Vec256_fsqr(bb, b);
+  Hacl_Impl_Curve25519_Vec256_fmul(da, d, a);
+  Hacl_Impl_Curve25519_Vec256_fmul(cb, c, b);
+  Hacl_Impl_Curve25519_Vec256_fsub(e, aa, bb);
+  Hacl_Impl_Curve25519_Vec256_fadd(t, da, cb);
+  Hacl_Impl_Curve25519_Vec256_fsqr(x3, t);
+  Hacl_Impl_Curve25519_Vec256_fsub(t, da, cb);
+  Hacl_Impl_Curve25519_Vec256_fsqr(t, t);
+  Hacl_Impl_Curve25519_Vec256_fmul(z3, x1, t);
+  Hacl_Impl_Curve25519_Vec256_fmul(x2, aa, bb);
+  for (uint32_t i = 0U; i < 10U; i++)
+    t[i] = _mm256_add_epi64(aa[i], _mm256_mul_epu32(e[i], a24));
+  Hacl_Impl_Curve25519_Vec256_carry(t);
+  Hacl_Impl_Curve25519_Vec256_fmul(z2, e, t);
+}
+
+/* Runs the four ladders, leaving the projective results (x2 : z2) */
+static void
+Hacl_Impl_Curve25519_Vec256_ladder_x4(
+  __m256i *x2,
+  __m256i *z2,
+  uint8_t **secret,
+  uint8_t **basepoint
+)
+{
+  uint64_t u[10U][4U];
+  uint8_t k[4U][32U];
+  __m256i x1[10U], x3[10U], z3[10U];
+  for (uint32_t l = 0U; l < 4U; l++)
+  {
+    memcpy(k[l], secret[l], 32U);
+    k[l][0U] = k[l][0U] & 248U;
+    k[l][31U] = (k[l][31U] & 127U) | 64U;
+    Hacl_Impl_Curve25519_Vec256_fexpand(u, l, basepoint[l]);
+  }
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    x1[i] = _mm256_loadu_si256((const __m256i *)u[i]);
+    x3[i] = x1[i];
+    x2[i] = _mm256_setzero_si256();
+    z2[i] = _mm256_setzero_si256();
+    z3[i] = _mm256_setzero_si256();
+  }
+  x2[0U] = _mm256_set1_epi64x(1);
+  z3[0U] = _mm256_set1_epi64x(1);
+  uint64_t swap[4U] = { 0U };
+  for (uint32_t i = 255U; i > 0U; i--)
+  {
+    uint32_t t = i - 1U;
+    uint64_t bit[4U];
+    for (uint32_t l = 0U; l < 4U; l++)
+    {
+      bit[l] = (uint64_t)(k[l][t / 8U] >> (t % 8U) & 1U);
+      swap[l] = (uint64_t)0U - (swap[l] ^ bit[l]);
+    }
+    __m256i mask = _mm256_loadu_si256((const __m256i *)swap);
+    Hacl_Impl_Curve25519_Vec256_cswap(x2, x3, mask);
+    Hacl_Impl_Curve25519_Vec256_cswap(z2, z3, mask);
+    memcpy(swap, bit, sizeof bit);
+    Hacl_Impl_Curve25519_Vec256_ladder_step(x1, x2, z2, x3, z3);
+  }
+  for (uint32_t l = 0U; l < 4U; l++)
+    swap[l] = (uint64_t)0U - swap[l];
+  __m256i mask = _mm256_loadu_si256((const __m256i *)swap);
+  Hacl_Impl_Curve25519_Vec256_cswap(x2, x3, mask);
+  Hacl_Impl_Curve25519_Vec256_cswap(z2, z3, mask);
+}
+
+/* Encodes x2 / z2 lane by lane, given zinv = 1 / z2 */
+static void Hacl_Impl_Curve25519_Vec256_store_x4(uint8_t **mypublic, __m256i *x2, const __m256i *zinv)
+{
+  uint64_t u[10U][4U];
+  Hacl_Impl_Curve25519_Vec256_fmul(x2, x2, zinv);
+  for (uint32_t i = 0U; i < 10U; i++)
+    _mm256_storeu_si256((__m256i *)u[i], x2[i]);
+  for (uint32_t l = 0U; l < 4U; l++)
+  {
+    uint64_t h[10U];
+    for (uint32_t i = 0U; i < 10U; i++)
+      h[i] = u[i][l];
+    Hacl_Impl_Curve25519_Vec256_fcontract(mypublic[l], h);
+  }
+}
+
+static void Hacl_Impl_Curve25519_Vec256_scalarmult_x4(uint8_t **mypublic, uint8_t **secret, uint8_t **basepoint)
+{
+  __m256i x2[10U], z2[10U], zinv[10U];
+  Hacl_Impl_Curve25519_Vec256_ladder_x4(x2, z2, secret, basepoint);
+  Hacl_Impl_Curve25519_Vec256_finv(zinv, z2);
+  Hacl_Impl_Curve25519_Vec256_store_x4(mypublic, x2, zinv);
+}
+
+/* In the lanes where z = 0 mod p (a point at infinity), sets (x : z) to
+   (0 : 1) so that the batch product stays invertible; the encoded result
+   of such a lane is 0 either way */
+static void Hacl_Impl_Curve25519_Vec256_fix_infinity(__m256i *x, __m256i *z)
+{
+  uint64_t u[10U][4U], zero[4U];
+  for (uint32_t i = 0U; i < 10U; i++)
+    _mm256_storeu_si256((__m256i *)u[i], z[i]);
+  for (uint32_t l = 0U; l < 4U; l++)
+  {
+    uint64_t h[10U], acc = 0U;
+    uint8_t b[32U];
+    for (uint32_t i = 0U; i < 10U; i++)
+      h[i] = u[i][l];
+    Hacl_Impl_Curve25519_Vec256_fcontract(b, h);
+    for (uint32_t i = 0U; i < 32U; i++)
+      acc = acc | (uint64_t)b[i];
+    zero[l] = ((acc | ((uint64_t)0U - acc)) >> 63U) - 1U;
+  }
+  __m256i mask = _mm256_loadu_si256((const __m256i *)zero);
+  for (uint32_t i = 0U; i < 10U; i++)
+  {
+    x[i] = _mm256_andnot_si256(mask, x[i]);
+    z[i] = _mm256_andnot_si256(mask, z[i]);
+  }
+  z[0U] = _mm256_or_si256(z[0U], _mm256_and_si256(mask, _mm256_set1_epi64x(1)));
+}
+
+/* Groups of four lanes sharing one (vector) inversion */
+#define HACL_CURVE25519_VEC256_BATCH_GROUPS 8U
+
+static void
+Hacl_Impl_Curve25519_Vec256_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+)
+{
+  __m256i x[HACL_CURVE25519_VEC256_BATCH_GROUPS][10U];
+  __m256i z[HACL_CURVE25519_VEC256_BATCH_GROUPS][10U];
+  __m256i prod[HACL_CURVE25519_VEC256_BATCH_GROUPS][10U];
+  __m256i inv[10U], zinv[10U];
+  uint8_t *out[HACL_CURVE25519_VEC256_BATCH_GROUPS][4U];
+  uint8_t discard[4U][32U];
+  uint32_t off = 0U;
+  while (off < n)
+  {
+    uint32_t groups = 0U;
+    for (; groups < HACL_CURVE25519_VEC256_BATCH_GROUPS && off < n; groups++)
+    {
+      uint8_t *sk[4U], *bp[4U];
+      for (uint32_t l = 0U; l < 4U; l++)
+      {
+        /* Pad a last, partial group with copies of its first operation */
+        uint32_t j = off + l < n ? off + l : off;
+        sk[l] = secret[j];
+        bp[l] = basepoint[j];
+        out[groups][l] = off + l < n ? mypublic[off + l] : discard[l];
+      }
+      Hacl_Impl_Curve25519_Vec256_ladder_x4(x[groups], z[groups], sk, bp);
+      Hacl_Impl_Curve25519_Vec256_fix_infinity(x[groups], z[groups]);
+      off = off + 4U;
+    }
+    /* Montgomery's trick, lane by lane across the groups */
+    memcpy(prod[0U], z[0U], sizeof prod[0U]);
+    for (uint32_t g = 1U; g < groups; g++)
+      Hacl_Impl_Curve25519_Vec256_fmul(prod[g], prod[g - 1U], z[g]);
+    Hacl_Impl_Curve25519_Vec256_finv(inv, prod[groups - 1U]);
+    for (uint32_t g = groups - 1U; g > 0U; g--)
+    {
+      Hacl_Impl_Curve25519_Vec256_fmul(zinv, inv, prod[g - 1U]);
+      Hacl_Impl_Curve25519_Vec256_fmul(inv, inv, z[g]);
+      Hacl_Impl_Curve25519_Vec256_store_x4(out[g], x[g], zinv);
+    }
+    Hacl_Impl_Curve25519_Vec256_store_x4(out[0U], x[0U], inv);
+  }
+}
+
+void Hacl_Curve25519_scalarmult_x4(uint8_t *mypublic[4], uint8_t *secret[4], uint8_t *basepoint[4])
+{
+  if (Hacl_Curve25519_Vec256_is_supported())
+    Hacl_Impl_Curve25519_Vec256_scalarmult_x4(mypublic, secret, basepoint);
+  else if (Hacl_Curve25519_64_is_supported())
+    Hacl_Curve25519_64_scalarmult_batch(mypublic, secret, basepoint, 4U);
+  else
+    for (uint32_t l = 0U; l < 4U; l++)
+      Hacl_Curve25519_crypto_scalarmult(mypublic[l], secret[l], basepoint[l]);
+}
+
+void
+Hacl_Curve25519_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+)
+{
+  if (Hacl_Curve25519_Vec256_is_supported())
+    Hacl_Impl_Curve25519_Vec256_scalarmult_batch(mypublic, secret, basepoint, n);
+  else if (Hacl_Curve25519_64_is_supported())
+    Hacl_Curve25519_64_scalarmult_batch(mypublic, secret, basepoint, n);
+  else
+    for (uint32_t i = 0U; i < n; i++)
+      Hacl_Curve25519_crypto_scalarmult(mypublic[i], secret[i], basepoint[i]);
+}
+
+#else
+
+bool Hacl_Curve25519_Vec256_is_supported(void)
+{
+  return false;
+}
+
+void Hacl_Curve25519_scalarmult_x4(uint8_t *mypublic[4], uint8_t *secret[4], uint8_t *basepoint[4])
+{
+  for (uint32_t l = 0U; l < 4U; l++)
+    Hacl_Curve25519_crypto_scalarmult(mypublic[l], secret[l], basepoint[l]);
+}
+
+void
+Hacl_Curve25519_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+)
+{
+  if (Hacl_Curve25519_64_is_supported())
+    Hacl_Curve25519_64_scalarmult_batch(mypublic, secret, basepoint, n);
+  else
+    for (uint32_t i = 0U; i < n; i++)
+      Hacl_Curve25519_crypto_scalarmult(mypublic[i], secret[i], basepoint[i]);
+}
+
+#endif
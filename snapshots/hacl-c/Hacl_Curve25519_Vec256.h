@@ -0,0 +1,68 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Curve25519_Vec256_H
+#define __Hacl_Curve25519_Vec256_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* Four independent X25519 scalar multiplications with AVX2 (unverified).
+ *
+ * Each 64-bit lane of a vector holds one operation: field elements use ten
+ * 25.5-bit limbs (as in ref10), so limb products are vpmuludq, and the four
+ * Montgomery ladders, including the final inversion, run in lock step. The
+ * conditional swaps use per-lane masks and every lane executes the same
+ * instructions, so timing does not depend on any of the secrets.
+ *
+ * Without AVX2 (checked at runtime, including OS support for the YMM
+ * state) the four operations go to the MULX/ADX backend as one batch
+ * (Hacl_Curve25519_64_scalarmult_batch) or, failing that, through
+ * Hacl_Curve25519_crypto_scalarmult one after the other. Results are
+ * identical either way. */
+
+/* True if Hacl_Curve25519_scalarmult_x4 takes the AVX2 path */
+bool Hacl_Curve25519_Vec256_is_supported(void);
+
+/* mypublic[l] = secret[l] * basepoint[l] for l = 0..3; same conventions as
+   Hacl_Curve25519_crypto_scalarmult */
+void Hacl_Curve25519_scalarmult_x4(uint8_t *mypublic[4], uint8_t *secret[4], uint8_t *basepoint[4]);
+
+/* mypublic[i] = secret[i] * basepoint[i] for i < n, with the final
+ * inversions batched (Montgomery's trick): the ladders stop at projective
+ * (x : z), every z of up to 32 operations is inverted at once with one
+ * inversion and 3 (n - 1) multiplications, and points at infinity are
+ * handled in constant time. With AVX2 the ladders run four at a time and
+ * the trick applies lane by lane across groups; otherwise the MULX/ADX
+ * backend (Hacl_Curve25519_64_scalarmult_batch) or, failing that, serial
+ * calls are used. mypublic[i] may alias secret[i] or basepoint[i], but not
+ * the inputs of another operation. */
+void
+Hacl_Curve25519_scalarmult_batch(
+  uint8_t **mypublic,
+  uint8_t **secret,
+  uint8_t **basepoint,
+  uint32_t n
+);
+
+#endif
@@ -0,0 +1,300 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Cpu_Features.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Poly1305_64.h"
+#include "Hacl_Poly1305_Vec256.h"
+#include "Hacl_SHA2_256.h"
+#include "Hacl_SHA2_256_SHANI.h"
+#include "Hacl_SHA2_State.h"
+#include "Hacl_Curve25519.h"
+#include "Hacl_Curve25519_64.h"
+
+/* Hacl_Poly1305_32.h cannot be included next to Hacl_Poly1305_64.h (both
+   define the Hacl_Bignum limb types) */
+extern void
+Hacl_Poly1305_32_crypto_onetimeauth(
+  uint8_t *output,
+  uint8_t *input,
+  uint64_t len1,
+  uint8_t *k1
+);
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#define HACL_DISPATCH_X86 1
+#else
+#define HACL_DISPATCH_X86 0
+#endif
+
+/* Selections start at -1 (not computed yet). Threads may compute them
+   concurrently: they all store the same value. */
+#if defined(__GNUC__) || defined(__clang__)
+#define HACL_DISPATCH_LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define HACL_DISPATCH_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+#else
+#define HACL_DISPATCH_LOAD(x) (x)
+#define HACL_DISPATCH_STORE(x, v) ((x) = (v))
+#endif
+
+/* ChaCha20 */
+
+static const Hacl_Dispatch_chacha20_t Hacl_Dispatch_chacha20_impls[4U] = {
+  Hacl_Chacha20_chacha20,
+  Hacl_Chacha20_Vec128_chacha20,
+  Hacl_Chacha20_Vec256_chacha20,
+  Hacl_Chacha20_Vec512_chacha20
+};
+
+static int32_t Hacl_Dispatch_chacha20_selected = -1;
+
+bool Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_chacha20_impl impl)
+{
+  switch (impl) {
+    case Hacl_Dispatch_Chacha20_Scalar:
+      return true;
+#if HACL_DISPATCH_X86
+    case Hacl_Dispatch_Chacha20_Vec128:
+      return Hacl_Cpu_Features_has(HACL_CPU_SSSE3);
+    case Hacl_Dispatch_Chacha20_Vec256:
+      return Hacl_Cpu_Features_has(HACL_CPU_AVX2);
+    case Hacl_Dispatch_Chacha20_Vec512:
+      return Hacl_Cpu_Features_has(HACL_CPU_AVX2 | HACL_CPU_AVX512F);
+#else
+    /* Vec256 and Vec512 would only forward to Vec128 */
+    case Hacl_Dispatch_Chacha20_Vec128:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+static Hacl_Dispatch_chacha20_impl Hacl_Dispatch_chacha20_default(void)
+{
+  if (Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_Chacha20_Vec512))
+    return Hacl_Dispatch_Chacha20_Vec512;
+  if (Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_Chacha20_Vec256))
+    return Hacl_Dispatch_Chacha20_Vec256;
+  if (Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_Chacha20_Vec128))
+    return Hacl_Dispatch_Chacha20_Vec128;
+  return Hacl_Dispatch_Chacha20_Scalar;
+}
+
+Hacl_Dispatch_chacha20_impl Hacl_Dispatch_chacha20_get(void)
+{
+  int32_t impl = HACL_DISPATCH_LOAD(Hacl_Dispatch_chacha20_selected);
+  if (impl == -1) {
+    impl = (int32_t)Hacl_Dispatch_chacha20_default();
+    HACL_DISPATCH_STORE(Hacl_Dispatch_chacha20_selected, impl);
+  }
+  return (Hacl_Dispatch_chacha20_impl)impl;
+}
+
+bool Hacl_Dispatch_chacha20_set(Hacl_Dispatch_chacha20_impl impl)
+{
+  if (!Hacl_Dispatch_chacha20_is_supported(impl))
+    return false;
+  HACL_DISPATCH_STORE(Hacl_Dispatch_chacha20_selected, (int32_t)impl);
+  return true;
+}
+
+Hacl_Dispatch_chacha20_t Hacl_Dispatch_chacha20_lookup(Hacl_Dispatch_chacha20_impl impl)
+{
+  if ((uint32_t)impl > (uint32_t)Hacl_Dispatch_Chacha20_Vec512)
+    return Hacl_Chacha20_chacha20;
+  return Hacl_Dispatch_chacha20_impls[impl];
+}
+
+void
+Hacl_Dispatch_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+)
+{
+  Hacl_Dispatch_chacha20_impls[Hacl_Dispatch_chacha20_get()](output, plain, len, k, n1, ctr);
+}
+
+/* Poly1305: AVX2 if available, otherwise the 64-bit code (radix 2^44,
+   128-bit products) wherever the target has native 64-bit multiplication */
+
+typedef void
+(*Hacl_Dispatch_poly1305_t)(uint8_t *output, uint8_t *input, uint64_t len1, uint8_t *k1);
+
+static const Hacl_Dispatch_poly1305_t Hacl_Dispatch_poly1305_impls[3U] = {
+  Hacl_Poly1305_32_crypto_onetimeauth,
+  Hacl_Poly1305_64_crypto_onetimeauth,
+  Hacl_Poly1305_Vec256_crypto_onetimeauth
+};
+
+static int32_t Hacl_Dispatch_poly1305_selected = -1;
+
+bool Hacl_Dispatch_poly1305_is_supported(Hacl_Dispatch_poly1305_impl impl)
+{
+  switch (impl) {
+    case Hacl_Dispatch_Poly1305_32:
+    case Hacl_Dispatch_Poly1305_64:
+      return true;
+#if HACL_DISPATCH_X86
+    case Hacl_Dispatch_Poly1305_Vec256:
+      return Hacl_Cpu_Features_has(HACL_CPU_AVX2);
+#endif
+    default:
+      return false;
+  }
+}
+
+Hacl_Dispatch_poly1305_impl Hacl_Dispatch_poly1305_get(void)
+{
+  int32_t impl = HACL_DISPATCH_LOAD(Hacl_Dispatch_poly1305_selected);
+  if (impl == -1) {
+    if (Hacl_Dispatch_poly1305_is_supported(Hacl_Dispatch_Poly1305_Vec256))
+      impl = (int32_t)Hacl_Dispatch_Poly1305_Vec256;
+    else
+#if UINTPTR_MAX > 0xffffffffU
+      impl = (int32_t)Hacl_Dispatch_Poly1305_64;
+#else
+      impl = (int32_t)Hacl_Dispatch_Poly1305_32;
+#endif
+    HACL_DISPATCH_STORE(Hacl_Dispatch_poly1305_selected, impl);
+  }
+  return (Hacl_Dispatch_poly1305_impl)impl;
+}
+
+bool Hacl_Dispatch_poly1305_set(Hacl_Dispatch_poly1305_impl impl)
+{
+  if (!Hacl_Dispatch_poly1305_is_supported(impl))
+    return false;
+  HACL_DISPATCH_STORE(Hacl_Dispatch_poly1305_selected, (int32_t)impl);
+  return true;
+}
+
+void Hacl_Dispatch_poly1305(uint8_t *output, uint8_t *input, uint64_t len1, uint8_t *k1)
+{
+  Hacl_Dispatch_poly1305_impls[Hacl_Dispatch_poly1305_get()](output, input, len1, k1);
+}
+
+/* SHA-256: the callers branch on Hacl_SHA2_256_SHANI_is_supported, which
+   the selection switches on and off. The verified Hacl_SHA2_256 is left
+   unchanged: Hacl_Dispatch_sha256 goes through Hacl_SHA2_State instead. */
+
+bool Hacl_Dispatch_sha256_is_supported(Hacl_Dispatch_sha256_impl impl)
+{
+  switch (impl) {
+    case Hacl_Dispatch_SHA256_Portable:
+      return true;
+#if HACL_DISPATCH_X86
+    case Hacl_Dispatch_SHA256_SHANI:
+      return Hacl_Cpu_Features_has(HACL_CPU_SHA | HACL_CPU_SSSE3 | HACL_CPU_SSE41);
+#endif
+    default:
+      return false;
+  }
+}
+
+Hacl_Dispatch_sha256_impl Hacl_Dispatch_sha256_get(void)
+{
+  if (Hacl_SHA2_256_SHANI_is_supported())
+    return Hacl_Dispatch_SHA256_SHANI;
+  return Hacl_Dispatch_SHA256_Portable;
+}
+
+bool Hacl_Dispatch_sha256_set(Hacl_Dispatch_sha256_impl impl)
+{
+  if (!Hacl_Dispatch_sha256_is_supported(impl))
+    return false;
+  Hacl_SHA2_256_SHANI_set_enabled(impl == Hacl_Dispatch_SHA256_SHANI);
+  return true;
+}
+
+/* Curve25519: the selection is the enable flag of Hacl_Curve25519_64, which
+   Hacl_Dispatch_curve25519 reads through Hacl_Curve25519_64_is_supported.
+   The verified Hacl_Curve25519 is left unchanged. */
+
+bool Hacl_Dispatch_curve25519_is_supported(Hacl_Dispatch_curve25519_impl impl)
+{
+  switch (impl) {
+    case Hacl_Dispatch_Curve25519_51:
+      return true;
+#if HACL_DISPATCH_X86 && defined(__x86_64__)
+    case Hacl_Dispatch_Curve25519_64:
+      return Hacl_Cpu_Features_has(HACL_CPU_BMI2 | HACL_CPU_ADX);
+#endif
+    default:
+      return false;
+  }
+}
+
+Hacl_Dispatch_curve25519_impl Hacl_Dispatch_curve25519_get(void)
+{
+  if (Hacl_Curve25519_64_is_supported())
+    return Hacl_Dispatch_Curve25519_64;
+  return Hacl_Dispatch_Curve25519_51;
+}
+
+bool Hacl_Dispatch_curve25519_set(Hacl_Dispatch_curve25519_impl impl)
+{
+  if (!Hacl_Dispatch_curve25519_is_supported(impl))
+    return false;
+  Hacl_Curve25519_64_set_enabled(impl == Hacl_Dispatch_Curve25519_64);
+  return true;
+}
+
+void Hacl_Dispatch_sha256(uint8_t *hash1, uint8_t *input, uint32_t len)
+{
+  if (Hacl_SHA2_256_SHANI_is_supported())
+  {
+    Hacl_SHA2_State_sha256 st;
+    Hacl_SHA2_State_sha256_init(&st);
+    Hacl_SHA2_State_sha256_update_multi(&st, input, len / 64U);
+    Hacl_SHA2_State_sha256_update_last(&st, input + len / 64U * 64U, len % 64U);
+    Hacl_SHA2_State_sha256_finish(&st, hash1);
+  }
+  else
+    Hacl_SHA2_256_hash(hash1, input, len);
+}
+
+void Hacl_Dispatch_curve25519(uint8_t *mypublic, uint8_t *secret, uint8_t *basepoint)
+{
+  if (Hacl_Curve25519_64_is_supported())
+    Hacl_Curve25519_64_crypto_scalarmult(mypublic, secret, basepoint);
+  else
+    Hacl_Curve25519_crypto_scalarmult(mypublic, secret, basepoint);
+}
+
+void Hacl_Dispatch_reset(void)
+{
+  HACL_DISPATCH_STORE(Hacl_Dispatch_chacha20_selected, -1);
+  HACL_DISPATCH_STORE(Hacl_Dispatch_poly1305_selected, -1);
+  Hacl_SHA2_256_SHANI_set_enabled(true);
+  Hacl_Curve25519_64_set_enabled(true);
+}
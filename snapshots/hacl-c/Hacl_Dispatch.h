@@ -0,0 +1,148 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Dispatch_H
+#define __Hacl_Dispatch_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* Runtime backend selection (unverified).
+ *
+ * Each primitive is bound to the fastest backend the host can run, as
+ * reported by Hacl_Cpu_Features. The SIMD backends are compiled with their
+ * own target options, so a single binary built for a baseline x86-64
+ * carries all of them. The selection can be queried and overridden, e.g.
+ * to benchmark one backend against another; an override that the host
+ * cannot run is refused.
+ *
+ * Backends that are not x86-specific (scalar ChaCha20, Vec128 on NEON,
+ * both Poly1305 implementations, portable SHA-256, 5x51-bit Curve25519)
+ * are always supported. */
+
+typedef enum
+{
+  Hacl_Dispatch_Chacha20_Scalar,
+  Hacl_Dispatch_Chacha20_Vec128,
+  Hacl_Dispatch_Chacha20_Vec256,
+  Hacl_Dispatch_Chacha20_Vec512
+}
+Hacl_Dispatch_chacha20_impl;
+
+typedef enum
+{
+  Hacl_Dispatch_Poly1305_32,
+  Hacl_Dispatch_Poly1305_64,
+  Hacl_Dispatch_Poly1305_Vec256
+}
+Hacl_Dispatch_poly1305_impl;
+
+/* SHA-NI only covers SHA-256; SHA-384/512 have a single backend */
+typedef enum
+{
+  Hacl_Dispatch_SHA256_Portable,
+  Hacl_Dispatch_SHA256_SHANI
+}
+Hacl_Dispatch_sha256_impl;
+
+/* Radix-2^64 Curve25519 needs MULX (BMI2) and ADX, on x86-64 */
+typedef enum
+{
+  Hacl_Dispatch_Curve25519_51,
+  Hacl_Dispatch_Curve25519_64
+}
+Hacl_Dispatch_curve25519_impl;
+
+/* Interface of Hacl_Chacha20_chacha20, shared by every ChaCha20 backend */
+typedef void
+(*Hacl_Dispatch_chacha20_t)(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+);
+
+bool Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_chacha20_impl impl);
+
+Hacl_Dispatch_chacha20_impl Hacl_Dispatch_chacha20_get(void);
+
+/* Returns false, leaving the selection unchanged, if impl is not supported */
+bool Hacl_Dispatch_chacha20_set(Hacl_Dispatch_chacha20_impl impl);
+
+/* The backend for impl, whether or not it is selected or supported: callers
+   that keep an impl past Hacl_Dispatch_chacha20_get call through this. A
+   value outside the enumeration gets the scalar backend. */
+Hacl_Dispatch_chacha20_t Hacl_Dispatch_chacha20_lookup(Hacl_Dispatch_chacha20_impl impl);
+
+bool Hacl_Dispatch_poly1305_is_supported(Hacl_Dispatch_poly1305_impl impl);
+
+Hacl_Dispatch_poly1305_impl Hacl_Dispatch_poly1305_get(void);
+
+bool Hacl_Dispatch_poly1305_set(Hacl_Dispatch_poly1305_impl impl);
+
+bool Hacl_Dispatch_sha256_is_supported(Hacl_Dispatch_sha256_impl impl);
+
+/* Applies to Hacl_Dispatch_sha256 and the unverified modules that branch the
+   same way (Hacl_SHA2_State and those built on it), through
+   Hacl_SHA2_256_SHANI_set_enabled; Hacl_SHA2_256 is always the portable
+   code */
+Hacl_Dispatch_sha256_impl Hacl_Dispatch_sha256_get(void);
+
+bool Hacl_Dispatch_sha256_set(Hacl_Dispatch_sha256_impl impl);
+
+bool Hacl_Dispatch_curve25519_is_supported(Hacl_Dispatch_curve25519_impl impl);
+
+/* Applies to Hacl_Dispatch_curve25519 and the unverified code that branches
+   the same way (haclnacl, Hacl_Box_Cache, Hacl_Curve25519_Vec256), through
+   Hacl_Curve25519_64_set_enabled; Hacl_Curve25519_crypto_scalarmult is
+   always the 5x51-bit code */
+Hacl_Dispatch_curve25519_impl Hacl_Dispatch_curve25519_get(void);
+
+bool Hacl_Dispatch_curve25519_set(Hacl_Dispatch_curve25519_impl impl);
+
+/* Restores the default (fastest supported) selection for every primitive */
+void Hacl_Dispatch_reset(void);
+
+/* Same interface as Hacl_Chacha20_chacha20 */
+void
+Hacl_Dispatch_chacha20(
+  uint8_t *output,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *k,
+  uint8_t *n1,
+  uint32_t ctr
+);
+
+/* Same interface as Hacl_Poly1305_64_crypto_onetimeauth */
+void Hacl_Dispatch_poly1305(uint8_t *output, uint8_t *input, uint64_t len1, uint8_t *k1);
+
+/* Same interface as Hacl_SHA2_256_hash */
+void Hacl_Dispatch_sha256(uint8_t *hash1, uint8_t *input, uint32_t len);
+
+/* Same interface as Hacl_Curve25519_crypto_scalarmult */
+void Hacl_Dispatch_curve25519(uint8_t *mypublic, uint8_t *secret, uint8_t *basepoint);
+
+#endif
@@ -0,0 +1,177 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_HMAC_SHA2.h"
+#include "Hacl_Util.h"
+
+static void
+Hacl_HMAC_SHA2_sha256_hash(uint8_t *hash1, uint8_t *data, uint32_t len)
+{
+  Hacl_SHA2_State_sha256 st;
+  uint32_t n1 = len / 64U;
+  Hacl_SHA2_State_sha256_init(&st);
+  Hacl_SHA2_State_sha256_update_multi(&st, data, n1);
+  Hacl_SHA2_State_sha256_update_last(&st, data + n1 * 64U, len % 64U);
+  Hacl_SHA2_State_sha256_finish(&st, hash1);
+}
+
+void Hacl_HMAC_SHA2_sha256_init_key(Hacl_HMAC_SHA2_key256 *k, uint8_t *key, uint32_t keylen)
+{
+  uint8_t kb[64U] = { 0U };
+  uint8_t pad[64U];
+  if (keylen > 64U)
+    Hacl_HMAC_SHA2_sha256_hash(kb, key, keylen);
+  else
+    memcpy(kb, key, keylen);
+  for (uint32_t i = 0U; i < 64U; i++)
+    pad[i] = kb[i] ^ (uint8_t)0x36U;
+  Hacl_SHA2_State_sha256_init(&k->inner);
+  Hacl_SHA2_State_sha256_update_multi(&k->inner, pad, 1U);
+  for (uint32_t i = 0U; i < 64U; i++)
+    pad[i] = kb[i] ^ (uint8_t)0x5cU;
+  Hacl_SHA2_State_sha256_init(&k->outer);
+  Hacl_SHA2_State_sha256_update_multi(&k->outer, pad, 1U);
+  Hacl_Util_wipe(kb, 64U);
+  Hacl_Util_wipe(pad, 64U);
+}
+
+void
+Hacl_HMAC_SHA2_sha256_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key256 *k,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  uint8_t ih[32U];
+  uint32_t n1 = datalen / 64U;
+  Hacl_SHA2_State_sha256 st = k->inner;
+  Hacl_SHA2_State_sha256_update_multi(&st, data, n1);
+  Hacl_SHA2_State_sha256_update_last(&st, data + n1 * 64U, datalen % 64U);
+  Hacl_SHA2_State_sha256_finish(&st, ih);
+  st = k->outer;
+  Hacl_SHA2_State_sha256_update_last(&st, ih, 32U);
+  Hacl_SHA2_State_sha256_finish(&st, mac);
+}
+
+/* SHA-384 and SHA-512 share the block function and only differ by their
+   IV (init) and digest truncation (finish) */
+typedef void (*Hacl_HMAC_SHA2_sha512_init_t)(Hacl_SHA2_State_sha512 *st);
+
+typedef void (*Hacl_HMAC_SHA2_sha512_finish_t)(Hacl_SHA2_State_sha512 *st, uint8_t *hash1);
+
+static void
+Hacl_HMAC_SHA2_sha512_init_key_(
+  Hacl_HMAC_SHA2_sha512_init_t init,
+  Hacl_HMAC_SHA2_sha512_finish_t finish,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *key,
+  uint32_t keylen
+)
+{
+  uint8_t kb[128U] = { 0U };
+  uint8_t pad[128U];
+  if (keylen > 128U)
+  {
+    Hacl_SHA2_State_sha512 st;
+    uint32_t n1 = keylen / 128U;
+    init(&st);
+    Hacl_SHA2_State_sha512_update_multi(&st, key, n1);
+    Hacl_SHA2_State_sha512_update_last(&st, key + n1 * 128U, keylen % 128U);
+    finish(&st, kb);
+  }
+  else
+    memcpy(kb, key, keylen);
+  for (uint32_t i = 0U; i < 128U; i++)
+    pad[i] = kb[i] ^ (uint8_t)0x36U;
+  init(&k->inner);
+  Hacl_SHA2_State_sha512_update_multi(&k->inner, pad, 1U);
+  for (uint32_t i = 0U; i < 128U; i++)
+    pad[i] = kb[i] ^ (uint8_t)0x5cU;
+  init(&k->outer);
+  Hacl_SHA2_State_sha512_update_multi(&k->outer, pad, 1U);
+  Hacl_Util_wipe(kb, 128U);
+  Hacl_Util_wipe(pad, 128U);
+}
+
+static void
+Hacl_HMAC_SHA2_sha512_mac_(
+  Hacl_HMAC_SHA2_sha512_finish_t finish,
+  uint32_t hash_len,
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  uint8_t ih[64U];
+  uint32_t n1 = datalen / 128U;
+  Hacl_SHA2_State_sha512 st = k->inner;
+  Hacl_SHA2_State_sha512_update_multi(&st, data, n1);
+  Hacl_SHA2_State_sha512_update_last(&st, data + n1 * 128U, datalen % 128U);
+  finish(&st, ih);
+  st = k->outer;
+  Hacl_SHA2_State_sha512_update_last(&st, ih, hash_len);
+  finish(&st, mac);
+}
+
+void Hacl_HMAC_SHA2_sha384_init_key(Hacl_HMAC_SHA2_key512 *k, uint8_t *key, uint32_t keylen)
+{
+  Hacl_HMAC_SHA2_sha512_init_key_(Hacl_SHA2_State_sha384_init,
+    Hacl_SHA2_State_sha384_finish,
+    k,
+    key,
+    keylen);
+}
+
+void
+Hacl_HMAC_SHA2_sha384_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  Hacl_HMAC_SHA2_sha512_mac_(Hacl_SHA2_State_sha384_finish, 48U, mac, k, data, datalen);
+}
+
+void Hacl_HMAC_SHA2_sha512_init_key(Hacl_HMAC_SHA2_key512 *k, uint8_t *key, uint32_t keylen)
+{
+  Hacl_HMAC_SHA2_sha512_init_key_(Hacl_SHA2_State_sha512_init,
+    Hacl_SHA2_State_sha512_finish,
+    k,
+    key,
+    keylen);
+}
+
+void
+Hacl_HMAC_SHA2_sha512_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  Hacl_HMAC_SHA2_sha512_mac_(Hacl_SHA2_State_sha512_finish, 64U, mac, k, data, datalen);
+}
@@ -0,0 +1,87 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_HMAC_SHA2_H
+#define __Hacl_HMAC_SHA2_H
+
+#include <inttypes.h>
+
+#include "Hacl_SHA2_State.h"
+
+/* Precomputed-key HMAC-SHA2 (unverified).
+ *
+ * Hacl_HMAC_SHA2_256_hmac compresses the key XOR ipad and key XOR opad
+ * blocks again for every message. A key object stores the inner and outer
+ * chaining states reached after those two blocks, so that a MAC under an
+ * expanded key only costs the message blocks plus one finalization block
+ * for the outer hash. Tags are identical to Hacl_HMAC_SHA2_256_hmac and
+ * RFC 2104 / RFC 4231.
+ *
+ * A key object is as sensitive as the key itself. */
+
+typedef struct
+{
+  Hacl_SHA2_State_sha256 inner;
+  Hacl_SHA2_State_sha256 outer;
+}
+Hacl_HMAC_SHA2_key256;
+
+/* Shared by HMAC-SHA-384 and HMAC-SHA-512 */
+typedef struct
+{
+  Hacl_SHA2_State_sha512 inner;
+  Hacl_SHA2_State_sha512 outer;
+}
+Hacl_HMAC_SHA2_key512;
+
+void Hacl_HMAC_SHA2_sha256_init_key(Hacl_HMAC_SHA2_key256 *k, uint8_t *key, uint32_t keylen);
+
+void
+Hacl_HMAC_SHA2_sha256_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key256 *k,
+  uint8_t *data,
+  uint32_t datalen
+);
+
+void Hacl_HMAC_SHA2_sha384_init_key(Hacl_HMAC_SHA2_key512 *k, uint8_t *key, uint32_t keylen);
+
+void
+Hacl_HMAC_SHA2_sha384_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *data,
+  uint32_t datalen
+);
+
+void Hacl_HMAC_SHA2_sha512_init_key(Hacl_HMAC_SHA2_key512 *k, uint8_t *key, uint32_t keylen);
+
+void
+Hacl_HMAC_SHA2_sha512_mac(
+  uint8_t *mac,
+  Hacl_HMAC_SHA2_key512 *k,
+  uint8_t *data,
+  uint32_t datalen
+);
+
+#endif
@@ -0,0 +1,631 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_PBKDF2_SHA2.h"
+#include "Hacl_HMAC_SHA2.h"
+#include "Hacl_SHA2_256_Multi.h"
+#include "Hacl_SHA2_256_SHANI.h"
+#include "Hacl_Util.h"
+
+/* One output block T_i = U_1 ^ ... ^ U_c of one derivation. Jobs carry a
+   copy of their key so that a batch can mix blocks of different passwords. */
+typedef struct
+{
+  Hacl_HMAC_SHA2_key256 key;
+  uint8_t *out;
+  uint32_t outlen;
+  uint32_t u[8U];
+}
+Hacl_PBKDF2_SHA2_job256;
+
+typedef struct
+{
+  Hacl_HMAC_SHA2_key512 key;
+  uint8_t *out;
+  uint32_t outlen;
+  uint64_t u[8U];
+}
+Hacl_PBKDF2_SHA2_job512;
+
+#define HACL_PBKDF2_SHA2_MAX_JOBS HACL_SHA2_256_MULTI_MAX_LANES
+
+/* U_1 = HMAC(P, S || INT(i)): the inner hash runs from the precomputed
+   inner state over the salt, then the big-endian block index */
+static void
+Hacl_PBKDF2_SHA2_sha256_first(Hacl_PBKDF2_SHA2_job256 *job, uint8_t *salt, uint32_t saltlen, uint32_t i)
+{
+  uint8_t last[68U];
+  uint8_t ih[32U], u[32U];
+  uint32_t n1 = saltlen / 64U;
+  uint32_t r = saltlen % 64U;
+  Hacl_SHA2_State_sha256 st = job->key.inner;
+  Hacl_SHA2_State_sha256_update_multi(&st, salt, n1);
+  memcpy(last, salt + n1 * 64U, r);
+  store32_be(last + r, i);
+  if (r + 4U >= 64U) {
+    Hacl_SHA2_State_sha256_update_multi(&st, last, 1U);
+    Hacl_SHA2_State_sha256_update_last(&st, last + 64U, r + 4U - 64U);
+  } else
+    Hacl_SHA2_State_sha256_update_last(&st, last, r + 4U);
+  Hacl_SHA2_State_sha256_finish(&st, ih);
+  st = job->key.outer;
+  Hacl_SHA2_State_sha256_update_last(&st, ih, 32U);
+  Hacl_SHA2_State_sha256_finish(&st, u);
+  for (uint32_t j = 0U; j < 8U; j++)
+    job->u[j] = load32_be(u + 4U * j);
+}
+
+/* Iterations 2..c on the lanes of the multi-buffer compression. Every
+   message is the 32-byte previous digest after one key block, so words
+   8..15 of each block are the same constant padding for all lanes. */
+static void
+Hacl_PBKDF2_SHA2_sha256_iterate_multi(Hacl_PBKDF2_SHA2_job256 *jobs, uint32_t k, uint32_t iterations)
+{
+  uint32_t lanes = Hacl_SHA2_256_Multi_lanes;
+  uint32_t ist[8U * HACL_SHA2_256_MULTI_MAX_LANES] = { 0U };
+  uint32_t ost[8U * HACL_SHA2_256_MULTI_MAX_LANES] = { 0U };
+  uint32_t t[8U * HACL_SHA2_256_MULTI_MAX_LANES] = { 0U };
+  uint32_t h[8U * HACL_SHA2_256_MULTI_MAX_LANES];
+  uint32_t ws[16U * HACL_SHA2_256_MULTI_MAX_LANES] = { 0U };
+  for (uint32_t l = 0U; l < k; l++)
+    for (uint32_t j = 0U; j < 8U; j++) {
+      ist[lanes * j + l] = jobs[l].key.inner.hash_w[j];
+      ost[lanes * j + l] = jobs[l].key.outer.hash_w[j];
+      ws[lanes * j + l] = jobs[l].u[j];
+      t[lanes * j + l] = jobs[l].u[j];
+    }
+  for (uint32_t l = 0U; l < lanes; l++) {
+    ws[lanes * 8U + l] = 0x80000000U;
+    ws[lanes * 15U + l] = 768U;
+  }
+  for (uint32_t c = 1U; c < iterations; c++) {
+    memcpy(h, ist, sizeof h);
+    Hacl_SHA2_256_Multi_compress_interleaved(h, ws);
+    memcpy(ws, h, 8U * lanes * sizeof h[0U]);
+    memcpy(h, ost, sizeof h);
+    Hacl_SHA2_256_Multi_compress_interleaved(h, ws);
+    memcpy(ws, h, 8U * lanes * sizeof h[0U]);
+    for (uint32_t j = 0U; j < 8U * lanes; j++)
+      t[j] ^= h[j];
+  }
+  for (uint32_t l = 0U; l < k; l++)
+    for (uint32_t j = 0U; j < 8U; j++)
+      jobs[l].u[j] = t[lanes * j + l];
+  Hacl_Util_wipe(ist, sizeof ist);
+  Hacl_Util_wipe(ost, sizeof ost);
+  Hacl_Util_wipe(t, sizeof t);
+  Hacl_Util_wipe(h, sizeof h);
+  Hacl_Util_wipe(ws, sizeof ws);
+}
+
+/* Iterations 2..c with the SHA extensions, two chains at a time. A lone
+   chain is paired with a dummy copy of itself. */
+static void
+Hacl_PBKDF2_SHA2_sha256_iterate_shani(Hacl_PBKDF2_SHA2_job256 *jobs, uint32_t k, uint32_t iterations)
+{
+  for (uint32_t l = 0U; l < k; l += 2U) {
+    Hacl_PBKDF2_SHA2_job256 *job[2U] = { jobs + l, jobs + (l + 1U < k ? l + 1U : l) };
+    uint8_t blocks[2U][64U] = { { 0U } };
+    uint32_t h[2U][8U], t[2U][8U];
+    uint32_t *hp[2U] = { h[0U], h[1U] };
+    uint8_t *bp[2U] = { blocks[0U], blocks[1U] };
+    for (uint32_t s = 0U; s < 2U; s++) {
+      blocks[s][32U] = 0x80U;
+      blocks[s][62U] = 0x03U;
+      memcpy(t[s], job[s]->u, sizeof t[s]);
+      memcpy(h[s], job[s]->u, sizeof h[s]);
+    }
+    for (uint32_t c = 1U; c < iterations; c++) {
+      for (uint32_t s = 0U; s < 2U; s++) {
+        for (uint32_t j = 0U; j < 8U; j++)
+          store32_be(blocks[s] + 4U * j, h[s][j]);
+        memcpy(h[s], job[s]->key.inner.hash_w, sizeof h[s]);
+      }
+      Hacl_SHA2_256_SHANI_update_x2(hp, bp);
+      for (uint32_t s = 0U; s < 2U; s++) {
+        for (uint32_t j = 0U; j < 8U; j++)
+          store32_be(blocks[s] + 4U * j, h[s][j]);
+        memcpy(h[s], job[s]->key.outer.hash_w, sizeof h[s]);
+      }
+      Hacl_SHA2_256_SHANI_update_x2(hp, bp);
+      for (uint32_t s = 0U; s < 2U; s++)
+        for (uint32_t j = 0U; j < 8U; j++)
+          t[s][j] ^= h[s][j];
+    }
+    memcpy(job[1U]->u, t[1U], sizeof t[1U]);
+    memcpy(job[0U]->u, t[0U], sizeof t[0U]);
+    Hacl_Util_wipe(blocks, sizeof blocks);
+    Hacl_Util_wipe(h, sizeof h);
+    Hacl_Util_wipe(t, sizeof t);
+  }
+}
+
+/* A lone chain without the SHA extensions: one lane of the multi-buffer
+   compression would leave the others idle, the scalar one is faster */
+static void Hacl_PBKDF2_SHA2_sha256_iterate_scalar(Hacl_PBKDF2_SHA2_job256 *job, uint32_t iterations)
+{
+  uint8_t block[64U] = { 0U };
+  Hacl_SHA2_State_sha256 st;
+  uint32_t t[8U];
+  block[32U] = 0x80U;
+  block[62U] = 0x03U;
+  memcpy(t, job->u, sizeof t);
+  memcpy(st.hash_w, job->u, sizeof t);
+  for (uint32_t c = 1U; c < iterations; c++) {
+    for (uint32_t j = 0U; j < 8U; j++)
+      store32_be(block + 4U * j, st.hash_w[j]);
+    st = job->key.inner;
+    Hacl_SHA2_State_sha256_update_multi(&st, block, 1U);
+    for (uint32_t j = 0U; j < 8U; j++)
+      store32_be(block + 4U * j, st.hash_w[j]);
+    st = job->key.outer;
+    Hacl_SHA2_State_sha256_update_multi(&st, block, 1U);
+    for (uint32_t j = 0U; j < 8U; j++)
+      t[j] ^= st.hash_w[j];
+  }
+  memcpy(job->u, t, sizeof t);
+  Hacl_Util_wipe(block, sizeof block);
+  Hacl_Util_wipe(&st, sizeof st);
+  Hacl_Util_wipe(t, sizeof t);
+}
+
+static void
+Hacl_PBKDF2_SHA2_sha256_run(Hacl_PBKDF2_SHA2_job256 *jobs, uint32_t k, uint32_t iterations)
+{
+  uint8_t out[32U];
+  if (Hacl_SHA2_256_SHANI_is_supported())
+    Hacl_PBKDF2_SHA2_sha256_iterate_shani(jobs, k, iterations);
+  else if (k == 1U)
+    Hacl_PBKDF2_SHA2_sha256_iterate_scalar(jobs, iterations);
+  else
+    Hacl_PBKDF2_SHA2_sha256_iterate_multi(jobs, k, iterations);
+  for (uint32_t l = 0U; l < k; l++) {
+    for (uint32_t j = 0U; j < 8U; j++)
+      store32_be(out + 4U * j, jobs[l].u[j]);
+    memcpy(jobs[l].out, out, jobs[l].outlen);
+  }
+  Hacl_Util_wipe(out, 32U);
+}
+
+void
+Hacl_PBKDF2_SHA2_sha256_batch(
+  uint8_t **dk,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+)
+{
+  Hacl_PBKDF2_SHA2_job256 jobs[HACL_PBKDF2_SHA2_MAX_JOBS];
+  uint32_t lanes = Hacl_SHA2_256_SHANI_is_supported() ? 2U : Hacl_SHA2_256_Multi_lanes;
+  uint32_t k = 0U;
+  for (uint32_t d = 0U; d < n; d++) {
+    Hacl_HMAC_SHA2_key256 key;
+    Hacl_HMAC_SHA2_sha256_init_key(&key, password[d], passlen[d]);
+    for (uint32_t off = 0U, i = 1U; off < dklen; off += 32U, i++) {
+      jobs[k].key = key;
+      jobs[k].out = dk[d] + off;
+      jobs[k].outlen = dklen - off < 32U ? dklen - off : 32U;
+      Hacl_PBKDF2_SHA2_sha256_first(&jobs[k], salt[d], saltlen[d], i);
+      if (++k == lanes) {
+        Hacl_PBKDF2_SHA2_sha256_run(jobs, k, iterations);
+        k = 0U;
+      }
+    }
+    Hacl_Util_wipe(&key, sizeof key);
+  }
+  if (k > 0U)
+    Hacl_PBKDF2_SHA2_sha256_run(jobs, k, iterations);
+  Hacl_Util_wipe(jobs, sizeof jobs);
+}
+
+void
+Hacl_PBKDF2_SHA2_sha256(
+  uint8_t *dk,
+  uint32_t dklen,
+  uint8_t *password,
+  uint32_t passlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t iterations
+)
+{
+  Hacl_PBKDF2_SHA2_sha256_batch(&dk, dklen, &password, &passlen, &salt, &saltlen, iterations, 1U);
+}
+
+/* SHA-512 lane vectors: 4 lanes of 64-bit words with AVX2, one lane otherwise */
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define HACL_PBKDF2_SHA2_LANES512 4U
+
+typedef __m256i Hacl_PBKDF2_SHA2_vec512;
+
+#define Hacl_PBKDF2_SHA2_v512_add(a,b)    _mm256_add_epi64((a),(b))
+#define Hacl_PBKDF2_SHA2_v512_xor(a,b)    _mm256_xor_si256((a),(b))
+#define Hacl_PBKDF2_SHA2_v512_and(a,b)    _mm256_and_si256((a),(b))
+#define Hacl_PBKDF2_SHA2_v512_andnot(a,b) _mm256_andnot_si256((a),(b))
+#define Hacl_PBKDF2_SHA2_v512_set1(x)     _mm256_set1_epi64x((long long)(x))
+#define Hacl_PBKDF2_SHA2_v512_load(p)     _mm256_loadu_si256((const __m256i *)(p))
+#define Hacl_PBKDF2_SHA2_v512_store(p,v)  _mm256_storeu_si256((__m256i *)(p),(v))
+#define Hacl_PBKDF2_SHA2_v512_shr(a,n)    _mm256_srli_epi64((a),(n))
+#if defined(__AVX512VL__)
+#define Hacl_PBKDF2_SHA2_v512_rotr(a,n)   _mm256_ror_epi64((a),(n))
+#else
+#define Hacl_PBKDF2_SHA2_v512_rotr(a,n)   _mm256_or_si256(_mm256_srli_epi64((a),(n)), _mm256_slli_epi64((a),64-(n)))
+#endif
+
+#else
+
+#define HACL_PBKDF2_SHA2_LANES512 1U
+
+typedef uint64_t Hacl_PBKDF2_SHA2_vec512;
+
+#define Hacl_PBKDF2_SHA2_v512_add(a,b)    ((a) + (b))
+#define Hacl_PBKDF2_SHA2_v512_xor(a,b)    ((a) ^ (b))
+#define Hacl_PBKDF2_SHA2_v512_and(a,b)    ((a) & (b))
+#define Hacl_PBKDF2_SHA2_v512_andnot(a,b) (~(a) & (b))
+#define Hacl_PBKDF2_SHA2_v512_set1(x)     ((uint64_t)(x))
+#define Hacl_PBKDF2_SHA2_v512_load(p)     (*(p))
+#define Hacl_PBKDF2_SHA2_v512_store(p,v)  (*(p) = (v))
+#define Hacl_PBKDF2_SHA2_v512_shr(a,n)    ((a) >> (n))
+#define Hacl_PBKDF2_SHA2_v512_rotr(a,n)   ((a) >> (n) | (a) << (64U - (n)))
+
+#endif
+
+/* hash = compress(hash, U || padding) on every lane, where U is the 8-word
+   previous digest and the padding encodes a 192-byte message */
+static void
+Hacl_PBKDF2_SHA2_sha512_compress(Hacl_PBKDF2_SHA2_vec512 hash[8U], Hacl_PBKDF2_SHA2_vec512 u[8U])
+{
+  Hacl_PBKDF2_SHA2_vec512 ws[16U];
+  for (uint32_t i = 0U; i < 8U; i++)
+    ws[i] = u[i];
+  ws[8U] = Hacl_PBKDF2_SHA2_v512_set1(0x8000000000000000U);
+  for (uint32_t i = 9U; i < 15U; i++)
+    ws[i] = Hacl_PBKDF2_SHA2_v512_set1(0U);
+  ws[15U] = Hacl_PBKDF2_SHA2_v512_set1(1536U);
+  Hacl_PBKDF2_SHA2_vec512 a = hash[0U], b = hash[1U], c = hash[2U], d = hash[3U];
+  Hacl_PBKDF2_SHA2_vec512 e = hash[4U], f = hash[5U], g = hash[6U], h = hash[7U];
+  for (uint32_t i = 0U; i < 80U; i++) {
+    Hacl_PBKDF2_SHA2_vec512 wst;
+    if (i < 16U)
+      wst = ws[i];
+    else {
+      Hacl_PBKDF2_SHA2_vec512 t16 = ws[i & 15U];
+      Hacl_PBKDF2_SHA2_vec512 t15 = ws[(i - 15U) & 15U];
+      Hacl_PBKDF2_SHA2_vec512 t7 = ws[(i - 7U) & 15U];
+      Hacl_PBKDF2_SHA2_vec512 t2 = ws[(i - 2U) & 15U];
+      Hacl_PBKDF2_SHA2_vec512
+      s1 =
+        Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(t2, 19),
+          Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(t2, 61), Hacl_PBKDF2_SHA2_v512_shr(t2, 6)));
+      Hacl_PBKDF2_SHA2_vec512
+      s0 =
+        Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(t15, 1),
+          Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(t15, 8), Hacl_PBKDF2_SHA2_v512_shr(t15, 7)));
+      wst = Hacl_PBKDF2_SHA2_v512_add(Hacl_PBKDF2_SHA2_v512_add(s1, t7), Hacl_PBKDF2_SHA2_v512_add(s0, t16));
+      ws[i & 15U] = wst;
+    }
+    Hacl_PBKDF2_SHA2_vec512
+    sigma1 =
+      Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(e, 14),
+        Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(e, 18), Hacl_PBKDF2_SHA2_v512_rotr(e, 41)));
+    Hacl_PBKDF2_SHA2_vec512
+    ch = Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_and(e, f), Hacl_PBKDF2_SHA2_v512_andnot(e, g));
+    Hacl_PBKDF2_SHA2_vec512
+    t1 =
+      Hacl_PBKDF2_SHA2_v512_add(Hacl_PBKDF2_SHA2_v512_add(h, sigma1),
+        Hacl_PBKDF2_SHA2_v512_add(ch,
+          Hacl_PBKDF2_SHA2_v512_add(Hacl_PBKDF2_SHA2_v512_set1(Hacl_SHA2_State_k512[i]), wst)));
+    Hacl_PBKDF2_SHA2_vec512
+    sigma0 =
+      Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(a, 28),
+        Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_rotr(a, 34), Hacl_PBKDF2_SHA2_v512_rotr(a, 39)));
+    Hacl_PBKDF2_SHA2_vec512
+    maj =
+      Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_and(a, b),
+        Hacl_PBKDF2_SHA2_v512_xor(Hacl_PBKDF2_SHA2_v512_and(a, c), Hacl_PBKDF2_SHA2_v512_and(b, c)));
+    Hacl_PBKDF2_SHA2_vec512 t2 = Hacl_PBKDF2_SHA2_v512_add(sigma0, maj);
+    h = g;
+    g = f;
+    f = e;
+    e = Hacl_PBKDF2_SHA2_v512_add(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = Hacl_PBKDF2_SHA2_v512_add(t1, t2);
+  }
+  hash[0U] = Hacl_PBKDF2_SHA2_v512_add(hash[0U], a);
+  hash[1U] = Hacl_PBKDF2_SHA2_v512_add(hash[1U], b);
+  hash[2U] = Hacl_PBKDF2_SHA2_v512_add(hash[2U], c);
+  hash[3U] = Hacl_PBKDF2_SHA2_v512_add(hash[3U], d);
+  hash[4U] = Hacl_PBKDF2_SHA2_v512_add(hash[4U], e);
+  hash[5U] = Hacl_PBKDF2_SHA2_v512_add(hash[5U], f);
+  hash[6U] = Hacl_PBKDF2_SHA2_v512_add(hash[6U], g);
+  hash[7U] = Hacl_PBKDF2_SHA2_v512_add(hash[7U], h);
+}
+
+static void
+Hacl_PBKDF2_SHA2_sha512_first(Hacl_PBKDF2_SHA2_job512 *job, uint8_t *salt, uint32_t saltlen, uint32_t i)
+{
+  uint8_t last[132U];
+  uint8_t ih[64U], u[64U];
+  uint32_t n1 = saltlen / 128U;
+  uint32_t r = saltlen % 128U;
+  Hacl_SHA2_State_sha512 st = job->key.inner;
+  Hacl_SHA2_State_sha512_update_multi(&st, salt, n1);
+  memcpy(last, salt + n1 * 128U, r);
+  store32_be(last + r, i);
+  if (r + 4U >= 128U) {
+    Hacl_SHA2_State_sha512_update_multi(&st, last, 1U);
+    Hacl_SHA2_State_sha512_update_last(&st, last + 128U, r + 4U - 128U);
+  } else
+    Hacl_SHA2_State_sha512_update_last(&st, last, r + 4U);
+  Hacl_SHA2_State_sha512_finish(&st, ih);
+  st = job->key.outer;
+  Hacl_SHA2_State_sha512_update_last(&st, ih, 64U);
+  Hacl_SHA2_State_sha512_finish(&st, u);
+  for (uint32_t j = 0U; j < 8U; j++)
+    job->u[j] = load64_be(u + 8U * j);
+}
+
+/* A lone chain runs on the scalar compression, as for SHA-256 */
+static void Hacl_PBKDF2_SHA2_sha512_iterate_scalar(Hacl_PBKDF2_SHA2_job512 *job, uint32_t iterations)
+{
+  uint8_t block[128U] = { 0U };
+  Hacl_SHA2_State_sha512 st;
+  uint64_t t[8U];
+  block[64U] = 0x80U;
+  block[126U] = 0x06U;
+  memcpy(t, job->u, sizeof t);
+  memcpy(st.hash_w, job->u, sizeof t);
+  for (uint32_t c = 1U; c < iterations; c++) {
+    for (uint32_t j = 0U; j < 8U; j++)
+      store64_be(block + 8U * j, st.hash_w[j]);
+    st = job->key.inner;
+    Hacl_SHA2_State_sha512_update_multi(&st, block, 1U);
+    for (uint32_t j = 0U; j < 8U; j++)
+      store64_be(block + 8U * j, st.hash_w[j]);
+    st = job->key.outer;
+    Hacl_SHA2_State_sha512_update_multi(&st, block, 1U);
+    for (uint32_t j = 0U; j < 8U; j++)
+      t[j] ^= st.hash_w[j];
+  }
+  memcpy(job->u, t, sizeof t);
+  Hacl_Util_wipe(block, sizeof block);
+  Hacl_Util_wipe(&st, sizeof st);
+  Hacl_Util_wipe(t, sizeof t);
+}
+
+static void
+Hacl_PBKDF2_SHA2_sha512_iterate_lanes(Hacl_PBKDF2_SHA2_job512 *jobs, uint32_t k, uint32_t iterations)
+{
+  uint64_t tmp[8U][HACL_PBKDF2_SHA2_LANES512] = { { 0U } };
+  Hacl_PBKDF2_SHA2_vec512 ist[8U], ost[8U], u[8U], t[8U];
+  for (uint32_t j = 0U; j < 8U; j++) {
+    for (uint32_t l = 0U; l < k; l++)
+      tmp[j][l] = jobs[l].key.inner.hash_w[j];
+    ist[j] = Hacl_PBKDF2_SHA2_v512_load(tmp[j]);
+    for (uint32_t l = 0U; l < k; l++)
+      tmp[j][l] = jobs[l].key.outer.hash_w[j];
+    ost[j] = Hacl_PBKDF2_SHA2_v512_load(tmp[j]);
+    for (uint32_t l = 0U; l < k; l++)
+      tmp[j][l] = jobs[l].u[j];
+    u[j] = Hacl_PBKDF2_SHA2_v512_load(tmp[j]);
+    t[j] = u[j];
+  }
+  for (uint32_t c = 1U; c < iterations; c++) {
+    Hacl_PBKDF2_SHA2_vec512 h[8U];
+    memcpy(h, ist, sizeof h);
+    Hacl_PBKDF2_SHA2_sha512_compress(h, u);
+    memcpy(u, ost, sizeof u);
+    Hacl_PBKDF2_SHA2_sha512_compress(u, h);
+    for (uint32_t j = 0U; j < 8U; j++)
+      t[j] = Hacl_PBKDF2_SHA2_v512_xor(t[j], u[j]);
+  }
+  for (uint32_t j = 0U; j < 8U; j++) {
+    Hacl_PBKDF2_SHA2_v512_store(tmp[j], t[j]);
+    for (uint32_t l = 0U; l < k; l++)
+      jobs[l].u[j] = tmp[j][l];
+  }
+  Hacl_Util_wipe(tmp, sizeof tmp);
+  Hacl_Util_wipe(ist, sizeof ist);
+  Hacl_Util_wipe(ost, sizeof ost);
+  Hacl_Util_wipe(u, sizeof u);
+  Hacl_Util_wipe(t, sizeof t);
+}
+
+static void
+Hacl_PBKDF2_SHA2_sha512_run(Hacl_PBKDF2_SHA2_job512 *jobs, uint32_t k, uint32_t iterations)
+{
+  uint8_t out[64U];
+  if (k == 1U)
+    Hacl_PBKDF2_SHA2_sha512_iterate_scalar(jobs, iterations);
+  else
+    Hacl_PBKDF2_SHA2_sha512_iterate_lanes(jobs, k, iterations);
+  for (uint32_t l = 0U; l < k; l++) {
+    for (uint32_t j = 0U; j < 8U; j++)
+      store64_be(out + 8U * j, jobs[l].u[j]);
+    memcpy(jobs[l].out, out, jobs[l].outlen);
+  }
+  Hacl_Util_wipe(out, 64U);
+}
+
+void
+Hacl_PBKDF2_SHA2_sha512_batch(
+  uint8_t **dk,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+)
+{
+  Hacl_PBKDF2_SHA2_job512 jobs[HACL_PBKDF2_SHA2_LANES512];
+  uint32_t k = 0U;
+  for (uint32_t d = 0U; d < n; d++) {
+    Hacl_HMAC_SHA2_key512 key;
+    Hacl_HMAC_SHA2_sha512_init_key(&key, password[d], passlen[d]);
+    for (uint32_t off = 0U, i = 1U; off < dklen; off += 64U, i++) {
+      jobs[k].key = key;
+      jobs[k].out = dk[d] + off;
+      jobs[k].outlen = dklen - off < 64U ? dklen - off : 64U;
+      Hacl_PBKDF2_SHA2_sha512_first(&jobs[k], salt[d], saltlen[d], i);
+      if (++k == HACL_PBKDF2_SHA2_LANES512) {
+        Hacl_PBKDF2_SHA2_sha512_run(jobs, k, iterations);
+        k = 0U;
+      }
+    }
+    Hacl_Util_wipe(&key, sizeof key);
+  }
+  if (k > 0U)
+    Hacl_PBKDF2_SHA2_sha512_run(jobs, k, iterations);
+  Hacl_Util_wipe(jobs, sizeof jobs);
+}
+
+void
+Hacl_PBKDF2_SHA2_sha512(
+  uint8_t *dk,
+  uint32_t dklen,
+  uint8_t *password,
+  uint32_t passlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t iterations
+)
+{
+  Hacl_PBKDF2_SHA2_sha512_batch(&dk, dklen, &password, &passlen, &salt, &saltlen, iterations, 1U);
+}
+
+/* Verification derives into a scratch buffer, HACL_PBKDF2_SHA2_MAX_JOBS passwords at a time */
+typedef void
+(*Hacl_PBKDF2_SHA2_batch_t)(
+  uint8_t **dk,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+);
+
+static uint32_t
+Hacl_PBKDF2_SHA2_verify_batch(
+  Hacl_PBKDF2_SHA2_batch_t batch,
+  uint8_t *ok,
+  uint8_t **expected,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+)
+{
+  uint32_t matches = 0U;
+  uint8_t *scratch = malloc(HACL_PBKDF2_SHA2_MAX_JOBS * (size_t)dklen + 1U);
+  uint8_t *dk[HACL_PBKDF2_SHA2_MAX_JOBS];
+  if (scratch == NULL) {
+    memset(ok, 0, n);
+    return 0U;
+  }
+  for (uint32_t l = 0U; l < HACL_PBKDF2_SHA2_MAX_JOBS; l++)
+    dk[l] = scratch + l * (size_t)dklen;
+  for (uint32_t d = 0U; d < n; d += HACL_PBKDF2_SHA2_MAX_JOBS) {
+    uint32_t k = n - d < HACL_PBKDF2_SHA2_MAX_JOBS ? n - d : HACL_PBKDF2_SHA2_MAX_JOBS;
+    batch(dk, dklen, password + d, passlen + d, salt + d, saltlen + d, iterations, k);
+    for (uint32_t l = 0U; l < k; l++) {
+      uint8_t diff = 0U;
+      for (uint32_t j = 0U; j < dklen; j++)
+        diff |= dk[l][j] ^ expected[d + l][j];
+      ok[d + l] = (uint8_t)(1U & ((uint32_t)diff - 1U) >> 8U);
+      matches += ok[d + l];
+    }
+  }
+  Hacl_Util_wipe(scratch, HACL_PBKDF2_SHA2_MAX_JOBS * dklen);
+  free(scratch);
+  return matches;
+}
+
+uint32_t
+Hacl_PBKDF2_SHA2_sha256_verify_batch(
+  uint8_t *ok,
+  uint8_t **expected,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+)
+{
+  return
+    Hacl_PBKDF2_SHA2_verify_batch(Hacl_PBKDF2_SHA2_sha256_batch,
+      ok,
+      expected,
+      dklen,
+      password,
+      passlen,
+      salt,
+      saltlen,
+      iterations,
+      n);
+}
+
+uint32_t
+Hacl_PBKDF2_SHA2_sha512_verify_batch(
+  uint8_t *ok,
+  uint8_t **expected,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+)
+{
+  return
+    Hacl_PBKDF2_SHA2_verify_batch(Hacl_PBKDF2_SHA2_sha512_batch,
+      ok,
+      expected,
+      dklen,
+      password,
+      passlen,
+      salt,
+      saltlen,
+      iterations,
+      n);
+}
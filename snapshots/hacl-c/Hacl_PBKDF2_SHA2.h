@@ -0,0 +1,120 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_PBKDF2_SHA2_H
+#define __Hacl_PBKDF2_SHA2_H
+
+#include <inttypes.h>
+
+/* PBKDF2-HMAC-SHA256 and PBKDF2-HMAC-SHA512 (RFC 8018), unverified.
+ *
+ * The password is expanded once into precomputed HMAC states
+ * (Hacl_HMAC_SHA2), so each iteration costs exactly two compressions, with
+ * the message padding folded in as constants. Independent chains, i.e. the
+ * output blocks of one derivation and the derivations of a batch, run side
+ * by side: on the lanes of the multi-buffer SHA-256 compression
+ * (Hacl_SHA2_256_Multi), as two interleaved SHA-NI streams when the CPU has
+ * the SHA extensions, and on 4 AVX2 lanes for SHA-512; a lone chain uses
+ * the scalar compression. Batches of password checks should therefore go
+ * through the _batch / _verify_batch entry points rather than a loop over
+ * single derivations.
+ *
+ * iterations must be at least 1. */
+
+void
+Hacl_PBKDF2_SHA2_sha256(
+  uint8_t *dk,
+  uint32_t dklen,
+  uint8_t *password,
+  uint32_t passlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t iterations
+);
+
+/* n independent derivations with a common output length and iteration count */
+void
+Hacl_PBKDF2_SHA2_sha256_batch(
+  uint8_t **dk,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+);
+
+/* Checks n stored password hashes expected[0..n-1] of dklen bytes each.
+ * ok[i] is set to 1 if password i matches and to 0 otherwise; the
+ * comparison is constant-time. Returns the number of matches. */
+uint32_t
+Hacl_PBKDF2_SHA2_sha256_verify_batch(
+  uint8_t *ok,
+  uint8_t **expected,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+);
+
+void
+Hacl_PBKDF2_SHA2_sha512(
+  uint8_t *dk,
+  uint32_t dklen,
+  uint8_t *password,
+  uint32_t passlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t iterations
+);
+
+void
+Hacl_PBKDF2_SHA2_sha512_batch(
+  uint8_t **dk,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+);
+
+uint32_t
+Hacl_PBKDF2_SHA2_sha512_verify_batch(
+  uint8_t *ok,
+  uint8_t **expected,
+  uint32_t dklen,
+  uint8_t **password,
+  uint32_t *passlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t iterations,
+  uint32_t n
+);
+
+#endif
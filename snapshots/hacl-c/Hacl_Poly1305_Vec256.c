@@ -0,0 +1,365 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* AVX2 code whatever the global compiler flags; Hacl_Dispatch only selects
+   it on CPUs with AVX2 */
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__i386__) || defined(__x86_64__))
+#pragma GCC target("avx2")
+#endif
+
+#include "kremlib.h"
+#include "Hacl_Poly1305_Vec256.h"
+
+#define HACL_POLY1305_VEC256_MASK26 0x3ffffffU
+
+/* Below this, setting up and folding the lanes costs more than it saves */
+#define HACL_POLY1305_VEC256_MIN_BLOCKS 8U
+
+/* h = h * r mod 2^130 - 5, limbs left below 2^26 except h1 (below 2^27) */
+inline static void Hacl_Impl_Poly1305_Vec256_mul(uint64_t *h, const uint32_t *r)
+{
+  uint64_t r0 = (uint64_t)r[0U];
+  uint64_t r1 = (uint64_t)r[1U];
+  uint64_t r2 = (uint64_t)r[2U];
+  uint64_t r3 = (uint64_t)r[3U];
+  uint64_t r4 = (uint64_t)r[4U];
+  uint64_t s1 = r1 * 5U;
+  uint64_t s2 = r2 * 5U;
+  uint64_t s3 = r3 * 5U;
+  uint64_t s4 = r4 * 5U;
+  uint64_t d0 = h[0U] * r0 + h[1U] * s4 + h[2U] * s3 + h[3U] * s2 + h[4U] * s1;
+  uint64_t d1 = h[0U] * r1 + h[1U] * r0 + h[2U] * s4 + h[3U] * s3 + h[4U] * s2;
+  uint64_t d2 = h[0U] * r2 + h[1U] * r1 + h[2U] * r0 + h[3U] * s4 + h[4U] * s3;
+  uint64_t d3 = h[0U] * r3 + h[1U] * r2 + h[2U] * r1 + h[3U] * r0 + h[4U] * s4;
+  uint64_t d4 = h[0U] * r4 + h[1U] * r3 + h[2U] * r2 + h[3U] * r1 + h[4U] * r0;
+  uint64_t c;
+  c = d0 >> 26U;
+  h[0U] = d0 & HACL_POLY1305_VEC256_MASK26;
+  d1 = d1 + c;
+  c = d1 >> 26U;
+  h[1U] = d1 & HACL_POLY1305_VEC256_MASK26;
+  d2 = d2 + c;
+  c = d2 >> 26U;
+  h[2U] = d2 & HACL_POLY1305_VEC256_MASK26;
+  d3 = d3 + c;
+  c = d3 >> 26U;
+  h[3U] = d3 & HACL_POLY1305_VEC256_MASK26;
+  d4 = d4 + c;
+  c = d4 >> 26U;
+  h[4U] = d4 & HACL_POLY1305_VEC256_MASK26;
+  h[0U] = h[0U] + c * 5U;
+  c = h[0U] >> 26U;
+  h[0U] = h[0U] & HACL_POLY1305_VEC256_MASK26;
+  h[1U] = h[1U] + c;
+}
+
+/* Adds the 16-byte block b, with 2^128 set if hibit */
+inline static void Hacl_Impl_Poly1305_Vec256_add_block(uint64_t *h, uint8_t *b, uint64_t hibit)
+{
+  uint64_t lo = load64_le(b);
+  uint64_t hi = load64_le(b + 8U);
+  h[0U] = h[0U] + (lo & HACL_POLY1305_VEC256_MASK26);
+  h[1U] = h[1U] + ((lo >> 26U) & HACL_POLY1305_VEC256_MASK26);
+  h[2U] = h[2U] + (((lo >> 52U) | (hi << 12U)) & HACL_POLY1305_VEC256_MASK26);
+  h[3U] = h[3U] + ((hi >> 14U) & HACL_POLY1305_VEC256_MASK26);
+  h[4U] = h[4U] + ((hi >> 40U) | (hibit << 24U));
+}
+
+static void
+Hacl_Impl_Poly1305_Vec256_update_scalar(
+  Hacl_Poly1305_Vec256_state *st,
+  uint8_t *m,
+  uint32_t num_blocks
+)
+{
+  uint64_t h[5U];
+  for (uint32_t i = 0U; i < 5U; i++)
+    h[i] = (uint64_t)st->h[i];
+  for (uint32_t i = 0U; i < num_blocks; i++) {
+    Hacl_Impl_Poly1305_Vec256_add_block(h, m + 16U * i, 1U);
+    Hacl_Impl_Poly1305_Vec256_mul(h, st->r[0U]);
+  }
+  for (uint32_t i = 0U; i < 5U; i++)
+    st->h[i] = (uint32_t)h[i];
+}
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+/* d = h * r, lane by lane, without carries: every limb of h below 2^27 and
+   of r below 2^27 (s = 5 r below 2^30) keeps each sum below 2^60 */
+static inline void
+Hacl_Impl_Poly1305_Vec256_mul4(__m256i *d, const __m256i *h, const __m256i *r, const __m256i *s)
+{
+  d[0U] = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[0U], r[0U]),
+                                            _mm256_mul_epu32(h[1U], s[4U])),
+                           _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[2U], s[3U]),
+                                                             _mm256_mul_epu32(h[3U], s[2U])),
+                                            _mm256_mul_epu32(h[4U], s[1U])));
+  d[1U] = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[0U], r[1U]),
+                                            _mm256_mul_epu32(h[1U], r[0U])),
+                           _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[2U], s[4U]),
+                                                             _mm256_mul_epu32(h[3U], s[3U])),
+                                            _mm256_mul_epu32(h[4U], s[2U])));
+  d[2U] = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[0U], r[2U]),
+                                            _mm256_mul_epu32(h[1U], r[1U])),
+                           _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[2U], r[0U]),
+                                                             _mm256_mul_epu32(h[3U], s[4U])),
+                                            _mm256_mul_epu32(h[4U], s[3U])));
+  d[3U] = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[0U], r[3U]),
+                                            _mm256_mul_epu32(h[1U], r[2U])),
+                           _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[2U], r[1U]),
+                                                             _mm256_mul_epu32(h[3U], r[0U])),
+                                            _mm256_mul_epu32(h[4U], s[4U])));
+  d[4U] = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[0U], r[4U]),
+                                            _mm256_mul_epu32(h[1U], r[3U])),
+                           _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(h[2U], r[2U]),
+                                                             _mm256_mul_epu32(h[3U], r[1U])),
+                                            _mm256_mul_epu32(h[4U], r[0U])));
+}
+
+/* Lazy carry of the products d into h: limbs below 2^26, h1 below 2^27 */
+static inline void Hacl_Impl_Poly1305_Vec256_carry4(__m256i *h, __m256i *d)
+{
+  const __m256i mask = _mm256_set1_epi64x(HACL_POLY1305_VEC256_MASK26);
+  __m256i c;
+  c = _mm256_srli_epi64(d[0U], 26);
+  h[0U] = _mm256_and_si256(d[0U], mask);
+  d[1U] = _mm256_add_epi64(d[1U], c);
+  c = _mm256_srli_epi64(d[1U], 26);
+  h[1U] = _mm256_and_si256(d[1U], mask);
+  d[2U] = _mm256_add_epi64(d[2U], c);
+  c = _mm256_srli_epi64(d[2U], 26);
+  h[2U] = _mm256_and_si256(d[2U], mask);
+  d[3U] = _mm256_add_epi64(d[3U], c);
+  c = _mm256_srli_epi64(d[3U], 26);
+  h[3U] = _mm256_and_si256(d[3U], mask);
+  d[4U] = _mm256_add_epi64(d[4U], c);
+  c = _mm256_srli_epi64(d[4U], 26);
+  h[4U] = _mm256_and_si256(d[4U], mask);
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));
+  c = _mm256_srli_epi64(h[0U], 26);
+  h[0U] = _mm256_and_si256(h[0U], mask);
+  h[1U] = _mm256_add_epi64(h[1U], c);
+}
+
+/* Adds four blocks to the lanes. Lane order is (b0, b2, b1, b3), which is
+   what unpacking the two 32-byte loads gives without a cross-lane permute. */
+static inline void Hacl_Impl_Poly1305_Vec256_add_blocks4(__m256i *h, uint8_t *m)
+{
+  const __m256i mask = _mm256_set1_epi64x(HACL_POLY1305_VEC256_MASK26);
+  __m256i a = _mm256_loadu_si256((const __m256i *)m);
+  __m256i b = _mm256_loadu_si256((const __m256i *)(m + 32U));
+  __m256i lo = _mm256_unpacklo_epi64(a, b);
+  __m256i hi = _mm256_unpackhi_epi64(a, b);
+  h[0U] = _mm256_add_epi64(h[0U], _mm256_and_si256(lo, mask));
+  h[1U] = _mm256_add_epi64(h[1U], _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask));
+  h[2U] = _mm256_add_epi64(h[2U],
+    _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask));
+  h[3U] = _mm256_add_epi64(h[3U], _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask));
+  h[4U] = _mm256_add_epi64(h[4U],
+    _mm256_or_si256(_mm256_srli_epi64(hi, 40), _mm256_set1_epi64x(1LL << 24)));
+}
+
+/* r^2, r^3, r^4, computed on the first vectorized update */
+static void Hacl_Impl_Poly1305_Vec256_powers(Hacl_Poly1305_Vec256_state *st)
+{
+  uint64_t p[5U];
+  for (uint32_t i = 0U; i < 5U; i++)
+    p[i] = (uint64_t)st->r[0U][i];
+  for (uint32_t j = 1U; j < 4U; j++) {
+    Hacl_Impl_Poly1305_Vec256_mul(p, st->r[0U]);
+    for (uint32_t i = 0U; i < 5U; i++)
+      st->r[j][i] = (uint32_t)p[i];
+  }
+  st->powers = 1U;
+}
+
+/* Absorbs 4 * n4 blocks, n4 > 0 */
+static void Hacl_Impl_Poly1305_Vec256_update4(Hacl_Poly1305_Vec256_state *st, uint8_t *m, uint32_t n4)
+{
+  __m256i h[5U];
+  __m256i d[5U];
+  __m256i r[5U];
+  __m256i s[5U];
+  uint64_t hs[5U];
+  if (!st->powers)
+    Hacl_Impl_Poly1305_Vec256_powers(st);
+  for (uint32_t i = 0U; i < 5U; i++) {
+    h[i] = _mm256_set_epi64x(0, 0, 0, (int64_t)st->h[i]);
+    r[i] = _mm256_set1_epi64x((int64_t)st->r[3U][i]);
+    s[i] = _mm256_set1_epi64x((int64_t)st->r[3U][i] * 5);
+  }
+  for (uint32_t g = 0U; g + 1U < n4; g++) {
+    Hacl_Impl_Poly1305_Vec256_add_blocks4(h, m + 64U * g);
+    Hacl_Impl_Poly1305_Vec256_mul4(d, h, r, s);
+    Hacl_Impl_Poly1305_Vec256_carry4(h, d);
+  }
+  /* Last group: lanes (b0, b2, b1, b3) are multiplied by (r^4, r^2, r^3, r) */
+  Hacl_Impl_Poly1305_Vec256_add_blocks4(h, m + 64U * (n4 - 1U));
+  for (uint32_t i = 0U; i < 5U; i++) {
+    r[i] = _mm256_set_epi64x((int64_t)st->r[0U][i], (int64_t)st->r[2U][i],
+                             (int64_t)st->r[1U][i], (int64_t)st->r[3U][i]);
+    s[i] = _mm256_add_epi64(r[i], _mm256_slli_epi64(r[i], 2));
+  }
+  Hacl_Impl_Poly1305_Vec256_mul4(d, h, r, s);
+  for (uint32_t i = 0U; i < 5U; i++) {
+    __m128i t = _mm_add_epi64(_mm256_castsi256_si128(d[i]), _mm256_extracti128_si256(d[i], 1));
+    hs[i] = (uint64_t)_mm_cvtsi128_si64(_mm_add_epi64(t, _mm_unpackhi_epi64(t, t)));
+  }
+  /* The lane sums stay below 2^62; two carry passes bring them back to 26 bits */
+  for (uint32_t pass = 0U; pass < 2U; pass++) {
+    uint64_t c = 0U;
+    for (uint32_t i = 0U; i < 5U; i++) {
+      hs[i] = hs[i] + c;
+      c = hs[i] >> 26U;
+      hs[i] = hs[i] & HACL_POLY1305_VEC256_MASK26;
+    }
+    hs[0U] = hs[0U] + c * 5U;
+  }
+  for (uint32_t i = 0U; i < 5U; i++)
+    st->h[i] = (uint32_t)hs[i];
+}
+
+#endif
+
+void Hacl_Poly1305_Vec256_init(Hacl_Poly1305_Vec256_state *st, uint8_t *k1)
+{
+  /* r clamped with 0x0ffffffc0ffffffc0ffffffc0fffffff */
+  st->r[0U][0U] = load32_le(k1) & 0x3ffffffU;
+  st->r[0U][1U] = (load32_le(k1 + 3U) >> 2U) & 0x3ffff03U;
+  st->r[0U][2U] = (load32_le(k1 + 6U) >> 4U) & 0x3ffc0ffU;
+  st->r[0U][3U] = (load32_le(k1 + 9U) >> 6U) & 0x3f03fffU;
+  st->r[0U][4U] = (load32_le(k1 + 12U) >> 8U) & 0x00fffffU;
+  st->powers = 0U;
+  memset(st->h, 0, sizeof st->h);
+}
+
+void Hacl_Poly1305_Vec256_update(Hacl_Poly1305_Vec256_state *st, uint8_t *m, uint32_t num_blocks)
+{
+#if defined(__AVX2__)
+  uint32_t n4 = num_blocks / 4U;
+  if (num_blocks >= HACL_POLY1305_VEC256_MIN_BLOCKS) {
+    Hacl_Impl_Poly1305_Vec256_update4(st, m, n4);
+    m = m + 64U * n4;
+    num_blocks = num_blocks % 4U;
+  }
+#endif
+  Hacl_Impl_Poly1305_Vec256_update_scalar(st, m, num_blocks);
+}
+
+void Hacl_Poly1305_Vec256_update_last(Hacl_Poly1305_Vec256_state *st, uint8_t *m, uint32_t len1)
+{
+  uint8_t b[16U] = { 0U };
+  uint64_t h[5U];
+  if (len1 == 0U)
+    return;
+  memcpy(b, m, len1);
+  b[len1] = 1U;
+  for (uint32_t i = 0U; i < 5U; i++)
+    h[i] = (uint64_t)st->h[i];
+  Hacl_Impl_Poly1305_Vec256_add_block(h, b, 0U);
+  Hacl_Impl_Poly1305_Vec256_mul(h, st->r[0U]);
+  for (uint32_t i = 0U; i < 5U; i++)
+    st->h[i] = (uint32_t)h[i];
+}
+
+void Hacl_Poly1305_Vec256_finish(Hacl_Poly1305_Vec256_state *st, uint8_t *mac, uint8_t *k1)
+{
+  uint64_t h0 = (uint64_t)st->h[0U];
+  uint64_t h1 = (uint64_t)st->h[1U];
+  uint64_t h2 = (uint64_t)st->h[2U];
+  uint64_t h3 = (uint64_t)st->h[3U];
+  uint64_t h4 = (uint64_t)st->h[4U];
+  uint64_t g0, g1, g2, g3, g4, c, mask, f;
+  /* Full carry, then h - p in constant time */
+  c = h1 >> 26U;
+  h1 = h1 & HACL_POLY1305_VEC256_MASK26;
+  h2 = h2 + c;
+  c = h2 >> 26U;
+  h2 = h2 & HACL_POLY1305_VEC256_MASK26;
+  h3 = h3 + c;
+  c = h3 >> 26U;
+  h3 = h3 & HACL_POLY1305_VEC256_MASK26;
+  h4 = h4 + c;
+  c = h4 >> 26U;
+  h4 = h4 & HACL_POLY1305_VEC256_MASK26;
+  h0 = h0 + c * 5U;
+  c = h0 >> 26U;
+  h0 = h0 & HACL_POLY1305_VEC256_MASK26;
+  h1 = h1 + c;
+  g0 = h0 + 5U;
+  c = g0 >> 26U;
+  g0 = g0 & HACL_POLY1305_VEC256_MASK26;
+  g1 = h1 + c;
+  c = g1 >> 26U;
+  g1 = g1 & HACL_POLY1305_VEC256_MASK26;
+  g2 = h2 + c;
+  c = g2 >> 26U;
+  g2 = g2 & HACL_POLY1305_VEC256_MASK26;
+  g3 = h3 + c;
+  c = g3 >> 26U;
+  g3 = g3 & HACL_POLY1305_VEC256_MASK26;
+  g4 = h4 + c - (1ULL << 26U);
+  /* All ones if h >= p (no borrow out of g4) */
+  mask = (g4 >> 63U) - 1U;
+  h0 = (h0 & ~mask) | (g0 & mask);
+  h1 = (h1 & ~mask) | (g1 & mask);
+  h2 = (h2 & ~mask) | (g2 & mask);
+  h3 = (h3 & ~mask) | (g3 & mask);
+  h4 = (h4 & ~mask) | (g4 & mask);
+  /* (h + s) mod 2^128, by additions rather than ORs since the last carry
+     may leave h1 equal to 2^26 */
+  f = h0 + (h1 << 26U) + (uint64_t)load32_le(k1 + 16U);
+  store32_le(mac, (uint32_t)f);
+  f = (f >> 32U) + (h2 << 20U) + (uint64_t)load32_le(k1 + 20U);
+  store32_le(mac + 4U, (uint32_t)f);
+  f = (f >> 32U) + (h3 << 14U) + (uint64_t)load32_le(k1 + 24U);
+  store32_le(mac + 8U, (uint32_t)f);
+  f = (f >> 32U) + (h4 << 8U) + (uint64_t)load32_le(k1 + 28U);
+  store32_le(mac + 12U, (uint32_t)f);
+}
+
+void
+Hacl_Poly1305_Vec256_crypto_onetimeauth(
+  uint8_t *output,
+  uint8_t *input,
+  uint64_t len1,
+  uint8_t *k1
+)
+{
+  Hacl_Poly1305_Vec256_state st;
+  /* Chunks of 2^26 blocks keep the block count in 32 bits */
+  uint64_t chunk = (uint64_t)1U << 30U;
+  Hacl_Poly1305_Vec256_init(&st, k1);
+  while (len1 >= 16U) {
+    uint64_t len = len1 < chunk ? len1 : chunk;
+    uint32_t num_blocks = (uint32_t)(len / 16U);
+    Hacl_Poly1305_Vec256_update(&st, input, num_blocks);
+    input = input + (uint64_t)16U * num_blocks;
+    len1 = len1 - (uint64_t)16U * num_blocks;
+  }
+  Hacl_Poly1305_Vec256_update_last(&st, input, (uint32_t)len1);
+  Hacl_Poly1305_Vec256_finish(&st, output, k1);
+}
@@ -0,0 +1,71 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Poly1305_Vec256_H
+#define __Hacl_Poly1305_Vec256_H
+
+#include <inttypes.h>
+
+/* Poly1305 with AVX2 (unverified).
+ *
+ * The accumulator and the key use five 26-bit limbs, so that limb products
+ * fit vpmuludq. An update of at least 8 blocks absorbs four blocks per step
+ * in four 64-bit lanes, each lane multiplied by r^4, and folds the lanes
+ * back with r^4, r^3, r^2, r^1 at the end of the call (the powers are
+ * computed once per key, on first use). Shorter updates and the last
+ * blocks of a call (fewer than four) use the scalar code on the same
+ * representation. Tags are identical to Hacl_Poly1305_64.
+ *
+ * GCC builds for x86 always compile this code for AVX2, so the CPU check is
+ * left to the caller (Hacl_Dispatch_poly1305 does it). Without AVX2 the
+ * scalar code handles every block. */
+
+typedef struct
+{
+  uint32_t r[4U][5U];
+  uint32_t h[5U];
+  uint32_t powers;
+}
+Hacl_Poly1305_Vec256_state;
+
+/* Reads r from k1[0..15] */
+void Hacl_Poly1305_Vec256_init(Hacl_Poly1305_Vec256_state *st, uint8_t *k1);
+
+/* Absorbs num_blocks full 16-byte blocks */
+void Hacl_Poly1305_Vec256_update(Hacl_Poly1305_Vec256_state *st, uint8_t *m, uint32_t num_blocks);
+
+/* Absorbs a final partial block of len1 < 16 bytes (nothing if len1 = 0) */
+void Hacl_Poly1305_Vec256_update_last(Hacl_Poly1305_Vec256_state *st, uint8_t *m, uint32_t len1);
+
+/* Writes the 16-byte tag, adding s from k1[16..31] */
+void Hacl_Poly1305_Vec256_finish(Hacl_Poly1305_Vec256_state *st, uint8_t *mac, uint8_t *k1);
+
+void
+Hacl_Poly1305_Vec256_crypto_onetimeauth(
+  uint8_t *output,
+  uint8_t *input,
+  uint64_t len1,
+  uint8_t *k1
+);
+
+#endif
@@ -0,0 +1,293 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_SHA2_256_Multi.h"
+#include "Hacl_SHA2_State.h"
+
+#ifdef __MSVC__
+#define forceinline __forceinline inline
+#elif (defined(__GNUC__) || defined(__clang__))
+#define forceinline __attribute__((always_inline)) inline
+#else
+#define forceinline inline
+#endif
+
+/* Lane vectors: one 32-bit word of each message per lane */
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define MB_LANES 8
+
+typedef __m256i mb_vec;
+
+#define mb_add(a,b)    _mm256_add_epi32((a),(b))
+#define mb_xor(a,b)    _mm256_xor_si256((a),(b))
+#define mb_and(a,b)    _mm256_and_si256((a),(b))
+#define mb_andnot(a,b) _mm256_andnot_si256((a),(b))
+#define mb_or(a,b)     _mm256_or_si256((a),(b))
+#define mb_shl(a,n)    _mm256_slli_epi32((a),(n))
+#define mb_shr(a,n)    _mm256_srli_epi32((a),(n))
+#define mb_set1(x)     _mm256_set1_epi32((int)(x))
+#define mb_load(p)     _mm256_loadu_si256((const __m256i *)(p))
+#define mb_store(p,v)  _mm256_storeu_si256((__m256i *)(p),(v))
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+#include <emmintrin.h>
+
+#define MB_LANES 4
+
+typedef __m128i mb_vec;
+
+#define mb_add(a,b)    _mm_add_epi32((a),(b))
+#define mb_xor(a,b)    _mm_xor_si128((a),(b))
+#define mb_and(a,b)    _mm_and_si128((a),(b))
+#define mb_andnot(a,b) _mm_andnot_si128((a),(b))
+#define mb_or(a,b)     _mm_or_si128((a),(b))
+#define mb_shl(a,n)    _mm_slli_epi32((a),(n))
+#define mb_shr(a,n)    _mm_srli_epi32((a),(n))
+#define mb_set1(x)     _mm_set1_epi32((int)(x))
+#define mb_load(p)     _mm_loadu_si128((const __m128i *)(p))
+#define mb_store(p,v)  _mm_storeu_si128((__m128i *)(p),(v))
+
+#else
+
+#define MB_LANES 4
+
+typedef struct {
+  uint32_t v[4];
+} mb_vec;
+
+#define MB_LIFT2(name, op)                                         \
+  static forceinline mb_vec name(mb_vec a, mb_vec b) {             \
+    mb_vec r;                                                      \
+    for (int l = 0; l < 4; l++) r.v[l] = (op);                     \
+    return r;                                                      \
+  }
+
+MB_LIFT2(mb_add, a.v[l] + b.v[l])
+MB_LIFT2(mb_xor, a.v[l] ^ b.v[l])
+MB_LIFT2(mb_and, a.v[l] & b.v[l])
+MB_LIFT2(mb_andnot, ~a.v[l] & b.v[l])
+MB_LIFT2(mb_or, a.v[l] | b.v[l])
+
+static forceinline mb_vec mb_shl(mb_vec a, unsigned int n) {
+  mb_vec r;
+  for (int l = 0; l < 4; l++) r.v[l] = a.v[l] << n;
+  return r;
+}
+
+static forceinline mb_vec mb_shr(mb_vec a, unsigned int n) {
+  mb_vec r;
+  for (int l = 0; l < 4; l++) r.v[l] = a.v[l] >> n;
+  return r;
+}
+
+static forceinline mb_vec mb_set1(uint32_t x) {
+  mb_vec r;
+  for (int l = 0; l < 4; l++) r.v[l] = x;
+  return r;
+}
+
+static forceinline mb_vec mb_load(const uint32_t *p) {
+  mb_vec r;
+  for (int l = 0; l < 4; l++) r.v[l] = p[l];
+  return r;
+}
+
+static forceinline void mb_store(uint32_t *p, mb_vec a) {
+  for (int l = 0; l < 4; l++) p[l] = a.v[l];
+}
+
+#endif
+
+#define mb_rotr(a,n) mb_or(mb_shr((a),(n)), mb_shl((a),32-(n)))
+
+const uint32_t Hacl_SHA2_256_Multi_lanes = MB_LANES;
+
+static const uint32_t Hacl_SHA2_256_Multi_h0[8] = {
+  0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+  0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+};
+
+static const uint8_t Hacl_SHA2_256_Multi_zero_block[64] = { 0U };
+
+/* Per-lane message cursor: full input blocks, then one or two padded blocks */
+typedef struct {
+  const uint8_t *blocks;
+  uint32_t nblocks;
+  uint32_t total;
+  uint8_t last[128];
+} Hacl_SHA2_256_Multi_lane;
+
+static void
+Hacl_SHA2_256_Multi_lane_init(Hacl_SHA2_256_Multi_lane *lane, const uint8_t *input, uint32_t len)
+{
+  uint32_t r = len % 64U;
+  uint32_t nlast = r < 56U ? 1U : 2U;
+  memset(lane->last, 0, sizeof lane->last);
+  memcpy(lane->last, input + (len - r), r);
+  lane->last[r] = 0x80U;
+  store64_be(lane->last + nlast * 64U - 8U, (uint64_t)len * 8U);
+  lane->blocks = input;
+  lane->nblocks = len / 64U;
+  lane->total = lane->nblocks + nlast;
+}
+
+static forceinline const uint8_t *
+Hacl_SHA2_256_Multi_lane_block(const Hacl_SHA2_256_Multi_lane *lane, uint32_t b)
+{
+  if (b < lane->nblocks)
+    return lane->blocks + b * 64U;
+  if (b < lane->total)
+    return lane->last + (b - lane->nblocks) * 64U;
+  return Hacl_SHA2_256_Multi_zero_block;
+}
+
+/* Compresses the message words ws (one block per lane) into hash; lanes
+   whose mask is zero are left untouched. */
+static forceinline void
+Hacl_SHA2_256_Multi_rounds(mb_vec hash[8], mb_vec ws[16], mb_vec mask)
+{
+  mb_vec a = hash[0], b = hash[1], c = hash[2], d = hash[3];
+  mb_vec e = hash[4], f = hash[5], g = hash[6], h = hash[7];
+  for (uint32_t i = 0U; i < 64U; i++) {
+    mb_vec wst;
+    if (i < 16U)
+      wst = ws[i];
+    else {
+      mb_vec t16 = ws[i & 15U];
+      mb_vec t15 = ws[(i - 15U) & 15U];
+      mb_vec t7 = ws[(i - 7U) & 15U];
+      mb_vec t2 = ws[(i - 2U) & 15U];
+      mb_vec s1 = mb_xor(mb_rotr(t2, 17), mb_xor(mb_rotr(t2, 19), mb_shr(t2, 10)));
+      mb_vec s0 = mb_xor(mb_rotr(t15, 7), mb_xor(mb_rotr(t15, 18), mb_shr(t15, 3)));
+      wst = mb_add(mb_add(s1, t7), mb_add(s0, t16));
+      ws[i & 15U] = wst;
+    }
+    mb_vec sigma1 = mb_xor(mb_rotr(e, 6), mb_xor(mb_rotr(e, 11), mb_rotr(e, 25)));
+    mb_vec ch = mb_xor(mb_and(e, f), mb_andnot(e, g));
+    mb_vec t1 = mb_add(mb_add(h, sigma1), mb_add(ch, mb_add(mb_set1(Hacl_SHA2_State_k256[i]), wst)));
+    mb_vec sigma0 = mb_xor(mb_rotr(a, 2), mb_xor(mb_rotr(a, 13), mb_rotr(a, 22)));
+    mb_vec maj = mb_xor(mb_and(a, b), mb_xor(mb_and(a, c), mb_and(b, c)));
+    mb_vec t2 = mb_add(sigma0, maj);
+    h = g;
+    g = f;
+    f = e;
+    e = mb_add(d, t1);
+    d = c;
+    c = b;
+    b = a;
+    a = mb_add(t1, t2);
+  }
+  hash[0] = mb_add(hash[0], mb_and(a, mask));
+  hash[1] = mb_add(hash[1], mb_and(b, mask));
+  hash[2] = mb_add(hash[2], mb_and(c, mask));
+  hash[3] = mb_add(hash[3], mb_and(d, mask));
+  hash[4] = mb_add(hash[4], mb_and(e, mask));
+  hash[5] = mb_add(hash[5], mb_and(f, mask));
+  hash[6] = mb_add(hash[6], mb_and(g, mask));
+  hash[7] = mb_add(hash[7], mb_and(h, mask));
+}
+
+static forceinline void
+Hacl_SHA2_256_Multi_compress(mb_vec hash[8], const uint8_t *blocks[MB_LANES], mb_vec mask)
+{
+  mb_vec ws[16];
+  uint32_t tmp[MB_LANES];
+  for (uint32_t i = 0U; i < 16U; i++) {
+    for (uint32_t l = 0U; l < MB_LANES; l++)
+      tmp[l] = load32_be((uint8_t *)blocks[l] + 4U * i);
+    ws[i] = mb_load(tmp);
+  }
+  Hacl_SHA2_256_Multi_rounds(hash, ws, mask);
+}
+
+/* Hashes k <= MB_LANES messages in a single pass */
+static void
+Hacl_SHA2_256_Multi_hash_lanes(uint8_t **hash, uint8_t **input, uint32_t *len, uint32_t k)
+{
+  Hacl_SHA2_256_Multi_lane lanes[MB_LANES];
+  const uint8_t *blocks[MB_LANES];
+  uint32_t tmp[MB_LANES];
+  mb_vec st[8];
+  uint32_t maxb = 0U;
+  for (uint32_t l = 0U; l < MB_LANES; l++) {
+    if (l < k) {
+      Hacl_SHA2_256_Multi_lane_init(&lanes[l], input[l], len[l]);
+      if (lanes[l].total > maxb)
+        maxb = lanes[l].total;
+    } else {
+      lanes[l].blocks = Hacl_SHA2_256_Multi_zero_block;
+      lanes[l].nblocks = 0U;
+      lanes[l].total = 0U;
+    }
+  }
+  for (uint32_t i = 0U; i < 8U; i++)
+    st[i] = mb_set1(Hacl_SHA2_256_Multi_h0[i]);
+  for (uint32_t b = 0U; b < maxb; b++) {
+    for (uint32_t l = 0U; l < MB_LANES; l++) {
+      blocks[l] = Hacl_SHA2_256_Multi_lane_block(&lanes[l], b);
+      tmp[l] = b < lanes[l].total ? 0xffffffffU : 0U;
+    }
+    Hacl_SHA2_256_Multi_compress(st, blocks, mb_load(tmp));
+  }
+  for (uint32_t i = 0U; i < 8U; i++) {
+    mb_store(tmp, st[i]);
+    for (uint32_t l = 0U; l < k; l++)
+      store32_be(hash[l] + 4U * i, tmp[l]);
+  }
+}
+
+void Hacl_SHA2_256_hash_multi(uint8_t **hash, uint8_t **input, uint32_t *len, uint32_t n)
+{
+  for (uint32_t i = 0U; i < n; i += MB_LANES) {
+    uint32_t k = n - i < MB_LANES ? n - i : MB_LANES;
+    Hacl_SHA2_256_Multi_hash_lanes(hash + i, input + i, len + i, k);
+  }
+}
+
+void Hacl_SHA2_256_Multi_compress_interleaved(uint32_t *hash_w, uint32_t *ws)
+{
+  mb_vec st[8], w[16];
+  for (uint32_t i = 0U; i < 8U; i++)
+    st[i] = mb_load(hash_w + MB_LANES * i);
+  for (uint32_t i = 0U; i < 16U; i++)
+    w[i] = mb_load(ws + MB_LANES * i);
+  Hacl_SHA2_256_Multi_rounds(st, w, mb_set1(0xffffffffU));
+  for (uint32_t i = 0U; i < 8U; i++)
+    mb_store(hash_w + MB_LANES * i, st[i]);
+}
+
+void Hacl_SHA2_256_hash_x4(uint8_t *hash[4], uint8_t *input[4], uint32_t len[4])
+{
+  Hacl_SHA2_256_hash_multi(hash, input, len, 4U);
+}
+
+void Hacl_SHA2_256_hash_x8(uint8_t *hash[8], uint8_t *input[8], uint32_t len[8])
+{
+  Hacl_SHA2_256_hash_multi(hash, input, len, 8U);
+}
@@ -0,0 +1,58 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_256_Multi_H
+#define __Hacl_SHA2_256_Multi_H
+
+#include <inttypes.h>
+
+/* Multi-buffer SHA-256 (unverified).
+ *
+ * Hashes several independent messages at once, one message per SIMD lane:
+ * 8 lanes with AVX2, 4 lanes with SSE2 (or the portable fallback). Messages
+ * may have different lengths; each lane is padded on its own and stops
+ * absorbing once its last block has been compressed. Digests are identical
+ * to Hacl_SHA2_256_hash on the same input. */
+
+/* Number of messages processed by a single pass of the compression function */
+extern const uint32_t Hacl_SHA2_256_Multi_lanes;
+
+/* Upper bound on Hacl_SHA2_256_Multi_lanes, for sizing interleaved buffers */
+#define HACL_SHA2_256_MULTI_MAX_LANES 8
+
+/* Hashes input[0..3] (of byte lengths len[0..3]) into hash[0..3] */
+void Hacl_SHA2_256_hash_x4(uint8_t *hash[4], uint8_t *input[4], uint32_t len[4]);
+
+/* Hashes input[0..7] (of byte lengths len[0..7]) into hash[0..7] */
+void Hacl_SHA2_256_hash_x8(uint8_t *hash[8], uint8_t *input[8], uint32_t len[8]);
+
+/* Hashes n messages, Hacl_SHA2_256_Multi_lanes at a time */
+void Hacl_SHA2_256_hash_multi(uint8_t **hash, uint8_t **input, uint32_t *len, uint32_t n);
+
+/* Compresses one block per lane for callers that keep their own chaining
+ * values (e.g. HMAC iterations). Word i of lane l is at index
+ * i * Hacl_SHA2_256_Multi_lanes + l, both in the 8-word chaining values
+ * hash_w and in the 16 message words ws (already loaded big-endian). */
+void Hacl_SHA2_256_Multi_compress_interleaved(uint32_t *hash_w, uint32_t *ws);
+
+#endif
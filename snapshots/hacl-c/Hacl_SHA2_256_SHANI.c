@@ -0,0 +1,186 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Hacl_SHA2_256_SHANI.h"
+#include "Hacl_SHA2_State.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+
+#include <immintrin.h>
+#include "Hacl_Cpu_Features.h"
+
+#define HACL_SHA2_256_SHANI_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+
+/* Cleared by Hacl_Dispatch_sha256_set to force the portable code */
+static int Hacl_SHA2_256_SHANI_enabled = 1;
+
+bool Hacl_SHA2_256_SHANI_is_supported(void)
+{
+  return __atomic_load_n(&Hacl_SHA2_256_SHANI_enabled, __ATOMIC_RELAXED)
+    && Hacl_Cpu_Features_has(HACL_CPU_SHA | HACL_CPU_SSSE3 | HACL_CPU_SSE41);
+}
+
+void Hacl_SHA2_256_SHANI_set_enabled(bool enabled)
+{
+  __atomic_store_n(&Hacl_SHA2_256_SHANI_enabled, enabled ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+HACL_SHA2_256_SHANI_TARGET
+void Hacl_SHA2_256_SHANI_update_multi(uint32_t *hash_w, uint8_t *data, uint32_t n1)
+{
+  const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i tmp = _mm_loadu_si128((const __m128i *)hash_w);       /* DCBA */
+  __m128i state1 = _mm_loadu_si128((const __m128i *)(hash_w + 4)); /* HGFE */
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);                          /* CDAB */
+  state1 = _mm_shuffle_epi32(state1, 0x1B);                    /* EFGH */
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);            /* ABEF */
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);                 /* CDGH */
+  for (uint32_t b = 0U; b < n1; b++) {
+    const uint8_t *block = data + 64U * b;
+    __m128i abef = state0;
+    __m128i cdgh = state1;
+    __m128i w[4];
+    for (uint32_t i = 0U; i < 4U; i++)
+      w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(block + 16U * i)), mask);
+    for (uint32_t i = 0U; i < 16U; i++) {
+      if (i >= 4U) {
+        /* W[i] = msg2(msg1(W[i-4], W[i-3]) + W[i-2..i-1] shifted by one word, W[i-1]) */
+        __m128i t = _mm_sha256msg1_epu32(w[i & 3U], w[(i + 1U) & 3U]);
+        t = _mm_add_epi32(t, _mm_alignr_epi8(w[(i + 3U) & 3U], w[(i + 2U) & 3U], 4));
+        w[i & 3U] = _mm_sha256msg2_epu32(t, w[(i + 3U) & 3U]);
+      }
+      __m128i msg = _mm_add_epi32(w[i & 3U], _mm_loadu_si128((const __m128i *)(Hacl_SHA2_State_k256 + 4U * i)));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    }
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+  }
+  tmp = _mm_shuffle_epi32(state0, 0x1B);                       /* FEBA */
+  state1 = _mm_shuffle_epi32(state1, 0xB1);                    /* DCHG */
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);                 /* DCBA */
+  state1 = _mm_alignr_epi8(state1, tmp, 8);                    /* HGFE */
+  _mm_storeu_si128((__m128i *)hash_w, state0);
+  _mm_storeu_si128((__m128i *)(hash_w + 4), state1);
+}
+
+HACL_SHA2_256_SHANI_TARGET
+void Hacl_SHA2_256_SHANI_rounds(uint32_t *hash_w, const uint32_t *wk)
+{
+  __m128i tmp = _mm_loadu_si128((const __m128i *)hash_w);       /* DCBA */
+  __m128i state1 = _mm_loadu_si128((const __m128i *)(hash_w + 4)); /* HGFE */
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);                          /* CDAB */
+  state1 = _mm_shuffle_epi32(state1, 0x1B);                    /* EFGH */
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);            /* ABEF */
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);                 /* CDGH */
+  __m128i abef = state0;
+  __m128i cdgh = state1;
+  for (uint32_t i = 0U; i < 16U; i++) {
+    __m128i msg = _mm_loadu_si128((const __m128i *)(wk + 4U * i));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+  }
+  state0 = _mm_add_epi32(state0, abef);
+  state1 = _mm_add_epi32(state1, cdgh);
+  tmp = _mm_shuffle_epi32(state0, 0x1B);                       /* FEBA */
+  state1 = _mm_shuffle_epi32(state1, 0xB1);                    /* DCHG */
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);                 /* DCBA */
+  state1 = _mm_alignr_epi8(state1, tmp, 8);                    /* HGFE */
+  _mm_storeu_si128((__m128i *)hash_w, state0);
+  _mm_storeu_si128((__m128i *)(hash_w + 4), state1);
+}
+
+HACL_SHA2_256_SHANI_TARGET
+void Hacl_SHA2_256_SHANI_update_x2(uint32_t *hash_w[2], uint8_t *block[2])
+{
+  const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i state0[2], state1[2], abef[2], cdgh[2], w[2][4];
+  for (uint32_t s = 0U; s < 2U; s++) {
+    __m128i tmp = _mm_loadu_si128((const __m128i *)hash_w[s]);
+    __m128i st1 = _mm_loadu_si128((const __m128i *)(hash_w[s] + 4));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    st1 = _mm_shuffle_epi32(st1, 0x1B);
+    state0[s] = abef[s] = _mm_alignr_epi8(tmp, st1, 8);
+    state1[s] = cdgh[s] = _mm_blend_epi16(st1, tmp, 0xF0);
+    for (uint32_t i = 0U; i < 4U; i++)
+      w[s][i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(block[s] + 16U * i)), mask);
+  }
+  /* The two streams are independent: interleaving them hides the latency of sha256rnds2 */
+  for (uint32_t i = 0U; i < 16U; i++) {
+    __m128i k = _mm_loadu_si128((const __m128i *)(Hacl_SHA2_State_k256 + 4U * i));
+    for (uint32_t s = 0U; s < 2U; s++) {
+      if (i >= 4U) {
+        __m128i t = _mm_sha256msg1_epu32(w[s][i & 3U], w[s][(i + 1U) & 3U]);
+        t = _mm_add_epi32(t, _mm_alignr_epi8(w[s][(i + 3U) & 3U], w[s][(i + 2U) & 3U], 4));
+        w[s][i & 3U] = _mm_sha256msg2_epu32(t, w[s][(i + 3U) & 3U]);
+      }
+      __m128i msg = _mm_add_epi32(w[s][i & 3U], k);
+      state1[s] = _mm_sha256rnds2_epu32(state1[s], state0[s], msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0[s] = _mm_sha256rnds2_epu32(state0[s], state1[s], msg);
+    }
+  }
+  for (uint32_t s = 0U; s < 2U; s++) {
+    __m128i st0 = _mm_add_epi32(state0[s], abef[s]);
+    __m128i st1 = _mm_add_epi32(state1[s], cdgh[s]);
+    __m128i tmp = _mm_shuffle_epi32(st0, 0x1B);
+    st1 = _mm_shuffle_epi32(st1, 0xB1);
+    _mm_storeu_si128((__m128i *)hash_w[s], _mm_blend_epi16(tmp, st1, 0xF0));
+    _mm_storeu_si128((__m128i *)(hash_w[s] + 4), _mm_alignr_epi8(st1, tmp, 8));
+  }
+}
+
+#else
+
+bool Hacl_SHA2_256_SHANI_is_supported(void)
+{
+  return false;
+}
+
+void Hacl_SHA2_256_SHANI_set_enabled(bool enabled)
+{
+  (void)enabled;
+}
+
+void Hacl_SHA2_256_SHANI_update_multi(uint32_t *hash_w, uint8_t *data, uint32_t n1)
+{
+  (void)hash_w;
+  (void)data;
+  (void)n1;
+}
+
+void Hacl_SHA2_256_SHANI_rounds(uint32_t *hash_w, const uint32_t *wk)
+{
+  (void)hash_w;
+  (void)wk;
+}
+
+void Hacl_SHA2_256_SHANI_update_x2(uint32_t *hash_w[2], uint8_t *block[2])
+{
+  (void)hash_w;
+  (void)block;
+}
+
+#endif
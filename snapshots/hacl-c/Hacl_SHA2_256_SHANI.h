@@ -0,0 +1,56 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_256_SHANI_H
+#define __Hacl_SHA2_256_SHANI_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* SHA-256 compression with the Intel SHA extensions (unverified).
+ *
+ * The backend is compiled with per-function target attributes, so it is
+ * present in every x86 build and only selected at runtime, after CPUID
+ * reports SHA, SSSE3 and SSE4.1 support. The unverified SHA-256 code
+ * (Hacl_SHA2_State and the modules built on it, Hacl_Dispatch_sha256)
+ * branches here; the verified Hacl_SHA2_256 does not. */
+
+/* True if the running CPU can execute Hacl_SHA2_256_SHANI_update_multi and
+   the backend has not been disabled */
+bool Hacl_SHA2_256_SHANI_is_supported(void);
+
+/* Disabling makes those callers use the portable code, e.g. for
+   benchmarking; see Hacl_Dispatch_sha256_set */
+void Hacl_SHA2_256_SHANI_set_enabled(bool enabled);
+
+/* Compresses n1 64-byte blocks into the 8-word chaining value hash_w */
+void Hacl_SHA2_256_SHANI_update_multi(uint32_t *hash_w, uint8_t *data, uint32_t n1);
+
+/* Runs the 64 rounds of one block from a precomputed schedule wk[t] = W[t] + K[t],
+   for blocks whose content is known in advance (e.g. pure padding) */
+void Hacl_SHA2_256_SHANI_rounds(uint32_t *hash_w, const uint32_t *wk);
+
+/* Compresses one 64-byte block into each of two independent chaining values */
+void Hacl_SHA2_256_SHANI_update_x2(uint32_t *hash_w[2], uint8_t *block[2]);
+
+#endif
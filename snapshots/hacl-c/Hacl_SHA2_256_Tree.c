@@ -0,0 +1,252 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_SHA2_256_Tree.h"
+#include "Hacl_SHA2_State.h"
+
+#if !defined(_MSC_VER)
+#define HACL_SHA2_256_TREE_PTHREADS 1
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Levels of a task subtree: log2(HACL_SHA2_256_TREE_TASK_LEAVES) */
+#define HACL_SHA2_256_TREE_TASK_LEVELS 6U
+
+/* Enough levels for 2^64 leaves */
+#define HACL_SHA2_256_TREE_MAX_LEVELS 65U
+
+typedef struct
+{
+  uint8_t *input;
+  uint64_t len;
+  uint32_t levels;
+  uint64_t count[HACL_SHA2_256_TREE_MAX_LEVELS];
+  uint64_t offset[HACL_SHA2_256_TREE_MAX_LEVELS];
+  uint8_t *nodes;
+  uint8_t *roots;
+  uint64_t ntasks;
+  uint64_t next;
+#if HACL_SHA2_256_TREE_PTHREADS
+  pthread_mutex_t lock;
+#endif
+}
+Hacl_SHA2_256_Tree_job;
+
+static void Hacl_SHA2_256_Tree_leaf(uint8_t *hash1, uint8_t *data, uint32_t len)
+{
+  Hacl_SHA2_State_sha256 st;
+  uint8_t first[64U];
+  first[0U] = 0x00U;
+  Hacl_SHA2_State_sha256_init(&st);
+  if (len < 63U)
+  {
+    memcpy(first + 1U, data, len);
+    Hacl_SHA2_State_sha256_update_last(&st, first, len + 1U);
+  }
+  else
+  {
+    /* The blocks after the first one are contiguous in the input */
+    uint32_t n1 = (len - 63U) / 64U;
+    memcpy(first + 1U, data, 63U);
+    Hacl_SHA2_State_sha256_update_multi(&st, first, 1U);
+    Hacl_SHA2_State_sha256_update_multi(&st, data + 63U, n1);
+    Hacl_SHA2_State_sha256_update_last(&st, data + 63U + n1 * 64U, (len - 63U) % 64U);
+  }
+  Hacl_SHA2_State_sha256_finish(&st, hash1);
+}
+
+static void Hacl_SHA2_256_Tree_node(uint8_t *hash1, uint8_t *left, uint8_t *right)
+{
+  Hacl_SHA2_State_sha256 st;
+  uint8_t block[65U];
+  block[0U] = 0x01U;
+  memcpy(block + 1U, left, 32U);
+  memcpy(block + 33U, right, 32U);
+  Hacl_SHA2_State_sha256_init(&st);
+  Hacl_SHA2_State_sha256_update_multi(&st, block, 1U);
+  Hacl_SHA2_State_sha256_update_last(&st, block + 64U, 1U);
+  Hacl_SHA2_State_sha256_finish(&st, hash1);
+}
+
+/* Reduces the m nodes of level j (in place in h, starting at index first
+   of that level) up to level last, emitting every level to job->nodes */
+static void
+Hacl_SHA2_256_Tree_reduce(
+  Hacl_SHA2_256_Tree_job *job,
+  uint8_t *h,
+  uint64_t m,
+  uint64_t first,
+  uint32_t j,
+  uint32_t last
+)
+{
+  for (; j < last; j++)
+  {
+    uint64_t m1 = (m + 1U) / 2U;
+    for (uint64_t i = 0U; i < m1; i++)
+    {
+      uint8_t tmp[32U];
+      if (2U * i + 1U < m)
+        Hacl_SHA2_256_Tree_node(tmp, h + 64U * i, h + 64U * i + 32U);
+      else
+        memcpy(tmp, h + 64U * i, 32U);
+      memcpy(h + 32U * i, tmp, 32U);
+    }
+    m = m1;
+    first = first / 2U;
+    if (job->nodes != NULL)
+      memcpy(job->nodes + 32U * (job->offset[j + 1U] + first), h, (size_t)(32U * m));
+  }
+}
+
+static void Hacl_SHA2_256_Tree_task(Hacl_SHA2_256_Tree_job *job, uint64_t t)
+{
+  uint8_t h[32U * HACL_SHA2_256_TREE_TASK_LEAVES];
+  uint64_t first = t * HACL_SHA2_256_TREE_TASK_LEAVES;
+  uint64_t m = job->count[0U] - first;
+  if (m > HACL_SHA2_256_TREE_TASK_LEAVES)
+    m = HACL_SHA2_256_TREE_TASK_LEAVES;
+  for (uint64_t i = 0U; i < m; i++)
+  {
+    uint64_t start = (first + i) * HACL_SHA2_256_TREE_LEAF_SIZE;
+    uint64_t l = job->len - start;
+    if (l > HACL_SHA2_256_TREE_LEAF_SIZE)
+      l = HACL_SHA2_256_TREE_LEAF_SIZE;
+    Hacl_SHA2_256_Tree_leaf(h + 32U * i, job->input + start, (uint32_t)l);
+  }
+  if (job->nodes != NULL)
+    memcpy(job->nodes + 32U * first, h, (size_t)(32U * m));
+  uint32_t last = job->levels - 1U;
+  if (last > HACL_SHA2_256_TREE_TASK_LEVELS)
+    last = HACL_SHA2_256_TREE_TASK_LEVELS;
+  Hacl_SHA2_256_Tree_reduce(job, h, m, first, 0U, last);
+  memcpy(job->roots + 32U * t, h, 32U);
+}
+
+static void *Hacl_SHA2_256_Tree_worker(void *arg)
+{
+  Hacl_SHA2_256_Tree_job *job = arg;
+  while (true)
+  {
+    uint64_t t;
+#if HACL_SHA2_256_TREE_PTHREADS
+    pthread_mutex_lock(&job->lock);
+    t = job->next++;
+    pthread_mutex_unlock(&job->lock);
+#else
+    t = job->next++;
+#endif
+    if (t >= job->ntasks)
+      return NULL;
+    Hacl_SHA2_256_Tree_task(job, t);
+  }
+}
+
+uint64_t Hacl_SHA2_256_Tree_num_leaves(uint64_t len)
+{
+  if (len == 0U)
+    return 1U;
+  return (len - 1U) / HACL_SHA2_256_TREE_LEAF_SIZE + 1U;
+}
+
+uint64_t Hacl_SHA2_256_Tree_num_nodes(uint64_t len)
+{
+  uint64_t m = Hacl_SHA2_256_Tree_num_leaves(len);
+  uint64_t n = m;
+  while (m > 1U)
+  {
+    m = (m + 1U) / 2U;
+    n += m;
+  }
+  return n;
+}
+
+bool
+Hacl_SHA2_256_Tree_hash(
+  uint8_t *root,
+  uint8_t *input,
+  uint64_t len,
+  uint32_t nthreads,
+  uint8_t *nodes
+)
+{
+  Hacl_SHA2_256_Tree_job job;
+  job.input = input;
+  job.len = len;
+  job.nodes = nodes;
+  job.next = 0U;
+  job.count[0U] = Hacl_SHA2_256_Tree_num_leaves(len);
+  job.offset[0U] = 0U;
+  job.levels = 1U;
+  while (job.count[job.levels - 1U] > 1U)
+  {
+    job.count[job.levels] = (job.count[job.levels - 1U] + 1U) / 2U;
+    job.offset[job.levels] = job.offset[job.levels - 1U] + job.count[job.levels - 1U];
+    job.levels++;
+  }
+  job.ntasks = (job.count[0U] - 1U) / HACL_SHA2_256_TREE_TASK_LEAVES + 1U;
+  job.roots = malloc((size_t)(32U * job.ntasks));
+  if (job.roots == NULL)
+    return false;
+
+#if HACL_SHA2_256_TREE_PTHREADS
+  if (nthreads == 0U)
+  {
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    nthreads = ncpus > 0 ? (uint32_t)ncpus : 1U;
+  }
+  if ((uint64_t)nthreads > job.ntasks)
+    nthreads = (uint32_t)job.ntasks;
+  pthread_t *threads = NULL;
+  uint32_t started = 0U;
+  if (nthreads > 1U)
+    threads = malloc((nthreads - 1U) * sizeof (pthread_t));
+  pthread_mutex_init(&job.lock, NULL);
+  /* The calling thread works too; a thread that fails to start only
+     leaves more tasks to the others */
+  if (threads != NULL)
+    for (; started < nthreads - 1U; started++)
+      if (pthread_create(&threads[started], NULL, Hacl_SHA2_256_Tree_worker, &job) != 0)
+        break;
+  Hacl_SHA2_256_Tree_worker(&job);
+  for (uint32_t i = 0U; i < started; i++)
+    pthread_join(threads[i], NULL);
+  pthread_mutex_destroy(&job.lock);
+  free(threads);
+#else
+  Hacl_SHA2_256_Tree_worker(&job);
+#endif
+
+  if (job.levels - 1U > HACL_SHA2_256_TREE_TASK_LEVELS)
+    Hacl_SHA2_256_Tree_reduce(&job,
+      job.roots,
+      job.ntasks,
+      0U,
+      HACL_SHA2_256_TREE_TASK_LEVELS,
+      job.levels - 1U);
+  memcpy(root, job.roots, 32U);
+  free(job.roots);
+  return true;
+}
@@ -0,0 +1,71 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_256_Tree_H
+#define __Hacl_SHA2_256_Tree_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* Parallel Merkle-tree hashing over SHA-256 (unverified).
+ *
+ * The input is cut into leaves of HACL_SHA2_256_TREE_LEAF_SIZE bytes (the
+ * last one may be shorter; an empty input is a single empty leaf). Leaves
+ * and interior nodes are domain-separated as in RFC 6962:
+ *
+ *   leaf = SHA-256(0x00 || data)
+ *   node = SHA-256(0x01 || left || right)
+ *
+ * and the tree is left-balanced: each level pairs adjacent nodes, and an
+ * unpaired last node is promoted unchanged to the next level. The result is
+ * not the SHA-256 digest of the input.
+ *
+ * Leaves are hashed by a pool of threads, each taking aligned subtrees of
+ * HACL_SHA2_256_TREE_TASK_LEAVES leaves and reducing them locally; the
+ * subtree roots are then reduced by the calling thread. */
+
+#define HACL_SHA2_256_TREE_LEAF_SIZE ((uint32_t)0x10000U)
+
+#define HACL_SHA2_256_TREE_TASK_LEAVES ((uint32_t)64U)
+
+/* Number of leaves of the tree for an input of len bytes */
+uint64_t Hacl_SHA2_256_Tree_num_leaves(uint64_t len);
+
+/* Number of nodes of the tree, leaves and root included */
+uint64_t Hacl_SHA2_256_Tree_num_nodes(uint64_t len);
+
+/* Writes the 32-byte root of the tree over input[0..len) to root, using up
+ * to nthreads threads (0 for one per online CPU). If nodes is not NULL, it
+ * must hold 32 * Hacl_SHA2_256_Tree_num_nodes(len) bytes and receives every
+ * node, level by level from the leaves up, each level from left to right;
+ * the root comes last. Returns false if memory could not be allocated. */
+bool
+Hacl_SHA2_256_Tree_hash(
+  uint8_t *root,
+  uint8_t *input,
+  uint64_t len,
+  uint32_t nthreads,
+  uint8_t *nodes
+);
+
+#endif
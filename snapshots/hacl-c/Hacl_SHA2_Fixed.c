@@ -0,0 +1,320 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_SHA2_Fixed.h"
+#include "Hacl_SHA2_State.h"
+#include "Hacl_SHA2_256_SHANI.h"
+
+static const uint32_t Hacl_SHA2_Fixed_h256[8U] = {
+  0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+  0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+};
+
+static const uint64_t Hacl_SHA2_Fixed_h512[8U] = {
+  0x6a09e667f3bcc908U, 0xbb67ae8584caa73bU, 0x3c6ef372fe94f82bU, 0xa54ff53a5f1d36f1U,
+  0x510e527fade682d1U, 0x9b05688c2b3e6c1fU, 0x1f83d9abfb41bd6bU, 0x5be0cd19137e2179U
+};
+
+/* W[t] + K[t] for the padding block of a 64-byte message */
+static const uint32_t Hacl_SHA2_Fixed_wk256_pad64[64U] = {
+  0xc28a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+  0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf374U,
+  0x649b69c1U, 0xf0fe4786U, 0x0fe1edc6U, 0x240cf254U, 0x4fe9346fU, 0x6cc984beU, 0x61b9411eU, 0x16f988faU,
+  0xf2c65152U, 0xa88e5a6dU, 0xb019fc65U, 0xb9d99ec7U, 0x9a1231c3U, 0xe70eeaa0U, 0xfdb1232bU, 0xc7353eb0U,
+  0x3069bad5U, 0xcb976d5fU, 0x5a0f118fU, 0xdc1eeefdU, 0x0a35b689U, 0xde0b7a04U, 0x58f4ca9dU, 0xe15d5b16U,
+  0x007f3e86U, 0x37088980U, 0xa507ea32U, 0x6fab9537U, 0x17406110U, 0x0d8cd6f1U, 0xcdaa3b6dU, 0xc0bbbe37U,
+  0x83613bdaU, 0xdb48a363U, 0x0b02e931U, 0x6fd15ca7U, 0x521afacaU, 0x31338431U, 0x6ed41a95U, 0x6d437890U,
+  0xc39c91f2U, 0x9eccabbdU, 0xb5c9a0e6U, 0x532fb63cU, 0xd2c741c6U, 0x07237ea3U, 0xa4954b68U, 0x4c191d76U
+};
+
+/* W[t] + K[t] for the padding block of a 128-byte message */
+static const uint32_t Hacl_SHA2_Fixed_wk256_pad128[64U] = {
+  0xc28a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+  0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf574U,
+  0x649b69c1U, 0xf23e4787U, 0x0fe1edc6U, 0x240ca2dcU, 0x4fe9346fU, 0x4b1e84aaU, 0x61b9431eU, 0x36f9b39aU,
+  0xfa465156U, 0xb85a8e77U, 0xb01d681dU, 0x5e59c7eaU, 0x2faa3291U, 0x07e2a6fbU, 0x1f515a8eU, 0x6f915f0aU,
+  0x5fb4221dU, 0x612cc90aU, 0x35c3e883U, 0xa925d9d4U, 0x8b82d1b9U, 0x92848088U, 0x9a5b7704U, 0x034ba272U,
+  0x9f594686U, 0x6f480592U, 0xe49bee62U, 0xc1cf12ebU, 0x3ef55e11U, 0x1f0f59a3U, 0x327a0634U, 0xbfa4d9bcU,
+  0x770df572U, 0x9b9fbf40U, 0xc21be9e9U, 0xf5001d69U, 0x840ec6daU, 0x8a337f83U, 0xb737625aU, 0xe9b9ecd0U,
+  0xfe5d6d40U, 0xa52dab8dU, 0xee944592U, 0x5f2d004aU, 0x3bc8cb2eU, 0x36d964a4U, 0x5eb10cafU, 0x6289d971U
+};
+
+/* W[t] + K[t] for the padding block of a 128-byte message */
+static const uint64_t Hacl_SHA2_Fixed_wk512_pad128[80U] = {
+  0xc28a2f98d728ae22U, 0x7137449123ef65cdU, 0xb5c0fbcfec4d3b2fU, 0xe9b5dba58189dbbcU,
+  0x3956c25bf348b538U, 0x59f111f1b605d019U, 0x923f82a4af194f9bU, 0xab1c5ed5da6d8118U,
+  0xd807aa98a3030242U, 0x12835b0145706fbeU, 0x243185be4ee4b28cU, 0x550c7dc3d5ffb4e2U,
+  0x72be5d74f27b896fU, 0x80deb1fe3b1696b1U, 0x9bdc06a725c71235U, 0xc19bf174cf692a94U,
+  0x649b69c19ef14ad2U, 0xf03e4786384f45f3U, 0x11c1adc68b8cd5b9U, 0x240ca1dc77ad9c65U,
+  0x3df12c6f5b2b0295U, 0x6a74852aaeb0e883U, 0xdcb4cbddcd4a0114U, 0x36f988da845153c5U,
+  0x9b4761d2eea727cbU, 0xad33ee6d37b932c2U, 0xc143c7fbb90f6167U, 0x577487c7d5ef1fd6U,
+  0xe9250da555d6c804U, 0x1652326c7c6f319cU, 0x9c73c1308a6abe80U, 0xedcb859d96f4174fU,
+  0x05992bbc5302ea46U, 0xc0515d8c72d32b21U, 0xe27760859b58b01cU, 0xbd776eecd97e28bfU,
+  0xfec461e497d05dfbU, 0x8c65848a09b42f15U, 0x1d93677302646f8dU, 0x71d7625be0029f9bU,
+  0xed8c8b143b918647U, 0x5813345c6ddd5e95U, 0x44837edc639f1da6U, 0x65309e51db9245d4U,
+  0xa4de07e39af7c84cU, 0xea208293cb3b3d17U, 0x33abda924feb6a30U, 0x8965f30d8a442337U,
+  0x90808dcdb29ea41bU, 0xe2d6d8dad96f92caU, 0xfd690c3258486648U, 0xddb95f897e662ce2U,
+  0x6b2b08dcc03f02bcU, 0x261c68ddf66cc62cU, 0xa4f0eddd57c1364dU, 0xe35537ec1f29acd2U,
+  0x27e70659eef7b721U, 0xdabbb3bf5db9f4c8U, 0x34436c1241ad0e37U, 0x0302752801d6306bU,
+  0xbf77d7d65bedd8cdU, 0xa9871d46c85cd973U, 0x5fdbae1fae40e068U, 0x468af1bb676f47b0U,
+  0x809520bd379dac58U, 0x2766590af071ca9cU, 0xff96fca3577ecadeU, 0x1c490d6456b3b489U,
+  0xe85734c184192ce6U, 0x2ba01930bbb71001U, 0xabe1acaf661e43ebU, 0x120f3b5f15bf003dU,
+  0xfd7d4cd1515c8209U, 0x9cfa18c629a0c327U, 0x7e39ff2d2a3f2faeU, 0x2ff0a5398e575356U,
+  0xc9117833006d097eU, 0x09d40c7849733ff8U, 0x774d7c8f5f3aa6bdU, 0xe04b4161aa09de75U
+};
+
+/* Second half of the last block of a 32- or 96-byte message, in byte form
+ * for the SHA-NI path */
+static const uint8_t Hacl_SHA2_Fixed_tail256_32[32U] = { 0x80U, [30U] = 0x01U };
+
+static const uint8_t Hacl_SHA2_Fixed_tail256_96[32U] = { 0x80U, [30U] = 0x03U };
+
+#define ROTR32(x,n) ((x) >> (n) | (x) << (32U - (n)))
+#define ROTR64(x,n) ((x) >> (n) | (x) << (64U - (n)))
+
+/* 64 rounds over a schedule that already has the round constants added */
+static inline void Hacl_SHA2_Fixed_rounds256(uint32_t *hash_w, const uint32_t *wk)
+{
+  uint32_t a = hash_w[0U], b = hash_w[1U], c = hash_w[2U], d = hash_w[3U];
+  uint32_t e = hash_w[4U], f = hash_w[5U], g = hash_w[6U], h = hash_w[7U];
+  for (uint32_t i = 0U; i < 64U; i++) {
+    uint32_t t1 = h + (ROTR32(e, 6U) ^ ROTR32(e, 11U) ^ ROTR32(e, 25U)) + ((e & f) ^ (~e & g)) + wk[i];
+    uint32_t t2 = (ROTR32(a, 2U) ^ ROTR32(a, 13U) ^ ROTR32(a, 22U)) + ((a & b) ^ (a & c) ^ (b & c));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  hash_w[0U] += a;
+  hash_w[1U] += b;
+  hash_w[2U] += c;
+  hash_w[3U] += d;
+  hash_w[4U] += e;
+  hash_w[5U] += f;
+  hash_w[6U] += g;
+  hash_w[7U] += h;
+}
+
+/* Compresses one block given as 16 words. Inlined into each entry point, so
+ * constant padding words propagate into the first rounds of the schedule. */
+static inline void Hacl_SHA2_Fixed_block256(uint32_t *hash_w, uint32_t *ws)
+{
+  for (uint32_t i = 16U; i < 64U; i++) {
+    uint32_t t15 = ws[i - 15U];
+    uint32_t t2 = ws[i - 2U];
+    ws[i] =
+      (ROTR32(t2, 17U) ^ ROTR32(t2, 19U) ^ t2 >> 10U)
+      + ws[i - 7U]
+      + (ROTR32(t15, 7U) ^ ROTR32(t15, 18U) ^ t15 >> 3U)
+      + ws[i - 16U];
+  }
+  for (uint32_t i = 0U; i < 64U; i++)
+    ws[i] += Hacl_SHA2_State_k256[i];
+  Hacl_SHA2_Fixed_rounds256(hash_w, ws);
+}
+
+static inline void Hacl_SHA2_Fixed_load256(uint32_t *ws, uint8_t *data, uint32_t n1)
+{
+  for (uint32_t i = 0U; i < n1; i++)
+    ws[i] = load32_be(data + 4U * i);
+}
+
+static inline void Hacl_SHA2_Fixed_store256(uint8_t *hash1, uint32_t *hash_w)
+{
+  for (uint32_t i = 0U; i < 8U; i++)
+    store32_be(hash1 + 4U * i, hash_w[i]);
+}
+
+/* Words 8..15 of the last block of a 32- or 96-byte message */
+static inline void Hacl_SHA2_Fixed_tail256(uint32_t *ws, uint32_t bits)
+{
+  ws[8U] = 0x80000000U;
+  for (uint32_t i = 9U; i < 15U; i++)
+    ws[i] = 0U;
+  ws[15U] = bits;
+}
+
+void Hacl_SHA2_Fixed_sha256_32(uint8_t *hash1, uint8_t *input)
+{
+  uint32_t hash_w[8U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h256, sizeof hash_w);
+  if (Hacl_SHA2_256_SHANI_is_supported()) {
+    uint8_t block[64U];
+    memcpy(block, input, 32U);
+    memcpy(block + 32U, Hacl_SHA2_Fixed_tail256_32, 32U);
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, block, 1U);
+  } else {
+    uint32_t ws[64U];
+    Hacl_SHA2_Fixed_load256(ws, input, 8U);
+    Hacl_SHA2_Fixed_tail256(ws, 256U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+  }
+  Hacl_SHA2_Fixed_store256(hash1, hash_w);
+}
+
+void Hacl_SHA2_Fixed_sha256_64(uint8_t *hash1, uint8_t *input)
+{
+  uint32_t hash_w[8U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h256, sizeof hash_w);
+  if (Hacl_SHA2_256_SHANI_is_supported()) {
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, input, 1U);
+    Hacl_SHA2_256_SHANI_rounds(hash_w, Hacl_SHA2_Fixed_wk256_pad64);
+  } else {
+    uint32_t ws[64U];
+    Hacl_SHA2_Fixed_load256(ws, input, 16U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+    Hacl_SHA2_Fixed_rounds256(hash_w, Hacl_SHA2_Fixed_wk256_pad64);
+  }
+  Hacl_SHA2_Fixed_store256(hash1, hash_w);
+}
+
+void Hacl_SHA2_Fixed_sha256_96(uint8_t *hash1, uint8_t *input)
+{
+  uint32_t hash_w[8U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h256, sizeof hash_w);
+  if (Hacl_SHA2_256_SHANI_is_supported()) {
+    uint8_t block[64U];
+    memcpy(block, input + 64U, 32U);
+    memcpy(block + 32U, Hacl_SHA2_Fixed_tail256_96, 32U);
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, input, 1U);
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, block, 1U);
+  } else {
+    uint32_t ws[64U];
+    Hacl_SHA2_Fixed_load256(ws, input, 16U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+    Hacl_SHA2_Fixed_load256(ws, input + 64U, 8U);
+    Hacl_SHA2_Fixed_tail256(ws, 768U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+  }
+  Hacl_SHA2_Fixed_store256(hash1, hash_w);
+}
+
+void Hacl_SHA2_Fixed_sha256_128(uint8_t *hash1, uint8_t *input)
+{
+  uint32_t hash_w[8U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h256, sizeof hash_w);
+  if (Hacl_SHA2_256_SHANI_is_supported()) {
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, input, 2U);
+    Hacl_SHA2_256_SHANI_rounds(hash_w, Hacl_SHA2_Fixed_wk256_pad128);
+  } else {
+    uint32_t ws[64U];
+    Hacl_SHA2_Fixed_load256(ws, input, 16U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+    Hacl_SHA2_Fixed_load256(ws, input + 64U, 16U);
+    Hacl_SHA2_Fixed_block256(hash_w, ws);
+    Hacl_SHA2_Fixed_rounds256(hash_w, Hacl_SHA2_Fixed_wk256_pad128);
+  }
+  Hacl_SHA2_Fixed_store256(hash1, hash_w);
+}
+
+static inline void Hacl_SHA2_Fixed_rounds512(uint64_t *hash_w, const uint64_t *wk)
+{
+  uint64_t a = hash_w[0U], b = hash_w[1U], c = hash_w[2U], d = hash_w[3U];
+  uint64_t e = hash_w[4U], f = hash_w[5U], g = hash_w[6U], h = hash_w[7U];
+  for (uint32_t i = 0U; i < 80U; i++) {
+    uint64_t t1 = h + (ROTR64(e, 14U) ^ ROTR64(e, 18U) ^ ROTR64(e, 41U)) + ((e & f) ^ (~e & g)) + wk[i];
+    uint64_t t2 = (ROTR64(a, 28U) ^ ROTR64(a, 34U) ^ ROTR64(a, 39U)) + ((a & b) ^ (a & c) ^ (b & c));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  hash_w[0U] += a;
+  hash_w[1U] += b;
+  hash_w[2U] += c;
+  hash_w[3U] += d;
+  hash_w[4U] += e;
+  hash_w[5U] += f;
+  hash_w[6U] += g;
+  hash_w[7U] += h;
+}
+
+static inline void Hacl_SHA2_Fixed_block512(uint64_t *hash_w, uint64_t *ws)
+{
+  for (uint32_t i = 16U; i < 80U; i++) {
+    uint64_t t15 = ws[i - 15U];
+    uint64_t t2 = ws[i - 2U];
+    ws[i] =
+      (ROTR64(t2, 19U) ^ ROTR64(t2, 61U) ^ t2 >> 6U)
+      + ws[i - 7U]
+      + (ROTR64(t15, 1U) ^ ROTR64(t15, 8U) ^ t15 >> 7U)
+      + ws[i - 16U];
+  }
+  for (uint32_t i = 0U; i < 80U; i++)
+    ws[i] += Hacl_SHA2_State_k512[i];
+  Hacl_SHA2_Fixed_rounds512(hash_w, ws);
+}
+
+/* Single-block SHA-512 of a message of n1 words (n1 < 15) */
+static inline void Hacl_SHA2_Fixed_short512(uint8_t *hash1, uint8_t *input, uint32_t n1)
+{
+  uint64_t hash_w[8U];
+  uint64_t ws[80U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h512, sizeof hash_w);
+  for (uint32_t i = 0U; i < n1; i++)
+    ws[i] = load64_be(input + 8U * i);
+  ws[n1] = 0x8000000000000000U;
+  for (uint32_t i = n1 + 1U; i < 15U; i++)
+    ws[i] = 0U;
+  ws[15U] = (uint64_t)n1 * 64U;
+  Hacl_SHA2_Fixed_block512(hash_w, ws);
+  for (uint32_t i = 0U; i < 8U; i++)
+    store64_be(hash1 + 8U * i, hash_w[i]);
+}
+
+void Hacl_SHA2_Fixed_sha512_32(uint8_t *hash1, uint8_t *input)
+{
+  Hacl_SHA2_Fixed_short512(hash1, input, 4U);
+}
+
+void Hacl_SHA2_Fixed_sha512_64(uint8_t *hash1, uint8_t *input)
+{
+  Hacl_SHA2_Fixed_short512(hash1, input, 8U);
+}
+
+void Hacl_SHA2_Fixed_sha512_96(uint8_t *hash1, uint8_t *input)
+{
+  Hacl_SHA2_Fixed_short512(hash1, input, 12U);
+}
+
+void Hacl_SHA2_Fixed_sha512_128(uint8_t *hash1, uint8_t *input)
+{
+  uint64_t hash_w[8U];
+  uint64_t ws[80U];
+  memcpy(hash_w, Hacl_SHA2_Fixed_h512, sizeof hash_w);
+  for (uint32_t i = 0U; i < 16U; i++)
+    ws[i] = load64_be(input + 8U * i);
+  Hacl_SHA2_Fixed_block512(hash_w, ws);
+  Hacl_SHA2_Fixed_rounds512(hash_w, Hacl_SHA2_Fixed_wk512_pad128);
+  for (uint32_t i = 0U; i < 8U; i++)
+    store64_be(hash1 + 8U * i, hash_w[i]);
+}
@@ -0,0 +1,54 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_Fixed_H
+#define __Hacl_SHA2_Fixed_H
+
+#include <inttypes.h>
+
+/* Fixed-size SHA-2 one-shots (unverified).
+ *
+ * Hashes inputs of exactly 32, 64, 96 or 128 bytes (keys, Merkle node pairs,
+ * HKDF inputs). The padding and length words are compile-time constants:
+ * the final block is built directly in words instead of going through
+ * update_last, and when the final block is pure padding its message
+ * schedule (plus round constants) is a precomputed table. Digests are
+ * identical to Hacl_SHA2_{256,512}_hash on the same input. */
+
+void Hacl_SHA2_Fixed_sha256_32(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha256_64(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha256_96(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha256_128(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha512_32(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha512_64(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha512_96(uint8_t *hash1, uint8_t *input);
+
+void Hacl_SHA2_Fixed_sha512_128(uint8_t *hash1, uint8_t *input);
+
+#endif
@@ -0,0 +1,258 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_SHA2_State.h"
+#include "Hacl_SHA2_256_SHANI.h"
+
+const uint32_t Hacl_SHA2_State_k256[64] = {
+  0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+  0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+  0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+  0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+  0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+  0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+  0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+  0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U
+};
+
+const uint64_t Hacl_SHA2_State_k512[80] = {
+  0x428a2f98d728ae22U, 0x7137449123ef65cdU, 0xb5c0fbcfec4d3b2fU, 0xe9b5dba58189dbbcU,
+  0x3956c25bf348b538U, 0x59f111f1b605d019U, 0x923f82a4af194f9bU, 0xab1c5ed5da6d8118U,
+  0xd807aa98a3030242U, 0x12835b0145706fbeU, 0x243185be4ee4b28cU, 0x550c7dc3d5ffb4e2U,
+  0x72be5d74f27b896fU, 0x80deb1fe3b1696b1U, 0x9bdc06a725c71235U, 0xc19bf174cf692694U,
+  0xe49b69c19ef14ad2U, 0xefbe4786384f25e3U, 0x0fc19dc68b8cd5b5U, 0x240ca1cc77ac9c65U,
+  0x2de92c6f592b0275U, 0x4a7484aa6ea6e483U, 0x5cb0a9dcbd41fbd4U, 0x76f988da831153b5U,
+  0x983e5152ee66dfabU, 0xa831c66d2db43210U, 0xb00327c898fb213fU, 0xbf597fc7beef0ee4U,
+  0xc6e00bf33da88fc2U, 0xd5a79147930aa725U, 0x06ca6351e003826fU, 0x142929670a0e6e70U,
+  0x27b70a8546d22ffcU, 0x2e1b21385c26c926U, 0x4d2c6dfc5ac42aedU, 0x53380d139d95b3dfU,
+  0x650a73548baf63deU, 0x766a0abb3c77b2a8U, 0x81c2c92e47edaee6U, 0x92722c851482353bU,
+  0xa2bfe8a14cf10364U, 0xa81a664bbc423001U, 0xc24b8b70d0f89791U, 0xc76c51a30654be30U,
+  0xd192e819d6ef5218U, 0xd69906245565a910U, 0xf40e35855771202aU, 0x106aa07032bbd1b8U,
+  0x19a4c116b8d2d0c8U, 0x1e376c085141ab53U, 0x2748774cdf8eeb99U, 0x34b0bcb5e19b48a8U,
+  0x391c0cb3c5c95a63U, 0x4ed8aa4ae3418acbU, 0x5b9cca4f7763e373U, 0x682e6ff3d6b2b8a3U,
+  0x748f82ee5defb2fcU, 0x78a5636f43172f60U, 0x84c87814a1f0ab72U, 0x8cc702081a6439ecU,
+  0x90befffa23631e28U, 0xa4506cebde82bde9U, 0xbef9a3f7b2c67915U, 0xc67178f2e372532bU,
+  0xca273eceea26619cU, 0xd186b8c721c0c207U, 0xeada7dd6cde0eb1eU, 0xf57d4f7fee6ed178U,
+  0x06f067aa72176fbaU, 0x0a637dc5a2c898a6U, 0x113f9804bef90daeU, 0x1b710b35131c471bU,
+  0x28db77f523047d84U, 0x32caab7b40c72493U, 0x3c9ebe0a15c9bebcU, 0x431d67c49c100d4cU,
+  0x4cc5d4becb3e42b6U, 0x597f299cfc657e2aU, 0x5fcb6fab3ad6faecU, 0x6c44198c4a475817U
+};
+
+static const uint32_t Hacl_SHA2_State_h256[8] = {
+  0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+  0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+};
+
+static const uint64_t Hacl_SHA2_State_h384[8] = {
+  0xcbbb9d5dc1059ed8U, 0x629a292a367cd507U, 0x9159015a3070dd17U, 0x152fecd8f70e5939U,
+  0x67332667ffc00b31U, 0x8eb44a8768581511U, 0xdb0c2e0d64f98fa7U, 0x47b5481dbefa4fa4U
+};
+
+static const uint64_t Hacl_SHA2_State_h512[8] = {
+  0x6a09e667f3bcc908U, 0xbb67ae8584caa73bU, 0x3c6ef372fe94f82bU, 0xa54ff53a5f1d36f1U,
+  0x510e527fade682d1U, 0x9b05688c2b3e6c1fU, 0x1f83d9abfb41bd6bU, 0x5be0cd19137e2179U
+};
+
+#define ROTR32(x,n) ((x) >> (n) | (x) << (32U - (n)))
+#define ROTR64(x,n) ((x) >> (n) | (x) << (64U - (n)))
+
+static void Hacl_SHA2_State_compress256(uint32_t *hash_w, uint8_t *data, uint32_t n1)
+{
+  if (Hacl_SHA2_256_SHANI_is_supported()) {
+    Hacl_SHA2_256_SHANI_update_multi(hash_w, data, n1);
+    return;
+  }
+  for (uint32_t b = 0U; b < n1; b++) {
+    uint8_t *block = data + 64U * b;
+    uint32_t ws[64U];
+    for (uint32_t i = 0U; i < 16U; i++)
+      ws[i] = load32_be(block + 4U * i);
+    for (uint32_t i = 16U; i < 64U; i++) {
+      uint32_t t15 = ws[i - 15U];
+      uint32_t t2 = ws[i - 2U];
+      ws[i] =
+        (ROTR32(t2, 17U) ^ ROTR32(t2, 19U) ^ t2 >> 10U)
+        + ws[i - 7U]
+        + (ROTR32(t15, 7U) ^ ROTR32(t15, 18U) ^ t15 >> 3U)
+        + ws[i - 16U];
+    }
+    uint32_t a = hash_w[0U], bb = hash_w[1U], c = hash_w[2U], d = hash_w[3U];
+    uint32_t e = hash_w[4U], f = hash_w[5U], g = hash_w[6U], h = hash_w[7U];
+    for (uint32_t i = 0U; i < 64U; i++) {
+      uint32_t t1 =
+        h + (ROTR32(e, 6U) ^ ROTR32(e, 11U) ^ ROTR32(e, 25U)) + ((e & f) ^ (~e & g))
+        + Hacl_SHA2_State_k256[i] + ws[i];
+      uint32_t t2 = (ROTR32(a, 2U) ^ ROTR32(a, 13U) ^ ROTR32(a, 22U)) + ((a & bb) ^ (a & c) ^ (bb & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = bb;
+      bb = a;
+      a = t1 + t2;
+    }
+    hash_w[0U] += a;
+    hash_w[1U] += bb;
+    hash_w[2U] += c;
+    hash_w[3U] += d;
+    hash_w[4U] += e;
+    hash_w[5U] += f;
+    hash_w[6U] += g;
+    hash_w[7U] += h;
+  }
+}
+
+static void Hacl_SHA2_State_compress512(uint64_t *hash_w, uint8_t *data, uint32_t n1)
+{
+  for (uint32_t b = 0U; b < n1; b++) {
+    uint8_t *block = data + 128U * b;
+    uint64_t ws[80U];
+    for (uint32_t i = 0U; i < 16U; i++)
+      ws[i] = load64_be(block + 8U * i);
+    for (uint32_t i = 16U; i < 80U; i++) {
+      uint64_t t15 = ws[i - 15U];
+      uint64_t t2 = ws[i - 2U];
+      ws[i] =
+        (ROTR64(t2, 19U) ^ ROTR64(t2, 61U) ^ t2 >> 6U)
+        + ws[i - 7U]
+        + (ROTR64(t15, 1U) ^ ROTR64(t15, 8U) ^ t15 >> 7U)
+        + ws[i - 16U];
+    }
+    uint64_t a = hash_w[0U], bb = hash_w[1U], c = hash_w[2U], d = hash_w[3U];
+    uint64_t e = hash_w[4U], f = hash_w[5U], g = hash_w[6U], h = hash_w[7U];
+    for (uint32_t i = 0U; i < 80U; i++) {
+      uint64_t t1 =
+        h + (ROTR64(e, 14U) ^ ROTR64(e, 18U) ^ ROTR64(e, 41U)) + ((e & f) ^ (~e & g))
+        + Hacl_SHA2_State_k512[i] + ws[i];
+      uint64_t t2 = (ROTR64(a, 28U) ^ ROTR64(a, 34U) ^ ROTR64(a, 39U)) + ((a & bb) ^ (a & c) ^ (bb & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = bb;
+      bb = a;
+      a = t1 + t2;
+    }
+    hash_w[0U] += a;
+    hash_w[1U] += bb;
+    hash_w[2U] += c;
+    hash_w[3U] += d;
+    hash_w[4U] += e;
+    hash_w[5U] += f;
+    hash_w[6U] += g;
+    hash_w[7U] += h;
+  }
+}
+
+void Hacl_SHA2_State_sha256_init(Hacl_SHA2_State_sha256 *st)
+{
+  memcpy(st->hash_w, Hacl_SHA2_State_h256, sizeof st->hash_w);
+  st->counter = 0U;
+}
+
+void Hacl_SHA2_State_sha256_update_multi(Hacl_SHA2_State_sha256 *st, uint8_t *data, uint32_t n1)
+{
+  Hacl_SHA2_State_compress256(st->hash_w, data, n1);
+  st->counter += n1;
+}
+
+void Hacl_SHA2_State_sha256_update_last(Hacl_SHA2_State_sha256 *st, uint8_t *data, uint32_t len)
+{
+  uint8_t blocks[128U] = { 0U };
+  uint32_t nb = len < 56U ? 1U : 2U;
+  memcpy(blocks, data, len);
+  blocks[len] = 0x80U;
+  store64_be(blocks + 64U * nb - 8U, (st->counter * 64U + len) * 8U);
+  Hacl_SHA2_State_sha256_update_multi(st, blocks, nb);
+}
+
+void Hacl_SHA2_State_sha256_finish(Hacl_SHA2_State_sha256 *st, uint8_t *hash1)
+{
+  for (uint32_t i = 0U; i < 8U; i++)
+    store32_be(hash1 + 4U * i, st->hash_w[i]);
+}
+
+static void
+Hacl_SHA2_State_sha512_update_last_(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t len)
+{
+  uint8_t blocks[256U] = { 0U };
+  uint32_t nb = len < 112U ? 1U : 2U;
+  /* 128-bit big-endian bit length: counter * 1024 + len * 8 */
+  uint64_t lo = (st->counter << 10U) + (uint64_t)len * 8U;
+  uint64_t hi = (st->counter >> 54U) + (lo < (st->counter << 10U) ? 1U : 0U);
+  memcpy(blocks, data, len);
+  blocks[len] = 0x80U;
+  store64_be(blocks + 128U * nb - 16U, hi);
+  store64_be(blocks + 128U * nb - 8U, lo);
+  Hacl_SHA2_State_compress512(st->hash_w, blocks, nb);
+  st->counter += nb;
+}
+
+void Hacl_SHA2_State_sha384_init(Hacl_SHA2_State_sha512 *st)
+{
+  memcpy(st->hash_w, Hacl_SHA2_State_h384, sizeof st->hash_w);
+  st->counter = 0U;
+}
+
+void Hacl_SHA2_State_sha384_update_multi(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t n1)
+{
+  Hacl_SHA2_State_compress512(st->hash_w, data, n1);
+  st->counter += n1;
+}
+
+void Hacl_SHA2_State_sha384_update_last(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t len)
+{
+  Hacl_SHA2_State_sha512_update_last_(st, data, len);
+}
+
+void Hacl_SHA2_State_sha384_finish(Hacl_SHA2_State_sha512 *st, uint8_t *hash1)
+{
+  for (uint32_t i = 0U; i < 6U; i++)
+    store64_be(hash1 + 8U * i, st->hash_w[i]);
+}
+
+void Hacl_SHA2_State_sha512_init(Hacl_SHA2_State_sha512 *st)
+{
+  memcpy(st->hash_w, Hacl_SHA2_State_h512, sizeof st->hash_w);
+  st->counter = 0U;
+}
+
+void Hacl_SHA2_State_sha512_update_multi(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t n1)
+{
+  Hacl_SHA2_State_compress512(st->hash_w, data, n1);
+  st->counter += n1;
+}
+
+void Hacl_SHA2_State_sha512_update_last(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t len)
+{
+  Hacl_SHA2_State_sha512_update_last_(st, data, len);
+}
+
+void Hacl_SHA2_State_sha512_finish(Hacl_SHA2_State_sha512 *st, uint8_t *hash1)
+{
+  for (uint32_t i = 0U; i < 8U; i++)
+    store64_be(hash1 + 8U * i, st->hash_w[i]);
+}
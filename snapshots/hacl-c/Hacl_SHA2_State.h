@@ -0,0 +1,87 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_State_H
+#define __Hacl_SHA2_State_H
+
+#include <inttypes.h>
+
+/* Compact SHA-2 hashing states (unverified).
+ *
+ * The verified Hacl_SHA2_{256,384,512} states are flat arrays that embed a
+ * private copy of the round constants and a scratch message schedule
+ * (548 bytes for SHA-256, 1352 bytes for SHA-384/512), so every init writes
+ * the whole constant table. The states below only hold the chaining value
+ * and the block counter; the round constants are read from the shared
+ * tables Hacl_SHA2_State_k256 / Hacl_SHA2_State_k512, and the message
+ * schedule lives on the stack of the compression function. Init is a
+ * handful of stores.
+ *
+ * The calling convention matches the verified API: update_multi takes whole
+ * blocks, update_last takes the final partial block (strictly less than one
+ * block) and finish writes the digest. Digests are identical. */
+
+extern const uint32_t Hacl_SHA2_State_k256[64];
+
+extern const uint64_t Hacl_SHA2_State_k512[80];
+
+typedef struct
+{
+  uint32_t hash_w[8];
+  uint64_t counter;
+}
+Hacl_SHA2_State_sha256;
+
+/* Shared by SHA-384 and SHA-512, which only differ by IV and digest size */
+typedef struct
+{
+  uint64_t hash_w[8];
+  uint64_t counter;
+}
+Hacl_SHA2_State_sha512;
+
+void Hacl_SHA2_State_sha256_init(Hacl_SHA2_State_sha256 *st);
+
+void Hacl_SHA2_State_sha256_update_multi(Hacl_SHA2_State_sha256 *st, uint8_t *data, uint32_t n1);
+
+void Hacl_SHA2_State_sha256_update_last(Hacl_SHA2_State_sha256 *st, uint8_t *data, uint32_t len);
+
+void Hacl_SHA2_State_sha256_finish(Hacl_SHA2_State_sha256 *st, uint8_t *hash1);
+
+void Hacl_SHA2_State_sha384_init(Hacl_SHA2_State_sha512 *st);
+
+void Hacl_SHA2_State_sha384_update_multi(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t n1);
+
+void Hacl_SHA2_State_sha384_update_last(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t len);
+
+void Hacl_SHA2_State_sha384_finish(Hacl_SHA2_State_sha512 *st, uint8_t *hash1);
+
+void Hacl_SHA2_State_sha512_init(Hacl_SHA2_State_sha512 *st);
+
+void Hacl_SHA2_State_sha512_update_multi(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t n1);
+
+void Hacl_SHA2_State_sha512_update_last(Hacl_SHA2_State_sha512 *st, uint8_t *data, uint32_t len);
+
+void Hacl_SHA2_State_sha512_finish(Hacl_SHA2_State_sha512 *st, uint8_t *hash1);
+
+#endif
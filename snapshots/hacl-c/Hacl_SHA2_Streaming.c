@@ -0,0 +1,177 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "kremlib.h"
+#include "Hacl_SHA2_Streaming.h"
+
+/* Largest number of blocks handed to update_multi at once (its count is 32-bit) */
+#define HACL_SHA2_STREAMING_MAX_BLOCKS ((uint64_t)0x1000000U)
+
+/* Generic buffering over a block function, shared by the three hashes */
+static void
+Hacl_SHA2_Streaming_absorb(
+  void *st,
+  void (*update_multi)(void *st, uint8_t *data, uint32_t n1),
+  uint8_t *buf,
+  uint32_t *buf_len,
+  uint32_t block_size,
+  uint8_t *data,
+  uint64_t len
+)
+{
+  if (*buf_len > 0U) {
+    uint32_t fill = block_size - *buf_len;
+    if (len < (uint64_t)fill) {
+      memcpy(buf + *buf_len, data, (size_t)len);
+      *buf_len += (uint32_t)len;
+      return;
+    }
+    memcpy(buf + *buf_len, data, fill);
+    update_multi(st, buf, 1U);
+    *buf_len = 0U;
+    data += fill;
+    len -= fill;
+  }
+  uint64_t nblocks = len / block_size;
+  while (nblocks > 0U) {
+    uint64_t n = nblocks < HACL_SHA2_STREAMING_MAX_BLOCKS ? nblocks : HACL_SHA2_STREAMING_MAX_BLOCKS;
+    update_multi(st, data, (uint32_t)n);
+    data += n * block_size;
+    nblocks -= n;
+  }
+  *buf_len = (uint32_t)(len % block_size);
+  memcpy(buf, data, *buf_len);
+}
+
+static void Hacl_SHA2_Streaming_update_multi256(void *st, uint8_t *data, uint32_t n1)
+{
+  Hacl_SHA2_State_sha256_update_multi((Hacl_SHA2_State_sha256 *)st, data, n1);
+}
+
+static void Hacl_SHA2_Streaming_update_multi512(void *st, uint8_t *data, uint32_t n1)
+{
+  Hacl_SHA2_State_sha512_update_multi((Hacl_SHA2_State_sha512 *)st, data, n1);
+}
+
+void Hacl_SHA2_Streaming_sha256_init(Hacl_SHA2_Streaming_sha256 *ctx)
+{
+  Hacl_SHA2_State_sha256_init(&ctx->st);
+  ctx->buf_len = 0U;
+}
+
+void Hacl_SHA2_Streaming_sha256_update(Hacl_SHA2_Streaming_sha256 *ctx, uint8_t *data, uint64_t len)
+{
+  Hacl_SHA2_Streaming_absorb(&ctx->st, Hacl_SHA2_Streaming_update_multi256,
+    ctx->buf, &ctx->buf_len, 64U, data, len);
+}
+
+void Hacl_SHA2_Streaming_sha256_finish(Hacl_SHA2_Streaming_sha256 *ctx, uint8_t *hash1)
+{
+  Hacl_SHA2_State_sha256 st = ctx->st;
+  Hacl_SHA2_State_sha256_update_last(&st, ctx->buf, ctx->buf_len);
+  Hacl_SHA2_State_sha256_finish(&st, hash1);
+}
+
+void
+Hacl_SHA2_Streaming_sha256_copy(Hacl_SHA2_Streaming_sha256 *dst, Hacl_SHA2_Streaming_sha256 *src)
+{
+  dst->st = src->st;
+  dst->buf_len = src->buf_len;
+  memcpy(dst->buf, src->buf, src->buf_len);
+}
+
+void Hacl_SHA2_Streaming_sha256_hash(uint8_t *hash1, uint8_t *input, uint64_t len)
+{
+  Hacl_SHA2_Streaming_sha256 ctx;
+  Hacl_SHA2_Streaming_sha256_init(&ctx);
+  Hacl_SHA2_Streaming_sha256_update(&ctx, input, len);
+  Hacl_SHA2_Streaming_sha256_finish(&ctx, hash1);
+}
+
+void Hacl_SHA2_Streaming_sha384_init(Hacl_SHA2_Streaming_sha512 *ctx)
+{
+  Hacl_SHA2_State_sha384_init(&ctx->st);
+  ctx->buf_len = 0U;
+}
+
+void Hacl_SHA2_Streaming_sha384_update(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *data, uint64_t len)
+{
+  Hacl_SHA2_Streaming_absorb(&ctx->st, Hacl_SHA2_Streaming_update_multi512,
+    ctx->buf, &ctx->buf_len, 128U, data, len);
+}
+
+void Hacl_SHA2_Streaming_sha384_finish(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *hash1)
+{
+  Hacl_SHA2_State_sha512 st = ctx->st;
+  Hacl_SHA2_State_sha384_update_last(&st, ctx->buf, ctx->buf_len);
+  Hacl_SHA2_State_sha384_finish(&st, hash1);
+}
+
+void
+Hacl_SHA2_Streaming_sha384_copy(Hacl_SHA2_Streaming_sha512 *dst, Hacl_SHA2_Streaming_sha512 *src)
+{
+  Hacl_SHA2_Streaming_sha512_copy(dst, src);
+}
+
+void Hacl_SHA2_Streaming_sha384_hash(uint8_t *hash1, uint8_t *input, uint64_t len)
+{
+  Hacl_SHA2_Streaming_sha512 ctx;
+  Hacl_SHA2_Streaming_sha384_init(&ctx);
+  Hacl_SHA2_Streaming_sha384_update(&ctx, input, len);
+  Hacl_SHA2_Streaming_sha384_finish(&ctx, hash1);
+}
+
+void Hacl_SHA2_Streaming_sha512_init(Hacl_SHA2_Streaming_sha512 *ctx)
+{
+  Hacl_SHA2_State_sha512_init(&ctx->st);
+  ctx->buf_len = 0U;
+}
+
+void Hacl_SHA2_Streaming_sha512_update(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *data, uint64_t len)
+{
+  Hacl_SHA2_Streaming_absorb(&ctx->st, Hacl_SHA2_Streaming_update_multi512,
+    ctx->buf, &ctx->buf_len, 128U, data, len);
+}
+
+void Hacl_SHA2_Streaming_sha512_finish(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *hash1)
+{
+  Hacl_SHA2_State_sha512 st = ctx->st;
+  Hacl_SHA2_State_sha512_update_last(&st, ctx->buf, ctx->buf_len);
+  Hacl_SHA2_State_sha512_finish(&st, hash1);
+}
+
+void
+Hacl_SHA2_Streaming_sha512_copy(Hacl_SHA2_Streaming_sha512 *dst, Hacl_SHA2_Streaming_sha512 *src)
+{
+  dst->st = src->st;
+  dst->buf_len = src->buf_len;
+  memcpy(dst->buf, src->buf, src->buf_len);
+}
+
+void Hacl_SHA2_Streaming_sha512_hash(uint8_t *hash1, uint8_t *input, uint64_t len)
+{
+  Hacl_SHA2_Streaming_sha512 ctx;
+  Hacl_SHA2_Streaming_sha512_init(&ctx);
+  Hacl_SHA2_Streaming_sha512_update(&ctx, input, len);
+  Hacl_SHA2_Streaming_sha512_finish(&ctx, hash1);
+}
@@ -0,0 +1,93 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_SHA2_Streaming_H
+#define __Hacl_SHA2_Streaming_H
+
+#include <inttypes.h>
+
+#include "Hacl_SHA2_State.h"
+
+/* Streaming SHA-2 contexts (unverified).
+ *
+ * Unlike the verified block-level API, update accepts input of any length:
+ * a partial block is kept in the context until it can be completed, and
+ * every full block found in the input is compressed in place with
+ * update_multi, without being copied. finish does not modify the context,
+ * so a running hash can be queried and then extended; copy clones a
+ * context, e.g. to hash several messages sharing a common prefix.
+ *
+ * The one-shot hash functions take a 64-bit length, unlike
+ * Hacl_SHA2_{256,384,512}_hash; only the last partial block is copied. */
+
+typedef struct
+{
+  Hacl_SHA2_State_sha256 st;
+  uint32_t buf_len;
+  uint8_t buf[64];
+}
+Hacl_SHA2_Streaming_sha256;
+
+/* Shared by SHA-384 and SHA-512 */
+typedef struct
+{
+  Hacl_SHA2_State_sha512 st;
+  uint32_t buf_len;
+  uint8_t buf[128];
+}
+Hacl_SHA2_Streaming_sha512;
+
+void Hacl_SHA2_Streaming_sha256_init(Hacl_SHA2_Streaming_sha256 *ctx);
+
+void Hacl_SHA2_Streaming_sha256_update(Hacl_SHA2_Streaming_sha256 *ctx, uint8_t *data, uint64_t len);
+
+void Hacl_SHA2_Streaming_sha256_finish(Hacl_SHA2_Streaming_sha256 *ctx, uint8_t *hash1);
+
+void
+Hacl_SHA2_Streaming_sha256_copy(Hacl_SHA2_Streaming_sha256 *dst, Hacl_SHA2_Streaming_sha256 *src);
+
+void Hacl_SHA2_Streaming_sha256_hash(uint8_t *hash1, uint8_t *input, uint64_t len);
+
+void Hacl_SHA2_Streaming_sha384_init(Hacl_SHA2_Streaming_sha512 *ctx);
+
+void Hacl_SHA2_Streaming_sha384_update(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *data, uint64_t len);
+
+void Hacl_SHA2_Streaming_sha384_finish(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *hash1);
+
+void
+Hacl_SHA2_Streaming_sha384_copy(Hacl_SHA2_Streaming_sha512 *dst, Hacl_SHA2_Streaming_sha512 *src);
+
+void Hacl_SHA2_Streaming_sha384_hash(uint8_t *hash1, uint8_t *input, uint64_t len);
+
+void Hacl_SHA2_Streaming_sha512_init(Hacl_SHA2_Streaming_sha512 *ctx);
+
+void Hacl_SHA2_Streaming_sha512_update(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *data, uint64_t len);
+
+void Hacl_SHA2_Streaming_sha512_finish(Hacl_SHA2_Streaming_sha512 *ctx, uint8_t *hash1);
+
+void
+Hacl_SHA2_Streaming_sha512_copy(Hacl_SHA2_Streaming_sha512 *dst, Hacl_SHA2_Streaming_sha512 *src);
+
+void Hacl_SHA2_Streaming_sha512_hash(uint8_t *hash1, uint8_t *input, uint64_t len);
+
+#endif
@@ -0,0 +1,43 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_Util_H
+#define __Hacl_Util_H
+
+#include <stddef.h>
+#include <inttypes.h>
+
+/* Helpers shared by the hand-written modules and the NaCl and QUIC wrappers
+   (unverified). */
+
+/* Zeroes len bytes of secret material. The stores go through a volatile
+   pointer, so they are not removed when the buffer is dead afterwards (e.g.
+   just before it is freed or goes out of scope). */
+static inline void Hacl_Util_wipe(void *b, size_t len)
+{
+  volatile uint8_t *p = (volatile uint8_t *)b;
+  for (size_t i = 0U; i < len; i++)
+    p[i] = (uint8_t)0U;
+}
+
+#endif
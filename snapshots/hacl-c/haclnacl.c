@@ -28,6 +28,9 @@
 #include "haclnacl.h"
 #include "kremlib.h"
 #include "Hacl_Curve25519.h"
+#include "Hacl_Curve25519_Base.h"
+#include "Hacl_Box_Cache.h"
+#include "Hacl_Util.h"
 #include "Hacl_Chacha20.h"
 #include "Hacl_Salsa20.h"
 #include "Hacl_HMAC_SHA2_256.h"
@@ -48,6 +51,7 @@
 #include "Hacl_SHA2_512.h"
 #undef K___uint32_t_uint8_t_
 #include "NaCl.h"
+#include "Hacl_Dispatch.h"
 
 
 extern void randombytes(uint8_t *bytes, uint64_t bytes_len);
@@ -56,11 +60,11 @@ extern void randombytes(uint8_t *bytes, uint64_t bytes_len);
 /* HACL* Primitives and Constructions */
 
 void curve25519_scalarmult(uint8_t *out, uint8_t *secret, uint8_t *point){
-  Hacl_Curve25519_crypto_scalarmult(out, secret, point);
+  Hacl_Dispatch_curve25519(out, secret, point);
 }
 
 void chacha20(uint8_t *output, uint8_t *plain, uint32_t plain_len, uint8_t *key, uint8_t *nonce, uint32_t ctr){
-  Hacl_Chacha20_chacha20(output, plain, plain_len, key, nonce, ctr);
+  Hacl_Dispatch_chacha20(output, plain, plain_len, key, nonce, ctr);
 }
 
 void salsa20(uint8_t *output, uint8_t *plain, uint32_t len, uint8_t *key, uint8_t *nonce, uint64_t ctr){
@@ -68,7 +72,7 @@ void salsa20(uint8_t *output, uint8_t *plain, uint32_t len, uint8_t *key, uint8_
 }
 
 void poly1305_onetimeauth(uint8_t *output, uint8_t *input, uint64_t input_len, uint8_t *key){
-  Hacl_Poly1305_64_crypto_onetimeauth(output, input, input_len, key);
+  Hacl_Dispatch_poly1305(output, input, input_len, key);
 }
 
 uint32_t aead_chacha20_poly1305_encrypt(uint8_t *cipher, uint8_t *mac, uint8_t *msg, uint32_t msg_len, uint8_t *aad, uint32_t aad_len, uint8_t *key, uint8_t *nonce){
@@ -116,26 +120,36 @@ int crypto_auth_verify(const uint8_t *tag, const uint8_t *input, uint64_t input_
 
 int crypto_box_keypair(uint8_t *pk, uint8_t *sk){
   randombytes(sk, 32);
-  uint8_t basepoint[32] = {9};
-  curve25519_scalarmult(pk, sk, basepoint);
+  Hacl_Curve25519_secret_to_public(pk, sk);
   return 0;
 }
 
+/* The (pk, sk) variants take their precomputed key from Hacl_Box_Cache */
+
 int crypto_box_easy(uint8_t *c, const uint8_t *m,
                     uint64_t mlen, const uint8_t *n,
                     const uint8_t *pk, const uint8_t *sk){
-  return NaCl_crypto_box_easy(c, (uint8_t*)m, mlen, (uint8_t*)n, (uint8_t*)pk, (uint8_t*)sk);
+  uint8_t k[32];
+  Hacl_Box_Cache_beforenm(k, (uint8_t*)pk, (uint8_t*)sk);
+  int res = NaCl_crypto_box_easy_afternm(c, (uint8_t*)m, mlen, (uint8_t*)n, k);
+  Hacl_Util_wipe(k, 32);
+  return res;
 }
 
 int crypto_box_open_easy(uint8_t *m, const uint8_t *c,
                          uint64_t clen, const uint8_t *n,
                          const uint8_t *pk, const uint8_t *sk){
-  return NaCl_crypto_box_open_easy(m, (uint8_t*)c, clen, (uint8_t*)n, (uint8_t*)pk, (uint8_t*)sk);
+  uint8_t k[32];
+  Hacl_Box_Cache_beforenm(k, (uint8_t*)pk, (uint8_t*)sk);
+  int res = NaCl_crypto_box_open_easy_afternm(m, (uint8_t*)c, clen, (uint8_t*)n, k);
+  Hacl_Util_wipe(k, 32);
+  return res;
 }
 
 int crypto_box_beforenm(uint8_t *k, const uint8_t *pk,
                         const uint8_t *sk){
-  return NaCl_crypto_box_beforenm(k, (uint8_t*)pk, (uint8_t*)sk);
+  Hacl_Box_Cache_beforenm_uncached(k, (uint8_t*)pk, (uint8_t*)sk);
+  return 0;
 }
 
 int crypto_box_easy_afternm(uint8_t *c, const uint8_t *m,
@@ -155,11 +169,19 @@ uint32_t crypto_box_detached_afternm(uint8_t *c, uint8_t *mac, uint8_t *m, uint6
 }
 
 uint32_t crypto_box_detached(uint8_t *c, uint8_t *mac, uint8_t *m, uint64_t mlen, uint8_t *n, uint8_t *pk, uint8_t *sk){
-  return NaCl_crypto_box_detached(c, mac, m, mlen, n, pk, sk);
+  uint8_t k[32];
+  Hacl_Box_Cache_beforenm(k, pk, sk);
+  uint32_t res = NaCl_crypto_box_detached_afternm(c, mac, m, mlen, n, k);
+  Hacl_Util_wipe(k, 32);
+  return res;
 }
 
 uint32_t crypto_box_open_detached(uint8_t *m, uint8_t *c, uint8_t *mac, uint64_t mlen,  uint8_t *n, uint8_t *pk, uint8_t *sk){
-  return NaCl_crypto_box_open_detached(m, c, mac, mlen, n, pk, sk);
+  uint8_t k[32];
+  Hacl_Box_Cache_beforenm(k, pk, sk);
+  uint32_t res = NaCl_crypto_box_open_detached_afternm(m, c, mac, mlen, n, k);
+  Hacl_Util_wipe(k, 32);
+  return res;
 }
 
 uint32_t crypto_box_open_detached_afternm(uint8_t *m, uint8_t *c, uint8_t *mac, uint64_t mlen, uint8_t *n, uint8_t *k){
@@ -185,7 +207,7 @@ int crypto_box_open_afternm(uint8_t *msg, const uint8_t *cipher, uint64_t cipher
 
 
 int crypto_hash(uint8_t *output, const uint8_t *input,uint64_t input_len){
-  Hacl_SHA2_256_hash(output, (uint8_t *)input, input_len);
+  Hacl_Dispatch_sha256(output, (uint8_t *)input, input_len);
   return 0;
 }
 
@@ -206,14 +228,12 @@ int crypto_onetimeauth_verify(const uint8_t *auth, const uint8_t *input, uint64_
 
 
 int crypto_scalarmult_base(uint8_t *q, const uint8_t *n){
-  /* This leaves room for improvements with precomputations */
-  uint8_t basepoint[32] = {9};
-  Hacl_Curve25519_crypto_scalarmult(q, (uint8_t*)n, basepoint);
+  Hacl_Curve25519_secret_to_public(q, (uint8_t*)n);
   return 0;
 }
 
 int crypto_scalarmult(uint8_t *q, const uint8_t *n, const uint8_t *p){
-  Hacl_Curve25519_crypto_scalarmult(q, (uint8_t*)n, (uint8_t*)p);
+  Hacl_Dispatch_curve25519(q, (uint8_t*)n, (uint8_t*)p);
   return 0;
 }
 
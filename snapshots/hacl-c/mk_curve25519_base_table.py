@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+
+# Regenerates Hacl_Curve25519_Base_Table.h, the precomputed multiples of the
+# Ed25519 base point used by Hacl_Curve25519_Base.c:
+#
+#   python3 mk_curve25519_base_table.py > Hacl_Curve25519_Base_Table.h
+#
+# B and d are those of RFC 8032, section 5.1. Points are added in affine
+# Edwards coordinates with Python integers, independently of the C code.
+
+import sys
+
+p = 2**255 - 19
+d = -121665 * pow(121666, p - 2, p) % p
+By = 4 * pow(5, p - 2, p) % p
+
+
+def recover_x(y):
+    xx = (y * y - 1) * pow(d * y * y + 1, p - 2, p) % p
+    x = pow(xx, (p + 3) // 8, p)
+    if (x * x - xx) % p != 0:
+        x = x * pow(2, (p - 1) // 4, p) % p
+    if x % 2 != 0:
+        x = p - x
+    return x
+
+
+B = (recover_x(By), By)
+
+
+def add(P, Q):
+    (x1, y1), (x2, y2) = P, Q
+    t = d * x1 * x2 * y1 * y2 % p
+    x3 = (x1 * y2 + x2 * y1) * pow(1 + t, p - 2, p) % p
+    y3 = (y1 * y2 + x1 * x2) * pow(1 - t, p - 2, p) % p
+    return (x3, y3)
+
+
+def limbs(a):
+    return [(a >> (51 * k)) & (2**51 - 1) for k in range(5)]
+
+
+def niels(P):
+    x, y = P
+    return limbs((y + x) % p) + limbs((y - x) % p) + limbs(2 * d * x * y % p)
+
+
+LICENSE = """/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+"""
+
+HEADER = """
+#ifndef __Hacl_Curve25519_Base_Table_H
+#define __Hacl_Curve25519_Base_Table_H
+
+/* Precomputed multiples of the Ed25519 base point B, included by
+ * Hacl_Curve25519_Base.c only. Generated by mk_curve25519_base_table.py.
+ *
+ * Row i, entry j holds (j + 1) * 16^i * B in affine "Niels" form:
+ * (y + x, y - x, 2 * d * x * y) mod 2^255 - 19, each as five fully reduced
+ * 51-bit limbs, least significant first. Only the rows whose index is a
+ * multiple of HACL_CURVE25519_BASE_SPACING are compiled in. */
+
+static const uint64_t
+Hacl_Impl_Curve25519_Base_table[64U / HACL_CURVE25519_BASE_SPACING][8U][15U] =
+{
+"""
+
+
+def main():
+    out = [LICENSE, HEADER]
+    row = B
+    for i in range(64):
+        out.append("#if %d %% HACL_CURVE25519_BASE_SPACING == 0\n  {\n" % i)
+        P = row
+        entries = []
+        for j in range(8):
+            w = ["0x%013xU" % v for v in niels(P)]
+            lines = [", ".join(w[k:k + 5]) for k in range(0, 15, 5)]
+            entries.append("    {\n      " + ",\n      ".join(lines) + "\n    }")
+            P = add(P, row)
+        out.append(",\n".join(entries) + "\n  },\n#endif\n")
+        for _ in range(4):
+            row = add(row, row)
+    out.append("};\n\n#endif\n")
+    sys.stdout.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
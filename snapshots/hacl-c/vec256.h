@@ -0,0 +1,116 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __Vec256_H
+#define __Vec256_H
+
+/* 256-bit vectors for ChaCha20 (AVX2), after code/experimental/salsa-family/vec256.h.
+ *
+ * A vec256 holds the same row of two consecutive ChaCha20 blocks, one per
+ * 128-bit half; the operations below act on each half independently, so the
+ * 128-bit round code carries over unchanged. Only defined when the compiler
+ * targets AVX2 (VEC256 is then set). */
+
+#ifdef __MSVC__
+#define forceinline __forceinline inline
+#elif (defined(__GNUC__) || defined(__clang__))
+#define forceinline __attribute__((always_inline)) inline
+#else
+#define forceinline inline
+#endif
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define VEC256
+
+typedef __m256i vec256;
+
+static forceinline vec256 vec256_rotate_left_8(vec256 v) {
+  __m256i x = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+                              14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+  return _mm256_shuffle_epi8(v, x);
+}
+
+static forceinline vec256 vec256_rotate_left_16(vec256 v) {
+  __m256i x = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                              13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+  return _mm256_shuffle_epi8(v, x);
+}
+
+static forceinline vec256 vec256_rotate_left(vec256 v, unsigned int n) {
+  if (n == 8) return vec256_rotate_left_8(v);
+  if (n == 16) return vec256_rotate_left_16(v);
+  return _mm256_xor_si256(_mm256_slli_epi32(v, n),
+                          _mm256_srli_epi32(v, 32 - n));
+}
+
+/* Rotates the 4 words of each 128-bit half right by n positions */
+#define vec256_shuffle_right(x,n) \
+  _mm256_shuffle_epi32(x,_MM_SHUFFLE((3+(n))%4,(2+(n))%4,(1+(n))%4,(n)%4))
+
+static forceinline vec256 vec256_load_32x8(uint32_t x1, uint32_t x2, uint32_t x3, uint32_t x4,
+                                           uint32_t x5, uint32_t x6, uint32_t x7, uint32_t x8) {
+  return _mm256_set_epi32(x8, x7, x6, x5, x4, x3, x2, x1);
+}
+
+/* The same 4 words in both halves */
+static forceinline vec256 vec256_load_32x4(uint32_t x1, uint32_t x2, uint32_t x3, uint32_t x4) {
+  return _mm256_set_epi32(x4, x3, x2, x1, x4, x3, x2, x1);
+}
+
+static forceinline vec256 vec256_load_le(const unsigned char* in) {
+  return _mm256_loadu_si256((const __m256i*)(in));
+}
+
+/* 16 bytes broadcast to both halves */
+static forceinline vec256 vec256_load128_le(const unsigned char* in) {
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(in)));
+}
+
+static forceinline void vec256_store_le(unsigned char* out, vec256 v) {
+  _mm256_storeu_si256((__m256i*)(out), v);
+}
+
+static forceinline vec256 vec256_add(vec256 v1, vec256 v2) {
+  return _mm256_add_epi32(v1, v2);
+}
+
+static forceinline vec256 vec256_xor(vec256 v1, vec256 v2) {
+  return _mm256_xor_si256(v1, v2);
+}
+
+/* Adds n to the block counter (word 0) of both halves */
+static forceinline vec256 vec256_add_counter(vec256 v1, uint32_t n) {
+  return _mm256_add_epi32(v1, _mm256_set_epi32(0, 0, 0, n, 0, 0, 0, n));
+}
+
+/* Low half: half first of (v1.lo, v1.hi, v2.lo, v2.hi); high half: half second */
+#define vec256_choose_128(v1,v2,first,second) \
+  _mm256_permute2x128_si256((v1),(v2),(second)*16+(first))
+
+#define vec256_zero() _mm256_setzero_si256()
+
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2017 INRIA and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __Vec512_H
+#define __Vec512_H
+
+/* 512-bit vectors for ChaCha20 (AVX-512F).
+ *
+ * A vec512 holds the same row of four consecutive ChaCha20 blocks, one per
+ * 128-bit lane, extending the vec256 layout. Rotations are single vprold
+ * instructions, so the amount must be a compile-time constant. Only defined
+ * when the compiler targets AVX-512F (VEC512 is then set). */
+
+#ifdef __MSVC__
+#define forceinline __forceinline inline
+#elif (defined(__GNUC__) || defined(__clang__))
+#define forceinline __attribute__((always_inline)) inline
+#else
+#define forceinline inline
+#endif
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#define VEC512
+
+typedef __m512i vec512;
+
+#define vec512_rotate_left(v,n) _mm512_rol_epi32((v),(n))
+
+/* Rotates the 4 words of each 128-bit lane right by n positions */
+#define vec512_shuffle_right(x,n) \
+  _mm512_shuffle_epi32(x,(_MM_PERM_ENUM)_MM_SHUFFLE((3+(n))%4,(2+(n))%4,(1+(n))%4,(n)%4))
+
+/* The same 4 words in all four lanes */
+static forceinline vec512 vec512_load_32x4(uint32_t x1, uint32_t x2, uint32_t x3, uint32_t x4) {
+  return _mm512_set4_epi32(x4, x3, x2, x1);
+}
+
+static forceinline vec512 vec512_load_le(const unsigned char* in) {
+  return _mm512_loadu_si512((const void*)(in));
+}
+
+/* 16 bytes broadcast to all four lanes */
+static forceinline vec512 vec512_load128_le(const unsigned char* in) {
+  return _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)(in)));
+}
+
+static forceinline void vec512_store_le(unsigned char* out, vec512 v) {
+  _mm512_storeu_si512((void*)(out), v);
+}
+
+static forceinline vec512 vec512_add(vec512 v1, vec512 v2) {
+  return _mm512_add_epi32(v1, v2);
+}
+
+static forceinline vec512 vec512_xor(vec512 v1, vec512 v2) {
+  return _mm512_xor_si512(v1, v2);
+}
+
+/* Adds n to the block counter (word 0) of lane l, plus l */
+static forceinline vec512 vec512_add_counter(vec512 v1, uint32_t n) {
+  return _mm512_add_epi32(v1, _mm512_set_epi32(0, 0, 0, n + 3U, 0, 0, 0, n + 2U,
+                                               0, 0, 0, n + 1U, 0, 0, 0, n));
+}
+
+/* Lanes (v1[a], v1[b], v2[c], v2[d]) */
+#define vec512_choose_128(v1,v2,a,b,c,d) \
+  _mm512_shuffle_i32x4((v1),(v2),_MM_SHUFFLE((d),(c),(b),(a)))
+
+#endif
+
+#endif
@@ -0,0 +1,3 @@
+#define CRYPTO_BYTES 32
+#define CRYPTO_SCALARBYTES 32
+#define CRYPTO_VERSION "2.0"
@@ -0,0 +1,20 @@
+#include "crypto_scalarmult.h"
+#include "Hacl_Curve25519.h"
+#include "Hacl_Curve25519_64.h"
+
+int crypto_scalarmult(unsigned char *mypublic, const unsigned char *secret, const unsigned char *basepoint)
+{
+  /* CPUs without BMI2 and ADX run the 5x51-bit code instead */
+  if (Hacl_Curve25519_64_is_supported())
+    Hacl_Curve25519_64_crypto_scalarmult(mypublic, (uint8_t *)secret, (uint8_t *)basepoint);
+  else
+    Hacl_Curve25519_crypto_scalarmult(mypublic, (uint8_t *)secret, (uint8_t *)basepoint);
+  return 0;
+}
+
+static const unsigned char basepoint[32] = {9};
+
+int crypto_scalarmult_base(unsigned char *q,const unsigned char *n)
+{
+  return crypto_scalarmult(q,n,basepoint);
+}
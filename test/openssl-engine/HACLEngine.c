@@ -25,10 +25,7 @@
 #include "Chacha20.h"
 #include "Chacha20_Vec128.h"
 #include "Chacha20Poly1305.h"
-#define K___uint32_t_uint8_t_ whateveer
-#include "SHA2_256.h"
-#undef K___uint32_t_uint8_t_
-#include "SHA2_512.h"
+#include "Hacl_SHA2_Streaming.h"
 
 // OpenSSL private header for benchmarking purposes
 #include "crypto/include/internal/poly1305.h"
@@ -143,37 +140,32 @@ static int Wrapper_Chacha20_Cipher(EVP_CIPHER_CTX *ctx, unsigned char *out, cons
 
 #if IMPL==IMPL_HACL
 
-// In 32-bit words
-#define HACL_SHA2_256_STATE_SIZE 133
+// The streaming context buffers partial blocks, so OpenSSL may hand us input
+// of any length.
+#define HACL_SHA2_256_STATE_SIZE sizeof(Hacl_SHA2_Streaming_sha256)
 // In bytes
 #define HACL_SHA2_256_BLOCK_SIZE_B 64
 
 static int hacl_sha2_256_init(EVP_MD_CTX *ctx) {
-  uint32_t *state = EVP_MD_CTX_md_data(ctx);
-  SHA2_256_init(state);
+  Hacl_SHA2_Streaming_sha256 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha256_init(state);
   return 1;
 }
 
 static int hacl_sha2_256_update(EVP_MD_CTX *ctx, const void *data_r, size_t count) {
-  uint32_t *state = EVP_MD_CTX_md_data(ctx);
-  // Same remark as poly1305
-  uint32_t n_blocks = count / HACL_SHA2_256_BLOCK_SIZE_B;
-  uint8_t *data = (uint8_t *) data_r;
-  while (n_blocks--) {
-    SHA2_256_update(state, data);
-    data += HACL_SHA2_256_BLOCK_SIZE_B;
-  }
+  Hacl_SHA2_Streaming_sha256 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha256_update(state, (uint8_t *) data_r, count);
   return 1;
 }
 
 static int hacl_sha2_256_final(EVP_MD_CTX *ctx, unsigned char *md) {
-  uint32_t *state = EVP_MD_CTX_md_data(ctx);
-  SHA2_256_update_last(state, NULL, 0);
-  SHA2_256_finish(state, md);
+  Hacl_SHA2_Streaming_sha256 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha256_finish(state, md);
   return 1;
 }
 
 static int hacl_sha2_256_copy(EVP_MD_CTX *to, const EVP_MD_CTX *from) {
+  Hacl_SHA2_Streaming_sha256_copy(EVP_MD_CTX_md_data(to), EVP_MD_CTX_md_data(from));
   return 1;
 }
 
@@ -187,37 +179,30 @@ static int hacl_sha2_256_cleanup(EVP_MD_CTX *ctx) {
 
 #if IMPL==IMPL_HACL
 
-// In 64-bit words
-#define HACL_SHA2_512_STATE_SIZE 169
+#define HACL_SHA2_512_STATE_SIZE sizeof(Hacl_SHA2_Streaming_sha512)
 // In bytes
 #define HACL_SHA2_512_BLOCK_SIZE_B 128
 
 static int hacl_sha2_512_init(EVP_MD_CTX *ctx) {
-  uint64_t *state = EVP_MD_CTX_md_data(ctx);
-  SHA2_512_init(state);
+  Hacl_SHA2_Streaming_sha512 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha512_init(state);
   return 1;
 }
 
 static int hacl_sha2_512_update(EVP_MD_CTX *ctx, const void *data_r, size_t count) {
-  uint64_t *state = EVP_MD_CTX_md_data(ctx);
-  // Same remark as poly1305
-  uint32_t n_blocks = count / HACL_SHA2_512_BLOCK_SIZE_B;
-  uint8_t *data = (uint8_t *) data_r;
-  while (n_blocks--) {
-    SHA2_512_update(state, data);
-    data += HACL_SHA2_512_BLOCK_SIZE_B;
-  }
+  Hacl_SHA2_Streaming_sha512 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha512_update(state, (uint8_t *) data_r, count);
   return 1;
 }
 
 static int hacl_sha2_512_final(EVP_MD_CTX *ctx, unsigned char *md) {
-  uint64_t *state = EVP_MD_CTX_md_data(ctx);
-  SHA2_512_update_last(state, NULL, 0);
-  SHA2_512_finish(state, md);
+  Hacl_SHA2_Streaming_sha512 *state = EVP_MD_CTX_md_data(ctx);
+  Hacl_SHA2_Streaming_sha512_finish(state, md);
   return 1;
 }
 
 static int hacl_sha2_512_copy(EVP_MD_CTX *to, const EVP_MD_CTX *from) {
+  Hacl_SHA2_Streaming_sha512_copy(EVP_MD_CTX_md_data(to), EVP_MD_CTX_md_data(from));
   return 1;
 }
 
@@ -538,13 +523,13 @@ void Everest_create_all_the_things() {
   #if IMPL == IMPL_HACL
   hacl_sha2_256_digest = EVP_MD_meth_new(NID_sha256, NID_undef);
   if (hacl_sha2_256_digest == NULL ||
-    !EVP_MD_meth_set_result_size(hacl_sha2_256_digest, 64) ||
+    !EVP_MD_meth_set_result_size(hacl_sha2_256_digest, 32) ||
     !EVP_MD_meth_set_init(hacl_sha2_256_digest, hacl_sha2_256_init) ||
     !EVP_MD_meth_set_update(hacl_sha2_256_digest, hacl_sha2_256_update) ||
     !EVP_MD_meth_set_final(hacl_sha2_256_digest, hacl_sha2_256_final) ||
     !EVP_MD_meth_set_cleanup(hacl_sha2_256_digest, hacl_sha2_256_cleanup) ||
     !EVP_MD_meth_set_copy(hacl_sha2_256_digest, hacl_sha2_256_copy) ||
-    !EVP_MD_meth_set_app_datasize(hacl_sha2_256_digest, HACL_SHA2_256_STATE_SIZE * 8) ||
+    !EVP_MD_meth_set_app_datasize(hacl_sha2_256_digest, HACL_SHA2_256_STATE_SIZE) ||
     !EVP_MD_meth_set_input_blocksize(hacl_sha2_256_digest, HACL_SHA2_256_BLOCK_SIZE_B) ||
     !EVP_MD_meth_set_flags(hacl_sha2_256_digest, EVP_MD_FLAG_ONESHOT))
   {
@@ -569,7 +554,7 @@ void Everest_create_all_the_things() {
     !EVP_MD_meth_set_final(hacl_sha2_512_digest, hacl_sha2_512_final) ||
     !EVP_MD_meth_set_cleanup(hacl_sha2_512_digest, hacl_sha2_512_cleanup) ||
     !EVP_MD_meth_set_copy(hacl_sha2_512_digest, hacl_sha2_512_copy) ||
-    !EVP_MD_meth_set_app_datasize(hacl_sha2_512_digest, HACL_SHA2_512_STATE_SIZE * 8) ||
+    !EVP_MD_meth_set_app_datasize(hacl_sha2_512_digest, HACL_SHA2_512_STATE_SIZE) ||
     !EVP_MD_meth_set_input_blocksize(hacl_sha2_512_digest, HACL_SHA2_512_BLOCK_SIZE_B) ||
     !EVP_MD_meth_set_flags(hacl_sha2_512_digest, EVP_MD_FLAG_ONESHOT))
   {
@@ -18,6 +18,8 @@ int32_t perf_chacha() {
 #else
 
 #include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
 #include "sodium.h"
 #include "openssl/evp.h"
 
@@ -390,6 +392,10 @@ int32_t test_chacha()
   uint32_t ctx[32] = { 0 };
   Hacl_Chacha20_Vec128_chacha20(ciphertext,plaintext,len, key, nonce, counter);
   TestLib_compare_and_print("HACL Chacha20", expected, ciphertext, len);
+  Hacl_Chacha20_Vec256_chacha20(ciphertext,plaintext,len, key, nonce, counter);
+  TestLib_compare_and_print("HACL Chacha20 Vec256", expected, ciphertext, len);
+  Hacl_Chacha20_Vec512_chacha20(ciphertext,plaintext,len, key, nonce, counter);
+  TestLib_compare_and_print("HACL Chacha20 Vec512", expected, ciphertext, len);
 
   crypto_stream_chacha20_ietf_xor_ic(ciphertext,plaintext, len, nonce, 1, key);
   TestLib_compare_and_print("Sodium Chacha20", expected, ciphertext, len);
@@ -428,6 +434,34 @@ int32_t perf_chacha() {
     res += (uint64_t) plain[i];
   printf("Composite result (ignore): %" PRIx64 "\n", res);
 
+  t1 = clock();
+  a = TestLib_cpucycles_begin();
+  for (int i = 0; i < ROUNDS; i++){
+    Hacl_Chacha20_Vec256_chacha20(plain,plain,len, key, nonce, counter);
+    plain[0] = cipher[0];
+  }
+  b = TestLib_cpucycles_end();
+  t2 = clock();
+  print_results("HACL ChaCha20 Vec256 speed", (double)t2-t1,
+		(double) b - a, ROUNDS, PLAINLEN);
+  for (int i = 0; i < PLAINLEN; i++)
+    res += (uint64_t) plain[i];
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
+  t1 = clock();
+  a = TestLib_cpucycles_begin();
+  for (int i = 0; i < ROUNDS; i++){
+    Hacl_Chacha20_Vec512_chacha20(plain,plain,len, key, nonce, counter);
+    plain[0] = cipher[0];
+  }
+  b = TestLib_cpucycles_end();
+  t2 = clock();
+  print_results("HACL ChaCha20 Vec512 speed", (double)t2-t1,
+		(double) b - a, ROUNDS, PLAINLEN);
+  for (int i = 0; i < PLAINLEN; i++)
+    res += (uint64_t) plain[i];
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
   t1 = clock();
   a = TestLib_cpucycles_begin();
   for (int i = 0; i < ROUNDS; i++){
@@ -1,6 +1,9 @@
 #include "kremlib.h"
 #include "testlib.h"
 #include "Hacl_Curve25519.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Curve25519_Base.h"
+#include "Hacl_Curve25519_Vec256.h"
 #include "sodium.h"
 #include "tweetnacl.h"
 #include "ec_lcl.h"
@@ -313,6 +316,17 @@ int32_t test_curve()
   TestLib_compare_and_print("HACL Curve25519", expected1, result, KEYSIZE);
   Hacl_Curve25519_crypto_scalarmult(result, scalar2, input2);
   TestLib_compare_and_print("HACL Curve25519", expected2, result, KEYSIZE);
+  if (Hacl_Curve25519_64_is_supported()){
+    Hacl_Curve25519_64_crypto_scalarmult(result, scalar1, input1);
+    TestLib_compare_and_print("HACL Curve25519 (radix 2^64)", expected1, result, KEYSIZE);
+    Hacl_Curve25519_64_crypto_scalarmult(result, scalar2, input2);
+    TestLib_compare_and_print("HACL Curve25519 (radix 2^64)", expected2, result, KEYSIZE);
+  }
+
+  uint8_t basepoint[KEYSIZE] = {9}, expected_pk[KEYSIZE];
+  Hacl_Curve25519_crypto_scalarmult(expected_pk, scalar1, basepoint);
+  Hacl_Curve25519_secret_to_public(result, scalar1);
+  TestLib_compare_and_print("HACL Curve25519 fixed-base", expected_pk, result, KEYSIZE);
 
   int res = crypto_scalarmult_curve25519(result, scalar1, input1);
   TestLib_compare_and_print("Sodium Curve25519", expected1, result, KEYSIZE);
@@ -356,6 +370,21 @@ int32_t perf_curve() {
                                  + (uint64_t)*(mul+KEYSIZE*i+16) + (uint64_t)*(mul+KEYSIZE*i+24);
   printf("Composite result (ignore): %" PRIx64 "\n", res);
 
+  if (Hacl_Curve25519_64_is_supported()){
+    t1 = clock();
+    for (int i = 0; i < ROUNDS; i++){
+      a = TestLib_cpucycles();
+      Hacl_Curve25519_64_crypto_scalarmult(mul + KEYSIZE * i, sk + KEYSIZE * i, pk + KEYSIZE * i);
+      b = TestLib_cpucycles();
+      d[i] = b - a;
+    }
+    t2 = clock();
+    print_results("HACL Curve25519 (radix 2^64, MULX/ADX) speed", (double)(t2-t1)/ROUNDS, (double) median(d,ROUNDS), 1, 1);
+    for (int i = 0; i < ROUNDS; i++) res += (uint64_t)*(mul+KEYSIZE*i) + (uint64_t)*(mul+KEYSIZE*i+8)
+                                   + (uint64_t)*(mul+KEYSIZE*i+16) + (uint64_t)*(mul+KEYSIZE*i+24);
+    printf("Composite result (ignore): %" PRIx64 "\n", res);
+  }
+
   t1 = clock();
   for (int i = 0; i < ROUNDS; i++){
     a = TestLib_cpucycles();
@@ -402,6 +431,69 @@ int32_t perf_curve() {
                                  + (uint64_t)*(mul+KEYSIZE*i+16) + (uint64_t)*(mul+KEYSIZE*i+24);
   printf("Composite result (ignore): %" PRIx64 "\n", res);
 
+  uint8_t basepoint[KEYSIZE] = {9};
+  t1 = clock();
+  for (int i = 0; i < ROUNDS; i++){
+    a = TestLib_cpucycles();
+    Hacl_Curve25519_crypto_scalarmult(mul + KEYSIZE * i, sk + KEYSIZE * i, basepoint);
+    b = TestLib_cpucycles();
+    d[i] = b - a;
+  }
+  t2 = clock();
+  print_results("HACL Curve25519 keygen (ladder) speed", (double)(t2-t1)/ROUNDS, (double) median(d,ROUNDS), 1, 1);
+  t1 = clock();
+  for (int i = 0; i < ROUNDS; i++){
+    a = TestLib_cpucycles();
+    Hacl_Curve25519_secret_to_public(mul + KEYSIZE * i, sk + KEYSIZE * i);
+    b = TestLib_cpucycles();
+    d[i] = b - a;
+  }
+  t2 = clock();
+  print_results("HACL Curve25519 keygen (fixed-base) speed", (double)(t2-t1)/ROUNDS, (double) median(d,ROUNDS), 1, 1);
+  for (int i = 0; i < ROUNDS; i++) res += (uint64_t)*(mul+KEYSIZE*i) + (uint64_t)*(mul+KEYSIZE*i+8)
+                                 + (uint64_t)*(mul+KEYSIZE*i+16) + (uint64_t)*(mul+KEYSIZE*i+24);
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
+  /* Throughput of independent operations: 4-way AVX2 against serial calls */
+  uint8_t *out4[4], *sk4[4], *pk4[4];
+  double serial_s, x4_s, batch_s;
+  t1 = clock();
+  for (int i = 0; i < ROUNDS; i++)
+    Hacl_Curve25519_crypto_scalarmult(mul + KEYSIZE * i, sk + KEYSIZE * i, pk + KEYSIZE * i);
+  t2 = clock();
+  serial_s = (double)(t2 - t1) / CLOCKS_PER_SEC;
+  t1 = clock();
+  for (int i = 0; i < ROUNDS; i += 4){
+    for (int l = 0; l < 4; l++){
+      out4[l] = mul + KEYSIZE * (i + l);
+      sk4[l] = sk + KEYSIZE * (i + l);
+      pk4[l] = pk + KEYSIZE * (i + l);
+    }
+    Hacl_Curve25519_scalarmult_x4(out4, sk4, pk4);
+  }
+  t2 = clock();
+  x4_s = (double)(t2 - t1) / CLOCKS_PER_SEC;
+  printf("Testing: HACL Curve25519 throughput (AVX2 path: %s)\n",
+         Hacl_Curve25519_Vec256_is_supported() ? "yes" : "no");
+  t1 = clock();
+  for (int i = 0; i < ROUNDS; i += 64){
+    uint8_t *outb[64], *skb[64], *pkb[64];
+    int n = ROUNDS - i < 64 ? ROUNDS - i : 64;
+    for (int l = 0; l < n; l++){
+      outb[l] = mul + KEYSIZE * (i + l);
+      skb[l] = sk + KEYSIZE * (i + l);
+      pkb[l] = pk + KEYSIZE * (i + l);
+    }
+    Hacl_Curve25519_scalarmult_batch(outb, skb, pkb, n);
+  }
+  t2 = clock();
+  batch_s = (double)(t2 - t1) / CLOCKS_PER_SEC;
+  printf("Serial calls: %.0f ops/sec; scalarmult_x4: %.0f ops/sec (%.2fx); scalarmult_batch: %.0f ops/sec (%.2fx)\n",
+         ROUNDS / serial_s, ROUNDS / x4_s, serial_s / x4_s, ROUNDS / batch_s, serial_s / batch_s);
+  for (int i = 0; i < ROUNDS; i++) res += (uint64_t)*(mul+KEYSIZE*i) + (uint64_t)*(mul+KEYSIZE*i+8)
+                                 + (uint64_t)*(mul+KEYSIZE*i+16) + (uint64_t)*(mul+KEYSIZE*i+24);
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
   flush_results("X25519", hacl_cy, sodium_cy, ossl_cy, tweet_cy, hacl_utime, sodium_utime, ossl_utime, tweet_utime, 1, 1);
 
   return exit_success;
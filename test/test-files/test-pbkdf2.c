@@ -0,0 +1,112 @@
+#include "kremlib.h"
+#include "testlib.h"
+#include "Hacl_PBKDF2_SHA2.h"
+#include <openssl/evp.h>
+#include "hacl_test_utils.h"
+
+#define ITERATIONS 10000
+#define BATCH 64
+#define PASSLEN 16
+#define SALTLEN 16
+
+int32_t test_pbkdf2()
+{
+  // Random passwords and salts of every length up to two blocks, against OpenSSL
+  uint8_t password[256], salt[256], hacl_dk[160], ossl_dk[160];
+  if (! read_random_bytes(256, password) || ! read_random_bytes(256, salt))
+    return exit_failure;
+  for (uint32_t len = 0; len <= 256; len += 7){
+    uint32_t dklen = 1 + len % 160;
+    Hacl_PBKDF2_SHA2_sha256(hacl_dk, dklen, password, len, salt, 256 - len, 2);
+    PKCS5_PBKDF2_HMAC((char *)password, len, salt, 256 - len, 2, EVP_sha256(), dklen, ossl_dk);
+    if (memcmp(hacl_dk, ossl_dk, dklen) != 0){
+      printf("PBKDF2-HMAC-SHA256 differs from OpenSSL on password length %d\n", len);
+      return exit_failure;
+    }
+    Hacl_PBKDF2_SHA2_sha512(hacl_dk, dklen, password, len, salt, 256 - len, 2);
+    PKCS5_PBKDF2_HMAC((char *)password, len, salt, 256 - len, 2, EVP_sha512(), dklen, ossl_dk);
+    if (memcmp(hacl_dk, ossl_dk, dklen) != 0){
+      printf("PBKDF2-HMAC-SHA512 differs from OpenSSL on password length %d\n", len);
+      return exit_failure;
+    }
+  }
+  printf("PBKDF2-HMAC-SHA2 matches OpenSSL\n");
+  return exit_success;
+}
+
+int32_t perf_pbkdf2_hash(const char *name, const EVP_MD *md, uint32_t dklen,
+  void (*single)(uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *, uint32_t, uint32_t),
+  uint32_t (*verify)(uint8_t *, uint8_t **, uint32_t, uint8_t **, uint32_t *, uint8_t **, uint32_t *, uint32_t, uint32_t))
+{
+  uint8_t* buf = malloc(BATCH * (PASSLEN + SALTLEN + dklen));
+  if (! read_random_bytes(BATCH * (PASSLEN + SALTLEN), buf))
+    return 1;
+  uint8_t *password[BATCH], *salt[BATCH], *expected[BATCH];
+  uint32_t passlen[BATCH], saltlen[BATCH];
+  uint8_t ok[BATCH];
+  for (int i = 0; i < BATCH; i++){
+    password[i] = buf + PASSLEN * i;
+    salt[i] = buf + BATCH * PASSLEN + SALTLEN * i;
+    expected[i] = buf + BATCH * (PASSLEN + SALTLEN) + dklen * i;
+    passlen[i] = PASSLEN;
+    saltlen[i] = SALTLEN;
+  }
+  uint64_t res = 0;
+  double ossl_cy, hacl_cy, hacl_batch_cy;
+  cycles a,b;
+
+  a = TestLib_cpucycles_begin();
+  for (int i = 0; i < BATCH; i++)
+    PKCS5_PBKDF2_HMAC((char *)password[i], PASSLEN, salt[i], SALTLEN, ITERATIONS, md, dklen, expected[i]);
+  b = TestLib_cpucycles_end();
+  ossl_cy = (double)b - a;
+
+  uint8_t dk[64];
+  a = TestLib_cpucycles_begin();
+  for (int i = 0; i < BATCH; i++){
+    single(dk, dklen, password[i], PASSLEN, salt[i], SALTLEN, ITERATIONS);
+    res += (uint64_t)(memcmp(dk, expected[i], dklen) == 0);
+  }
+  b = TestLib_cpucycles_end();
+  hacl_cy = (double)b - a;
+
+  a = TestLib_cpucycles_begin();
+  res += verify(ok, expected, dklen, password, passlen, salt, saltlen, ITERATIONS, BATCH);
+  b = TestLib_cpucycles_end();
+  hacl_batch_cy = (double)b - a;
+
+  printf("%s (%d iterations, %d-byte output), cycles per derivation:\n", name, ITERATIONS, dklen);
+  printf("  OpenSSL PKCS5_PBKDF2_HMAC: %.0f\n", ossl_cy / BATCH);
+  printf("  HACL single:               %.0f (%.2fx)\n", hacl_cy / BATCH, ossl_cy / hacl_cy);
+  printf("  HACL verify_batch x %d:    %.0f (%.2fx)\n", BATCH, hacl_batch_cy / BATCH, ossl_cy / hacl_batch_cy);
+  printf("Matches: %" PRIu64 " / %d\n", res, 2 * BATCH);
+
+  free(buf);
+  return res == 2 * BATCH ? exit_success : exit_failure;
+}
+
+int32_t perf_pbkdf2()
+{
+  int32_t res = perf_pbkdf2_hash("PBKDF2-HMAC-SHA256", EVP_sha256(), 32,
+    Hacl_PBKDF2_SHA2_sha256, Hacl_PBKDF2_SHA2_sha256_verify_batch);
+  if (res == exit_success)
+    res = perf_pbkdf2_hash("PBKDF2-HMAC-SHA512", EVP_sha512(), 64,
+      Hacl_PBKDF2_SHA2_sha512, Hacl_PBKDF2_SHA2_sha512_verify_batch);
+  return res;
+}
+
+int32_t main(int argc, char *argv[])
+{
+  if (argc < 2 || strcmp(argv[1], "perf") == 0 ) {
+    int32_t res = test_pbkdf2();
+    if (res == exit_success) {
+      res = perf_pbkdf2();
+    }
+    return res;
+  } else if (argc == 2 && strcmp (argv[1], "unit-test") == 0 ) {
+    return test_pbkdf2();
+  } else {
+    printf("Error: expected arguments 'perf' (default) or 'unit-test'.\n");
+    return exit_failure;
+  }
+}
@@ -1,6 +1,7 @@
 #include "kremlib.h"
 #include "testlib.h"
 #include "Hacl_Poly1305_64.h"
+#include "Hacl_Poly1305_Vec256.h"
 #include "sodium.h"
 #include "internal/poly1305.h"
 #include "poly1305_local.h"
@@ -176,6 +177,8 @@ int32_t test_poly()
   memset(mac, 0, MACSIZE * sizeof mac[0]);
   Hacl_Poly1305_64_crypto_onetimeauth(mac, plaintext, 34, key);
   TestLib_compare_and_print("HACL Poly1305", expected, mac, MACSIZE);
+  Hacl_Poly1305_Vec256_crypto_onetimeauth(mac, plaintext, len_, key);
+  TestLib_compare_and_print("HACL Poly1305 Vec256", expected, mac, MACSIZE);
   Hacl_Poly1305_64_crypto_onetimeauth(mac, plaintext, len_, key);
   TestLib_compare_and_print("Sodium Poly1305", expected, mac, MACSIZE);
   return exit_success;
@@ -207,6 +210,19 @@ int32_t perf_poly() {
 				     + (uint64_t)*(macs+MACSIZE*i+16) + (uint64_t)*(macs+MACSIZE*i+24);
   printf("Composite result (ignore): %" PRIx64 "\n", res);
 
+  t1 = clock();
+  a = TestLib_cpucycles_begin();
+  for (int i = 0; i < ROUNDS; i++){
+    Hacl_Poly1305_Vec256_crypto_onetimeauth(macs + MACSIZE * i, plain, len, key);
+  }
+  b = TestLib_cpucycles_end();
+  t2 = clock();
+  print_results("HACL Poly1305 Vec256 speed", (double)t2-t1,
+		(double) b - a, ROUNDS, PLAINLEN);
+  for (int i = 0; i < ROUNDS; i++) res += (uint64_t)*(macs+MACSIZE*i) + (uint64_t)*(macs+MACSIZE*i+8)
+				     + (uint64_t)*(macs+MACSIZE*i+16) + (uint64_t)*(macs+MACSIZE*i+24);
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
   t1 = clock();
   a = TestLib_cpucycles_begin();
   for (int i = 0; i < ROUNDS; i++){
@@ -1,10 +1,14 @@
 #include "kremlib.h"
 #include "testlib.h"
 #include "Hacl_SHA2_256.h"
+#include "Hacl_SHA2_256_Multi.h"
+#include "Hacl_SHA2_256_Tree.h"
+#include "Hacl_SHA2_Fixed.h"
 #include "sodium.h"
 #include "tweetnacl.h"
 #include <openssl/sha.h>
 #include "hacl_test_utils.h"
+#include <unistd.h>
 
 void print_results(char *txt, double t1, uint64_t d1, int rounds, int plainlen){
   printf("Testing: %s\n", txt);
@@ -76,6 +80,7 @@ int32_t perf_sha256() {
   if (! read_random_bytes(len, plain))
     return 1;
   uint8_t* macs = malloc(ROUNDS * SIGSIZE * sizeof(char));
+  uint64_t res = 0;
 
   cycles a,b;
   clock_t t1,t2;
@@ -145,6 +150,145 @@ int32_t perf_sha256() {
   return exit_success;
 }
 
+#define MULTI_MSGLEN 64
+#define MULTI_MSGS 1024
+
+int32_t perf_sha256_multi() {
+  double hacl_cy, hacl_multi_cy, hacl_utime, hacl_multi_utime;
+  uint32_t len = MULTI_MSGS * MULTI_MSGLEN * sizeof(char);
+  uint8_t* plain = malloc(len);
+  if (! read_random_bytes(len, plain))
+    return 1;
+  uint8_t* macs = malloc(MULTI_MSGS * 32 * sizeof(char));
+  uint8_t* input[MULTI_MSGS];
+  uint8_t* hash[MULTI_MSGS];
+  uint32_t lens[MULTI_MSGS];
+  for (int i = 0; i < MULTI_MSGS; i++){
+    input[i] = plain + MULTI_MSGLEN * i;
+    hash[i] = macs + 32 * i;
+    lens[i] = MULTI_MSGLEN;
+  }
+  uint64_t res = 0;
+
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = TestLib_cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++){
+    for (int i = 0; i < MULTI_MSGS; i++)
+      Hacl_SHA2_256_hash(hash[i], input[i], lens[i]);
+  }
+  b = TestLib_cpucycles_end();
+  t2 = clock();
+  hacl_cy = (double)b - a;
+  hacl_utime = (double)t2 - t1;
+  print_results("HACL SHA256 speed (1024 x 64 bytes, scalar)", (double)t2-t1,
+		(double) b - a, ROUNDS, len);
+  for (int i = 0; i < MULTI_MSGS; i++) res += (uint64_t)*(macs+32*i) + (uint64_t)*(macs+32*i+8);
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
+  t1 = clock();
+  a = TestLib_cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++){
+    Hacl_SHA2_256_hash_multi(hash, input, lens, MULTI_MSGS);
+  }
+  b = TestLib_cpucycles_end();
+  t2 = clock();
+  hacl_multi_cy = (double)b - a;
+  hacl_multi_utime = (double)t2 - t1;
+  printf("Multi-buffer lanes: %" PRIu32 "\n", Hacl_SHA2_256_Multi_lanes);
+  print_results("HACL SHA256 speed (1024 x 64 bytes, multi-buffer)", (double)t2-t1,
+		(double) b - a, ROUNDS, len);
+  for (int i = 0; i < MULTI_MSGS; i++) res += (uint64_t)*(macs+32*i) + (uint64_t)*(macs+32*i+8);
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+  printf("Multi-buffer speedup: %.2fx\n", hacl_cy / hacl_multi_cy);
+
+  flush_results("SHA256-multi", hacl_multi_cy, 0, 0, 0, hacl_multi_utime, 0, 0, 0, ROUNDS, len);
+
+  free(plain);
+  free(macs);
+  return exit_success;
+}
+
+#define FIXED_MSGS 1024
+
+int32_t perf_sha256_fixed() {
+  uint8_t* plain = malloc(FIXED_MSGS * 128 * sizeof(char));
+  if (! read_random_bytes(FIXED_MSGS * 128, plain))
+    return 1;
+  uint8_t* macs = malloc(FIXED_MSGS * 32 * sizeof(char));
+  void (*fixed[4])(uint8_t *, uint8_t *) = {
+    Hacl_SHA2_Fixed_sha256_32, Hacl_SHA2_Fixed_sha256_64, Hacl_SHA2_Fixed_sha256_96, Hacl_SHA2_Fixed_sha256_128
+  };
+  uint64_t res = 0;
+
+  cycles a,b;
+  // Short-message latency of the generic one-shot and the fixed-size entry points
+  for (int k = 0; k < 4; k++){
+    uint32_t msglen = 32 * (k + 1);
+    double hacl_cy, hacl_fixed_cy;
+    a = TestLib_cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++){
+      for (int i = 0; i < FIXED_MSGS; i++)
+        Hacl_SHA2_256_hash(macs + 32 * i, plain + 128 * i, msglen);
+    }
+    b = TestLib_cpucycles_end();
+    hacl_cy = (double)b - a;
+    for (int i = 0; i < FIXED_MSGS; i++) res += (uint64_t)*(macs+32*i) + (uint64_t)*(macs+32*i+8);
+    a = TestLib_cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++){
+      for (int i = 0; i < FIXED_MSGS; i++)
+        fixed[k](macs + 32 * i, plain + 128 * i);
+    }
+    b = TestLib_cpucycles_end();
+    hacl_fixed_cy = (double)b - a;
+    for (int i = 0; i < FIXED_MSGS; i++) res += (uint64_t)*(macs+32*i) + (uint64_t)*(macs+32*i+8);
+    printf("HACL SHA256 %3" PRIu32 " bytes: %.1f cycles/hash generic, %.1f cycles/hash fixed-size (%.2fx)\n",
+           msglen, hacl_cy / ROUNDS / FIXED_MSGS, hacl_fixed_cy / ROUNDS / FIXED_MSGS, hacl_cy / hacl_fixed_cy);
+  }
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
+  free(plain);
+  free(macs);
+  return exit_success;
+}
+
+#define TREE_LEN (256 * 1024 * 1024)
+
+static double wall_time(){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int32_t perf_sha256_tree() {
+  uint64_t len = TREE_LEN * sizeof(char);
+  uint8_t* plain = malloc(len);
+  if (! read_random_bytes(len, plain))
+    return 1;
+  uint8_t root[32];
+  uint64_t res = 0;
+  long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+  double base = 0;
+
+  // Wall-clock throughput, doubling the number of threads up to the core count
+  for (long n = 1; ; n = 2 * n < ncpus ? 2 * n : ncpus){
+    double t1 = wall_time();
+    if (! Hacl_SHA2_256_Tree_hash(root, plain, len, (uint32_t)n, NULL))
+      return exit_failure;
+    double t2 = wall_time();
+    if (n == 1) base = t2 - t1;
+    printf("HACL SHA256 tree (256MB, %ld threads): %.2f GB/s (%.2fx)\n", n, (double)len / (t2 - t1) / 1e9, base / (t2 - t1));
+    res += (uint64_t)root[0] + (uint64_t)root[8];
+    if (n >= ncpus) break;
+  }
+  printf("Composite result (ignore): %" PRIx64 "\n", res);
+
+  free(plain);
+  return exit_success;
+}
+
 int32_t main(int argc, char *argv[])
 {
   if (argc < 2 || strcmp(argv[1], "perf") == 0 ) {
@@ -152,6 +296,15 @@ int32_t main(int argc, char *argv[])
     if (res == exit_success) {
       res = perf_sha256();
     }
+    if (res == exit_success) {
+      res = perf_sha256_multi();
+    }
+    if (res == exit_success) {
+      res = perf_sha256_fixed();
+    }
+    if (res == exit_success) {
+      res = perf_sha256_tree();
+    }
     return res;
   } else if (argc == 2 && strcmp (argv[1], "unit-test") == 0 ) {
     return test_sha256();
@@ -5,7 +5,35 @@
 #include <time.h>
 
 #include "haclnacl.h"
+#include "Hacl_Chacha20.h"
 #include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "Hacl_Chacha20Poly1305.h"
+#include "Hacl_Chacha20Poly1305_Stitched.h"
+#include "Hacl_Chacha20Poly1305_Streaming.h"
+#include "Hacl_Chacha20Poly1305_IOVec.h"
+#include "Hacl_Chacha20Poly1305_Batch.h"
+#include "Hacl_Chacha20Poly1305_Keyed.h"
+#include "Hacl_SHA2_256.h"
+#include "Hacl_SHA2_256_Multi.h"
+#include "Hacl_SHA2_256_SHANI.h"
+#include "Hacl_SHA2_256_Tree.h"
+#include "Hacl_SHA2_384.h"
+#include "Hacl_SHA2_512.h"
+#include "Hacl_SHA2_Fixed.h"
+#include "Hacl_SHA2_State.h"
+#include "Hacl_SHA2_Streaming.h"
+#include "Hacl_HMAC_SHA2.h"
+#include "Hacl_HMAC_SHA2_256.h"
+#include "Hacl_PBKDF2_SHA2.h"
+#include "Hacl_Dispatch.h"
+#include "Hacl_Cpu_Features.h"
+#include "Hacl_Curve25519_Base.h"
+#include "Hacl_Curve25519_Vec256.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_Box_Cache.h"
+#include "Hacl_Poly1305_Vec256.h"
 #include "Hacl_Unverified_Random.h"
 
 #include "tweetnacl.h"
@@ -139,6 +167,160 @@ bool unit_test_chacha20_vec128(){
   return pass;
 }
 
+bool unit_test_chacha20_vec256(){
+  int a;
+  bool pass = true;
+
+  if (!Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_Chacha20_Vec256)){
+    printf("Chacha20 Vec256 not supported by this CPU, skipped\n");
+    return pass;
+  }
+  uint8_t ciphertext[114];
+  memset(ciphertext, 0, 114 * sizeof ciphertext[0]);
+  uint32_t counter = (uint32_t )1;
+  Hacl_Chacha20_Vec256_chacha20(ciphertext,chacha_plaintext,114, chacha_key, chacha_nonce, counter);
+
+    a = memcmp(ciphertext, chacha_ciphertext, 114 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("Chacha20 Vec256 failed on RFC test of size 114\n.");
+      return pass;
+    }
+  // Every length across the 8-block, 2-block and partial-block paths, against
+  // the scalar code, including a block counter that wraps around
+  uint32_t max_len = 1100;
+  uint8_t *plaintext = malloc(max_len), *expected = malloc(max_len), *hacl_cipher = malloc(max_len);
+  READ_RANDOM_BYTES(max_len, plaintext);
+  uint32_t counters[2] = { 7, 0xfffffffcU };
+  for (uint32_t c = 0; pass && c < 2; c++)
+    for (uint32_t len = 0; len <= max_len; len++){
+      Hacl_Chacha20_chacha20(expected, plaintext, len, chacha_key, chacha_nonce, counters[c]);
+      Hacl_Chacha20_Vec256_chacha20(hacl_cipher, plaintext, len, chacha_key, chacha_nonce, counters[c]);
+      if (memcmp(hacl_cipher, expected, len * sizeof (uint8_t)) != 0){
+        pass = false;
+        printf("Chacha20 Vec256 failed on input of size %d\n", len);
+        break;
+      }
+    }
+  free(plaintext);
+  free(expected);
+  free(hacl_cipher);
+  return pass;
+}
+
+bool unit_test_chacha20_vec512(){
+  int a;
+  bool pass = true;
+
+  if (!Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_Chacha20_Vec512)){
+    printf("Chacha20 Vec512 not supported by this CPU, skipped\n");
+    return pass;
+  }
+  uint8_t ciphertext[114];
+  memset(ciphertext, 0, 114 * sizeof ciphertext[0]);
+  uint32_t counter = (uint32_t )1;
+  Hacl_Chacha20_Vec512_chacha20(ciphertext,chacha_plaintext,114, chacha_key, chacha_nonce, counter);
+
+    a = memcmp(ciphertext, chacha_ciphertext, 114 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("Chacha20 Vec512 failed on RFC test of size 114\n.");
+      return pass;
+    }
+  // Every length across the 16-block loop and each tail path, against
+  // the scalar code, including a block counter that wraps around
+  uint32_t max_len = 2400;
+  uint8_t *plaintext = malloc(max_len), *expected = malloc(max_len), *hacl_cipher = malloc(max_len);
+  READ_RANDOM_BYTES(max_len, plaintext);
+  uint32_t counters[2] = { 7, 0xfffffffcU };
+  for (uint32_t c = 0; pass && c < 2; c++)
+    for (uint32_t len = 0; len <= max_len; len++){
+      Hacl_Chacha20_chacha20(expected, plaintext, len, chacha_key, chacha_nonce, counters[c]);
+      Hacl_Chacha20_Vec512_chacha20(hacl_cipher, plaintext, len, chacha_key, chacha_nonce, counters[c]);
+      if (memcmp(hacl_cipher, expected, len * sizeof (uint8_t)) != 0){
+        pass = false;
+        printf("Chacha20 Vec512 failed on input of size %d\n", len);
+        break;
+      }
+    }
+  free(plaintext);
+  free(expected);
+  free(hacl_cipher);
+  return pass;
+}
+
+bool unit_test_dispatch(){
+  bool pass = true;
+  uint32_t max_len = 1500;
+  uint8_t *plaintext = malloc(max_len), *expected = malloc(max_len), *hacl_cipher = malloc(max_len);
+  uint8_t key[32], nonce[12], tag[16], expected_tag[16], hash[32], expected_hash[32];
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  printf("CPU features 0x%x; backends: ChaCha20 %d, Poly1305 %d, SHA-256 %d, Curve25519 %d\n",
+         Hacl_Cpu_Features_get(), Hacl_Dispatch_chacha20_get(),
+         Hacl_Dispatch_poly1305_get(), Hacl_Dispatch_sha256_get(),
+         Hacl_Dispatch_curve25519_get());
+
+  // Every ChaCha20 backend the CPU supports, selected through the override API
+  for (int impl = Hacl_Dispatch_Chacha20_Scalar; pass && impl <= Hacl_Dispatch_Chacha20_Vec512; impl++){
+    bool supported = Hacl_Dispatch_chacha20_is_supported(impl);
+    if (Hacl_Dispatch_chacha20_set(impl) != supported){
+      pass = false;
+      printf("Dispatch: ChaCha20 override of backend %d not handled\n", impl);
+    }
+    if (!supported) continue;
+    for (uint32_t len = 0; len <= max_len; len += 37){
+      Hacl_Chacha20_chacha20(expected, plaintext, len, key, nonce, 1);
+      Hacl_Dispatch_chacha20(hacl_cipher, plaintext, len, key, nonce, 1);
+      if (Hacl_Dispatch_chacha20_get() != impl || memcmp(hacl_cipher, expected, len) != 0){
+        pass = false;
+        printf("Dispatch: ChaCha20 backend %d failed on input of size %d\n", impl, len);
+        break;
+      }
+    }
+  }
+  if (Hacl_Dispatch_chacha20_lookup((Hacl_Dispatch_chacha20_impl)(Hacl_Dispatch_Chacha20_Vec512 + 1)) != Hacl_Chacha20_chacha20){
+    pass = false;
+    printf("Dispatch: ChaCha20 lookup out of range did not fall back to the scalar backend\n");
+  }
+  for (int impl = Hacl_Dispatch_Poly1305_32; pass && impl <= Hacl_Dispatch_Poly1305_Vec256; impl++){
+    if (!Hacl_Dispatch_poly1305_set(impl)) continue;
+    for (uint32_t len = 0; len <= max_len; len += 19){
+      tweet_crypto_onetimeauth(expected_tag, plaintext, len, key);
+      Hacl_Dispatch_poly1305(tag, plaintext, len, key);
+      if (memcmp(tag, expected_tag, 16) != 0){
+        pass = false;
+        printf("Dispatch: Poly1305 backend %d failed on input of size %d\n", impl, len);
+        break;
+      }
+    }
+  }
+  Hacl_Dispatch_sha256_set(Hacl_Dispatch_SHA256_Portable);
+  if (Hacl_SHA2_256_SHANI_is_supported()){
+    pass = false;
+    printf("Dispatch: SHA-256 portable override ignored\n");
+  }
+  Hacl_SHA2_256_hash(expected_hash, plaintext, max_len);
+  if (Hacl_Dispatch_sha256_set(Hacl_Dispatch_SHA256_SHANI)){
+    Hacl_Dispatch_sha256(hash, plaintext, max_len);
+    if (!Hacl_SHA2_256_SHANI_is_supported() || memcmp(hash, expected_hash, 32) != 0){
+      pass = false;
+      printf("Dispatch: SHA-256 SHA-NI backend failed\n");
+    }
+  }
+  Hacl_Dispatch_reset();
+  if (Hacl_Dispatch_chacha20_get() < Hacl_Dispatch_Chacha20_Vec512
+      && Hacl_Dispatch_chacha20_is_supported(Hacl_Dispatch_chacha20_get() + 1)){
+    pass = false;
+    printf("Dispatch: reset did not select the fastest ChaCha20 backend\n");
+  }
+  free(plaintext);
+  free(expected);
+  free(hacl_cipher);
+  return pass;
+}
+
 bool unit_test_aead(){
   int a;
   bool pass = true;
@@ -186,6 +368,452 @@ result:
   return pass;
 }
 
+bool unit_test_aead_stitched(){
+  bool pass = true;
+  uint32_t max_len = 3 * HACL_CHACHA20POLY1305_STITCHED_CHUNK;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t *expected_cipher = malloc(max_len);
+  uint8_t *hacl_cipher = malloc(max_len);
+  uint8_t *decrypted = malloc(max_len);
+  uint8_t key[32], nonce[12], aad[64], expected_mac[16], hacl_mac[16];
+  uint32_t aad_lens[4] = { 0, 1, 12, 64 };
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  READ_RANDOM_BYTES(64, aad);
+  // Both Poly1305 code paths, around the chunk boundaries and the last block
+  Hacl_Dispatch_poly1305_impl polys[2] = { Hacl_Dispatch_Poly1305_Vec256, Hacl_Dispatch_Poly1305_64 };
+  for (int p = 0; p < 2 && pass; p++){
+    if (!Hacl_Dispatch_poly1305_set(polys[p]))
+      continue;
+    for (uint32_t len = 0; len <= max_len && pass; len += (len < 200 || len % HACL_CHACHA20POLY1305_STITCHED_CHUNK > HACL_CHACHA20POLY1305_STITCHED_CHUNK - 80) ? 1 : 61){
+      uint32_t aadlen = aad_lens[len % 4];
+      aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, aadlen, key, nonce);
+      Hacl_Chacha20Poly1305_Stitched_aead_encrypt(hacl_cipher, hacl_mac, plaintext, len, aad, aadlen, key, nonce);
+      if (memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+        pass = false;
+        printf("Stitched AEAD encryption failed on input of size %d\n", len);
+        break;
+      }
+      if (Hacl_Chacha20Poly1305_Stitched_aead_decrypt(decrypted, hacl_cipher, len, hacl_mac, aad, aadlen, key, nonce) != 0
+          || memcmp(decrypted, plaintext, len) != 0){
+        pass = false;
+        printf("Stitched AEAD decryption failed on input of size %d\n", len);
+        break;
+      }
+    }
+  }
+  Hacl_Dispatch_reset();
+  // In place, then a forged tag: rejected, and no plaintext left behind
+  uint32_t len = max_len;
+  memcpy(hacl_cipher, plaintext, len);
+  Hacl_Chacha20Poly1305_Stitched_aead_encrypt(hacl_cipher, hacl_mac, hacl_cipher, len, aad, 12, key, nonce);
+  aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, 12, key, nonce);
+  if (memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+    pass = false;
+    printf("Stitched AEAD failed on in-place encryption\n");
+  }
+  if (Hacl_Chacha20Poly1305_Stitched_aead_decrypt(hacl_cipher, hacl_cipher, len, hacl_mac, aad, 12, key, nonce) != 0
+      || memcmp(hacl_cipher, plaintext, len) != 0){
+    pass = false;
+    printf("Stitched AEAD failed on in-place decryption\n");
+  }
+  hacl_mac[3] ^= 0x10;
+  memset(decrypted, 0xa5, len);
+  if (Hacl_Chacha20Poly1305_Stitched_aead_decrypt(decrypted, expected_cipher, len, hacl_mac, aad, 12, key, nonce) != 1){
+    pass = false;
+    printf("Stitched AEAD accepted a forged tag\n");
+  }
+  for (uint32_t i = 0; i < len; i++){
+    if (decrypted[i] != 0){
+      pass = false;
+      printf("Stitched AEAD released plaintext under a forged tag\n");
+      break;
+    }
+  }
+  free(plaintext);
+  free(expected_cipher);
+  free(hacl_cipher);
+  free(decrypted);
+  return pass;
+}
+bool unit_test_aead_streaming(){
+  bool pass = true;
+  uint32_t max_len = 3000;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t *expected_cipher = malloc(max_len);
+  uint8_t *hacl_cipher = malloc(max_len);
+  uint8_t *decrypted = malloc(max_len);
+  uint8_t key[32], nonce[12], aad[100], expected_mac[16], hacl_mac[16];
+  uint8_t sizes[64];
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  READ_RANDOM_BYTES(100, aad);
+  READ_RANDOM_BYTES(64, sizes);
+  Hacl_Dispatch_poly1305_impl polys[2] = { Hacl_Dispatch_Poly1305_Vec256, Hacl_Dispatch_Poly1305_64 };
+  for (int p = 0; p < 2 && pass; p++){
+    if (!Hacl_Dispatch_poly1305_set(polys[p]))
+      continue;
+    for (uint32_t t = 0; t < 200 && pass; t++){
+      uint32_t len = t < 100 ? t : (t * 997) % max_len;
+      uint32_t aadlen = (t * 7) % 100;
+      Hacl_Chacha20Poly1305_Streaming_state ctx;
+      aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, aadlen, key, nonce);
+      // Random pieces: up to 23 bytes of AAD at a time, up to 255 bytes of message
+      Hacl_Chacha20Poly1305_Streaming_init(&ctx, key, nonce);
+      uint32_t off = 0, i = t;
+      while (off < aadlen){
+        uint32_t n = sizes[i++ % 64] % 24;
+        if (n > aadlen - off) n = aadlen - off;
+        Hacl_Chacha20Poly1305_Streaming_aad(&ctx, aad + off, n);
+        off += n;
+      }
+      off = 0;
+      while (off < len){
+        uint32_t n = sizes[i++ % 64];
+        if (n > len - off) n = len - off;
+        Hacl_Chacha20Poly1305_Streaming_encrypt_update(&ctx, hacl_cipher + off, plaintext + off, n);
+        off += n;
+      }
+      Hacl_Chacha20Poly1305_Streaming_encrypt_finish(&ctx, hacl_mac);
+      if (memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+        pass = false;
+        printf("Streaming AEAD encryption failed on input of size %d\n", len);
+        break;
+      }
+      // Decryption in place, in different pieces
+      memcpy(decrypted, expected_cipher, len);
+      Hacl_Chacha20Poly1305_Streaming_init(&ctx, key, nonce);
+      Hacl_Chacha20Poly1305_Streaming_aad(&ctx, aad, aadlen);
+      off = 0;
+      while (off < len){
+        uint32_t n = sizes[i++ % 64] * 3;
+        if (n > len - off) n = len - off;
+        Hacl_Chacha20Poly1305_Streaming_decrypt_update(&ctx, decrypted + off, decrypted + off, n);
+        off += n;
+      }
+      if (Hacl_Chacha20Poly1305_Streaming_decrypt_finish(&ctx, expected_mac) != 0 || memcmp(decrypted, plaintext, len) != 0){
+        pass = false;
+        printf("Streaming AEAD decryption failed on input of size %d\n", len);
+        break;
+      }
+      // A tag from other AAD is rejected
+      Hacl_Chacha20Poly1305_Streaming_init(&ctx, key, nonce);
+      Hacl_Chacha20Poly1305_Streaming_aad(&ctx, aad, aadlen + 1);
+      Hacl_Chacha20Poly1305_Streaming_decrypt_update(&ctx, decrypted, expected_cipher, len);
+      if (Hacl_Chacha20Poly1305_Streaming_decrypt_finish(&ctx, expected_mac) != 1){
+        pass = false;
+        printf("Streaming AEAD accepted a wrong tag on input of size %d\n", len);
+        break;
+      }
+      Hacl_Chacha20Poly1305_Streaming_wipe(&ctx);
+      for (uint32_t i = 0; i < sizeof ctx; i++){
+        if (((uint8_t *)&ctx)[i] != 0){
+          pass = false;
+          printf("Streaming AEAD context not wiped\n");
+          break;
+        }
+      }
+    }
+  }
+  Hacl_Dispatch_reset();
+  free(plaintext);
+  free(expected_cipher);
+  free(hacl_cipher);
+  free(decrypted);
+  return pass;
+}
+// Cuts buf[0..len) into at most max_cnt segments of random lengths (some empty)
+static uint32_t iovec_split(Hacl_Chacha20Poly1305_IOVec_iovec *v, uint32_t max_cnt, uint8_t *buf, uint32_t len, uint8_t *sizes){
+  uint32_t cnt = 0, off = 0;
+  while (cnt + 1 < max_cnt && off < len){
+    uint32_t n = sizes[cnt] % 96;
+    if (n > len - off) n = len - off;
+    v[cnt].buf = buf + off;
+    v[cnt].len = n;
+    off += n;
+    cnt++;
+  }
+  v[cnt].buf = buf + off;
+  v[cnt].len = len - off;
+  return cnt + 1;
+}
+
+bool unit_test_aead_iovec(){
+  bool pass = true;
+  uint32_t max_len = 1500;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t *expected_cipher = malloc(max_len);
+  uint8_t *hacl_cipher = malloc(max_len);
+  uint8_t *decrypted = malloc(max_len);
+  uint8_t key[32], nonce[12], aad[64], expected_mac[16], hacl_mac[16];
+  uint8_t sizes[3][32];
+  Hacl_Chacha20Poly1305_IOVec_iovec m[32], c[32], a[32];
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  READ_RANDOM_BYTES(64, aad);
+  for (uint32_t t = 0; t < 100 && pass; t++){
+    uint32_t len = (t * 331) % max_len;
+    uint32_t aadlen = t % 64;
+    READ_RANDOM_BYTES(3 * 32, (uint8_t *)sizes);
+    uint32_t m_cnt = iovec_split(m, 32, plaintext, len, sizes[0]);
+    uint32_t c_cnt = iovec_split(c, 32, hacl_cipher, len, sizes[1]);
+    uint32_t a_cnt = iovec_split(a, 8, aad, aadlen, sizes[2]);
+    aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, aadlen, key, nonce);
+    if (Hacl_Chacha20Poly1305_IOVec_aead_encrypt(c, c_cnt, hacl_mac, m, m_cnt, a, a_cnt, key, nonce) != 0
+        || memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+      pass = false;
+      printf("Scatter-gather AEAD encryption failed on input of size %d\n", len);
+      break;
+    }
+    // In place, over the segments of the ciphertext
+    memcpy(decrypted, expected_cipher, len);
+    c_cnt = iovec_split(c, 32, decrypted, len, sizes[1]);
+    if (Hacl_Chacha20Poly1305_IOVec_aead_decrypt(c, c_cnt, c, c_cnt, expected_mac, a, a_cnt, key, nonce) != 0
+        || memcmp(decrypted, plaintext, len) != 0){
+      pass = false;
+      printf("Scatter-gather AEAD decryption failed on input of size %d\n", len);
+      break;
+    }
+    if (len == 0)
+      continue;
+    // Output one byte short
+    m_cnt = iovec_split(m, 32, decrypted, len - 1, sizes[0]);
+    c_cnt = iovec_split(c, 32, expected_cipher, len, sizes[1]);
+    if (Hacl_Chacha20Poly1305_IOVec_aead_decrypt(m, m_cnt, c, c_cnt, expected_mac, a, a_cnt, key, nonce) != 1){
+      pass = false;
+      printf("Scatter-gather AEAD accepted a short output\n");
+      break;
+    }
+    // Forged tag: rejected and the output zeroed
+    m_cnt = iovec_split(m, 32, decrypted, len, sizes[0]);
+    expected_mac[t % 16] ^= 1;
+    if (Hacl_Chacha20Poly1305_IOVec_aead_decrypt(m, m_cnt, c, c_cnt, expected_mac, a, a_cnt, key, nonce) != 1){
+      pass = false;
+      printf("Scatter-gather AEAD accepted a forged tag\n");
+      break;
+    }
+    for (uint32_t i = 0; i < len; i++){
+      if (decrypted[i] != 0){
+        pass = false;
+        printf("Scatter-gather AEAD released plaintext under a forged tag\n");
+        break;
+      }
+    }
+  }
+  free(plaintext);
+  free(expected_cipher);
+  free(hacl_cipher);
+  free(decrypted);
+  return pass;
+}
+
+bool unit_test_aead_batch(){
+  bool pass = true;
+  uint32_t n = 100, max_len = HACL_CHACHA20POLY1305_BATCH_MAX_LEN + 100;
+  uint8_t *plaintext = malloc(n * max_len);
+  uint8_t *expected_cipher = malloc(n * max_len);
+  uint8_t *hacl_cipher = malloc(n * max_len);
+  uint8_t *nonces = malloc(n * 12);
+  uint8_t *aads = malloc(n * 40);
+  uint8_t *expected_macs = malloc(n * 16);
+  uint8_t *hacl_macs = malloc(n * 16);
+  uint32_t *res = malloc(n * sizeof (uint32_t));
+  Hacl_Chacha20Poly1305_Batch_packet *p = malloc(n * sizeof (Hacl_Chacha20Poly1305_Batch_packet));
+  uint8_t key[32];
+  READ_RANDOM_BYTES(n * max_len, plaintext);
+  READ_RANDOM_BYTES(n * 12, nonces);
+  READ_RANDOM_BYTES(n * 40, aads);
+  READ_RANDOM_BYTES(32, key);
+  // Mostly short packets, a few past the batching limit
+  for (uint32_t i = 0; i < n; i++){
+    p[i].nonce = nonces + 12 * i;
+    p[i].aad = aads + 40 * i;
+    p[i].aadlen = (i * 7) % 41;
+    p[i].len = i % 10 == 9 ? max_len - i : (i * i * 13) % 300;
+    p[i].mac = hacl_macs + 16 * i;
+    aead_chacha20_poly1305_encrypt(expected_cipher + max_len * i, expected_macs + 16 * i, plaintext + max_len * i,
+                                   p[i].len, p[i].aad, p[i].aadlen, key, p[i].nonce);
+  }
+  // The AVX2 lanes, and the per-packet path
+  Hacl_Dispatch_chacha20_impl impls[2] = { Hacl_Dispatch_Chacha20_Vec256, Hacl_Dispatch_Chacha20_Vec128 };
+  for (int t = 0; t < 2 && pass; t++){
+    if (!Hacl_Dispatch_chacha20_set(impls[t]))
+      continue;
+    for (uint32_t i = 0; i < n; i++){
+      p[i].input = plaintext + max_len * i;
+      p[i].output = hacl_cipher + max_len * i;
+    }
+    Hacl_Chacha20Poly1305_Batch_aead_encrypt(p, n, key);
+    for (uint32_t i = 0; i < n; i++){
+      if (memcmp(hacl_cipher + max_len * i, expected_cipher + max_len * i, p[i].len) != 0
+          || memcmp(hacl_macs + 16 * i, expected_macs + 16 * i, 16) != 0){
+        pass = false;
+        printf("Batch AEAD encryption failed on packet %d (size %d)\n", i, p[i].len);
+        break;
+      }
+    }
+    // In place, with two forged tags: only those packets are rejected and zeroed
+    hacl_macs[16 * 3] ^= 1;
+    hacl_macs[16 * 59 + 15] ^= 0x80;
+    for (uint32_t i = 0; i < n; i++)
+      p[i].input = hacl_cipher + max_len * i;
+    if (Hacl_Chacha20Poly1305_Batch_aead_decrypt(res, p, n, key) != 2){
+      pass = false;
+      printf("Batch AEAD decryption miscounted forged tags\n");
+    }
+    for (uint32_t i = 0; i < n && pass; i++){
+      bool forged = i == 3 || i == 59;
+      if (res[i] != forged){
+        pass = false;
+        printf("Batch AEAD decryption gave the wrong verdict on packet %d\n", i);
+      }
+      for (uint32_t j = 0; j < p[i].len && pass; j++){
+        if (hacl_cipher[max_len * i + j] != (forged ? 0 : plaintext[max_len * i + j])){
+          pass = false;
+          printf("Batch AEAD decryption failed on packet %d (size %d)\n", i, p[i].len);
+        }
+      }
+    }
+  }
+  Hacl_Dispatch_reset();
+  free(plaintext);
+  free(expected_cipher);
+  free(hacl_cipher);
+  free(nonces);
+  free(aads);
+  free(expected_macs);
+  free(hacl_macs);
+  free(res);
+  free(p);
+  return pass;
+}
+
+bool unit_test_aead_keyed(){
+  bool pass = true;
+  uint32_t max_len = 1200;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t *expected_cipher = malloc(max_len);
+  uint8_t *hacl_cipher = malloc(max_len);
+  uint8_t key[32], nonce[12], aad[64], expected_mac[16], hacl_mac[16];
+  Hacl_Chacha20Poly1305_Keyed_key k;
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  READ_RANDOM_BYTES(64, aad);
+  // The backends are fixed when the key is expanded
+  Hacl_Dispatch_chacha20_impl chachas[3] = { Hacl_Dispatch_Chacha20_Vec256, Hacl_Dispatch_Chacha20_Vec128, Hacl_Dispatch_Chacha20_Scalar };
+  Hacl_Dispatch_poly1305_impl polys[3] = { Hacl_Dispatch_Poly1305_Vec256, Hacl_Dispatch_Poly1305_64, Hacl_Dispatch_Poly1305_64 };
+  for (int t = 0; t < 3 && pass; t++){
+    if (!Hacl_Dispatch_chacha20_set(chachas[t]) || !Hacl_Dispatch_poly1305_set(polys[t]))
+      continue;
+    Hacl_Chacha20Poly1305_Keyed_init_key(&k, key);
+    Hacl_Dispatch_reset();
+    Hacl_Chacha20Poly1305_Keyed_chacha20(&k, hacl_cipher, plaintext, max_len, nonce, 5);
+    Hacl_Chacha20_chacha20(expected_cipher, plaintext, max_len, key, nonce, 5);
+    if (memcmp(hacl_cipher, expected_cipher, max_len) != 0){
+      pass = false;
+      printf("Keyed Chacha20 failed\n");
+      break;
+    }
+    for (uint32_t len = 0; len <= max_len && pass; len += len < 520 ? 1 : 37){
+      uint32_t aadlen = len % 65;
+      aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, aadlen, key, nonce);
+      Hacl_Chacha20Poly1305_Keyed_aead_encrypt(&k, hacl_cipher, hacl_mac, plaintext, len, aad, aadlen, nonce);
+      if (memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+        pass = false;
+        printf("Keyed AEAD encryption failed on input of size %d\n", len);
+        break;
+      }
+      // In place
+      memcpy(hacl_cipher, plaintext, len);
+      Hacl_Chacha20Poly1305_Keyed_aead_encrypt(&k, hacl_cipher, hacl_mac, hacl_cipher, len, aad, aadlen, nonce);
+      if (memcmp(hacl_cipher, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+        pass = false;
+        printf("Keyed AEAD in-place encryption failed on input of size %d\n", len);
+        break;
+      }
+      if (Hacl_Chacha20Poly1305_Keyed_aead_decrypt(&k, hacl_cipher, hacl_cipher, len, hacl_mac, aad, aadlen, nonce) != 0
+          || memcmp(hacl_cipher, plaintext, len) != 0){
+        pass = false;
+        printf("Keyed AEAD decryption failed on input of size %d\n", len);
+        break;
+      }
+      hacl_mac[len % 16] ^= 1;
+      // In place, a forged packet is left as it was
+      memcpy(hacl_cipher, expected_cipher, len);
+      if (Hacl_Chacha20Poly1305_Keyed_aead_decrypt(&k, hacl_cipher, hacl_cipher, len, hacl_mac, aad, aadlen, nonce) != 1
+          || memcmp(hacl_cipher, expected_cipher, len) != 0){
+        pass = false;
+        printf("Keyed AEAD accepted or altered a forged packet in place\n");
+        break;
+      }
+      memset(hacl_cipher, 0xa5, len);
+      if (Hacl_Chacha20Poly1305_Keyed_aead_decrypt(&k, hacl_cipher, expected_cipher, len, hacl_mac, aad, aadlen, nonce) != 1){
+        pass = false;
+        printf("Keyed AEAD accepted a forged tag\n");
+        break;
+      }
+      for (uint32_t i = 0; i < len; i++){
+        if (hacl_cipher[i] != 0){
+          pass = false;
+          printf("Keyed AEAD released plaintext under a forged tag\n");
+          break;
+        }
+      }
+    }
+  }
+  Hacl_Dispatch_reset();
+  free(plaintext);
+  free(expected_cipher);
+  free(hacl_cipher);
+  return pass;
+}
+
+bool unit_test_aead_inplace(){
+  bool pass = true;
+  uint32_t max_len = 1200;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t *expected_cipher = malloc(max_len);
+  uint8_t *buf = malloc(max_len);
+  uint8_t key[32], nonce[12], aad[64], expected_mac[16], hacl_mac[16];
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  READ_RANDOM_BYTES(12, nonce);
+  READ_RANDOM_BYTES(64, aad);
+  for (uint32_t len = 0; len <= max_len && pass; len += len < 520 ? 1 : 37){
+    uint32_t aadlen = len % 65;
+    aead_chacha20_poly1305_encrypt(expected_cipher, expected_mac, plaintext, len, aad, aadlen, key, nonce);
+    memcpy(buf, plaintext, len);
+    Hacl_Chacha20Poly1305_aead_encrypt(buf, hacl_mac, buf, len, aad, aadlen, key, nonce);
+    if (memcmp(buf, expected_cipher, len) != 0 || memcmp(hacl_mac, expected_mac, 16) != 0){
+      pass = false;
+      printf("In-place AEAD encryption failed on input of size %d\n", len);
+      break;
+    }
+    if (Hacl_Chacha20Poly1305_aead_decrypt(buf, buf, len, hacl_mac, aad, aadlen, key, nonce) != 0
+        || memcmp(buf, plaintext, len) != 0){
+      pass = false;
+      printf("In-place AEAD decryption failed on input of size %d\n", len);
+      break;
+    }
+    // A forged packet is left as it was
+    memcpy(buf, expected_cipher, len);
+    hacl_mac[len % 16] ^= 1;
+    if (Hacl_Chacha20Poly1305_aead_decrypt(buf, buf, len, hacl_mac, aad, aadlen, key, nonce) != 1
+        || memcmp(buf, expected_cipher, len) != 0){
+      pass = false;
+      printf("In-place AEAD decryption accepted or altered a forged packet of size %d\n", len);
+      break;
+    }
+  }
+  free(plaintext);
+  free(expected_cipher);
+  free(buf);
+  return pass;
+}
 
 bool unit_test_onetimeauth(){
   // Global length
@@ -237,6 +865,57 @@ bool unit_test_onetimeauth(){
   return pass;
 }
 
+bool unit_test_poly1305_vec256(){
+  bool pass = true;
+  uint32_t max_len = 2000;
+  uint8_t *plaintext = malloc(max_len);
+  uint8_t key[32], expected_mac[16], hacl_mac[16];
+  READ_RANDOM_BYTES(max_len, plaintext);
+  READ_RANDOM_BYTES(32, key);
+  if (!Hacl_Dispatch_poly1305_is_supported(Hacl_Dispatch_Poly1305_Vec256)){
+    printf("Poly1305 Vec256 not supported by this CPU, skipped\n");
+    free(plaintext);
+    return pass;
+  }
+  for (uint32_t len = 0; len <= max_len; len++){
+    tweet_crypto_onetimeauth(expected_mac, plaintext, len, key);
+    Hacl_Poly1305_Vec256_crypto_onetimeauth(hacl_mac, plaintext, len, key);
+    if (memcmp(hacl_mac, expected_mac, 16) != 0){
+      pass = false;
+      printf("Poly1305 Vec256 failed on input of size %d\n", len);
+      break;
+    }
+  }
+  // The same key state across updates of 1, 3, 4, 9 and 41 blocks, mixing
+  // the scalar and vectorized paths
+  uint32_t splits[5] = { 1, 3, 4, 9, 41 };
+  Hacl_Poly1305_Vec256_state st;
+  uint32_t off = 0;
+  Hacl_Poly1305_Vec256_init(&st, key);
+  for (uint32_t i = 0; i < 5; i++){
+    Hacl_Poly1305_Vec256_update(&st, plaintext + off, splits[i]);
+    off += 16 * splits[i];
+  }
+  Hacl_Poly1305_Vec256_update_last(&st, plaintext + off, 7);
+  Hacl_Poly1305_Vec256_finish(&st, hacl_mac, key);
+  tweet_crypto_onetimeauth(expected_mac, plaintext, off + 7, key);
+  if (memcmp(hacl_mac, expected_mac, 16) != 0){
+    pass = false;
+    printf("Poly1305 Vec256 failed on incremental input\n");
+  }
+  // Limbs at their maximum: all-ones key and message
+  memset(plaintext, 0xff, max_len);
+  memset(key, 0xff, 32);
+  tweet_crypto_onetimeauth(expected_mac, plaintext, max_len, key);
+  Hacl_Poly1305_Vec256_crypto_onetimeauth(hacl_mac, plaintext, max_len, key);
+  if (memcmp(hacl_mac, expected_mac, 16) != 0){
+    pass = false;
+    printf("Poly1305 Vec256 failed on all-ones input\n");
+  }
+  free(plaintext);
+  return pass;
+}
+
 #define crypto_box_ZEROBYTES 32
 #define crypto_box_BOXZEROBYTES 16
 
@@ -308,6 +987,73 @@ bool unit_test_crypto_box(){
   return pass;
 }
 
+// Boxes a 64-byte message to pk with both implementations
+static bool box_cache_check(uint8_t *pk, uint8_t *sk, uint8_t *plaintext, uint8_t *nonce){
+  uint8_t hacl_cipher[crypto_box_ZEROBYTES + 64], expected_cipher[crypto_box_ZEROBYTES + 64];
+  tweet_crypto_box(expected_cipher, plaintext, crypto_box_ZEROBYTES + 64, nonce, pk, sk);
+  crypto_box(hacl_cipher, plaintext, crypto_box_ZEROBYTES + 64, nonce, pk, sk);
+  return memcmp(hacl_cipher, expected_cipher, crypto_box_ZEROBYTES + 64) == 0;
+}
+
+bool unit_test_box_cache(){
+  uint8_t plaintext[crypto_box_ZEROBYTES + 64], nonce[24];
+  uint8_t sk1[32], sk2[32], pk[HACL_BOX_CACHE_WAYS + 1][32];
+  uint64_t hits0, misses0, hits, misses;
+  bool pass = true;
+  memset(plaintext, 0, crypto_box_ZEROBYTES);
+  READ_RANDOM_BYTES(64, plaintext + crypto_box_ZEROBYTES);
+  READ_RANDOM_BYTES(24, nonce);
+  READ_RANDOM_BYTES(32, sk1);
+  READ_RANDOM_BYTES(32, sk2);
+  // Any u-coordinate is a valid peer key; these all fall in the same set
+  READ_RANDOM_BYTES(32 * (HACL_BOX_CACHE_WAYS + 1), (uint8_t *)pk);
+  for (uint32_t i = 0; i <= HACL_BOX_CACHE_WAYS; i++) memset(pk[i], 0, 4);
+  Hacl_Box_Cache_clear();
+  Hacl_Box_Cache_stats(&hits0, &misses0);
+  // Miss then hit; the same peer with another secret key is a different entry
+  pass = pass && box_cache_check(pk[0], sk1, plaintext, nonce);
+  pass = pass && box_cache_check(pk[0], sk1, plaintext, nonce);
+  pass = pass && box_cache_check(pk[0], sk2, plaintext, nonce);
+  Hacl_Box_Cache_stats(&hits, &misses);
+  if (pass && (hits - hits0 != 1 || misses - misses0 != 2)){
+    pass = false;
+    printf("Box cache counted %d hits and %d misses, expected 1 and 2\n", (int)(hits - hits0), (int)(misses - misses0));
+  }
+  // Filling the set evicts the least recently used entry (pk[0], sk1)
+  for (uint32_t i = 1; i < HACL_BOX_CACHE_WAYS; i++)
+    pass = pass && box_cache_check(pk[i], sk2, plaintext, nonce);
+  pass = pass && box_cache_check(pk[0], sk2, plaintext, nonce);
+  pass = pass && box_cache_check(pk[0], sk1, plaintext, nonce);
+  Hacl_Box_Cache_stats(&hits, &misses);
+  if (pass && (hits - hits0 != 2 || misses - misses0 != 2 + HACL_BOX_CACHE_WAYS)){
+    pass = false;
+    printf("Box cache eviction failed\n");
+  }
+  // Opening goes through the cache too, and clearing forgets every key
+  Hacl_Box_Cache_clear();
+  uint8_t cipher[crypto_box_ZEROBYTES + 64], opened[crypto_box_ZEROBYTES + 64], pk2[32];
+  crypto_scalarmult_base(pk2, sk2);
+  crypto_box(cipher, plaintext, crypto_box_ZEROBYTES + 64, nonce, pk2, sk1);
+  crypto_scalarmult_base(pk[0], sk1);
+  for (int i = 0; pass && i < 2; i++)
+    if (crypto_box_open(opened, cipher, crypto_box_ZEROBYTES + 64, nonce, pk[0], sk2) != 0
+        || memcmp(opened, plaintext, crypto_box_ZEROBYTES + 64) != 0){
+      pass = false;
+      printf("Box cache open failed\n");
+    }
+  cipher[crypto_box_ZEROBYTES] ^= 1;
+  if (pass && crypto_box_open(opened, cipher, crypto_box_ZEROBYTES + 64, nonce, pk[0], sk2) == 0){
+    pass = false;
+    printf("Box cache open accepted a forgery\n");
+  }
+  Hacl_Box_Cache_stats(&hits, &misses);
+  if (pass && (hits - hits0 != 4 || misses - misses0 != 4 + HACL_BOX_CACHE_WAYS)){
+    pass = false;
+    printf("Box cache clear failed\n");
+  }
+  return pass;
+}
+
 #define NUM_SCALARMULT 1000
 
 bool unit_test_scalarmult(){
@@ -344,6 +1090,170 @@ bool unit_test_scalarmult(){
   return pass;
 }
 
+#define NUM_SCALARMULT_64 2000
+
+bool unit_test_curve25519_64(){
+  // RFC 7748, section 5.2
+  uint8_t rfc_scalar[32] = {
+    0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15, 0x4b, 0x82, 0x46, 0x5e, 0xdd,
+    0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc, 0x5a, 0x18, 0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4
+  };
+  uint8_t rfc_u[32] = {
+    0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1, 0xa4, 0x24, 0xb1, 0x5f, 0x7c,
+    0x72, 0x66, 0x24, 0xec, 0x26, 0xb3, 0x35, 0x3b, 0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c
+  };
+  uint8_t rfc_expected[32] = {
+    0xc3, 0xda, 0x55, 0x37, 0x9d, 0xe9, 0xc6, 0x90, 0x8e, 0x94, 0xea, 0x4d, 0xf2, 0x8d, 0x08, 0x4f,
+    0x32, 0xec, 0xcf, 0x03, 0x49, 0x1c, 0x71, 0xf7, 0x54, 0xb4, 0x07, 0x55, 0x77, 0xa2, 0x85, 0x52
+  };
+  uint8_t *random_bytes = malloc(64 * NUM_SCALARMULT_64 * sizeof(uint8_t));
+  READ_RANDOM_BYTES(64 * NUM_SCALARMULT_64, random_bytes);
+  uint8_t expected_bytes[32], hacl_bytes[32];
+  bool pass = true;
+  if (!Hacl_Dispatch_curve25519_set(Hacl_Dispatch_Curve25519_64)){
+    free(random_bytes);
+    Hacl_Dispatch_reset();
+    return true;
+  }
+  int b = crypto_scalarmult(hacl_bytes, rfc_scalar, rfc_u);
+  if (memcmp(hacl_bytes, rfc_expected, 32) != 0){
+    pass = false;
+    printf("Curve25519 radix-2^64 backend failed on the RFC 7748 vector\n");
+  }
+  for (int i = 0; pass && i < NUM_SCALARMULT_64; i++){
+    uint8_t *scalar = random_bytes + 64 * i, *u = random_bytes + 64 * i + 32;
+    // Non-canonical and boundary u-coordinates: p - 1, p, p + 1, 2^255 - 1
+    if (i < 4){
+      memset(u, 0xff, 32);
+      u[0] = (uint8_t)(0xec + i);
+      if (i == 3) u[0] = 0xff;
+      u[31] = 0x7f;
+    }
+    if (i == 4) memset(u, 0, 32);
+    if (i == 5) memset(u, 0xff, 32);
+    Hacl_Dispatch_curve25519_set(Hacl_Dispatch_Curve25519_51);
+    b = crypto_scalarmult(expected_bytes, scalar, u);
+    Hacl_Dispatch_curve25519_set(Hacl_Dispatch_Curve25519_64);
+    b = crypto_scalarmult(hacl_bytes, scalar, u);
+    if (memcmp(hacl_bytes, expected_bytes, 32) != 0){
+      pass = false;
+      printf("Curve25519 radix-2^64 backend differs from the 5x51-bit code\n");
+    }
+  }
+  free(random_bytes);
+  Hacl_Dispatch_reset();
+  return pass;
+}
+
+#define NUM_SECRET_TO_PUBLIC 2000
+
+bool unit_test_secret_to_public(){
+  uint8_t *random_bytes = malloc(32 * NUM_SECRET_TO_PUBLIC * sizeof(uint8_t));
+  READ_RANDOM_BYTES(32 * NUM_SECRET_TO_PUBLIC, random_bytes);
+  uint8_t basepoint[32] = {9};
+  uint8_t expected_bytes[32], hacl_bytes[32];
+  int b;
+  bool pass = true;
+  // Scalars that clamp to 2^254 and to 2^255 - 8
+  memset(random_bytes, 0, 32);
+  memset(random_bytes + 32, 0xff, 32);
+  for (int i = 0; i < NUM_SECRET_TO_PUBLIC; i++){
+    b = crypto_scalarmult(expected_bytes, random_bytes + 32 * i, basepoint);
+    Hacl_Curve25519_secret_to_public(hacl_bytes, random_bytes + 32 * i);
+    if (memcmp(hacl_bytes, expected_bytes, 32) != 0){
+      pass = false;
+      printf("Fixed-base Curve25519 differs from the ladder\n");
+      break;
+    }
+  }
+  free(random_bytes);
+  return pass;
+}
+
+#define NUM_SCALARMULT_X4 500
+
+bool unit_test_scalarmult_x4(){
+  uint8_t *random_bytes = malloc(4 * 64 * NUM_SCALARMULT_X4 * sizeof(uint8_t));
+  READ_RANDOM_BYTES(4 * 64 * NUM_SCALARMULT_X4, random_bytes);
+  uint8_t expected_bytes[4][32], hacl_bytes[4][32];
+  uint8_t *out[4], *scalar[4], *u[4];
+  int b;
+  bool pass = true;
+  for (int i = 0; pass && i < NUM_SCALARMULT_X4; i++){
+    for (int l = 0; l < 4; l++){
+      scalar[l] = random_bytes + 64 * (4 * i + l);
+      u[l] = scalar[l] + 32;
+      out[l] = hacl_bytes[l];
+    }
+    // Lanes with non-canonical u-coordinates next to ordinary ones
+    if (i < 4){
+      memset(u[i], 0xff, 32);
+      u[i][0] = 0xed;
+      u[i][31] = 0x7f;
+    }
+    for (int l = 0; l < 4; l++)
+      b = crypto_scalarmult(expected_bytes[l], scalar[l], u[l]);
+    // The last iteration computes in place, over the u-coordinates
+    if (i == NUM_SCALARMULT_X4 - 1)
+      for (int l = 0; l < 4; l++) out[l] = u[l];
+    Hacl_Curve25519_scalarmult_x4(out, scalar, u);
+    for (int l = 0; l < 4; l++)
+      if (memcmp(out[l], expected_bytes[l], 32) != 0){
+        pass = false;
+        printf("4-way Curve25519 differs from crypto_scalarmult in lane %d\n", l);
+        break;
+      }
+  }
+  free(random_bytes);
+  return pass;
+}
+
+#define MAX_SCALARMULT_BATCH 70
+
+bool unit_test_scalarmult_batch(){
+  uint8_t *random_bytes = malloc(64 * MAX_SCALARMULT_BATCH * sizeof(uint8_t));
+  uint8_t expected_bytes[MAX_SCALARMULT_BATCH][32], hacl_bytes[MAX_SCALARMULT_BATCH][32];
+  uint8_t *out[MAX_SCALARMULT_BATCH], *scalar[MAX_SCALARMULT_BATCH], *u[MAX_SCALARMULT_BATCH];
+  int b;
+  bool pass = true;
+  // Every chunk and group remainder up to 37, then more than two full chunks (70)
+  for (uint32_t n = 0; pass && n <= MAX_SCALARMULT_BATCH; n = n < 37 ? n + 1 : MAX_SCALARMULT_BATCH + 1){
+    READ_RANDOM_BYTES(64 * n, random_bytes);
+    for (uint32_t i = 0; i < n; i++){
+      scalar[i] = random_bytes + 64 * i;
+      u[i] = scalar[i] + 32;
+      out[i] = hacl_bytes[i];
+    }
+    // Points of small order give z = 0, which must not spoil the batch
+    if (n > 2){
+      memset(u[n / 2], 0, 32);
+      memset(u[n - 1], 0, 32);
+      u[n - 1][0] = 1;
+    }
+    for (uint32_t i = 0; i < n; i++)
+      b = crypto_scalarmult(expected_bytes[i], scalar[i], u[i]);
+    Hacl_Curve25519_scalarmult_batch(out, scalar, u, n);
+    for (uint32_t i = 0; i < n; i++)
+      if (memcmp(hacl_bytes[i], expected_bytes[i], 32) != 0){
+        pass = false;
+        printf("Batched Curve25519 failed for n = %d, operation %d\n", n, i);
+        break;
+      }
+    if (pass && Hacl_Curve25519_64_is_supported()){
+      memset(hacl_bytes, 0, sizeof hacl_bytes);
+      Hacl_Curve25519_64_scalarmult_batch(out, scalar, u, n);
+      for (uint32_t i = 0; i < n; i++)
+        if (memcmp(hacl_bytes[i], expected_bytes[i], 32) != 0){
+          pass = false;
+          printf("Batched radix-2^64 Curve25519 failed for n = %d, operation %d\n", n, i);
+          break;
+        }
+    }
+  }
+  free(random_bytes);
+  return pass;
+}
+
 #define NUM_KEYPAIR 1000
 
 bool unit_test_crypto_keypair(){
@@ -529,6 +1439,496 @@ bool unit_test_crypto_stream(){
   return pass;
 }
 
+uint8_t sha2_256_abc_hash[32] = {
+  0xba,0x78,0x16,0xbf,0x8f,0x01,0xcf,0xea,0x41,0x41,0x40,0xde,0x5d,0xae,0x22,0x23,
+  0xb0,0x03,0x61,0xa3,0x96,0x17,0x7a,0x9c,0xb4,0x10,0xff,0x61,0xf2,0x00,0x15,0xad
+};
+
+uint8_t sha2_256_two_blocks_hash[32] = {
+  0x24,0x8d,0x6a,0x61,0xd2,0x06,0x38,0xb8,0xe5,0xc0,0x26,0x93,0x0c,0x3e,0x60,0x39,
+  0xa3,0x3c,0xe4,0x59,0x64,0xff,0x21,0x67,0xf6,0xec,0xed,0xd4,0x19,0xdb,0x06,0xc1
+};
+
+uint8_t sha2_256_million_a_hash[32] = {
+  0xcd,0xc7,0x6e,0x5c,0x99,0x14,0xfb,0x92,0x81,0xa1,0xc7,0xe2,0x84,0xd7,0x3e,0x67,
+  0xf1,0x80,0x9a,0x48,0xa4,0x97,0x20,0x0e,0x04,0x6d,0x39,0xcc,0xc7,0x11,0x2c,0xd0
+};
+
+// RFC 4231 test case 6: 131-byte key, hashed before use
+
+uint8_t hmac_sha2_256_long_key_mac[32] = {
+  0x60,0xe4,0x31,0x59,0x1e,0xe0,0xb6,0x7f,0x0d,0x8a,0x26,0xaa,0xcb,0xf5,0xb7,0x7f,
+  0x8e,0x0b,0xc6,0x21,0x37,0x28,0xc5,0x14,0x05,0x46,0x04,0x0f,0x0e,0xe3,0x7f,0x54
+};
+
+uint8_t hmac_sha2_384_long_key_mac[48] = {
+  0x4e,0xce,0x08,0x44,0x85,0x81,0x3e,0x90,0x88,0xd2,0xc6,0x3a,0x04,0x1b,0xc5,0xb4,
+  0x4f,0x9e,0xf1,0x01,0x2a,0x2b,0x58,0x8f,0x3c,0xd1,0x1f,0x05,0x03,0x3a,0xc4,0xc6,
+  0x0c,0x2e,0xf6,0xab,0x40,0x30,0xfe,0x82,0x96,0x24,0x8d,0xf1,0x63,0xf4,0x49,0x52
+};
+
+uint8_t hmac_sha2_512_long_key_mac[64] = {
+  0x80,0xb2,0x42,0x63,0xc7,0xc1,0xa3,0xeb,0xb7,0x14,0x93,0xc1,0xdd,0x7b,0xe8,0xb4,
+  0x9b,0x46,0xd1,0xf4,0x1b,0x4a,0xee,0xc1,0x12,0x1b,0x01,0x37,0x83,0xf8,0xf3,0x52,
+  0x6b,0x56,0xd0,0x37,0xe0,0x5f,0x25,0x98,0xbd,0x0f,0xd2,0x21,0x5d,0x6a,0x1e,0x52,
+  0x95,0xe6,0x4f,0x73,0xf6,0x3f,0x0a,0xec,0x8b,0x91,0x5a,0x98,0x5d,0x78,0x65,0x98
+};
+
+bool unit_test_sha2_256(){
+  // The verified code, then the dispatcher (SHA-NI when supported)
+  void (*hash_fns[2])(uint8_t *, uint8_t *, uint32_t) = { Hacl_SHA2_256_hash, Hacl_Dispatch_sha256 };
+  const char *names[2] = { "SHA2-256", "Dispatched SHA2-256" };
+  uint8_t hash[32];
+  int a;
+  bool pass = true;
+  if (Hacl_SHA2_256_SHANI_is_supported())
+    printf("Dispatched SHA2-256 runs on the SHA-NI backend\n");
+  uint8_t *million_a = malloc(1000000 * sizeof (uint8_t));
+  memset(million_a, 'a', 1000000 * sizeof (uint8_t));
+  for (int f = 0; f < 2; f++){
+    hash_fns[f](hash, (uint8_t *)"abc", 3);
+    a = memcmp(hash, sha2_256_abc_hash, 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("%s failed on FIPS 180-2 test of size 3\n", names[f]);
+    }
+    hash_fns[f](hash, (uint8_t *)"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56);
+    a = memcmp(hash, sha2_256_two_blocks_hash, 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("%s failed on FIPS 180-2 test of size 56\n", names[f]);
+    }
+    hash_fns[f](hash, million_a, 1000000);
+    a = memcmp(hash, sha2_256_million_a_hash, 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("%s failed on FIPS 180-2 test of size 1000000\n", names[f]);
+    }
+  }
+
+  free(million_a);
+
+  return pass;
+}
+
+bool unit_test_sha2_state(){
+  // Compact states against the one-shot verified code, on lengths crossing
+  // the one/two padding block boundaries of both block sizes
+  uint32_t max_len = 3 * 128 + 1;
+  uint8_t *plaintext = malloc(max_len * sizeof (uint8_t));
+  READ_RANDOM_BYTES(max_len, plaintext);
+  uint8_t expected_hash[64], hacl_hash[64];
+  Hacl_SHA2_State_sha256 st256;
+  Hacl_SHA2_State_sha512 st512;
+  int a;
+  bool pass = true;
+  if (sizeof st256 * 10 > 137 * sizeof (uint32_t) || sizeof st512 * 10 > 169 * sizeof (uint64_t)){
+    printf("SHA2 compact states are not compact: %d and %d bytes\n", (int)sizeof st256, (int)sizeof st512);
+    return false;
+  }
+  for (uint32_t len = 0; len < max_len; len++){
+    Hacl_SHA2_256_hash(expected_hash, plaintext, len);
+    Hacl_SHA2_State_sha256_init(&st256);
+    Hacl_SHA2_State_sha256_update_multi(&st256, plaintext, len / 64);
+    Hacl_SHA2_State_sha256_update_last(&st256, plaintext + len / 64 * 64, len % 64);
+    Hacl_SHA2_State_sha256_finish(&st256, hacl_hash);
+    a = memcmp(hacl_hash, expected_hash, 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-256 compact state failed on input of size %d\n", len);
+      break;
+    }
+    Hacl_SHA2_384_hash(expected_hash, plaintext, len);
+    Hacl_SHA2_State_sha384_init(&st512);
+    Hacl_SHA2_State_sha384_update_multi(&st512, plaintext, len / 128);
+    Hacl_SHA2_State_sha384_update_last(&st512, plaintext + len / 128 * 128, len % 128);
+    Hacl_SHA2_State_sha384_finish(&st512, hacl_hash);
+    a = memcmp(hacl_hash, expected_hash, 48 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-384 compact state failed on input of size %d\n", len);
+      break;
+    }
+    tweet_crypto_hash(expected_hash, plaintext, len);
+    Hacl_SHA2_State_sha512_init(&st512);
+    Hacl_SHA2_State_sha512_update_multi(&st512, plaintext, len / 128);
+    Hacl_SHA2_State_sha512_update_last(&st512, plaintext + len / 128 * 128, len % 128);
+    Hacl_SHA2_State_sha512_finish(&st512, hacl_hash);
+    a = memcmp(hacl_hash, expected_hash, 64 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-512 compact state failed on input of size %d\n", len);
+      break;
+    }
+  }
+
+  free(plaintext);
+
+  return pass;
+}
+
+bool unit_test_sha2_streaming(){
+  // Feed a message in chunks of every size, then check finish and copy
+  uint64_t len = HACL_UNIT_TESTS_SIZE * sizeof(uint8_t);
+  uint8_t *plaintext = malloc(HACL_UNIT_TESTS_SIZE * sizeof (uint8_t));
+  READ_RANDOM_BYTES(len, plaintext);
+  uint8_t expected_hash[3][64], hacl_hash[64];
+  Hacl_SHA2_Streaming_sha256 ctx256, copy256;
+  Hacl_SHA2_Streaming_sha512 ctx384, ctx512, copy512;
+  int a;
+  bool pass = true;
+  Hacl_SHA2_256_hash(expected_hash[0], plaintext, HACL_UNIT_TESTS_SIZE);
+  Hacl_SHA2_384_hash(expected_hash[1], plaintext, HACL_UNIT_TESTS_SIZE);
+  tweet_crypto_hash(expected_hash[2], plaintext, HACL_UNIT_TESTS_SIZE);
+  for (uint32_t chunk = 1; chunk <= 257; chunk++){
+    Hacl_SHA2_Streaming_sha256_init(&ctx256);
+    Hacl_SHA2_Streaming_sha384_init(&ctx384);
+    Hacl_SHA2_Streaming_sha512_init(&ctx512);
+    for (uint32_t i = 0; i < HACL_UNIT_TESTS_SIZE; i += chunk){
+      uint32_t n = HACL_UNIT_TESTS_SIZE - i < chunk ? HACL_UNIT_TESTS_SIZE - i : chunk;
+      Hacl_SHA2_Streaming_sha256_update(&ctx256, plaintext + i, n);
+      Hacl_SHA2_Streaming_sha384_update(&ctx384, plaintext + i, n);
+      Hacl_SHA2_Streaming_sha512_update(&ctx512, plaintext + i, n);
+    }
+    Hacl_SHA2_Streaming_sha256_finish(&ctx256, hacl_hash);
+    a = memcmp(hacl_hash, expected_hash[0], 32 * sizeof (uint8_t));
+    Hacl_SHA2_Streaming_sha384_finish(&ctx384, hacl_hash);
+    a = a || memcmp(hacl_hash, expected_hash[1], 48 * sizeof (uint8_t));
+    Hacl_SHA2_Streaming_sha512_finish(&ctx512, hacl_hash);
+    a = a || memcmp(hacl_hash, expected_hash[2], 64 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2 streaming failed on chunks of size %d\n", chunk);
+      break;
+    }
+  }
+  if (!pass) return pass;
+  // Clone a context after a common prefix and finish both branches
+  Hacl_SHA2_Streaming_sha256_init(&ctx256);
+  Hacl_SHA2_Streaming_sha256_update(&ctx256, plaintext, 100);
+  Hacl_SHA2_Streaming_sha256_copy(&copy256, &ctx256);
+  Hacl_SHA2_Streaming_sha256_update(&ctx256, plaintext + 100, HACL_UNIT_TESTS_SIZE - 100);
+  Hacl_SHA2_Streaming_sha256_finish(&ctx256, hacl_hash);
+  a = memcmp(hacl_hash, expected_hash[0], 32 * sizeof (uint8_t));
+  Hacl_SHA2_256_hash(expected_hash[0], plaintext, 100);
+  Hacl_SHA2_Streaming_sha256_finish(&copy256, hacl_hash);
+  a = a || memcmp(hacl_hash, expected_hash[0], 32 * sizeof (uint8_t));
+  Hacl_SHA2_Streaming_sha512_init(&ctx512);
+  Hacl_SHA2_Streaming_sha512_update(&ctx512, plaintext, 200);
+  Hacl_SHA2_Streaming_sha512_copy(&copy512, &ctx512);
+  Hacl_SHA2_Streaming_sha512_update(&ctx512, plaintext + 200, HACL_UNIT_TESTS_SIZE - 200);
+  Hacl_SHA2_Streaming_sha512_finish(&ctx512, hacl_hash);
+  a = a || memcmp(hacl_hash, expected_hash[2], 64 * sizeof (uint8_t));
+  tweet_crypto_hash(expected_hash[2], plaintext, 200);
+  Hacl_SHA2_Streaming_sha512_finish(&copy512, hacl_hash);
+  a = a || memcmp(hacl_hash, expected_hash[2], 64 * sizeof (uint8_t));
+  if (a != 0){
+    pass = false;
+    printf("SHA2 streaming copy failed\n");
+  }
+  // 64-bit length one-shot hashes
+  Hacl_SHA2_256_hash(expected_hash[0], plaintext, HACL_UNIT_TESTS_SIZE - 1);
+  Hacl_SHA2_384_hash(expected_hash[1], plaintext, HACL_UNIT_TESTS_SIZE - 1);
+  tweet_crypto_hash(expected_hash[2], plaintext, HACL_UNIT_TESTS_SIZE - 1);
+  Hacl_SHA2_Streaming_sha256_hash(hacl_hash, plaintext, len - 1);
+  a = memcmp(hacl_hash, expected_hash[0], 32 * sizeof (uint8_t));
+  Hacl_SHA2_Streaming_sha384_hash(hacl_hash, plaintext, len - 1);
+  a = a || memcmp(hacl_hash, expected_hash[1], 48 * sizeof (uint8_t));
+  Hacl_SHA2_Streaming_sha512_hash(hacl_hash, plaintext, len - 1);
+  a = a || memcmp(hacl_hash, expected_hash[2], 64 * sizeof (uint8_t));
+  if (a != 0){
+    pass = false;
+    printf("SHA2 one-shot hashes with 64-bit length failed\n");
+  }
+
+  free(plaintext);
+
+  return pass;
+}
+
+bool unit_test_hmac_sha2(){
+  // RFC 4231 vectors, then the SHA2-256 key objects against the verified
+  // HMAC and the SHA2-512 ones against an HMAC built on TweetNaCl's SHA-512
+  uint32_t max_len = 2 * 128 + 1;
+  uint8_t *plaintext = malloc(max_len * sizeof (uint8_t));
+  uint8_t key[131], kpad[128 + 2 * 128 + 1], opad[128 + 64];
+  uint8_t expected_mac[64], hacl_mac[64];
+  Hacl_HMAC_SHA2_key256 k256;
+  Hacl_HMAC_SHA2_key512 k384, k512;
+  int a;
+  bool pass = true;
+  READ_RANDOM_BYTES(max_len, plaintext);
+  memset(key, 0xaa, 131 * sizeof (uint8_t));
+  uint8_t *msg = (uint8_t *)"Test Using Larger Than Block-Size Key - Hash Key First";
+  Hacl_HMAC_SHA2_sha256_init_key(&k256, key, 131);
+  Hacl_HMAC_SHA2_sha256_mac(hacl_mac, &k256, msg, 54);
+  a = memcmp(hacl_mac, hmac_sha2_256_long_key_mac, 32 * sizeof (uint8_t));
+  Hacl_HMAC_SHA2_sha384_init_key(&k384, key, 131);
+  Hacl_HMAC_SHA2_sha384_mac(hacl_mac, &k384, msg, 54);
+  a = a || memcmp(hacl_mac, hmac_sha2_384_long_key_mac, 48 * sizeof (uint8_t));
+  Hacl_HMAC_SHA2_sha512_init_key(&k512, key, 131);
+  Hacl_HMAC_SHA2_sha512_mac(hacl_mac, &k512, msg, 54);
+  a = a || memcmp(hacl_mac, hmac_sha2_512_long_key_mac, 64 * sizeof (uint8_t));
+  if (a != 0){
+    pass = false;
+    printf("HMAC-SHA2 key objects failed on RFC 4231 test case 6\n");
+  }
+  for (uint32_t keylen = 0; pass && keylen <= 131; keylen += 13){
+    READ_RANDOM_BYTES(keylen, key);
+    Hacl_HMAC_SHA2_sha256_init_key(&k256, key, keylen);
+    Hacl_HMAC_SHA2_sha512_init_key(&k512, key, keylen);
+    for (uint32_t len = 0; len < max_len; len++){
+      Hacl_HMAC_SHA2_256_hmac(expected_mac, key, keylen, plaintext, len);
+      Hacl_HMAC_SHA2_sha256_mac(hacl_mac, &k256, plaintext, len);
+      a = memcmp(hacl_mac, expected_mac, 32 * sizeof (uint8_t));
+      if (a != 0){
+        pass = false;
+        printf("HMAC-SHA2-256 key object failed on key of size %d, input of size %d\n", keylen, len);
+        break;
+      }
+      memset(kpad, 0, 128 * sizeof (uint8_t));
+      if (keylen > 128) tweet_crypto_hash(kpad, key, keylen);
+      else memcpy(kpad, key, keylen);
+      for (int i = 0; i < 128; i++){
+        opad[i] = kpad[i] ^ 0x5c;
+        kpad[i] ^= 0x36;
+      }
+      memcpy(kpad + 128, plaintext, len);
+      tweet_crypto_hash(opad + 128, kpad, 128 + len);
+      tweet_crypto_hash(expected_mac, opad, 128 + 64);
+      Hacl_HMAC_SHA2_sha512_mac(hacl_mac, &k512, plaintext, len);
+      a = memcmp(hacl_mac, expected_mac, 64 * sizeof (uint8_t));
+      if (a != 0){
+        pass = false;
+        printf("HMAC-SHA2-512 key object failed on key of size %d, input of size %d\n", keylen, len);
+        break;
+      }
+    }
+  }
+
+  free(plaintext);
+
+  return pass;
+}
+
+// RFC 6962 Merkle tree hash: split at the largest power of two below n
+static void sha2_256_tree_reference(uint8_t *hash, uint8_t *input, uint64_t len, uint64_t first, uint64_t n){
+  uint8_t *buf = malloc(HACL_SHA2_256_TREE_LEAF_SIZE + 1);
+  if (n == 1){
+    uint64_t start = first * HACL_SHA2_256_TREE_LEAF_SIZE;
+    uint64_t l = len - start < HACL_SHA2_256_TREE_LEAF_SIZE ? len - start : HACL_SHA2_256_TREE_LEAF_SIZE;
+    buf[0] = 0x00;
+    memcpy(buf + 1, input + start, l);
+    Hacl_SHA2_256_hash(hash, buf, l + 1);
+  } else {
+    uint64_t k = 1;
+    while (2 * k < n) k *= 2;
+    buf[0] = 0x01;
+    sha2_256_tree_reference(buf + 1, input, len, first, k);
+    sha2_256_tree_reference(buf + 33, input, len, first + k, n - k);
+    Hacl_SHA2_256_hash(hash, buf, 65);
+  }
+  free(buf);
+}
+
+bool unit_test_sha2_256_tree(){
+  // Sizes around the leaf and task boundaries, one and several threads
+  uint64_t leaf = HACL_SHA2_256_TREE_LEAF_SIZE, task = HACL_SHA2_256_TREE_TASK_LEAVES;
+  uint64_t lens[] = { 0, 1, 63, 64, 127, leaf - 1, leaf, leaf + 1, 3 * leaf, task * leaf, task * leaf + 5, (2 * task + 3) * leaf - 7 };
+  uint64_t max_len = (2 * task + 3) * leaf;
+  uint8_t *plaintext = malloc(max_len * sizeof (uint8_t));
+  READ_RANDOM_BYTES(max_len, plaintext);
+  uint8_t expected_hash[32], hacl_hash[32];
+  int a;
+  bool pass = true;
+  for (uint32_t j = 0; pass && j < sizeof lens / sizeof lens[0]; j++){
+    uint64_t len = lens[j];
+    uint64_t num_nodes = Hacl_SHA2_256_Tree_num_nodes(len);
+    uint8_t *nodes1 = malloc(32 * num_nodes), *nodes4 = malloc(32 * num_nodes);
+    sha2_256_tree_reference(expected_hash, plaintext, len, 0, Hacl_SHA2_256_Tree_num_leaves(len));
+    Hacl_SHA2_256_Tree_hash(hacl_hash, plaintext, len, 1, NULL);
+    a = memcmp(hacl_hash, expected_hash, 32 * sizeof (uint8_t));
+    Hacl_SHA2_256_Tree_hash(hacl_hash, plaintext, len, 1, nodes1);
+    a = a || memcmp(hacl_hash, expected_hash, 32 * sizeof (uint8_t));
+    Hacl_SHA2_256_Tree_hash(hacl_hash, plaintext, len, 4, nodes4);
+    a = a || memcmp(hacl_hash, expected_hash, 32 * sizeof (uint8_t));
+    a = a || memcmp(nodes1 + 32 * (num_nodes - 1), expected_hash, 32 * sizeof (uint8_t));
+    a = a || memcmp(nodes1, nodes4, 32 * num_nodes * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-256 tree hashing failed on input of size %d\n", (int)len);
+    }
+    free(nodes1);
+    free(nodes4);
+  }
+
+  free(plaintext);
+
+  return pass;
+}
+
+bool unit_test_sha2_fixed(){
+  // Every fixed-size entry point against the generic one-shots
+  uint8_t plaintext[128];
+  uint8_t expected_hash[64], hacl_hash[64];
+  void (*sha256[4])(uint8_t *, uint8_t *) = {
+    Hacl_SHA2_Fixed_sha256_32, Hacl_SHA2_Fixed_sha256_64, Hacl_SHA2_Fixed_sha256_96, Hacl_SHA2_Fixed_sha256_128
+  };
+  void (*sha512[4])(uint8_t *, uint8_t *) = {
+    Hacl_SHA2_Fixed_sha512_32, Hacl_SHA2_Fixed_sha512_64, Hacl_SHA2_Fixed_sha512_96, Hacl_SHA2_Fixed_sha512_128
+  };
+  int a;
+  bool pass = true;
+  for (uint32_t iter = 0; pass && iter < 16; iter++){
+    READ_RANDOM_BYTES(128, plaintext);
+    for (uint32_t j = 0; j < 4; j++){
+      uint32_t len = 32 * (j + 1);
+      Hacl_SHA2_256_hash(expected_hash, plaintext, len);
+      sha256[j](hacl_hash, plaintext);
+      a = memcmp(hacl_hash, expected_hash, 32 * sizeof (uint8_t));
+      tweet_crypto_hash(expected_hash, plaintext, len);
+      sha512[j](hacl_hash, plaintext);
+      a = a || memcmp(hacl_hash, expected_hash, 64 * sizeof (uint8_t));
+      if (a != 0){
+        pass = false;
+        printf("Fixed-size SHA2 failed on input of size %d\n", len);
+        break;
+      }
+    }
+  }
+
+  return pass;
+}
+
+// RFC 7914 section 11, and PBKDF2-HMAC-SHA512 of "password" / "salt" with 4096 iterations
+
+uint8_t pbkdf2_sha256_vector1[64] = {
+  0x55,0xac,0x04,0x6e,0x56,0xe3,0x08,0x9f,0xec,0x16,0x91,0xc2,0x25,0x44,0xb6,0x05,
+  0xf9,0x41,0x85,0x21,0x6d,0xde,0x04,0x65,0xe6,0x8b,0x9d,0x57,0xc2,0x0d,0xac,0xbc,
+  0x49,0xca,0x9c,0xcc,0xf1,0x79,0xb6,0x45,0x99,0x16,0x64,0xb3,0x9d,0x77,0xef,0x31,
+  0x7c,0x71,0xb8,0x45,0xb1,0xe3,0x0b,0xd5,0x09,0x11,0x20,0x41,0xd3,0xa1,0x97,0x83
+};
+
+uint8_t pbkdf2_sha256_vector2[64] = {
+  0x4d,0xdc,0xd8,0xf6,0x0b,0x98,0xbe,0x21,0x83,0x0c,0xee,0x5e,0xf2,0x27,0x01,0xf9,
+  0x64,0x1a,0x44,0x18,0xd0,0x4c,0x04,0x14,0xae,0xff,0x08,0x87,0x6b,0x34,0xab,0x56,
+  0xa1,0xd4,0x25,0xa1,0x22,0x58,0x33,0x54,0x9a,0xdb,0x84,0x1b,0x51,0xc9,0xb3,0x17,
+  0x6a,0x27,0x2b,0xde,0xbb,0xa1,0xd0,0x78,0x47,0x8f,0x62,0xb3,0x97,0xf3,0x3c,0x8d
+};
+
+uint8_t pbkdf2_sha512_vector[64] = {
+  0xd1,0x97,0xb1,0xb3,0x3d,0xb0,0x14,0x3e,0x01,0x8b,0x12,0xf3,0xd1,0xd1,0x47,0x9e,
+  0x6c,0xde,0xbd,0xcc,0x97,0xc5,0xc0,0xf8,0x7f,0x69,0x02,0xe0,0x72,0xf4,0x57,0xb5,
+  0x14,0x3f,0x30,0x60,0x26,0x41,0xb3,0xd5,0x5c,0xd3,0x35,0x98,0x8c,0xb3,0x6b,0x84,
+  0x37,0x60,0x60,0xec,0xd5,0x32,0xe0,0x39,0xb7,0x42,0xa2,0x39,0x43,0x4a,0xf2,0xd5
+};
+
+#define NUM_PBKDF2 11
+
+bool unit_test_pbkdf2_sha2(){
+  // Known answers, then batches against single derivations
+  uint8_t hacl_dk[64];
+  int a;
+  bool pass = true;
+  Hacl_PBKDF2_SHA2_sha256(hacl_dk, 64, (uint8_t *)"passwd", 6, (uint8_t *)"salt", 4, 1);
+  a = memcmp(hacl_dk, pbkdf2_sha256_vector1, 64 * sizeof (uint8_t));
+  Hacl_PBKDF2_SHA2_sha256(hacl_dk, 64, (uint8_t *)"Password", 8, (uint8_t *)"NaCl", 4, 80000);
+  a = a || memcmp(hacl_dk, pbkdf2_sha256_vector2, 64 * sizeof (uint8_t));
+  Hacl_PBKDF2_SHA2_sha512(hacl_dk, 64, (uint8_t *)"password", 8, (uint8_t *)"salt", 4, 4096);
+  a = a || memcmp(hacl_dk, pbkdf2_sha512_vector, 64 * sizeof (uint8_t));
+  if (a != 0){
+    printf("PBKDF2 failed on known-answer tests\n");
+    return false;
+  }
+  // Password lengths across the block sizes, salts across the last-block boundary
+  uint8_t buf[NUM_PBKDF2 * 400];
+  READ_RANDOM_BYTES(sizeof buf, buf);
+  uint8_t *password[NUM_PBKDF2], *salt[NUM_PBKDF2], *dk[NUM_PBKDF2], *expected[NUM_PBKDF2];
+  uint32_t passlen[NUM_PBKDF2], saltlen[NUM_PBKDF2];
+  uint8_t ok[NUM_PBKDF2];
+  for (uint32_t i = 0; i < NUM_PBKDF2; i++){
+    password[i] = buf + 400 * i;
+    salt[i] = buf + 400 * i + 200;
+    passlen[i] = 13 * i;
+    saltlen[i] = 59 + 6 * i;
+    dk[i] = malloc(72);
+    expected[i] = malloc(72);
+  }
+  for (uint32_t h = 0; pass && h < 2; h++){
+    uint32_t dklen = h == 0 ? 40 : 72;
+    for (uint32_t i = 0; i < NUM_PBKDF2; i++)
+      if (h == 0)
+        Hacl_PBKDF2_SHA2_sha256(expected[i], dklen, password[i], passlen[i], salt[i], saltlen[i], 3);
+      else
+        Hacl_PBKDF2_SHA2_sha512(expected[i], dklen, password[i], passlen[i], salt[i], saltlen[i], 3);
+    if (h == 0)
+      Hacl_PBKDF2_SHA2_sha256_batch(dk, dklen, password, passlen, salt, saltlen, 3, NUM_PBKDF2);
+    else
+      Hacl_PBKDF2_SHA2_sha512_batch(dk, dklen, password, passlen, salt, saltlen, 3, NUM_PBKDF2);
+    a = 0;
+    for (uint32_t i = 0; i < NUM_PBKDF2; i++)
+      a = a || memcmp(dk[i], expected[i], dklen * sizeof (uint8_t));
+    // A wrong stored hash is rejected, the others still verify
+    expected[5][dklen - 1] ^= 1;
+    uint32_t matches = h == 0
+      ? Hacl_PBKDF2_SHA2_sha256_verify_batch(ok, expected, dklen, password, passlen, salt, saltlen, 3, NUM_PBKDF2)
+      : Hacl_PBKDF2_SHA2_sha512_verify_batch(ok, expected, dklen, password, passlen, salt, saltlen, 3, NUM_PBKDF2);
+    a = a || matches != NUM_PBKDF2 - 1 || ok[5] != 0 || ok[4] != 1;
+    if (a != 0){
+      pass = false;
+      printf("PBKDF2-HMAC-SHA%s batch failed\n", h == 0 ? "256" : "512");
+    }
+  }
+  for (uint32_t i = 0; i < NUM_PBKDF2; i++){
+    free(dk[i]);
+    free(expected[i]);
+  }
+
+  return pass;
+}
+
+#define NUM_SHA2_256_MULTI 19
+
+bool unit_test_sha2_256_multi(){
+  // Messages of mixed lengths, crossing the one/two padding block boundary
+  uint32_t max_len = 3 * 64 + 1;
+  uint8_t *plaintext = malloc(max_len * sizeof (uint8_t));
+  READ_RANDOM_BYTES(max_len, plaintext);
+  uint8_t expected_hash[NUM_SHA2_256_MULTI * 32], hacl_hash[NUM_SHA2_256_MULTI * 32];
+  uint8_t *input[NUM_SHA2_256_MULTI], *hash[NUM_SHA2_256_MULTI];
+  uint32_t len[NUM_SHA2_256_MULTI];
+  int a;
+  bool pass = true;
+  for (uint32_t j = 0; j < max_len; j++){
+    for (int i = 0; i < NUM_SHA2_256_MULTI; i++){
+      len[i] = (j + 29 * i) % max_len;
+      input[i] = plaintext + (max_len - len[i]);
+      hash[i] = hacl_hash + 32 * i;
+      Hacl_SHA2_256_hash(expected_hash + 32 * i, input[i], len[i]);
+    }
+    Hacl_SHA2_256_hash_multi(hash, input, len, NUM_SHA2_256_MULTI);
+    a = memcmp(hacl_hash, expected_hash, NUM_SHA2_256_MULTI * 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-256 multi-buffer failed on input lengths starting at %d\n", j);
+      break;
+    }
+  }
+  if (pass){
+    Hacl_SHA2_256_hash_x4(hash, input, len);
+    Hacl_SHA2_256_hash_x8(hash + 4, input + 4, len + 4);
+    a = memcmp(hacl_hash, expected_hash, 12 * 32 * sizeof (uint8_t));
+    if (a != 0){
+      pass = false;
+      printf("SHA2-256 x4/x8 failed\n");
+    }
+  }
+
+  free(plaintext);
+
+  return pass;
+}
+
 int main(){
   bool res;
   res = unit_test_onetimeauth();
@@ -537,6 +1937,12 @@ int main(){
   } else {
     printf("Unit tests for crypto_onetimeauth (Poly1305) *** FAILED ***\n");
   }
+  res = res && unit_test_poly1305_vec256();
+  if (res == true) {
+    printf("Unit tests for Poly1305 Vec256 succeeded\n");
+  } else {
+    printf("Unit tests for Poly1305 Vec256 *** FAILED ***\n");
+  }
   res = res && unit_test_crypto_stream();
   if (res == true) {
     printf("Unit tests for crypto_stream (Salsa20) succeeded\n");
@@ -561,12 +1967,66 @@ int main(){
   } else {
     printf("Unit tests for IETF Chacha20 Vec128 *** FAILED ***\n");
   }
+  res = res && unit_test_chacha20_vec256();
+  if (res == true) {
+    printf("Unit tests for IETF Chacha20 Vec256 succeeded\n");
+  } else {
+    printf("Unit tests for IETF Chacha20 Vec256 *** FAILED ***\n");
+  }
+  res = res && unit_test_chacha20_vec512();
+  if (res == true) {
+    printf("Unit tests for IETF Chacha20 Vec512 succeeded\n");
+  } else {
+    printf("Unit tests for IETF Chacha20 Vec512 *** FAILED ***\n");
+  }
+  res = res && unit_test_dispatch();
+  if (res == true) {
+    printf("Unit tests for runtime dispatch succeeded\n");
+  } else {
+    printf("Unit tests for runtime dispatch *** FAILED ***\n");
+  }
   res = res && unit_test_aead();
   if (res == true) {
     printf("Unit tests for IETF AEAD (Chacha20/Poly1305) succeeded\n");
   } else {
     printf("Unit tests for IETF AEAD (Chacha20/Poly1305) *** FAILED ***\n");
   } 
+  res = res && unit_test_aead_stitched();
+  if (res == true) {
+    printf("Unit tests for stitched IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for stitched IETF AEAD *** FAILED ***\n");
+  }
+  res = res && unit_test_aead_streaming();
+  if (res == true) {
+    printf("Unit tests for streaming IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for streaming IETF AEAD *** FAILED ***\n");
+  }
+  res = res && unit_test_aead_iovec();
+  if (res == true) {
+    printf("Unit tests for scatter-gather IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for scatter-gather IETF AEAD *** FAILED ***\n");
+  }
+  res = res && unit_test_aead_batch();
+  if (res == true) {
+    printf("Unit tests for batched IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for batched IETF AEAD *** FAILED ***\n");
+  }
+  res = res && unit_test_aead_keyed();
+  if (res == true) {
+    printf("Unit tests for expanded-key IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for expanded-key IETF AEAD *** FAILED ***\n");
+  }
+  res = res && unit_test_aead_inplace();
+  if (res == true) {
+    printf("Unit tests for in-place IETF AEAD succeeded\n");
+  } else {
+    printf("Unit tests for in-place IETF AEAD *** FAILED ***\n");
+  }
   res = res && unit_test_crypto_keypair();
   if (res == true) {
     printf("Unit tests for crypto_keypair (Curve25519) succeeded\n");
@@ -579,18 +2039,96 @@ int main(){
   } else {
     printf("Unit tests for crypto_scalarmult (Curve25519) *** FAILED ***\n");
   }
+  res = res && unit_test_curve25519_64();
+  if (res == true) {
+    printf("Unit tests for radix-2^64 Curve25519 succeeded\n");
+  } else {
+    printf("Unit tests for radix-2^64 Curve25519 *** FAILED ***\n");
+  }
+  res = res && unit_test_secret_to_public();
+  if (res == true) {
+    printf("Unit tests for fixed-base Curve25519 succeeded\n");
+  } else {
+    printf("Unit tests for fixed-base Curve25519 *** FAILED ***\n");
+  }
+  res = res && unit_test_scalarmult_x4();
+  if (res == true) {
+    printf("Unit tests for 4-way Curve25519 succeeded\n");
+  } else {
+    printf("Unit tests for 4-way Curve25519 *** FAILED ***\n");
+  }
+  res = res && unit_test_scalarmult_batch();
+  if (res == true) {
+    printf("Unit tests for batched Curve25519 succeeded\n");
+  } else {
+    printf("Unit tests for batched Curve25519 *** FAILED ***\n");
+  }
   res = res && unit_test_crypto_box();
   if (res == true) {
     printf("Unit tests for crypto_box (Curve25519/Salsa20/Poly1305) succeeded\n");
   } else {
     printf("Unit tests for crypto_box (Curve25519/Salsa20/Poly1305) *** FAILED ***\n");
   }
+  res = res && unit_test_box_cache();
+  if (res == true) {
+    printf("Unit tests for crypto_box key cache succeeded\n");
+  } else {
+    printf("Unit tests for crypto_box key cache *** FAILED ***\n");
+  }
   res = res && unit_test_crypto_sign();
   if (res == true) {
     printf("Unit tests for crypto_sign (Ed25519) succeeded\n");
   } else {
     printf("Unit tests for crypto_sign (Ed25519) *** FAILED ***\n");
   }
+  res = res && unit_test_sha2_256();
+  if (res == true) {
+    printf("Unit tests for SHA2-256 succeeded\n");
+  } else {
+    printf("Unit tests for SHA2-256 *** FAILED ***\n");
+  }
+  res = res && unit_test_sha2_state();
+  if (res == true) {
+    printf("Unit tests for compact SHA2 states succeeded\n");
+  } else {
+    printf("Unit tests for compact SHA2 states *** FAILED ***\n");
+  }
+  res = res && unit_test_sha2_streaming();
+  if (res == true) {
+    printf("Unit tests for streaming SHA2 succeeded\n");
+  } else {
+    printf("Unit tests for streaming SHA2 *** FAILED ***\n");
+  }
+  res = res && unit_test_sha2_256_multi();
+  if (res == true) {
+    printf("Unit tests for multi-buffer SHA2-256 succeeded\n");
+  } else {
+    printf("Unit tests for multi-buffer SHA2-256 *** FAILED ***\n");
+  }
+  res = res && unit_test_hmac_sha2();
+  if (res == true) {
+    printf("Unit tests for precomputed-key HMAC-SHA2 succeeded\n");
+  } else {
+    printf("Unit tests for precomputed-key HMAC-SHA2 *** FAILED ***\n");
+  }
+  res = res && unit_test_sha2_256_tree();
+  if (res == true) {
+    printf("Unit tests for SHA2-256 tree hashing succeeded\n");
+  } else {
+    printf("Unit tests for SHA2-256 tree hashing *** FAILED ***\n");
+  }
+  res = res && unit_test_sha2_fixed();
+  if (res == true) {
+    printf("Unit tests for fixed-size SHA2 succeeded\n");
+  } else {
+    printf("Unit tests for fixed-size SHA2 *** FAILED ***\n");
+  }
+  res = res && unit_test_pbkdf2_sha2();
+  if (res == true) {
+    printf("Unit tests for PBKDF2-HMAC-SHA2 succeeded\n");
+  } else {
+    printf("Unit tests for PBKDF2-HMAC-SHA2 *** FAILED ***\n");
+  }
 
   return res == true ? 0 : 255;
 }